@@ -92,6 +92,8 @@ GDALVectorLayerAlgebraAlgorithm::GDALVectorLayerAlgebraAlgorithm(
 
     AddArg("method-layer", 0, _("Method layer name"), &m_methodLayerName);
 
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+
     AddGeometryTypeArg(&m_geometryType);
 
     AddArg("input-prefix", 0,
@@ -313,6 +315,8 @@ bool GDALVectorLayerAlgebraAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosOptions.SetNameValue("PROMOTE_TO_MULTI", "YES");
     }
 
+    aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
+
     const std::map<std::string, decltype(&OGRLayer::Union)>
         mapOperationToMethod = {
             {"union", &OGRLayer::Union},
@@ -63,6 +63,9 @@ class GDALVectorLayerAlgebraAlgorithm /* non final */
     bool m_noMethodFields = false;
     bool m_allMethodFields = false;
 
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
+
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
     bool RunImpl(GDALProgressFunc pfnProgress, void *pProgressData) override;
 };
@@ -26,7 +26,10 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -35,15 +38,19 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_json.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_vrt.h"
 #include "gdal_priv.h"
 #include "gdal_proxy.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
@@ -293,6 +300,8 @@ class VRTBuilder
                                        void *pProgressData);
 
     std::string m_osProgramName{};
+    std::string m_osNumThreads{};
+    std::string m_osProbeCacheFilename{};
 };
 
 /************************************************************************/
@@ -1726,6 +1735,892 @@ void VRTBuilder::CreateVRTNonSeparate(VRTDataset *poVRTDS)
     }
 }
 
+/************************************************************************/
+/*                             SourceProbe                              */
+/************************************************************************/
+
+/** Properties of a source dataset read by AnalyseRaster().
+ *
+ * They are recorded in the probe cache, keyed by the filename, size and
+ * modification time of the source.
+ */
+struct SourceProbe
+{
+    struct Band
+    {
+        GDALDataType eDataType = GDT_Unknown;
+        std::string osDescription{};
+        CPLStringList aosMetadata{};
+        bool bHasNoData = false;
+        double dfNoDataValue = 0;
+        bool bHasOffset = false;
+        double dfOffset = 0;
+        bool bHasScale = false;
+        double dfScale = 1;
+        GDALColorInterp eColorInterp = GCI_Undefined;
+        std::unique_ptr<GDALColorTable> poColorTable{};
+        int nMaskFlags = GMF_ALL_VALID;
+    };
+
+    GIntBig nFileSize = 0;
+    GIntBig nMTime = 0;
+    int nRasterXSize = 0;
+    int nRasterYSize = 0;
+    bool bHasGeoTransform = false;
+    GDALGeoTransform gt{};
+    std::string osWKT{};
+    CPLStringList aosSubdatasets{};
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    int nMaskBlockXSize = 0;
+    int nMaskBlockYSize = 0;
+    // Dimensions of the overviews of the first band
+    std::vector<std::pair<int, int>> anOverviewSizes{};
+    std::vector<Band> asBands{};
+
+    static std::shared_ptr<SourceProbe> FromDataset(GDALDataset *poDS);
+    static std::shared_ptr<SourceProbe> FromJSON(const CPLJSONObject &oObj);
+    CPLJSONObject ToJSON() const;
+};
+
+/************************************************************************/
+/*                      SourceProbe::FromDataset()                      */
+/************************************************************************/
+
+std::shared_ptr<SourceProbe> SourceProbe::FromDataset(GDALDataset *poDS)
+{
+    auto poProbe = std::make_shared<SourceProbe>();
+    poProbe->nRasterXSize = poDS->GetRasterXSize();
+    poProbe->nRasterYSize = poDS->GetRasterYSize();
+    poProbe->bHasGeoTransform = poDS->GetGeoTransform(poProbe->gt) == CE_None;
+    if (const char *pszWKT = poDS->GetProjectionRef())
+        poProbe->osWKT = pszWKT;
+
+    const int nBands = poDS->GetRasterCount();
+    if (nBands == 0)
+    {
+        poProbe->aosSubdatasets =
+            CPLStringList(poDS->GetMetadata(GDAL_MDD_SUBDATASETS));
+        return poProbe;
+    }
+
+    GDALRasterBand *poFirstBand = poDS->GetRasterBand(1);
+    poFirstBand->GetBlockSize(&poProbe->nBlockXSize, &poProbe->nBlockYSize);
+    poFirstBand->GetMaskBand()->GetBlockSize(&poProbe->nMaskBlockXSize,
+                                             &poProbe->nMaskBlockYSize);
+    for (int i = 0; i < poFirstBand->GetOverviewCount(); ++i)
+    {
+        GDALRasterBand *poOverview = poFirstBand->GetOverview(i);
+        if (!poOverview)
+            continue;
+        poProbe->anOverviewSizes.emplace_back(poOverview->GetXSize(),
+                                              poOverview->GetYSize());
+    }
+
+    poProbe->asBands.resize(nBands);
+    for (int i = 0; i < nBands; ++i)
+    {
+        GDALRasterBand *poBand = poDS->GetRasterBand(i + 1);
+        auto &oBand = poProbe->asBands[i];
+        oBand.eDataType = poBand->GetRasterDataType();
+        oBand.osDescription = poBand->GetDescription();
+        oBand.aosMetadata = CPLStringList(poBand->GetMetadata());
+        int bHasNoData = false;
+        oBand.dfNoDataValue = poBand->GetNoDataValue(&bHasNoData);
+        oBand.bHasNoData = bHasNoData != 0;
+        int bHasOffset = false;
+        oBand.dfOffset = poBand->GetOffset(&bHasOffset);
+        oBand.bHasOffset = bHasOffset != 0;
+        int bHasScale = false;
+        oBand.dfScale = poBand->GetScale(&bHasScale);
+        oBand.bHasScale = bHasScale != 0;
+        oBand.eColorInterp = poBand->GetColorInterpretation();
+        if (const GDALColorTable *poColorTable = poBand->GetColorTable())
+            oBand.poColorTable.reset(poColorTable->Clone());
+        oBand.nMaskFlags = poBand->GetMaskFlags();
+    }
+
+    return poProbe;
+}
+
+/************************************************************************/
+/*                        SourceProbe::ToJSON()                         */
+/************************************************************************/
+
+CPLJSONObject SourceProbe::ToJSON() const
+{
+    CPLJSONObject oObj;
+    oObj.Add("size", nFileSize);
+    oObj.Add("mtime", nMTime);
+    oObj.Add("width", nRasterXSize);
+    oObj.Add("height", nRasterYSize);
+    if (bHasGeoTransform)
+    {
+        CPLJSONArray oGT;
+        for (int i = 0; i < 6; ++i)
+            oGT.Add(gt[i]);
+        oObj.Add("geotransform", oGT);
+    }
+    if (!osWKT.empty())
+        oObj.Add("srs", osWKT);
+    if (!aosSubdatasets.empty())
+    {
+        CPLJSONArray oSubdatasets;
+        for (const char *pszItem : aosSubdatasets)
+            oSubdatasets.Add(pszItem);
+        oObj.Add("subdatasets", oSubdatasets);
+    }
+    if (asBands.empty())
+        return oObj;
+
+    CPLJSONArray oBlockSize;
+    oBlockSize.Add(nBlockXSize);
+    oBlockSize.Add(nBlockYSize);
+    oObj.Add("block_size", oBlockSize);
+    CPLJSONArray oMaskBlockSize;
+    oMaskBlockSize.Add(nMaskBlockXSize);
+    oMaskBlockSize.Add(nMaskBlockYSize);
+    oObj.Add("mask_block_size", oMaskBlockSize);
+    CPLJSONArray oOverviews;
+    for (const auto &[nOvrXSize, nOvrYSize] : anOverviewSizes)
+    {
+        CPLJSONArray oSize;
+        oSize.Add(nOvrXSize);
+        oSize.Add(nOvrYSize);
+        oOverviews.Add(oSize);
+    }
+    oObj.Add("overviews", oOverviews);
+
+    CPLJSONArray oBands;
+    for (const auto &oBand : asBands)
+    {
+        CPLJSONObject oBandObj;
+        oBandObj.Add("data_type", GDALGetDataTypeName(oBand.eDataType));
+        oBandObj.Add("description", oBand.osDescription);
+        // Metadata items are stored as KEY=VALUE strings, as keys may
+        // contain slashes
+        CPLJSONArray oMetadata;
+        for (const char *pszItem : oBand.aosMetadata)
+            oMetadata.Add(pszItem);
+        oBandObj.Add("metadata", oMetadata);
+        // As a string, to round-trip NaN and infinity
+        if (oBand.bHasNoData)
+            oBandObj.Add("nodata", CPLSPrintf("%.17g", oBand.dfNoDataValue));
+        if (oBand.bHasOffset)
+            oBandObj.Add("offset", oBand.dfOffset);
+        if (oBand.bHasScale)
+            oBandObj.Add("scale", oBand.dfScale);
+        oBandObj.Add("color_interpretation",
+                     GDALGetColorInterpretationName(oBand.eColorInterp));
+        if (oBand.poColorTable)
+        {
+            oBandObj.Add("palette_interpretation",
+                         static_cast<int>(
+                             oBand.poColorTable->GetPaletteInterpretation()));
+            CPLJSONArray oEntries;
+            for (int i = 0; i < oBand.poColorTable->GetColorEntryCount(); ++i)
+            {
+                const GDALColorEntry *psEntry =
+                    oBand.poColorTable->GetColorEntry(i);
+                CPLJSONArray oEntry;
+                oEntry.Add(static_cast<int>(psEntry->c1));
+                oEntry.Add(static_cast<int>(psEntry->c2));
+                oEntry.Add(static_cast<int>(psEntry->c3));
+                oEntry.Add(static_cast<int>(psEntry->c4));
+                oEntries.Add(oEntry);
+            }
+            oBandObj.Add("color_table", oEntries);
+        }
+        oBandObj.Add("mask_flags", oBand.nMaskFlags);
+        oBands.Add(oBandObj);
+    }
+    oObj.Add("bands", oBands);
+
+    return oObj;
+}
+
+/************************************************************************/
+/*                       SourceProbe::FromJSON()                        */
+/************************************************************************/
+
+/** Return nullptr if oObj is not a valid probe. */
+std::shared_ptr<SourceProbe> SourceProbe::FromJSON(const CPLJSONObject &oObj)
+{
+    auto poProbe = std::make_shared<SourceProbe>();
+    poProbe->nFileSize = oObj.GetLong("size", -1);
+    poProbe->nMTime = oObj.GetLong("mtime");
+    poProbe->nRasterXSize = oObj.GetInteger("width");
+    poProbe->nRasterYSize = oObj.GetInteger("height");
+    if (poProbe->nFileSize < 0 || poProbe->nRasterXSize < 0 ||
+        poProbe->nRasterYSize < 0)
+        return nullptr;
+
+    const auto oGT = oObj.GetArray("geotransform");
+    if (oGT.IsValid())
+    {
+        if (oGT.Size() != 6)
+            return nullptr;
+        poProbe->bHasGeoTransform = true;
+        for (int i = 0; i < 6; ++i)
+            poProbe->gt[i] = oGT[i].ToDouble();
+    }
+    poProbe->osWKT = oObj.GetString("srs");
+    for (const auto &oItem : oObj.GetArray("subdatasets"))
+        poProbe->aosSubdatasets.AddString(oItem.ToString());
+
+    const auto oBands = oObj.GetArray("bands");
+    if (!oBands.IsValid() || oBands.Size() == 0)
+        return poProbe;
+
+    const auto oBlockSize = oObj.GetArray("block_size");
+    const auto oMaskBlockSize = oObj.GetArray("mask_block_size");
+    if (oBlockSize.Size() != 2 || oMaskBlockSize.Size() != 2)
+        return nullptr;
+    poProbe->nBlockXSize = oBlockSize[0].ToInteger();
+    poProbe->nBlockYSize = oBlockSize[1].ToInteger();
+    poProbe->nMaskBlockXSize = oMaskBlockSize[0].ToInteger();
+    poProbe->nMaskBlockYSize = oMaskBlockSize[1].ToInteger();
+    if (poProbe->nBlockXSize <= 0 || poProbe->nBlockYSize <= 0 ||
+        poProbe->nMaskBlockXSize <= 0 || poProbe->nMaskBlockYSize <= 0)
+        return nullptr;
+    for (const auto &oSize : oObj.GetArray("overviews"))
+    {
+        const auto oSizeArray = oSize.ToArray();
+        if (oSizeArray.Size() != 2)
+            return nullptr;
+        poProbe->anOverviewSizes.emplace_back(oSizeArray[0].ToInteger(),
+                                              oSizeArray[1].ToInteger());
+    }
+
+    poProbe->asBands.resize(oBands.Size());
+    for (int i = 0; i < oBands.Size(); ++i)
+    {
+        const auto oBandObj = oBands[i];
+        auto &oBand = poProbe->asBands[i];
+        oBand.eDataType =
+            GDALGetDataTypeByName(oBandObj.GetString("data_type").c_str());
+        if (oBand.eDataType == GDT_Unknown)
+            return nullptr;
+        oBand.osDescription = oBandObj.GetString("description");
+        for (const auto &oItem : oBandObj.GetArray("metadata"))
+            oBand.aosMetadata.AddString(oItem.ToString());
+        const auto osNoData = oBandObj.GetString("nodata");
+        oBand.bHasNoData = !osNoData.empty();
+        if (oBand.bHasNoData)
+            oBand.dfNoDataValue = CPLAtofM(osNoData.c_str());
+        oBand.bHasOffset = oBandObj.GetObj("offset").IsValid();
+        oBand.dfOffset = oBandObj.GetDouble("offset", 0.0);
+        oBand.bHasScale = oBandObj.GetObj("scale").IsValid();
+        oBand.dfScale = oBandObj.GetDouble("scale", 1.0);
+        oBand.eColorInterp = GDALGetColorInterpretationByName(
+            oBandObj.GetString("color_interpretation").c_str());
+        const auto oEntries = oBandObj.GetArray("color_table");
+        if (oEntries.IsValid())
+        {
+            oBand.poColorTable = std::make_unique<GDALColorTable>(
+                static_cast<GDALPaletteInterp>(
+                    oBandObj.GetInteger("palette_interpretation")));
+            for (int j = 0; j < oEntries.Size(); ++j)
+            {
+                const auto oEntry = oEntries[j].ToArray();
+                if (oEntry.Size() != 4)
+                    return nullptr;
+                GDALColorEntry sEntry;
+                sEntry.c1 = static_cast<short>(oEntry[0].ToInteger());
+                sEntry.c2 = static_cast<short>(oEntry[1].ToInteger());
+                sEntry.c3 = static_cast<short>(oEntry[2].ToInteger());
+                sEntry.c4 = static_cast<short>(oEntry[3].ToInteger());
+                oBand.poColorTable->SetColorEntry(j, &sEntry);
+            }
+        }
+        oBand.nMaskFlags = oBandObj.GetInteger("mask_flags", GMF_ALL_VALID);
+    }
+
+    return poProbe;
+}
+
+/************************************************************************/
+/*                           ProbedRasterBand                           */
+/************************************************************************/
+
+class ProbedDataset;
+
+/** Band of a ProbedDataset, or overview or mask band of such a band, of
+ * which only the dimensions are known. It has no pixel values.
+ */
+class ProbedRasterBand final : public GDALRasterBand
+{
+  public:
+    ProbedRasterBand(ProbedDataset *poDSIn, int nBandIn,
+                     const SourceProbe::Band &oBand);
+    ProbedRasterBand(int nXSize, int nYSize, int nBlockXSizeIn,
+                     int nBlockYSizeIn);
+
+    double GetNoDataValue(int *pbSuccess = nullptr) override;
+    double GetOffset(int *pbSuccess = nullptr) override;
+    double GetScale(int *pbSuccess = nullptr) override;
+    GDALColorInterp GetColorInterpretation() override;
+    GDALColorTable *GetColorTable() override;
+    int GetMaskFlags() override;
+    GDALRasterBand *GetMaskBand() override;
+    int GetOverviewCount() override;
+    GDALRasterBand *GetOverview(int i) override;
+
+  protected:
+    CPLErr IReadBlock(int, int, void *) override;
+
+  private:
+    const SourceProbe::Band *const m_psBand = nullptr;
+    std::vector<std::unique_ptr<ProbedRasterBand>> m_apoOverviews{};
+
+    friend class ProbedDataset;
+
+    CPL_DISALLOW_COPY_ASSIGN(ProbedRasterBand)
+};
+
+/************************************************************************/
+/*                            ProbedDataset                             */
+/************************************************************************/
+
+/** Dataset replaying the properties of a source recorded in the probe cache,
+ * so that AnalyseRaster() does not have to open it.
+ */
+class ProbedDataset final : public GDALDataset
+{
+  public:
+    ProbedDataset(const std::string &osFilename,
+                  const std::shared_ptr<const SourceProbe> &poProbe);
+
+    const OGRSpatialReference *GetSpatialRef() const override;
+    CPLErr GetGeoTransform(GDALGeoTransform &gt) const override;
+
+  private:
+    const std::shared_ptr<const SourceProbe> m_poProbe;
+    OGRSpatialReference m_oSRS{};
+    std::unique_ptr<ProbedRasterBand> m_poMaskBand{};
+
+    friend class ProbedRasterBand;
+
+    CPL_DISALLOW_COPY_ASSIGN(ProbedDataset)
+};
+
+/************************************************************************/
+/*                           ProbedDataset()                            */
+/************************************************************************/
+
+ProbedDataset::ProbedDataset(const std::string &osFilename,
+                             const std::shared_ptr<const SourceProbe> &poProbe)
+    : m_poProbe(poProbe)
+{
+    SetDescription(osFilename.c_str());
+    nRasterXSize = poProbe->nRasterXSize;
+    nRasterYSize = poProbe->nRasterYSize;
+    if (!poProbe->osWKT.empty())
+    {
+        m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+        m_oSRS.importFromWkt(poProbe->osWKT.c_str());
+    }
+    if (!poProbe->aosSubdatasets.empty())
+        GDALDataset::SetMetadata(poProbe->aosSubdatasets.List(),
+                                 GDAL_MDD_SUBDATASETS);
+    if (poProbe->asBands.empty())
+        return;
+
+    m_poMaskBand = std::make_unique<ProbedRasterBand>(
+        nRasterXSize, nRasterYSize, poProbe->nMaskBlockXSize,
+        poProbe->nMaskBlockYSize);
+    for (int i = 0; i < static_cast<int>(poProbe->asBands.size()); ++i)
+    {
+        auto poBand = std::make_unique<ProbedRasterBand>(this, i + 1,
+                                                         poProbe->asBands[i]);
+        if (i == 0)
+        {
+            for (const auto &[nOvrXSize, nOvrYSize] : poProbe->anOverviewSizes)
+            {
+                poBand->m_apoOverviews.push_back(
+                    std::make_unique<ProbedRasterBand>(
+                        nOvrXSize, nOvrYSize, poProbe->nBlockXSize,
+                        poProbe->nBlockYSize));
+            }
+        }
+        SetBand(i + 1, std::move(poBand));
+    }
+}
+
+/************************************************************************/
+/*                    ProbedDataset::GetSpatialRef()                    */
+/************************************************************************/
+
+const OGRSpatialReference *ProbedDataset::GetSpatialRef() const
+{
+    return m_oSRS.IsEmpty() ? nullptr : &m_oSRS;
+}
+
+/************************************************************************/
+/*                   ProbedDataset::GetGeoTransform()                   */
+/************************************************************************/
+
+CPLErr ProbedDataset::GetGeoTransform(GDALGeoTransform &gt) const
+{
+    gt = m_poProbe->gt;
+    return m_poProbe->bHasGeoTransform ? CE_None : CE_Failure;
+}
+
+/************************************************************************/
+/*                          ProbedRasterBand()                          */
+/************************************************************************/
+
+ProbedRasterBand::ProbedRasterBand(ProbedDataset *poDSIn, int nBandIn,
+                                   const SourceProbe::Band &oBand)
+    : m_psBand(&oBand)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    nRasterXSize = poDSIn->GetRasterXSize();
+    nRasterYSize = poDSIn->GetRasterYSize();
+    eDataType = oBand.eDataType;
+    nBlockXSize = poDSIn->m_poProbe->nBlockXSize;
+    nBlockYSize = poDSIn->m_poProbe->nBlockYSize;
+    GDALRasterBand::SetDescription(oBand.osDescription.c_str());
+    GDALRasterBand::SetMetadata(oBand.aosMetadata.List());
+}
+
+ProbedRasterBand::ProbedRasterBand(int nXSize, int nYSize, int nBlockXSizeIn,
+                                   int nBlockYSizeIn)
+{
+    nRasterXSize = nXSize;
+    nRasterYSize = nYSize;
+    eDataType = GDT_Byte;
+    nBlockXSize = nBlockXSizeIn;
+    nBlockYSize = nBlockYSizeIn;
+}
+
+/************************************************************************/
+/*                    ProbedRasterBand::IReadBlock()                    */
+/************************************************************************/
+
+CPLErr ProbedRasterBand::IReadBlock(int, int, void *)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Pixel values of a probed source are not available");
+    return CE_Failure;
+}
+
+/************************************************************************/
+/*                  ProbedRasterBand::GetNoDataValue()                  */
+/************************************************************************/
+
+double ProbedRasterBand::GetNoDataValue(int *pbSuccess)
+{
+    if (pbSuccess)
+        *pbSuccess = m_psBand && m_psBand->bHasNoData;
+    return m_psBand ? m_psBand->dfNoDataValue : 0;
+}
+
+/************************************************************************/
+/*                    ProbedRasterBand::GetOffset()                     */
+/************************************************************************/
+
+double ProbedRasterBand::GetOffset(int *pbSuccess)
+{
+    if (pbSuccess)
+        *pbSuccess = m_psBand && m_psBand->bHasOffset;
+    return m_psBand ? m_psBand->dfOffset : 0;
+}
+
+/************************************************************************/
+/*                     ProbedRasterBand::GetScale()                     */
+/************************************************************************/
+
+double ProbedRasterBand::GetScale(int *pbSuccess)
+{
+    if (pbSuccess)
+        *pbSuccess = m_psBand && m_psBand->bHasScale;
+    return m_psBand ? m_psBand->dfScale : 1;
+}
+
+/************************************************************************/
+/*              ProbedRasterBand::GetColorInterpretation()              */
+/************************************************************************/
+
+GDALColorInterp ProbedRasterBand::GetColorInterpretation()
+{
+    return m_psBand ? m_psBand->eColorInterp : GCI_Undefined;
+}
+
+/************************************************************************/
+/*                  ProbedRasterBand::GetColorTable()                   */
+/************************************************************************/
+
+GDALColorTable *ProbedRasterBand::GetColorTable()
+{
+    return m_psBand ? m_psBand->poColorTable.get() : nullptr;
+}
+
+/************************************************************************/
+/*                   ProbedRasterBand::GetMaskFlags()                   */
+/************************************************************************/
+
+int ProbedRasterBand::GetMaskFlags()
+{
+    return m_psBand ? m_psBand->nMaskFlags : GMF_ALL_VALID;
+}
+
+/************************************************************************/
+/*                   ProbedRasterBand::GetMaskBand()                    */
+/************************************************************************/
+
+GDALRasterBand *ProbedRasterBand::GetMaskBand()
+{
+    // Only the block size of the mask band is of interest
+    if (m_psBand)
+        return cpl::down_cast<ProbedDataset *>(poDS)->m_poMaskBand.get();
+    return GDALRasterBand::GetMaskBand();
+}
+
+/************************************************************************/
+/*                 ProbedRasterBand::GetOverviewCount()                 */
+/************************************************************************/
+
+int ProbedRasterBand::GetOverviewCount()
+{
+    return static_cast<int>(m_apoOverviews.size());
+}
+
+/************************************************************************/
+/*                   ProbedRasterBand::GetOverview()                    */
+/************************************************************************/
+
+GDALRasterBand *ProbedRasterBand::GetOverview(int i)
+{
+    return i >= 0 && i < GetOverviewCount() ? m_apoOverviews[i].get()
+                                            : nullptr;
+}
+
+/************************************************************************/
+/*                              ProbeCache                              */
+/************************************************************************/
+
+/** Persistent cache of the properties of source datasets.
+ *
+ * It is read at the start of Build() and written back when it is destroyed,
+ * including when Build() fails or is interrupted by the progress callback, so
+ * that a later run does not probe again the sources already analysed.
+ * The probe of a source is reused as long as its size and modification time
+ * are unchanged, and the open options are the same.
+ * Lookup() and Store() may be called from worker threads.
+ */
+class ProbeCache
+{
+  public:
+    ProbeCache(const std::string &osFilename, CSLConstList papszOpenOptions);
+    ~ProbeCache();
+
+    std::shared_ptr<const SourceProbe> Lookup(const std::string &osSrcFilename,
+                                              const VSIStatBufL &sStat);
+    void Store(const std::string &osSrcFilename,
+               const std::shared_ptr<const SourceProbe> &poProbe);
+
+  private:
+    const std::string m_osFilename;
+    const CPLStringList m_aosOpenOptions;
+    std::mutex m_oMutex{};
+    std::map<std::string, std::shared_ptr<const SourceProbe>> m_oMap{};
+    bool m_bDirty = false;
+
+    CPLJSONArray OpenOptionsAsJSON() const;
+
+    CPL_DISALLOW_COPY_ASSIGN(ProbeCache)
+};
+
+/************************************************************************/
+/*                   ProbeCache::OpenOptionsAsJSON()                    */
+/************************************************************************/
+
+CPLJSONArray ProbeCache::OpenOptionsAsJSON() const
+{
+    CPLJSONArray oArray;
+    for (const char *pszOption : m_aosOpenOptions)
+        oArray.Add(pszOption);
+    return oArray;
+}
+
+/************************************************************************/
+/*                             ProbeCache()                             */
+/************************************************************************/
+
+ProbeCache::ProbeCache(const std::string &osFilename,
+                       CSLConstList papszOpenOptions)
+    : m_osFilename(osFilename), m_aosOpenOptions(papszOpenOptions)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return;
+
+    CPLJSONDocument oDoc;
+    if (!oDoc.Load(osFilename))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Cannot read probe cache %s. It will be rebuilt",
+                 osFilename.c_str());
+        m_bDirty = true;
+        return;
+    }
+    const auto oRoot = oDoc.GetRoot();
+    if (oRoot.GetString("type") != "GDALBuildVRTProbeCache" ||
+        oRoot.GetInteger("version") != 1)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "%s is not a probe cache of a supported version. "
+                 "It will be rebuilt",
+                 osFilename.c_str());
+        m_bDirty = true;
+        return;
+    }
+    constexpr auto ePlain = CPLJSONObject::PrettyFormat::Plain;
+    if (oRoot.GetArray("open_options").Format(ePlain) !=
+        OpenOptionsAsJSON().Format(ePlain))
+    {
+        CPLDebug("BuildVRT",
+                 "Open options differ from the ones of the probe cache %s. "
+                 "Ignoring it",
+                 osFilename.c_str());
+        m_bDirty = true;
+        return;
+    }
+    for (const auto &oSource : oRoot.GetArray("sources"))
+    {
+        const std::string osSrcFilename = oSource.GetString("filename");
+        auto poProbe = SourceProbe::FromJSON(oSource);
+        if (!osSrcFilename.empty() && poProbe)
+            m_oMap[osSrcFilename] = std::move(poProbe);
+        else
+            m_bDirty = true;
+    }
+}
+
+/************************************************************************/
+/*                            ~ProbeCache()                             */
+/************************************************************************/
+
+ProbeCache::~ProbeCache()
+{
+    if (!m_bDirty)
+        return;
+
+    CPLJSONDocument oDoc;
+    auto oRoot = oDoc.GetRoot();
+    oRoot.Add("type", "GDALBuildVRTProbeCache");
+    oRoot.Add("version", 1);
+    oRoot.Add("open_options", OpenOptionsAsJSON());
+    CPLJSONArray oSources;
+    for (const auto &[osSrcFilename, poProbe] : m_oMap)
+    {
+        auto oSource = poProbe->ToJSON();
+        oSource.Add("filename", osSrcFilename);
+        oSources.Add(oSource);
+    }
+    oRoot.Add("sources", oSources);
+    if (!oDoc.Save(m_osFilename))
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot write probe cache %s",
+                 m_osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                         ProbeCache::Lookup()                         */
+/************************************************************************/
+
+std::shared_ptr<const SourceProbe>
+ProbeCache::Lookup(const std::string &osSrcFilename, const VSIStatBufL &sStat)
+{
+    std::lock_guard oLock(m_oMutex);
+    const auto oIter = m_oMap.find(osSrcFilename);
+    if (oIter == m_oMap.end() ||
+        oIter->second->nFileSize != static_cast<GIntBig>(sStat.st_size) ||
+        oIter->second->nMTime != static_cast<GIntBig>(sStat.st_mtime))
+    {
+        return nullptr;
+    }
+    return oIter->second;
+}
+
+/************************************************************************/
+/*                         ProbeCache::Store()                          */
+/************************************************************************/
+
+void ProbeCache::Store(const std::string &osSrcFilename,
+                       const std::shared_ptr<const SourceProbe> &poProbe)
+{
+    std::lock_guard oLock(m_oMutex);
+    m_oMap[osSrcFilename] = poProbe;
+    m_bDirty = true;
+}
+
+/************************************************************************/
+/*                         OpenSourceDataset()                          */
+/************************************************************************/
+
+/** Open a source dataset, or return a ProbedDataset if the probe cache has
+ * an up-to-date entry for it.
+ *
+ * Sources that are not regular files, such as subdatasets, are not cached.
+ */
+static GDALDatasetH OpenSourceDataset(const std::string &osFilename,
+                                      CSLConstList papszOpenOptions,
+                                      ProbeCache *poProbeCache)
+{
+    VSIStatBufL sStat;
+    const bool bCacheable = poProbeCache &&
+                            VSIStatL(osFilename.c_str(), &sStat) == 0 &&
+                            VSI_ISREG(sStat.st_mode);
+    if (bCacheable)
+    {
+        if (auto poProbe = poProbeCache->Lookup(osFilename, sStat))
+            return GDALDataset::ToHandle(
+                new ProbedDataset(osFilename, poProbe));
+    }
+
+    GDALDatasetH hDS = GDALOpenEx(osFilename.c_str(), GDAL_OF_RASTER, nullptr,
+                                  papszOpenOptions, nullptr);
+    if (!hDS || !bCacheable)
+        return hDS;
+
+    auto poProbe = SourceProbe::FromDataset(GDALDataset::FromHandle(hDS));
+    GDALClose(hDS);
+    poProbe->nFileSize = static_cast<GIntBig>(sStat.st_size);
+    poProbe->nMTime = static_cast<GIntBig>(sStat.st_mtime);
+    poProbeCache->Store(osFilename, poProbe);
+    return GDALDataset::ToHandle(new ProbedDataset(osFilename, poProbe));
+}
+
+/************************************************************************/
+/*                         SourceDatasetOpener                          */
+/************************************************************************/
+
+/** Opens source datasets ahead of their analysis in worker threads.
+ *
+ * Opening a dataset is dominated by I/O latency when it is on network storage,
+ * whereas AnalyseRaster() must process sources sequentially and in order.
+ * Up to twice as many sources as threads are kept in flight.
+ */
+class SourceDatasetOpener
+{
+  public:
+    SourceDatasetOpener(CPLWorkerThreadPool *poThreadPool, int nNumThreads,
+                        CSLConstList papszOpenOptions, ProbeCache *poProbeCache)
+        : m_poJobQueue(poThreadPool->CreateJobQueue()),
+          m_nMaxInFlight(2 * nNumThreads), m_papszOpenOptions(papszOpenOptions),
+          m_poProbeCache(poProbeCache),
+          m_aosThreadLocalConfigOptions(CPLGetThreadLocalConfigOptions())
+    {
+    }
+
+    ~SourceDatasetOpener();
+
+    GDALDatasetH Open(int iSrc, int nSrcCount,
+                      const char *const *papszSrcFilenames);
+
+  private:
+    struct Slot
+    {
+        bool bDone = false;
+        GDALDatasetH hDS = nullptr;
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    CPLJobQueuePtr m_poJobQueue;
+    const int m_nMaxInFlight;
+    CSLConstList m_papszOpenOptions;
+    ProbeCache *const m_poProbeCache;
+    const CPLStringList m_aosThreadLocalConfigOptions;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<int, std::unique_ptr<Slot>> m_oMapSlots{};
+    int m_nNextToSubmit = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(SourceDatasetOpener)
+};
+
+/************************************************************************/
+/*                        ~SourceDatasetOpener()                        */
+/************************************************************************/
+
+SourceDatasetOpener::~SourceDatasetOpener()
+{
+    // Datasets opened ahead of an early exit of Build() must be closed.
+    m_poJobQueue->WaitCompletion();
+    for (auto &[iSrc, poSlot] : m_oMapSlots)
+    {
+        if (poSlot->hDS)
+            GDALClose(poSlot->hDS);
+    }
+}
+
+/************************************************************************/
+/*                     SourceDatasetOpener::Open()                      */
+/************************************************************************/
+
+/** Return the dataset of index iSrc, and submit the opening of the next ones.
+ *
+ * Errors emitted while opening are replayed in the calling thread.
+ * nSrcCount and papszSrcFilenames may change between calls, as subdatasets
+ * get appended to the list of sources.
+ */
+GDALDatasetH SourceDatasetOpener::Open(int iSrc, int nSrcCount,
+                                       const char *const *papszSrcFilenames)
+{
+    CPLAssert(iSrc >= m_nNextToSubmit || cpl::contains(m_oMapSlots, iSrc));
+    m_nNextToSubmit = std::max(m_nNextToSubmit, iSrc);
+    while (m_nNextToSubmit < nSrcCount &&
+           m_nNextToSubmit < iSrc + m_nMaxInFlight)
+    {
+        auto poSlot = std::make_unique<Slot>();
+        Slot *poSlotRaw = poSlot.get();
+        {
+            std::lock_guard oLock(m_oMutex);
+            m_oMapSlots[m_nNextToSubmit] = std::move(poSlot);
+        }
+        m_poJobQueue->SubmitJob(
+            [this, poSlotRaw,
+             osFilename = std::string(papszSrcFilenames[m_nNextToSubmit])]()
+            {
+                // Honour the thread-local config options of the caller
+                const CPLStringList aosTLConfigOptionsBackup(
+                    CPLGetThreadLocalConfigOptions());
+                CPLSetThreadLocalConfigOptions(
+                    m_aosThreadLocalConfigOptions.List());
+                GDALDatasetH hDS;
+                {
+                    auto oAccumulator =
+                        poSlotRaw->oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    hDS = OpenSourceDataset(osFilename, m_papszOpenOptions,
+                                            m_poProbeCache);
+                }
+                CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
+                std::lock_guard oLock(m_oMutex);
+                poSlotRaw->hDS = hDS;
+                poSlotRaw->bDone = true;
+                m_oCV.notify_all();
+            });
+        ++m_nNextToSubmit;
+    }
+
+    std::unique_ptr<Slot> poSlot;
+    {
+        std::unique_lock oLock(m_oMutex);
+        auto oIter = m_oMapSlots.find(iSrc);
+        CPLAssert(oIter != m_oMapSlots.end());
+        m_oCV.wait(oLock, [&oIter] { return oIter->second->bDone; });
+        poSlot = std::move(oIter->second);
+        m_oMapSlots.erase(oIter);
+    }
+    poSlot->oErrorAccumulator.ReplayErrors();
+    return poSlot->hDS;
+}
+
 /************************************************************************/
 /*                               Build()                                */
 /************************************************************************/
@@ -1829,6 +2724,40 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // Declared before poOpener, so that it outlives the jobs of the latter
+    std::unique_ptr<ProbeCache> poProbeCache;
+    if (pahSrcDS == nullptr && !m_osProbeCacheFilename.empty())
+    {
+        poProbeCache = std::make_unique<ProbeCache>(m_osProbeCacheFilename,
+                                                    papszOpenOptions);
+    }
+
+    std::unique_ptr<SourceDatasetOpener> poOpener;
+    if (pahSrcDS == nullptr && nInputFiles > 1)
+    {
+        const char *pszNumThreads = nullptr;
+        bool bOK = false;
+        const int nNumThreads = GDALGetNumThreads(
+            m_osNumThreads.empty() ? nullptr : m_osNumThreads.c_str(),
+            /* nMaxVal = */ -1,
+            /* bDefaultAllCPUs = */ false, &pszNumThreads, &bOK);
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for number of threads: %s", pszNumThreads);
+            return nullptr;
+        }
+        // Sources are opened sequentially if the thread pool is unavailable
+        CPLWorkerThreadPool *poThreadPool =
+            nNumThreads > 1 ? GDALGetGlobalThreadPool(nNumThreads) : nullptr;
+        if (poThreadPool)
+        {
+            poOpener = std::make_unique<SourceDatasetOpener>(
+                poThreadPool, nNumThreads, papszOpenOptions,
+                poProbeCache.get());
+        }
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1839,10 +2768,11 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS =
+            pahSrcDS   ? pahSrcDS[i]
+            : poOpener ? poOpener->Open(i, nInputFiles, ppszInputFilenames)
+                       : OpenSourceDataset(dsFileName, papszOpenOptions,
+                                           poProbeCache.get());
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -2056,6 +2986,8 @@ struct GDALBuildVRTOptions
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
     bool bWriteAbsolutePath = false;
+    std::string osNumThreads{};
+    std::string osProbeCache{};
     std::string osPixelFunction{};
     CPLStringList aosPixelFunctionArgs{};
 
@@ -2214,6 +3146,8 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.aosPixelFunctionArgs, sOptions.aosOpenOptions.List(),
         sOptions.aosCreateOptions, sOptions.bWriteAbsolutePath);
     oBuilder.m_osProgramName = sOptions.osProgramName;
+    oBuilder.m_osNumThreads = sOptions.osNumThreads;
+    oBuilder.m_osProbeCacheFilename = sOptions.osProbeCache;
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData).release());
@@ -2502,6 +3436,18 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
         .help(_("Write the absolute path of the raster files in the tile index "
                 "file."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads to use to open source datasets, or "
+                "ALL_CPUS."));
+
+    argParser->add_argument("-probe_cache")
+        .metavar("<filename>")
+        .store_into(psOptions->osProbeCache)
+        .help(_("JSON file caching the properties of the source datasets "
+                "across runs."));
+
     argParser->add_argument("-ignore_srcmaskband")
         .flag()
         .action([psOptions](const std::string &)
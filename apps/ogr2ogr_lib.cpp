@@ -6571,6 +6571,19 @@ bool LayerTranslator::Translate(
     bool bRet = true;
     CPLErrorReset();
 
+    // When no geometry processing is needed, geometries that the source
+    // driver only provided as WKB are passed as such to the target layer,
+    // without building geometry objects.
+    const bool bCanPassThroughWKB =
+        !bExplodeCollections && iSrcZField == -1 &&
+        m_nCoordDim == COORD_DIM_UNCHANGED && m_eGeomOp == GEOMOP_NONE &&
+        !m_poClipSrcOri && !m_poClipDstOri && eGType == GEOMTYPE_UNCHANGED &&
+        m_eGeomTypeConversion == GTC_DEFAULT && m_poOutputSRS == nullptr &&
+        !m_bNullifyOutputSRS &&
+        psOptions->dfXYRes == OGRGeomCoordinatePrecision::UNKNOWN &&
+        !m_bMakeValid && !m_bSkipInvalidGeom && psInfo->m_bSupportCurves &&
+        psInfo->m_bSupportZ && psInfo->m_bSupportM;
+
     bool bSetupCTOK = false;
     if (m_bTransform && psInfo->m_nFeaturesRead == 0 &&
         !psInfo->m_bPerFeatureCT)
@@ -6702,7 +6715,13 @@ bool LayerTranslator::Translate(
                     (nDstGeomFieldCount == 1 ||
                      (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
                 {
-                    poStolenGeometry.reset(poFeature->StealGeometry());
+                    // A geometry only available as WKB is copied by SetFrom()
+                    // without being built.
+                    if (nDstGeomFieldCount == 0 ||
+                        !poFeature->GetGeomFieldWKB(0, nullptr))
+                    {
+                        poStolenGeometry.reset(poFeature->StealGeometry());
+                    }
                 }
                 else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
                 {
@@ -6861,6 +6880,15 @@ bool LayerTranslator::Translate(
 
             for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
             {
+                if (bCanPassThroughWKB &&
+                    poDstFeature->GetGeomFieldWKB(iGeom, nullptr) &&
+                    !psInfo->m_aoReprojectionInfo[iGeom].m_poCT &&
+                    psInfo->m_aoReprojectionInfo[iGeom]
+                        .m_aosTransformOptions.empty())
+                {
+                    continue;
+                }
+
                 std::unique_ptr<OGRGeometry> poDstGeometry;
 
                 if (poCollToExplode && iGeom == iGeomCollToExplode)
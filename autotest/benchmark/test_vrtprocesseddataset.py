@@ -0,0 +1,80 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Benchmarking of VRTProcessedDataset
+#
+###############################################################################
+# Copyright (c) 2026, GDAL contributors
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import gdaltest
+import pytest
+
+from osgeo import gdal
+
+pytestmark = [
+    pytest.mark.skipif(
+        not gdaltest.vrt_has_open_support(),
+        reason="VRT driver open missing",
+    ),
+    # Must be set to run the test_XXX functions under the benchmark fixture
+    pytest.mark.usefixtures("decorate_with_benchmark"),
+]
+
+
+@pytest.fixture(scope="module")
+def source_ds():
+    # 4-band R,G,B,NIR dataset, as used as the input of pansharpening-style
+    # processing chains
+    filename = "/vsimem/benchmark_vrtprocesseddataset.tif"
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename, 2048, 2048, 4, gdal.GDT_UInt16
+    )
+    for i in range(4):
+        ds.GetRasterBand(i + 1).Fill(1000 * (i + 1))
+    ds.Close()
+    yield filename
+    gdal.Unlink(filename)
+
+
+@pytest.mark.parametrize("fuse_steps", ["YES", "NO"])
+def test_vrtprocesseddataset_chained_steps(source_ds, fuse_steps):
+    vrt_xml = f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{source_ds}</SourceFilename>
+    </Input>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">0,1.1,0,0,-0.05</Argument>
+            <Argument name="coefficients_2">0,0,1.05,0,-0.02</Argument>
+            <Argument name="coefficients_3">0,0,0,0.98,-0.01</Argument>
+            <Argument name="coefficients_4">0,0,0,0,1</Argument>
+        </Step>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">-10,0.25,0,0,0</Argument>
+            <Argument name="coefficients_2">-10,0,0.25,0,0</Argument>
+            <Argument name="coefficients_3">-10,0,0,0.25,0</Argument>
+            <Argument name="coefficients_4">-10,0,0,0,0.25</Argument>
+            <Argument name="min">0</Argument>
+            <Argument name="max">255</Argument>
+        </Step>
+        <Step>
+            <Algorithm>LUT</Algorithm>
+            <Argument name="lut_1">0:0,128:160,255:255</Argument>
+            <Argument name="lut_2">0:0,128:150,255:255</Argument>
+            <Argument name="lut_3">0:0,128:140,255:255</Argument>
+            <Argument name="lut_4">0:0,255:255</Argument>
+        </Step>
+    </ProcessingSteps>
+    <OutputBands count="FROM_LAST_STEP" dataType="Byte" />
+    </VRTDataset>"""
+
+    with gdal.config_option("VRT_PROCESSED_DATASET_FUSE_STEPS", fuse_steps):
+        ds = gdal.Open(vrt_xml)
+        ds.ReadRaster()
@@ -0,0 +1,101 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Benchmarking of /vsicurl/ sequential reads
+#
+###############################################################################
+# Copyright (c) 2026, GDAL contributors
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+import gdaltest
+import pytest
+
+from osgeo import gdal
+
+pytestmark = [
+    pytest.mark.require_curl(),
+    # Must be set to run the test_XXX functions under the benchmark fixture
+    pytest.mark.usefixtures("decorate_with_benchmark"),
+]
+
+FILE_SIZE = 32 * 1024 * 1024
+CONTENT = bytes(i % 251 for i in range(FILE_SIZE))
+
+# Simulates the per-connection throughput limit of object storage
+BYTES_PER_SECOND_PER_CONNECTION = 16 * 1024 * 1024
+WRITE_GRANULARITY = 256 * 1024
+
+
+class ThrottledRangeHandler(BaseHTTPRequestHandler):
+
+    protocol_version = "HTTP/1.1"
+
+    def log_request(self, code="-", size="-"):
+        pass
+
+    def do_HEAD(self):
+        self.send_response(200)
+        self.send_header("Content-Length", FILE_SIZE)
+        self.end_headers()
+
+    def do_GET(self):
+        if "Range" not in self.headers:
+            self.send_response(404)
+            self.send_header("Content-Length", 0)
+            self.end_headers()
+            return
+        rng = self.headers["Range"][len("bytes=") :]
+        start = int(rng.split("-")[0])
+        end = min(int(rng.split("-")[1]), FILE_SIZE - 1)
+        self.send_response(206)
+        self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, FILE_SIZE))
+        self.send_header("Content-Length", end - start + 1)
+        self.end_headers()
+        pos = start
+        while pos <= end:
+            n = min(WRITE_GRANULARITY, end + 1 - pos)
+            self.wfile.write(CONTENT[pos : pos + n])
+            pos += n
+            time.sleep(n / BYTES_PER_SECOND_PER_CONNECTION)
+
+
+@pytest.fixture(scope="module")
+def server_port():
+    server = ThreadingHTTPServer(("localhost", 0), ThrottledRangeHandler)
+    server.daemon_threads = True
+    thread = threading.Thread(target=server.serve_forever)
+    thread.start()
+    yield server.server_address[1]
+    server.shutdown()
+    thread.join()
+
+
+@pytest.mark.parametrize("read_ahead_requests", ["1", "2", "4", "8"])
+def test_vsicurl_sequential_read(server_port, read_ahead_requests):
+    gdal.VSICurlClearCache()
+    with gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_CACHE_SIZE": str(64 * 1024 * 1024),
+            "CPL_VSIL_CURL_READ_AHEAD_REQUESTS": read_ahead_requests,
+        }
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_vsicurl_sequential_read.bin"
+            % server_port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            while len(gdal.VSIFReadL(1, 1024 * 1024, f)) == 1024 * 1024:
+                pass
+        finally:
+            gdal.VSIFCloseL(f)
@@ -52,6 +52,7 @@
 #include <limits>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #if !defined(_WIN32)
 #include <unistd.h>
@@ -4743,6 +4744,214 @@ TEST_F(test_cpl, file_system_pread)
     VSIUnlink("temp_test_64.bin");
 }
 
+// Test reading local files with io_uring (when available)
+TEST_F(test_cpl, file_system_io_uring)
+{
+    const std::string osFilename =
+        CPLGenerateTempFilenameSafe("test_cpl_io_uring");
+    std::vector<GByte> abyContent(3 * 1000 * 1000 + 17);
+    for (size_t i = 0; i < abyContent.size(); ++i)
+        abyContent[i] = static_cast<GByte>(i * 7 + i / 1000);
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+        if (fp == nullptr)
+            return;
+        ASSERT_EQ(VSIFWriteL(abyContent.data(), 1, abyContent.size(), fp),
+                  abyContent.size());
+        VSIFCloseL(fp);
+    }
+
+    CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", "YES", false);
+    CPLConfigOptionSetter oSetter2("CPL_VSIL_IO_URING_DIRECT_IO_MIN_SIZE",
+                                   "1 MB", false);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+
+    {
+        constexpr int N_RANGES = 100;
+        std::vector<std::vector<GByte>> aabyBuffers(N_RANGES);
+        std::vector<void *> apData(N_RANGES);
+        std::vector<vsi_l_offset> anOffsets(N_RANGES);
+        std::vector<size_t> anSizes(N_RANGES);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            anOffsets[i] = static_cast<vsi_l_offset>(i) * 29989 + 13;
+            anSizes[i] = 1000 + i * 7;
+            aabyBuffers[i].resize(anSizes[i]);
+            apData[i] = aabyBuffers[i].data();
+        }
+        ASSERT_EQ(VSIFReadMultiRangeL(N_RANGES, apData.data(),
+                                      anOffsets.data(), anSizes.data(), fp),
+                  0);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            EXPECT_EQ(memcmp(aabyBuffers[i].data(),
+                             abyContent.data() + anOffsets[i], anSizes[i]),
+                      0);
+        }
+
+        // Range beyond end of file
+        anOffsets[0] = abyContent.size() - 10;
+        anSizes[0] = 20;
+        EXPECT_NE(VSIFReadMultiRangeL(1, apData.data(), anOffsets.data(),
+                                      anSizes.data(), fp),
+                  0);
+    }
+
+    // Large unaligned reads, served with O_DIRECT if the file system
+    // supports it.
+    {
+        std::vector<GByte> abyBuffer(abyContent.size());
+        ASSERT_EQ(VSIFSeekL(fp, 123, SEEK_SET), 0);
+        ASSERT_EQ(VSIFReadL(abyBuffer.data(), 1, 1500 * 1000, fp),
+                  1500U * 1000);
+        EXPECT_EQ(memcmp(abyBuffer.data(), abyContent.data() + 123,
+                         1500 * 1000),
+                  0);
+        EXPECT_EQ(VSIFTellL(fp), 123U + 1500 * 1000);
+
+        // Regular reads after O_DIRECT ones must continue at the right place
+        GByte abySmall[10];
+        ASSERT_EQ(VSIFReadL(abySmall, 1, sizeof(abySmall), fp),
+                  sizeof(abySmall));
+        EXPECT_EQ(memcmp(abySmall, abyContent.data() + 123 + 1500 * 1000,
+                         sizeof(abySmall)),
+                  0);
+
+        // Read up to end of file
+        const size_t nRemaining = abyContent.size() - 123 - 1500 * 1000 -
+                                  sizeof(abySmall);
+        EXPECT_EQ(VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp),
+                  nRemaining);
+        EXPECT_EQ(memcmp(abyBuffer.data(),
+                         abyContent.data() + abyContent.size() - nRemaining,
+                         nRemaining),
+                  0);
+        EXPECT_TRUE(VSIFEofL(fp));
+    }
+
+    VSIFCloseL(fp);
+    VSIUnlink(osFilename.c_str());
+}
+
+// Test VSIVirtualHandle::SubmitRead()
+TEST_F(test_cpl, vsi_submit_read)
+{
+    std::vector<GByte> abyContent(100000);
+    for (size_t i = 0; i < abyContent.size(); ++i)
+        abyContent[i] = static_cast<GByte>(i * 7);
+    VSILFILE *fp = VSIFileFromMemBuffer("", abyContent.data(),
+                                        abyContent.size(), FALSE);
+    ASSERT_NE(fp, nullptr);
+    VSIVirtualHandle *poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+
+    constexpr int N_RANGES = 50;
+    std::vector<std::vector<GByte>> aabyBuffers(N_RANGES);
+    std::vector<void *> apData(N_RANGES);
+    std::vector<vsi_l_offset> anOffsets(N_RANGES);
+    std::vector<size_t> anSizes(N_RANGES);
+    for (int i = 0; i < N_RANGES; ++i)
+    {
+        anOffsets[i] = static_cast<vsi_l_offset>(i) * 1999;
+        anSizes[i] = 100 + i;
+        aabyBuffers[i].resize(anSizes[i]);
+        apData[i] = aabyBuffers[i].data();
+    }
+
+    {
+        std::atomic<int> nCallbackCount{0};
+        std::atomic<bool> bCallbackSuccess{false};
+        auto oFuture = poHandle->SubmitRead(
+            N_RANGES, apData.data(), anOffsets.data(), anSizes.data(),
+            [&nCallbackCount, &bCallbackSuccess](bool bSuccess)
+            {
+                bCallbackSuccess = bSuccess;
+                ++nCallbackCount;
+            });
+        EXPECT_TRUE(oFuture.get());
+        EXPECT_EQ(nCallbackCount, 1);
+        EXPECT_TRUE(bCallbackSuccess);
+        EXPECT_EQ(poHandle->Tell(), 0U);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            EXPECT_EQ(memcmp(aabyBuffers[i].data(),
+                             abyContent.data() + anOffsets[i], anSizes[i]),
+                      0);
+        }
+    }
+
+    // Range partly beyond end of file
+    {
+        GByte abyBuffer[10];
+        void *pData = abyBuffer;
+        const vsi_l_offset nOffset = abyContent.size() - 5;
+        const size_t nSize = sizeof(abyBuffer);
+        auto oFuture = poHandle->SubmitRead(1, &pData, &nOffset, &nSize);
+        EXPECT_FALSE(oFuture.get());
+    }
+
+    // No range
+    EXPECT_TRUE(poHandle->SubmitRead(0, nullptr, nullptr, nullptr).get());
+
+    VSIFCloseL(fp);
+}
+
+// Test that VSIVirtualHandle::SubmitRead() requests are traced
+TEST_F(test_cpl, vsi_submit_read_trace)
+{
+    const std::string osFilename =
+        VSIMemGenerateHiddenFilename("vsi_submit_read_trace.bin");
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        std::vector<GByte> abyContent(1000, 1);
+        EXPECT_EQ(VSIFWriteL(abyContent.data(), 1, abyContent.size(), fp),
+                  abyContent.size());
+        VSIFCloseL(fp);
+    }
+
+    CPLConfigOptionSetter oSetter("CPL_VSIL_TRACE", "YES", false);
+    VSITraceReset();
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    VSIVirtualHandle *poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+
+    GByte abyBuffer1[10];
+    GByte abyBuffer2[20];
+    void *apData[] = {abyBuffer1, abyBuffer2};
+    const vsi_l_offset anOffsets[] = {100, 500};
+    const size_t anSizes[] = {sizeof(abyBuffer1), sizeof(abyBuffer2)};
+    bool bCallbackInvoked = false;
+    EXPECT_TRUE(poHandle
+                    ->SubmitRead(2, apData, anOffsets, anSizes,
+                                 [&bCallbackInvoked](bool)
+                                 { bCallbackInvoked = true; })
+                    .get());
+    EXPECT_TRUE(bCallbackInvoked);
+    VSIFCloseL(fp);
+
+    char *pszJSON = VSITraceGetAsSerializedJSON(nullptr);
+    VSITraceReset();
+    ASSERT_NE(pszJSON, nullptr);
+    CPLJSONDocument oDoc;
+    EXPECT_TRUE(oDoc.LoadMemory(pszJSON));
+    CPLFree(pszJSON);
+    // Filenames contain slashes, which cannot be used in a JSON path
+    const auto aoFiles = oDoc.GetRoot().GetObj("files").GetChildren();
+    ASSERT_EQ(aoFiles.size(), 1U);
+    EXPECT_EQ(aoFiles[0].GetName(), osFilename);
+    EXPECT_EQ(aoFiles[0].GetLong("read/multi_range_count"), 1);
+    EXPECT_EQ(aoFiles[0].GetLong("read/read_bytes"), 30);
+    const auto oRanges = aoFiles[0].GetArray("ranges");
+    ASSERT_EQ(oRanges.Size(), 2);
+    EXPECT_EQ(oRanges[0].ToArray()[0].ToLong(), 100);
+    EXPECT_EQ(oRanges[0].ToArray()[1].ToLong(), 110);
+    EXPECT_EQ(oRanges[1].ToArray()[0].ToLong(), 500);
+    EXPECT_EQ(oRanges[1].ToArray()[1].ToLong(), 520);
+
+    VSIUnlink(osFilename.c_str());
+}
+
 // Test CPLMask implementation
 TEST_F(test_cpl, CPLMask)
 {
@@ -5549,6 +5758,152 @@ TEST_F(test_cpl, VSIMemGenerateHiddenFilename)
     }
 }
 
+TEST_F(test_cpl, VSIMemGenerateThreadPrivateFilename)
+{
+    const std::string osFilename =
+        VSIMemGenerateThreadPrivateFilename("foo.bar");
+    EXPECT_TRUE(STARTS_WITH(osFilename.c_str(), "/vsimem/.#!THREAD!#./"));
+    EXPECT_TRUE(ENDS_WITH(osFilename.c_str(), "/foo.bar"));
+
+    GByte abyDummyData[1] = {0};
+    VSIFCloseL(VSIFileFromMemBuffer(osFilename.c_str(), abyDummyData,
+                                    sizeof(abyDummyData), false));
+    {
+        VSIStatBufL sStat;
+        EXPECT_EQ(VSIStatL(osFilename.c_str(), &sStat), 0);
+    }
+    EXPECT_EQ(CPLStringList(VSIReadDir("/vsimem/.#!THREAD!#.")).size(), 1);
+    EXPECT_TRUE(CPLStringList(VSIReadDir("/vsimem/")).FindString(
+                    ".#!THREAD!#.") < 0);
+
+    // Thread-private files are not visible from other threads
+    std::thread(
+        [&osFilename]()
+        {
+            VSIStatBufL sStat;
+            EXPECT_EQ(VSIStatL(osFilename.c_str(), &sStat), -1);
+            EXPECT_TRUE(
+                CPLStringList(VSIReadDir("/vsimem/.#!THREAD!#.")).empty());
+            EXPECT_EQ(VSIFOpenL(osFilename.c_str(), "rb"), nullptr);
+        })
+        .join();
+
+    // Cannot be moved to the shared namespace
+    EXPECT_NE(VSIRename(osFilename.c_str(), "/vsimem/foo.bar"), 0);
+
+    // Create a file in a subdirectory
+    const std::string osSubDir = VSIMemGenerateThreadPrivateFilename("subdir");
+    const std::string osFilename2 = osSubDir + "/my.bin";
+    VSILFILE *fp = VSIFOpenL(osFilename2.c_str(), "wb+");
+    ASSERT_NE(fp, nullptr);
+    EXPECT_EQ(VSIFWriteL("abc", 1, 3, fp), 3U);
+    VSIFCloseL(fp);
+    EXPECT_EQ(CPLStringList(VSIReadDir(osSubDir.c_str())).size(), 1);
+    EXPECT_EQ(CPLStringList(VSIReadDir("/vsimem/.#!THREAD!#.")).size(), 2);
+
+    EXPECT_EQ(VSIUnlink(osFilename.c_str()), 0);
+    EXPECT_EQ(VSIRmdirRecursive(osSubDir.c_str()), 0);
+    EXPECT_TRUE(CPLStringList(VSIReadDir("/vsimem/.#!THREAD!#.")).empty());
+}
+
+TEST_F(test_cpl, vsimem_concurrent_create_delete)
+{
+    // Many threads creating, reading and deleting files, in both the shared
+    // and thread-private namespaces, with buffer pooling enabled.
+    // The option is read once per thread, so set it globally, so that it is
+    // seen by the newly created threads.
+    CPLSetConfigOption("VSI_MEM_BUFFER_POOL_SIZE", "1MB");
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < 8; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [iThread]()
+            {
+                for (int i = 0; i < 200; ++i)
+                {
+                    const std::string osFilename =
+                        (i % 2) == 0
+                            ? std::string(CPLSPrintf(
+                                  "/vsimem/vsimem_concurrent/%d/%d.bin",
+                                  iThread, i))
+                            : std::string(
+                                  VSIMemGenerateThreadPrivateFilename("x"));
+                    const std::string osData(1000 + 100 * i,
+                                             static_cast<char>(i));
+                    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb+");
+                    ASSERT_NE(fp, nullptr);
+                    // Write in two steps, with a hole in between, to
+                    // exercise buffer growth
+                    EXPECT_EQ(VSIFWriteL(osData.data(), 1, 10, fp), 10U);
+                    EXPECT_EQ(VSIFSeekL(fp, 100, SEEK_SET), 0);
+                    EXPECT_EQ(VSIFWriteL(osData.data() + 100, 1,
+                                         osData.size() - 100, fp),
+                              osData.size() - 100);
+                    VSIFCloseL(fp);
+
+                    vsi_l_offset nLength = 0;
+                    const GByte *pabyData = VSIGetMemFileBuffer(
+                        osFilename.c_str(), &nLength, false);
+                    ASSERT_NE(pabyData, nullptr);
+                    ASSERT_EQ(nLength, osData.size());
+                    EXPECT_EQ(memcmp(pabyData, osData.data(), 10), 0);
+                    for (int j = 10; j < 100; ++j)
+                        EXPECT_EQ(pabyData[j], 0);
+                    EXPECT_EQ(memcmp(pabyData + 100, osData.data() + 100,
+                                     osData.size() - 100),
+                              0);
+                    EXPECT_EQ(VSIUnlink(osFilename.c_str()), 0);
+                }
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    CPLSetConfigOption("VSI_MEM_BUFFER_POOL_SIZE", nullptr);
+    EXPECT_EQ(VSIRmdirRecursive("/vsimem/vsimem_concurrent"), 0);
+}
+
+TEST_F(test_cpl, vsimem_buffer_zeroed_after_end)
+{
+    // The bytes after the end of a file must be zero, even when its buffer
+    // comes from the pool, as callers use it as a nul-terminated string.
+    CPLSetConfigOption("VSI_MEM_BUFFER_POOL_SIZE", "1MB");
+    std::thread(
+        []()
+        {
+            const std::string osFilename =
+                VSIMemGenerateHiddenFilename("zeroed.txt");
+            const std::string osData(8000, 'x');
+            for (int i = 0; i < 2; ++i)
+            {
+                VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+                ASSERT_NE(fp, nullptr);
+                const size_t nSize = i == 0 ? osData.size() : 3;
+                EXPECT_EQ(VSIFWriteL(osData.data(), 1, nSize, fp), nSize);
+                VSIFCloseL(fp);
+
+                const char *pszData = reinterpret_cast<const char *>(
+                    VSIGetMemFileBuffer(osFilename.c_str(), nullptr, false));
+                ASSERT_NE(pszData, nullptr);
+                EXPECT_EQ(strlen(pszData), nSize);
+                EXPECT_EQ(VSIUnlink(osFilename.c_str()), 0);
+            }
+
+            // Truncation
+            VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb+");
+            ASSERT_NE(fp, nullptr);
+            EXPECT_EQ(VSIFWriteL(osData.data(), 1, 100, fp), 100U);
+            EXPECT_EQ(VSIFTruncateL(fp, 10), 0);
+            VSIFCloseL(fp);
+            const char *pszData = reinterpret_cast<const char *>(
+                VSIGetMemFileBuffer(osFilename.c_str(), nullptr, false));
+            ASSERT_NE(pszData, nullptr);
+            EXPECT_EQ(strlen(pszData), 10U);
+            EXPECT_EQ(VSIUnlink(osFilename.c_str()), 0);
+        })
+        .join();
+    CPLSetConfigOption("VSI_MEM_BUFFER_POOL_SIZE", nullptr);
+}
+
 TEST_F(test_cpl, VSIGlob)
 {
     GByte abyDummyData[1] = {0};
@@ -23,6 +23,7 @@
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <thread>
 
 #ifdef HAVE_SQLITE3
 #include <sqlite3.h>
@@ -4625,6 +4626,360 @@ TEST_F(test_ogr, OGRFeature_SetGeomField)
     poFeatureDefn->Release();
 }
 
+TEST_F(test_ogr, OGRFeature_SetGeomFieldFromWKB)
+{
+    OGRFeatureDefn *poFeatureDefn = new OGRFeatureDefn();
+    poFeatureDefn->Reference();
+    OGRSpatialReference *poSRS = new OGRSpatialReference();
+    poSRS->importFromEPSG(4326);
+    poFeatureDefn->GetGeomFieldDefn(0)->SetSpatialRef(poSRS);
+    poSRS->Release();
+
+    auto [poGeom, err] =
+        OGRGeometryFactory::createFromWkt("LINESTRING Z (1 2 3,4 5 6)");
+    ASSERT_EQ(err, OGRERR_NONE);
+    std::vector<GByte> abyWKB(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+
+    OGRFeature oFeat(poFeatureDefn);
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(1, abyWKB.data(), abyWKB.size()),
+              OGRERR_FAILURE);
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), 0), OGRERR_FAILURE);
+    ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), abyWKB.size()),
+              OGRERR_NONE);
+
+    // Zero-copy accessors do not build the geometry
+    size_t nWKBSize = 0;
+    const GByte *pabyWKB = oFeat.GetGeomFieldWKB(0, &nWKBSize);
+    ASSERT_NE(pabyWKB, nullptr);
+    ASSERT_EQ(nWKBSize, abyWKB.size());
+    EXPECT_EQ(memcmp(pabyWKB, abyWKB.data(), nWKBSize), 0);
+    OGREnvelope sEnvelope;
+    ASSERT_TRUE(oFeat.GetGeomFieldEnvelope(0, &sEnvelope));
+    EXPECT_EQ(sEnvelope.MinX, 1);
+    EXPECT_EQ(sEnvelope.MinY, 2);
+    EXPECT_EQ(sEnvelope.MaxX, 4);
+    EXPECT_EQ(sEnvelope.MaxY, 5);
+    EXPECT_NE(oFeat.GetGeomFieldWKB(0, nullptr), nullptr);
+
+    // WKB is propagated by Clone() and SetFrom()
+    {
+        auto poClone = std::unique_ptr<OGRFeature>(oFeat.Clone());
+        EXPECT_NE(poClone->GetGeomFieldWKB(0, nullptr), nullptr);
+        OGRFeature oOther(poFeatureDefn);
+        EXPECT_EQ(oOther.SetFrom(&oFeat), OGRERR_NONE);
+        EXPECT_NE(oOther.GetGeomFieldWKB(0, nullptr), nullptr);
+        EXPECT_TRUE(oOther.Equal(poClone.get()));
+    }
+
+    // SerializeToBinary() reuses the WKB
+    {
+        std::vector<GByte> abyBuffer;
+        ASSERT_TRUE(oFeat.SerializeToBinary(abyBuffer));
+        OGRFeature oOther(poFeatureDefn);
+        ASSERT_TRUE(oOther.DeserializeFromBinary(abyBuffer.data(),
+                                                 abyBuffer.size()));
+        ASSERT_NE(oOther.GetGeometryRef(), nullptr);
+        EXPECT_TRUE(oOther.GetGeometryRef()->Equals(poGeom.get()));
+    }
+
+    // Requesting the geometry builds it
+    const OGRGeometry *poFeatGeom = oFeat.GetGeometryRef();
+    ASSERT_NE(poFeatGeom, nullptr);
+    EXPECT_EQ(oFeat.GetGeomFieldWKB(0, nullptr), nullptr);
+    EXPECT_TRUE(poFeatGeom->Equals(poGeom.get()));
+    EXPECT_EQ(poFeatGeom->getSpatialReference(),
+              poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
+    ASSERT_TRUE(oFeat.GetGeomFieldEnvelope(0, &sEnvelope));
+    EXPECT_EQ(sEnvelope.MaxY, 5);
+
+    // Setting a geometry object discards the WKB
+    ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), abyWKB.size()),
+              OGRERR_NONE);
+    EXPECT_EQ(oFeat.SetGeomField(0, nullptr), OGRERR_NONE);
+    EXPECT_EQ(oFeat.GetGeomFieldWKB(0, nullptr), nullptr);
+    EXPECT_EQ(oFeat.GetGeometryRef(), nullptr);
+    EXPECT_FALSE(oFeat.GetGeomFieldEnvelope(0, &sEnvelope));
+
+    // Empty geometry
+    {
+        auto [poEmptyGeom, errEmpty] =
+            OGRGeometryFactory::createFromWkt("POINT EMPTY");
+        ASSERT_EQ(errEmpty, OGRERR_NONE);
+        std::vector<GByte> abyEmptyWKB(poEmptyGeom->WkbSize());
+        poEmptyGeom->exportToWkb(wkbNDR, abyEmptyWKB.data(), wkbVariantIso);
+        ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyEmptyWKB.data(),
+                                            abyEmptyWKB.size()),
+                  OGRERR_NONE);
+        EXPECT_FALSE(oFeat.GetGeomFieldEnvelope(0, &sEnvelope));
+        ASSERT_NE(oFeat.GetGeometryRef(), nullptr);
+        EXPECT_TRUE(oFeat.GetGeometryRef()->IsEmpty());
+    }
+
+    // Corrupted WKB
+    {
+        ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), 9),
+                  OGRERR_NONE);
+        oFeat.Reset();
+        EXPECT_EQ(oFeat.GetGeomFieldWKB(0, nullptr), nullptr);
+
+        ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), 9),
+                  OGRERR_NONE);
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(oFeat.GetGeomFieldEnvelope(0, &sEnvelope));
+        EXPECT_EQ(oFeat.GetGeometryRef(), nullptr);
+    }
+
+    // Concurrent const readers build the geometry only once
+    for (int iIter = 0; iIter < 10; ++iIter)
+    {
+        ASSERT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), abyWKB.size()),
+                  OGRERR_NONE);
+        const OGRFeature &oConstFeat = oFeat;
+        constexpr int N_THREADS = 4;
+        std::vector<const OGRGeometry *> apoGeoms(N_THREADS);
+        std::vector<std::thread> aoThreads;
+        for (int i = 0; i < N_THREADS; ++i)
+        {
+            aoThreads.emplace_back(
+                [&oConstFeat, &apoGeoms, i]()
+                {
+                    OGREnvelope sThreadEnvelope;
+                    oConstFeat.GetGeomFieldEnvelope(0, &sThreadEnvelope);
+                    apoGeoms[i] = oConstFeat.GetGeomFieldRef(0);
+                });
+        }
+        for (auto &oThread : aoThreads)
+            oThread.join();
+        ASSERT_NE(apoGeoms[0], nullptr);
+        EXPECT_TRUE(apoGeoms[0]->Equals(poGeom.get()));
+        for (int i = 1; i < N_THREADS; ++i)
+            EXPECT_EQ(apoGeoms[i], apoGeoms[0]);
+    }
+
+    poFeatureDefn->Release();
+}
+
+// Test OGRLayer::GetNextFeatureInto()
+TEST_F(test_ogr, OGRLayer_GetNextFeatureInto)
+{
+    const auto Fill = [](OGRLayer *poLayer)
+    {
+        OGRFieldDefn oFieldStr("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldStr), OGRERR_NONE);
+        OGRFieldDefn oFieldInt("int", OFTInteger);
+        ASSERT_EQ(poLayer->CreateField(&oFieldInt), OGRERR_NONE);
+        const char *const apszWKT[] = {"LINESTRING (0 0,1 1)",
+                                       "LINESTRING (0 0,1 1,2 2)", nullptr,
+                                       "LINESTRING (3 3,4 4)"};
+        int i = 0;
+        for (const char *pszWKT : apszWKT)
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            if (i != 1)
+                oFeature.SetField(0, CPLSPrintf("value%d", i));
+            oFeature.SetField(1, i);
+            if (pszWKT)
+            {
+                auto [poGeom, err] = OGRGeometryFactory::createFromWkt(pszWKT);
+                ASSERT_EQ(err, OGRERR_NONE);
+                oFeature.SetGeometry(std::move(poGeom));
+            }
+            ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE);
+            ++i;
+        }
+    };
+
+    const auto Check = [](OGRLayer *poLayer)
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoRefFeatures;
+        poLayer->ResetReading();
+        while (auto poFeature = std::unique_ptr<OGRFeature>(
+                   poLayer->GetNextFeature()))
+            apoRefFeatures.push_back(std::move(poFeature));
+        ASSERT_EQ(apoRefFeatures.size(), 4U);
+
+        poLayer->ResetReading();
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        for (const auto &poRefFeature : apoRefFeatures)
+        {
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(&oFeature));
+            EXPECT_TRUE(oFeature.Equal(poRefFeature.get()));
+        }
+        EXPECT_FALSE(poLayer->GetNextFeatureInto(&oFeature));
+
+        // With an attribute filter
+        ASSERT_EQ(poLayer->SetAttributeFilter("int >= 2"), OGRERR_NONE);
+        ASSERT_TRUE(poLayer->GetNextFeatureInto(&oFeature));
+        EXPECT_TRUE(oFeature.Equal(apoRefFeatures[2].get()));
+        ASSERT_TRUE(poLayer->GetNextFeatureInto(&oFeature));
+        EXPECT_TRUE(oFeature.Equal(apoRefFeatures[3].get()));
+        EXPECT_FALSE(poLayer->GetNextFeatureInto(&oFeature));
+        ASSERT_EQ(poLayer->SetAttributeFilter(nullptr), OGRERR_NONE);
+
+        // Through the C API
+        poLayer->ResetReading();
+        OGRFeatureH hFeature =
+            OGR_F_Create(OGRFeatureDefn::ToHandle(poLayer->GetLayerDefn()));
+        int nCount = 0;
+        while (OGR_L_GetNextFeatureInto(OGRLayer::ToHandle(poLayer), hFeature))
+        {
+            EXPECT_TRUE(OGRFeature::FromHandle(hFeature)->Equal(
+                apoRefFeatures[nCount].get()));
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+        OGR_F_Destroy(hFeature);
+
+        // Default feature iterator, which returns new features
+        nCount = 0;
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures;
+        for (auto &poFeature : *poLayer)
+        {
+            EXPECT_TRUE(poFeature->Equal(apoRefFeatures[nCount].get()));
+            apoFeatures.emplace_back(poFeature.release());
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(apoFeatures[i]->Equal(apoRefFeatures[i].get()));
+        }
+
+        // Feature iterator, which recycles features
+        nCount = 0;
+        const OGRFeature *poFirstFeature = nullptr;
+        for (const auto &poFeature : poLayer->GetRecycledFeatures())
+        {
+            EXPECT_TRUE(poFeature->Equal(apoRefFeatures[nCount].get()));
+            if (nCount == 0)
+                poFirstFeature = poFeature.get();
+            else
+                EXPECT_EQ(poFeature.get(), poFirstFeature);
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+
+        // Feature of another feature definition
+        OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn();
+        poOtherDefn->Reference();
+        {
+            OGRFeature oOtherFeature(poOtherDefn);
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            EXPECT_FALSE(poLayer->GetNextFeatureInto(&oOtherFeature));
+        }
+        poOtherDefn->Release();
+    };
+
+    // Default implementation
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GetGDALDriverManager()->GetDriverByName("MEM")->Create(
+                "", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbLineString);
+        Fill(poLayer);
+        Check(poLayer);
+    }
+
+    // GeoPackage implementation
+    if (GDALGetDriverByName("GPKG"))
+    {
+        const char *pszFilename = "/vsimem/test_GetNextFeatureInto.gpkg";
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GetGDALDriverManager()->GetDriverByName("GPKG")->Create(
+                    pszFilename, 0, 0, 0, GDT_Unknown, nullptr));
+            auto poLayer = poDS->CreateLayer("test", nullptr, wkbLineString);
+            Fill(poLayer);
+        }
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+            ASSERT_TRUE(poDS != nullptr);
+            auto poLayer = poDS->GetLayer(0);
+            Check(poLayer);
+
+            // Geometry objects of the same type are reused
+            poLayer->ResetReading();
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(&oFeature));
+            const OGRGeometry *poGeom = oFeature.GetGeometryRef();
+            ASSERT_NE(poGeom, nullptr);
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(&oFeature));
+            EXPECT_EQ(oFeature.GetGeometryRef(), poGeom);
+            EXPECT_EQ(oFeature.GetGeometryRef()->toLineString()->getNumPoints(),
+                      3);
+            EXPECT_EQ(oFeature.GetGeometryRef()->getSpatialReference(),
+                      poLayer->GetSpatialRef());
+        }
+        VSIUnlink(pszFilename);
+    }
+
+    // Shapefile implementation
+    if (GDALGetDriverByName("ESRI Shapefile"))
+    {
+        const char *pszFilename = "/vsimem/test_GetNextFeatureInto.shp";
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GetGDALDriverManager()
+                ->GetDriverByName("ESRI Shapefile")
+                ->Create(pszFilename, 0, 0, 0, GDT_Unknown, nullptr));
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbLineString);
+        Fill(poLayer);
+        Check(poLayer);
+        poDS.reset();
+        GDALDeleteDataset(nullptr, pszFilename);
+    }
+
+    // CSV implementation
+    if (GDALGetDriverByName("CSV"))
+    {
+        const char *pszFilename = "/vsimem/test_GetNextFeatureInto.csv";
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GetGDALDriverManager()->GetDriverByName("CSV")->Create(
+                    pszFilename, 0, 0, 0, GDT_Unknown, nullptr));
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("GEOMETRY", "AS_WKT");
+            aosOptions.SetNameValue("CREATE_CSVT", "YES");
+            auto poLayer = poDS->CreateLayer("test_GetNextFeatureInto",
+                                             nullptr, wkbLineString,
+                                             aosOptions.List());
+            Fill(poLayer);
+        }
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+            ASSERT_TRUE(poDS != nullptr);
+            Check(poDS->GetLayer(0));
+        }
+        VSIUnlink(pszFilename);
+        VSIUnlink("/vsimem/test_GetNextFeatureInto.csvt");
+    }
+
+    // FlatGeobuf implementation
+    if (GDALGetDriverByName("FlatGeobuf"))
+    {
+        const char *pszFilename = "/vsimem/test_GetNextFeatureInto.fgb";
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GetGDALDriverManager()->GetDriverByName("FlatGeobuf")->Create(
+                    pszFilename, 0, 0, 0, GDT_Unknown, nullptr));
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("SPATIAL_INDEX", "NO");
+            auto poLayer = poDS->CreateLayer("test", nullptr, wkbLineString,
+                                             aosOptions.List());
+            Fill(poLayer);
+        }
+        {
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+            ASSERT_TRUE(poDS != nullptr);
+            Check(poDS->GetLayer(0));
+        }
+        VSIUnlink(pszFilename);
+    }
+}
+
 TEST_F(test_ogr, GetArrowStream_DateTime_As_String)
 {
     auto poDS = std::unique_ptr<GDALDataset>(
@@ -12669,3 +12669,188 @@ def test_tiff_write_10bit_roundtrip(tmp_vsimem, width):
     with gdal.Open(fname) as ds:
         read = ds.GetRasterBand(1).ReadAsArray().flatten()
     assert np.array_equal(data, read)
+
+
+###############################################################################
+# Test transferring encoded striles from a GeoTIFF source without decoding
+
+
+@pytest.mark.parametrize(
+    "src_compress,dst_compress,expected_mode",
+    [
+        ("DEFLATE", "DEFLATE", "raw"),
+        ("LZW", "LZW", "raw"),
+        pytest.param(
+            "DEFLATE",
+            "ZSTD",
+            "recompressed",
+            marks=pytest.mark.require_creation_option("GTiff", "ZSTD"),
+        ),
+        pytest.param(
+            "ZSTD",
+            "DEFLATE",
+            "recompressed",
+            marks=pytest.mark.require_creation_option("GTiff", "ZSTD"),
+        ),
+        ("DEFLATE", "LZW", None),
+    ],
+)
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+@pytest.mark.parametrize("copy_src_overviews", [True, False])
+def test_tiff_write_raw_strile_copy(
+    tmp_vsimem,
+    src_compress,
+    dst_compress,
+    expected_mode,
+    interleave,
+    copy_src_overviews,
+):
+
+    src_filename = tmp_vsimem / "src.tif"
+    src_ds = gdal.Translate(
+        src_filename,
+        "data/rgbsmall.tif",
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=" + src_compress,
+            "PREDICTOR=2",
+            "INTERLEAVE=" + interleave,
+        ],
+    )
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    src_ds.GetRasterBand(1).GetMaskBand().Fill(255)
+    src_ds.BuildOverviews("NEAR", [2])
+    src_ds = None
+
+    src_ds = gdal.Open(src_filename)
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+    expected_ovr_cs = [
+        src_ds.GetRasterBand(i + 1).GetOverview(0).Checksum() for i in range(3)
+    ]
+
+    msgs = []
+
+    def handler(lvl, no, msg):
+        if "striles from" in msg:
+            msgs.append(msg)
+
+    options = [
+        "TILED=YES",
+        "BLOCKXSIZE=16",
+        "BLOCKYSIZE=16",
+        "COMPRESS=" + dst_compress,
+        "PREDICTOR=2",
+        "INTERLEAVE=" + interleave,
+    ]
+    if copy_src_overviews:
+        options.append("COPY_SRC_OVERVIEWS=YES")
+    dst_filename = tmp_vsimem / "dst.tif"
+    with gdal.config_option("CPL_DEBUG", "GTiff"), gdaltest.error_handler(handler):
+        gdal.GetDriverByName("GTiff").CreateCopy(dst_filename, src_ds, options=options)
+
+    if expected_mode:
+        assert msgs
+        assert msgs[0].startswith(f"Copying {expected_mode} striles from")
+    else:
+        assert not msgs
+
+    with gdal.Open(dst_filename) as ds:
+        assert ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE") == dst_compress
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+        assert ds.GetRasterBand(1).GetMaskFlags() == gdal.GMF_PER_DATASET
+        if copy_src_overviews:
+            assert [
+                ds.GetRasterBand(i + 1).GetOverview(0).Checksum() for i in range(3)
+            ] == expected_ovr_cs
+
+
+###############################################################################
+# Test that GTIFF_RAW_STRILE_COPY=NO disables the raw strile copy
+
+
+def test_tiff_write_raw_strile_copy_disabled(tmp_vsimem):
+
+    src_filename = tmp_vsimem / "src.tif"
+    gdal.Translate(
+        src_filename,
+        "data/byte.tif",
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=LZW"],
+    )
+
+    msgs = []
+
+    def handler(lvl, no, msg):
+        if "striles from" in msg:
+            msgs.append(msg)
+
+    with gdal.config_options(
+        {"CPL_DEBUG": "GTiff", "GTIFF_RAW_STRILE_COPY": "NO"}
+    ), gdaltest.error_handler(handler):
+        gdal.Translate(
+            tmp_vsimem / "dst.tif",
+            src_filename,
+            creationOptions=[
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+                "COMPRESS=LZW",
+            ],
+        )
+    assert not msgs
+
+    with gdal.Open(tmp_vsimem / "dst.tif") as ds:
+        assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test that missing striles of a sparse source are not written by the raw
+# strile copy when SPARSE_OK=YES
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_tiff_write_raw_strile_copy_sparse(tmp_vsimem, interleave):
+
+    src_filename = tmp_vsimem / "src.tif"
+    with gdal.GetDriverByName("GTiff").Create(
+        src_filename,
+        32,
+        32,
+        2,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=LZW",
+            "SPARSE_OK=YES",
+            "INTERLEAVE=" + interleave,
+        ],
+    ) as ds:
+        ds.GetRasterBand(1).WriteRaster(16, 16, 16, 16, b"\x01" * (16 * 16))
+        ds.GetRasterBand(2).WriteRaster(16, 16, 16, 16, b"\x02" * (16 * 16))
+
+    dst_filename = tmp_vsimem / "dst.tif"
+    with gdal.Open(src_filename) as src_ds:
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            dst_filename,
+            src_ds,
+            options=[
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+                "COMPRESS=LZW",
+                "SPARSE_OK=YES",
+                "INTERLEAVE=" + interleave,
+            ],
+        )
+
+    with gdal.Open(dst_filename) as ds:
+        for i in range(2):
+            band = ds.GetRasterBand(i + 1)
+            assert band.GetMetadataItem("BLOCK_OFFSET_0_0", "TIFF") is None
+            assert band.GetMetadataItem("BLOCK_OFFSET_1_0", "TIFF") is None
+            assert band.GetMetadataItem("BLOCK_OFFSET_0_1", "TIFF") is None
+            assert band.GetMetadataItem("BLOCK_OFFSET_1_1", "TIFF") is not None
+            assert band.ReadRaster(0, 0, 16, 16) == b"\x00" * (16 * 16)
+            assert band.ReadRaster(16, 16, 16, 16) == bytes([i + 1]) * (16 * 16)
@@ -733,6 +733,146 @@ def test_vrt_read_20(tmp_path):
     assert "Checksum=4672" in ret
 
 
+###############################################################################
+# Test re-opening of sources evicted from the dataset pool
+
+
+@pytest.mark.parametrize("reopen_hints", ["YES", "NO"])
+def test_vrt_read_dataset_pool_reopen(tmp_path, reopen_hints):
+
+    if test_cli_utilities.get_gdalinfo_path() is None:
+        pytest.skip()
+
+    sources = ""
+    for i in range(4):
+        shutil.copy("data/byte.tif", tmp_path / f"byte{i}.tif")
+        sources += f"""
+    <SimpleSource>
+      <SourceFilename relativeToVRT="1">byte{i}.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SourceProperties RasterXSize="20" RasterYSize="20" DataType="Byte" BlockXSize="20" BlockYSize="20" />
+      <SrcRect xOff="0" yOff="0" xSize="20" ySize="20" />
+      <DstRect xOff="{20 * i}" yOff="0" xSize="20" ySize="20" />
+    </SimpleSource>"""
+    open(tmp_path / "mosaic.vrt", "wt").write(
+        f"""<VRTDataset rasterXSize="80" rasterYSize="20">
+  <VRTRasterBand dataType="Byte" band="1" blockXSize="80" blockYSize="1">{sources}
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+
+    expected_checksum = gdal.Open(tmp_path / "mosaic.vrt").GetRasterBand(1).Checksum()
+
+    # Each line of the VRT requires the 4 sources, whereas the pool can only
+    # keep 2 of them opened.
+    ret, err = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdalinfo_path()
+        + f" -checksum {tmp_path}/mosaic.vrt --config VRT_SHARED_SOURCE 0"
+        + " --config GDAL_MAX_DATASET_POOL_SIZE 2"
+        + f" --config GDAL_DATASET_POOL_REOPEN_HINTS {reopen_hints}"
+        + " --config CPL_DEBUG GDAL"
+    )
+    assert f"Checksum={expected_checksum}" in ret
+
+    # Check that the hints of evicted sources are used when re-opening them
+    if reopen_hints == "YES":
+        assert "GDALDatasetPool: re-opening" in err
+        assert "with driver GTiff" in err
+    else:
+        assert "GDALDatasetPool: re-opening" not in err
+
+
+###############################################################################
+# Test reading a VRT with enough sources to use the spatial index of sources
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_vrt_read_many_sources(tmp_vsimem, num_threads):
+
+    sources = ""
+    for i in range(100):
+        filename = tmp_vsimem / f"tile{i}.tif"
+        with gdal.GetDriverByName("GTiff").Create(filename, 10, 10) as ds:
+            ds.GetRasterBand(1).Fill(i + 1)
+        sources += f"""
+    <SimpleSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="10" ySize="10" />
+      <DstRect xOff="{10 * (i % 10)}" yOff="{10 * (i // 10)}" xSize="10" ySize="10" />
+    </SimpleSource>"""
+    # Last source, overlapping the first ones, must be composited last
+    sources += f"""
+    <ComplexSource>
+      <SourceFilename>{tmp_vsimem / "tile0.tif"}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <ScaleOffset>200</ScaleOffset>
+      <SrcRect xOff="0" yOff="0" xSize="10" ySize="10" />
+      <DstRect xOff="5" yOff="5" xSize="10" ySize="10" />
+    </ComplexSource>"""
+    gdal.FileFromMemBuffer(
+        tmp_vsimem / "mosaic.vrt",
+        f"""<VRTDataset rasterXSize="100" rasterYSize="100">
+  <VRTRasterBand dataType="Byte" band="1" blockXSize="100" blockYSize="100">{sources}
+  </VRTRasterBand>
+</VRTDataset>""",
+    )
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(tmp_vsimem / "mosaic.vrt")
+        band = ds.GetRasterBand(1)
+        for x, y in [(0, 0), (4, 4), (5, 5), (14, 14), (15, 15), (99, 99), (37, 62)]:
+            if 5 <= x < 15 and 5 <= y < 15:
+                expected = 201
+            else:
+                expected = (y // 10) * 10 + (x // 10) + 1
+            assert struct.unpack("B", band.ReadRaster(x, y, 1, 1))[0] == expected
+        # Window straddling 4 tiles
+        data = band.ReadRaster(49, 49, 2, 2)
+        assert struct.unpack("B" * 4, data) == (45, 46, 55, 56)
+        # Downsampled request covering everything
+        assert band.ReadRaster(0, 0, 100, 100, 10, 10) is not None
+        assert band.ComputeRasterMinMax(False) == (1, 201)
+
+
+###############################################################################
+# Test dataset-level reading of a multi-band VRT with enough sources to use
+# the spatial index of sources
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_vrt_read_many_sources_dataset_rasterio(tmp_vsimem, num_threads):
+
+    filenames = []
+    for i in range(100):
+        filename = str(tmp_vsimem / f"tile{i}.tif")
+        with gdal.GetDriverByName("GTiff").Create(filename, 10, 10, 2) as ds:
+            ds.SetGeoTransform([10 * (i % 10), 1, 0, -10 * (i // 10), 0, -1])
+            ds.GetRasterBand(1).Fill(i + 1)
+            ds.GetRasterBand(2).Fill(255 - i)
+        filenames.append(filename)
+    gdal.BuildVRT(tmp_vsimem / "mosaic.vrt", filenames)
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(tmp_vsimem / "mosaic.vrt")
+        # Window straddling 4 tiles
+        data = ds.ReadRaster(49, 49, 2, 2)
+        assert struct.unpack("B" * 8, data) == (
+            45,
+            46,
+            55,
+            56,
+            255 - 44,
+            255 - 45,
+            255 - 54,
+            255 - 55,
+        )
+        assert struct.unpack("B" * 2, ds.ReadRaster(99, 99, 1, 1)) == (100, 156)
+        assert ds.ReadRaster(0, 0, 100, 100) == ds.GetRasterBand(1).ReadRaster(
+            0, 0, 100, 100
+        ) + ds.GetRasterBand(2).ReadRaster(0, 0, 100, 100)
+
+
 ###############################################################################
 # Test implicit virtual overviews
 
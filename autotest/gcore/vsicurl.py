@@ -2163,3 +2163,221 @@ def test_vsicurl_transfer_encoding_chunked(server):
                 )
                 is None
             )
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    cache_dir = tmp_path / "cache"
+    url = "/vsicurl/http://localhost:%d/test_vsicurl_disk_cache.bin" % server.port
+
+    def read_file():
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f is not None
+        try:
+            return gdal.VSIFReadL(1, 6, f).decode("ascii")
+        finally:
+            gdal.VSIFCloseL(f)
+
+    def get_head_handler(etag):
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/", 404)
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_disk_cache.bin",
+            200,
+            {"Content-Length": "6", "ETag": f'"{etag}"'},
+        )
+        return handler
+
+    with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", str(cache_dir)):
+
+        gdal.VSICurlClearCache()
+        handler = get_head_handler("first")
+        handler.add(
+            "GET",
+            "/test_vsicurl_disk_cache.bin",
+            206,
+            {"Content-Range": "bytes 0-5/6", "Content-Length": "6"},
+            "foobar",
+            expected_headers={"Range": "bytes=0-16383"},
+        )
+        with webserver.install_http_handler(handler):
+            assert read_file() == "foobar"
+
+        chunk_files = list(cache_dir.glob("*/*.chunk"))
+        assert len(chunk_files) == 1
+        # The URL, which may contain credentials, must not be stored in clear
+        assert b"test_vsicurl_disk_cache" not in chunk_files[0].read_bytes()
+
+        # Only the in-memory cache is cleared: no GET request must be issued
+        gdal.VSICurlClearCache()
+        with webserver.install_http_handler(get_head_handler("first")):
+            assert read_file() == "foobar"
+
+        # The remote file has changed: the persistent cache must not be used
+        gdal.VSICurlClearCache()
+        handler = get_head_handler("second")
+        handler.add(
+            "GET",
+            "/test_vsicurl_disk_cache.bin",
+            206,
+            {"Content-Range": "bytes 0-5/6", "Content-Length": "6"},
+            "bazbaz",
+            expected_headers={"Range": "bytes=0-16383"},
+        )
+        with webserver.install_http_handler(handler):
+            assert read_file() == "bazbaz"
+
+        assert len(list(cache_dir.glob("*/*.chunk"))) == 2
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that CPL_VSIL_CURL_DISK_CACHE_SIZE evicts the least recently used
+# chunks
+
+
+def test_vsicurl_disk_cache_eviction(server, tmp_path):
+
+    cache_dir = tmp_path / "cache"
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(cache_dir),
+            "CPL_VSIL_CURL_DISK_CACHE_SIZE": "1000",
+        }
+    ):
+        for i in range(4):
+            gdal.VSICurlClearCache()
+            handler = webserver.SequentialHandler()
+            handler.add("GET", "/", 404)
+            handler.add(
+                "HEAD",
+                f"/test_vsicurl_disk_cache_eviction_{i}.bin",
+                200,
+                {"Content-Length": "600", "ETag": '"etag"'},
+            )
+            handler.add(
+                "GET",
+                f"/test_vsicurl_disk_cache_eviction_{i}.bin",
+                206,
+                {"Content-Range": "bytes 0-599/600", "Content-Length": "600"},
+                "x" * 600,
+                expected_headers={"Range": "bytes=0-16383"},
+            )
+            with webserver.install_http_handler(handler):
+                f = gdal.VSIFOpenL(
+                    "/vsicurl/http://localhost:%d/test_vsicurl_disk_cache_eviction_%d.bin"
+                    % (server.port, i),
+                    "rb",
+                )
+                assert f is not None
+                assert gdal.VSIFReadL(1, 600, f) == b"x" * 600
+                gdal.VSIFCloseL(f)
+
+        # Each chunk file occupies more than 600 bytes, so only one fits in
+        # the cache after trimming.
+        assert len(list(cache_dir.glob("*/*.chunk"))) == 1
+        assert not list(cache_dir.glob(".lock"))
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test parallel read-ahead of sequential reads
+
+
+class RangeServingHandler:
+    def __init__(self, path, content):
+        self.path = path
+        self.content = content
+        self.ranges = []
+
+    def final_check(self):
+        pass
+
+    def do_HEAD(self, request):
+        if request.path != self.path:
+            request.send_response(404)
+            request.end_headers()
+            return
+        request.send_response(200)
+        request.send_header("Content-Length", len(self.content))
+        request.end_headers()
+
+    def do_GET(self, request):
+        if request.path != self.path or "Range" not in request.headers:
+            request.send_response(404)
+            request.end_headers()
+            return
+        rng = request.headers["Range"][len("bytes=") :]
+        start = int(rng.split("-")[0])
+        end = min(int(rng.split("-")[1]), len(self.content) - 1)
+        self.ranges.append((start, end))
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end, len(self.content))
+        )
+        request.send_header("Content-Length", end - start + 1)
+        request.send_header("Connection", "close")
+        request.end_headers()
+        request.wfile.write(self.content[start : end + 1])
+
+
+@pytest.mark.parametrize("read_ahead_requests", ["1", "4"])
+def test_vsicurl_read_ahead_requests(server, read_ahead_requests):
+
+    gdal.VSICurlClearCache()
+
+    content = bytes(i % 251 for i in range(2 * 1024 * 1024 + 123))
+    handler = RangeServingHandler("/test_vsicurl_read_ahead.bin", content)
+    with webserver.install_http_handler(handler), gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_READ_AHEAD_REQUESTS": read_ahead_requests,
+        }
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_vsicurl_read_ahead.bin" % server.port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            data = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 100 * 1000, f)
+                data += chunk
+                if len(chunk) < 100 * 1000:
+                    break
+        finally:
+            gdal.VSIFCloseL(f)
+
+    assert data == content
+
+    # Each byte must have been downloaded exactly once
+    ranges = sorted(handler.ranges)
+    assert ranges[0][0] == 0
+    for i in range(1, len(ranges)):
+        assert ranges[i][0] == ranges[i - 1][1] + 1
+    assert ranges[-1][1] == len(content) - 1
+
+    if read_ahead_requests == "1":
+        # Requests are of increasing size
+        assert handler.ranges == ranges
+        assert len(ranges) < 10
+    else:
+        # Sequential reading is detected after the first request, and then
+        # requests are issued in the background by batches of 4 ranges of
+        # the same size, which doubles from one batch to the next one
+        assert len(ranges) >= 10
+        sizes = [end - start + 1 for (start, end) in ranges]
+        assert sizes[1] == sizes[2] == sizes[3] == sizes[4] == sizes[5]
+        assert sizes[6] == sizes[7] == sizes[8] == sizes[9] == 2 * sizes[5]
+
+    gdal.VSICurlClearCache()
@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import os
 import sys
 import time
@@ -919,6 +920,217 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test random access through the index of CPL_VSIL_GZIP_INDEX=YES
+
+
+def _bgzf_block(data):
+    import struct
+    import zlib
+
+    compressor = zlib.compressobj(6, zlib.DEFLATED, -15)
+    compressed = compressor.compress(data) + compressor.flush()
+    block_size = 18 + len(compressed) + 8
+    header = struct.pack(
+        "<BBBBIBBHBBHH", 0x1F, 0x8B, 8, 4, 0, 0, 0xFF, 6, 66, 67, 2, block_size - 1
+    )
+    return header + compressed + struct.pack("<II", zlib.crc32(data), len(data))
+
+
+@pytest.mark.parametrize("layout", ["single_member", "multi_member", "bgzf"])
+def test_vsigzip_index(tmp_path, layout):
+    import gzip
+    import random
+
+    rng = random.Random(0)
+    words = [b"alpha", b"beta", b"gamma", b"delta", b"\n", b"0123456789"]
+    data = b"".join(rng.choice(words) for _ in range(500000))
+
+    filename = str(tmp_path / "test.gz")
+    with open(filename, "wb") as f:
+        if layout == "single_member":
+            f.write(gzip.compress(data))
+        elif layout == "multi_member":
+            for i in range(0, len(data), 300000):
+                f.write(gzip.compress(data[i : i + 300000]))
+        else:
+            for i in range(0, len(data), 65280):
+                f.write(_bgzf_block(data[i : i + 65280]))
+            f.write(_bgzf_block(b""))
+
+    def check_random_reads():
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFSeekL(f, 0, 2) == 0
+            assert gdal.VSIFTellL(f) == len(data)
+            for offset in [len(data) - 10, 12345, 0, len(data) // 2, 1000000]:
+                assert gdal.VSIFSeekL(f, offset, 0) == 0
+                assert gdal.VSIFReadL(1, 1000, f) == data[offset : offset + 1000]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX": "YES", "CPL_VSIL_GZIP_INDEX_SPACING": "64K"}
+    ):
+        check_random_reads()
+        assert os.path.exists(filename + ".gzidx")
+
+        # Reopen with the persisted index
+        check_random_reads()
+
+        # An out-of-date index must be ignored
+        with open(filename + ".gzidx", "r+b") as f:
+            f.seek(12)
+            f.write(b"\xff" * 8)
+        check_random_reads()
+
+
+def test_vsigzip_index_not_gzip(tmp_path):
+
+    filename = str(tmp_path / "test.gz")
+    with open(filename, "wb") as f:
+        f.write(b"not a gzip file")
+
+    with gdal.config_option("CPL_VSIL_GZIP_INDEX", "YES"):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        assert gdal.VSIFSeekL(f, 0, 2) == 0
+        assert gdal.VSIFTellL(f) == 15
+        gdal.VSIFCloseL(f)
+    assert not os.path.exists(filename + ".gzidx")
+
+
+###############################################################################
+# Test multithreaded decompression of sequential reads
+
+
+@pytest.mark.parametrize(
+    "layout", ["single_member", "multi_member", "bgzf", "full_flush"]
+)
+def test_vsigzip_parallel_decoding(tmp_path, layout):
+    import gzip
+    import random
+
+    rng = random.Random(0)
+    words = [b"alpha", b"beta", b"gamma", b"delta", b"\n", b"0123456789"]
+    data = b"".join(rng.choice(words) for _ in range(2000000))
+
+    filename = str(tmp_path / "test.gz")
+    if layout == "full_flush":
+        # Written by the multithreaded writer, with Z_FULL_FLUSH markers
+        # between chunks
+        with gdaltest.config_options(
+            {"GDAL_NUM_THREADS": "4", "CPL_VSIL_DEFLATE_CHUNK_SIZE": "256K"}
+        ):
+            f = gdal.VSIFOpenL("/vsigzip/" + filename, "wb")
+            assert f
+            gdal.VSIFWriteL(data, 1, len(data), f)
+            gdal.VSIFCloseL(f)
+    else:
+        with open(filename, "wb") as f:
+            if layout == "single_member":
+                f.write(gzip.compress(data))
+            elif layout == "multi_member":
+                for i in range(0, len(data), 300000):
+                    f.write(gzip.compress(data[i : i + 300000]))
+            else:
+                for i in range(0, len(data), 65280):
+                    f.write(_bgzf_block(data[i : i + 65280]))
+                f.write(_bgzf_block(b""))
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            chunks = []
+            while True:
+                chunk = gdal.VSIFReadL(1, 100000, f)
+                chunks.append(chunk)
+                if len(chunk) < 100000:
+                    break
+            assert b"".join(chunks) == data
+            assert gdal.VSIFEofL(f)
+
+            # Seek backward in the middle of a sequential read
+            assert gdal.VSIFSeekL(f, 0, 0) == 0
+            assert gdal.VSIFReadL(1, 3000000, f) == data[0:3000000]
+            assert gdal.VSIFReadL(1, 1000, f) == data[3000000:3001000]
+            assert gdal.VSIFSeekL(f, 2000000, 0) == 0
+            assert gdal.VSIFReadL(1, 1000, f) == data[2000000:2001000]
+            assert gdal.VSIFSeekL(f, 100000, 1) == 0
+            assert gdal.VSIFReadL(1, 1000, f) == data[2101000:2102000]
+            assert gdal.VSIFTellL(f) == 2102000
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+def test_vsigzip_parallel_decoding_highly_compressed(tmp_path):
+    import gzip
+    import random
+
+    rng = random.Random(0)
+    words = [b"alpha", b"beta", b"gamma", b"delta", b"\n", b"0123456789"]
+    text = b"".join(rng.choice(words) for _ in range(1000000))
+    # A member compressed with a ratio of about 1000:1 must not be decoded
+    # in memory by the parallel decoder
+    zeros = b"\x00" * (48 * 1024 * 1024)
+    data = text + zeros + text
+
+    filename = str(tmp_path / "test.gz")
+    with open(filename, "wb") as f:
+        for i in range(0, len(text), 300000):
+            f.write(gzip.compress(text[i : i + 300000]))
+        f.write(gzip.compress(zeros))
+        for i in range(0, len(text), 300000):
+            f.write(gzip.compress(text[i : i + 300000]))
+
+    with gdal.config_options({"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ON"}):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            chunks = []
+            with gdaltest.error_raised(gdal.CE_Debug, "Going on with serial decoding"):
+                while True:
+                    chunk = gdal.VSIFReadL(1, 1000000, f)
+                    chunks.append(chunk)
+                    if len(chunk) < 1000000:
+                        break
+            assert b"".join(chunks) == data
+            assert gdal.VSIFEofL(f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+def test_vsigzip_parallel_decoding_crc_error(tmp_path):
+    import gzip
+
+    data = b"".join(b"%08d\n" % i for i in range(1000000))
+    members = [gzip.compress(data[i : i + 300000]) for i in range(0, len(data), 300000)]
+    # Corrupt the CRC of the 5th member
+    members[4] = members[4][0:-8] + b"\x00\x00\x00\x00" + members[4][-4:]
+
+    filename = str(tmp_path / "test.gz")
+    with open(filename, "wb") as f:
+        f.write(b"".join(members))
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            with gdal.quiet_errors():
+                got = b""
+                while True:
+                    chunk = gdal.VSIFReadL(1, 100000, f)
+                    got += chunk
+                    if len(chunk) < 100000:
+                        break
+            assert len(got) < len(data)
+            assert "CRC error" in gdal.GetLastErrorMsg()
+        finally:
+            gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -1964,3 +2176,71 @@ def test_vsifile_buffering_fix_14997(tmp_path):
         assert f.read(4096 + 4096) == buffer[0 : 4096 + 4096]
         f.seek(4096)
         assert f.read(1) == buffer[4096 : 4096 + 1]
+
+
+###############################################################################
+# Test I/O tracing
+
+
+def test_vsifile_trace(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.bin")
+    gdal.FileFromMemBuffer(filename, bytes(range(256)) * 4)
+    tif_filename = str(tmp_vsimem / "byte.tif")
+    gdal.CopyFile("data/byte.tif", tif_filename)
+
+    with gdal.config_option("CPL_VSIL_TRACE", "YES"):
+        gdal.VSITraceReset()
+        try:
+            with gdal.VSIFile(filename, "rb") as f:
+                f.seek(100)
+                assert f.read(10) == bytes(range(100, 110))
+                f.seek(50)
+                assert f.read(10) == bytes(range(50, 60))
+                assert f.read(10) == bytes(range(60, 70))
+
+            with gdal.Open(tif_filename) as ds:
+                assert ds.GetRasterBand(1).Checksum() == 4672
+
+            j = json.loads(gdal.VSITraceGetAsSerializedJSON())
+            chrome_trace = json.loads(
+                gdal.VSITraceGetAsSerializedJSON(["FORMAT=CHROME_TRACE"])
+            )
+            with gdal.quiet_errors():
+                assert gdal.VSITraceGetAsSerializedJSON(["FORMAT=invalid"]) is None
+        finally:
+            gdal.VSITraceReset()
+
+    stats = j["files"][filename]
+    assert stats["open_count"] == 1
+    assert stats["callers"] == ["(unknown)"]
+    assert stats["read"]["count"] == 3
+    assert stats["read"]["read_bytes"] == 30
+    assert sum(x["count"] for x in stats["read"]["latency_histogram"]) == 3
+    assert stats["seeks"]["sequential_count"] == 1
+    assert stats["seeks"]["forward_count"] == 1
+    assert stats["seeks"]["forward_bytes"] == 100
+    assert stats["seeks"]["backward_count"] == 1
+    assert stats["seeks"]["backward_bytes"] == 60
+    assert stats["seeks"]["distance_histogram"] == [
+        {"min_bytes": 0, "max_bytes": 0, "count": 1},
+        {"min_bytes": 32, "max_bytes": 63, "count": 1},
+        {"min_bytes": 64, "max_bytes": 127, "count": 1},
+    ]
+    assert stats["unique_bytes_read"] == 30
+    assert stats["ranges"] == [[50, 70], [100, 110]]
+
+    assert "GTiff" in j["files"][tif_filename]["callers"]
+    assert j["callers"]["GTiff"]["read"]["read_bytes"] > 0
+
+    events = [x for x in chrome_trace["traceEvents"] if x["args"]["file"] == filename]
+    assert [
+        (x["name"], x["args"]["offset"], x["args"]["size"]) for x in events
+    ] == [("Read", 100, 10), ("Read", 50, 10), ("Read", 60, 10)]
+    assert all(x["ph"] == "X" and x["dur"] >= 0 for x in events)
+    assert chrome_trace["otherData"]["dropped_events"] == 0
+
+    # Tracing is disabled by default
+    with gdal.VSIFile(filename, "rb") as f:
+        f.read(1)
+    assert json.loads(gdal.VSITraceGetAsSerializedJSON())["files"] == {}
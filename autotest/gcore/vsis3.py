@@ -3355,6 +3355,125 @@ def test_vsis3_abort_pending_uploads(aws_test_config, webserver_port):
             assert gdal.AbortPendingUploads("/vsis3/my_bucket")
 
 
+###############################################################################
+# Test asynchronous upload of parts with several part buffers
+
+
+def test_vsis3_multipart_upload_buffers(aws_test_config, webserver_port):
+
+    gdal.VSICurlClearCache()
+
+    filename = "/vsis3/s3_fake_bucket4/async_upload.bin"
+
+    # Parts are uploaded by several threads, and thus in any order
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/async_upload.bin?uploads",
+        200,
+        {"Content-type": "application:/xml"},
+        b"""<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    for part_number, content in enumerate([b"foo", b"bar", b"baz", b"!"], 1):
+        handler.add(
+            "PUT",
+            f"/s3_fake_bucket4/async_upload.bin?partNumber={part_number}"
+            "&uploadId=my_id",
+            200,
+            {"ETag": f'"etag_{part_number}"', "Content-Length": "0"},
+            expected_headers={"Content-Length": str(len(content))},
+            expected_body=content,
+        )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/async_upload.bin?uploadId=my_id",
+        200,
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag_1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag_2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag_3"</ETag></Part>
+<Part>
+<PartNumber>4</PartNumber><ETag>"etag_4"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE_BYTES": "3", "CPL_VSIL_MULTIPART_UPLOAD_BUFFERS": "3"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(filename, "wb")
+            assert f
+            assert gdal.VSIFWriteL(b"foobarbaz!", 1, 10, f) == 10
+
+            status = gdal.GetFileMetadata(filename, "UPLOAD_STATUS")
+            assert status["UPLOAD_ID"] == "my_id"
+            assert status["PART_SIZE"] == "3"
+            assert status["PART_BUFFERS"] == "3"
+            assert status["PARTS_SUBMITTED"] == "3"
+            assert status["BYTES_SUBMITTED"] == "9"
+            assert status["ERROR"] == "NO"
+
+            gdal.ErrorReset()
+            assert gdal.VSIFCloseL(f) == 0
+            assert gdal.GetLastErrorMsg() == ""
+
+    assert gdal.GetFileMetadata(filename, "UPLOAD_STATUS") == {}
+
+
+###############################################################################
+# Test failure of an asynchronous upload of a part
+
+
+def test_vsis3_multipart_upload_buffers_error(aws_test_config, webserver_port):
+
+    gdal.VSICurlClearCache()
+
+    # With 2 part buffers, a single thread uploads the parts, in order
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/async_upload_error.bin?uploads",
+        200,
+        {"Content-type": "application:/xml"},
+        b"""<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/async_upload_error.bin?partNumber=1&uploadId=my_id",
+        200,
+        {"ETag": '"etag_1"', "Content-Length": "0"},
+    )
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/async_upload_error.bin?partNumber=2&uploadId=my_id",
+        403,
+    )
+    handler.add("DELETE", "/s3_fake_bucket4/async_upload_error.bin?uploadId=my_id", 204)
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE_BYTES": "3", "CPL_VSIL_MULTIPART_UPLOAD_BUFFERS": "2"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/async_upload_error.bin", "wb")
+            assert f
+            with gdal.quiet_errors():
+                assert gdal.VSIFWriteL(b"foobarbaz!", 1, 10, f) == 0
+            assert "UploadPart(2)" in gdal.GetLastErrorMsg()
+            gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test Mkdir() / Rmdir()
 
@@ -0,0 +1,218 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Test /vsizstd/, and Zstandard compressed entries of /vsizip/ and
+#           /vsitar/
+#
+###############################################################################
+# Copyright (c) 2026, GDAL contributors
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import io
+import random
+import struct
+import tarfile
+import zlib
+
+import gdaltest
+import pytest
+
+from osgeo import gdal
+
+pytestmark = pytest.mark.skipif(
+    "/vsizstd/" not in gdal.GetFileSystemsPrefixes(),
+    reason="/vsizstd/ not available",
+)
+
+
+def _get_data(size):
+    rng = random.Random(0)
+    words = [b"alpha", b"beta", b"gamma", b"delta", b"\n", b"0123456789"]
+    data = b"".join(rng.choice(words) for _ in range(size // 5))
+    return data[0:size]
+
+
+def _compress(data, tmp_vsimem, frame_size="64K"):
+    filename = str(tmp_vsimem / "tmp.zst")
+    with gdaltest.config_option("CPL_VSIL_ZSTD_FRAME_SIZE", frame_size):
+        f = gdal.VSIFOpenL("/vsizstd/" + filename, "wb")
+        assert f
+        assert gdal.VSIFWriteL(data, 1, len(data), f) == len(data)
+        assert gdal.VSIFCloseL(f) == 0
+    compressed = gdal.VSIFile(filename, "rb").read()
+    gdal.Unlink(filename)
+    return compressed
+
+
+###############################################################################
+# Test writing and reading a seekable file
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsizstd_seekable(tmp_vsimem, num_threads):
+
+    data = _get_data(1000000)
+    filename = "/vsizstd/" + str(tmp_vsimem / "test.zst")
+    with gdaltest.config_option("CPL_VSIL_ZSTD_FRAME_SIZE", "64K"):
+        with gdal.VSIFile(filename, "wb") as f:
+            f.write(data)
+
+    # Seek table: skippable frame whose footer ends with the seekable magic
+    compressed = gdal.VSIFile(str(tmp_vsimem / "test.zst"), "rb").read()
+    assert compressed[-4:] == struct.pack("<I", 0x8F92EAB1)
+    assert struct.unpack("<I", compressed[-9:-5])[0] == (len(data) + 65535) // 65536
+
+    assert gdal.VSIStatL(filename).size == len(data)
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        with gdal.VSIFile(filename, "rb") as f:
+            assert f.read() == data
+            for offset in [len(data) - 10, 12345, 0, len(data) // 2, 65535]:
+                f.seek(offset)
+                assert f.read(100000) == data[offset : offset + 100000]
+            f.seek(len(data) + 1)
+            assert f.read(1) == b""
+
+
+###############################################################################
+# Test reading a regular (non seekable) file
+
+
+def test_vsizstd_not_seekable(tmp_vsimem):
+
+    data = _get_data(1000000)
+    compressed = _compress(data, tmp_vsimem)
+    # Strip the seek table
+    table_size = struct.unpack("<I", compressed[-9:-5])[0] * 8 + 9 + 8
+    filename = str(tmp_vsimem / "test.zst")
+    gdal.FileFromMemBuffer(filename, compressed[0:-table_size])
+
+    assert gdal.VSIStatL("/vsizstd/" + filename).size == len(data)
+    with gdal.VSIFile("/vsizstd/" + filename, "rb") as f:
+        f.seek(500000)
+        assert f.read(1000) == data[500000:501000]
+        f.seek(1000)
+        assert f.read(1000) == data[1000:2000]
+        f.seek(0, 2)
+        assert f.tell() == len(data)
+
+    # Truncated file
+    gdal.FileFromMemBuffer(filename, compressed[0:1000])
+    with gdal.VSIFile("/vsizstd/" + filename, "rb") as f:
+        with gdal.quiet_errors():
+            assert len(f.read(len(data))) < len(data)
+
+
+def test_vsizstd_not_zstd(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zst")
+    gdal.FileFromMemBuffer(filename, b"not a zstd file")
+    assert gdal.VSIFOpenL("/vsizstd/" + filename, "rb") is None
+
+
+###############################################################################
+# Test /vsitar/ on a .tar.zst file
+
+
+def test_vsizstd_vsitar(tmp_vsimem):
+
+    data = _get_data(300000)
+    tar_content = io.BytesIO()
+    with tarfile.open(fileobj=tar_content, mode="w") as tar:
+        for name in ("a.txt", "b.txt"):
+            info = tarfile.TarInfo(name)
+            info.size = len(data)
+            tar.addfile(info, io.BytesIO(data))
+
+    filename = str(tmp_vsimem / "test.tar.zst")
+    gdal.FileFromMemBuffer(filename, _compress(tar_content.getvalue(), tmp_vsimem))
+
+    assert set(gdal.ReadDir("/vsitar/" + filename)) == {"a.txt", "b.txt"}
+    assert gdal.VSIStatL("/vsitar/" + filename + "/b.txt").size == len(data)
+    with gdal.VSIFile("/vsitar/" + filename + "/b.txt", "rb") as f:
+        f.seek(123456)
+        assert f.read(1000) == data[123456:124456]
+
+
+###############################################################################
+# Test /vsizip/ on an entry compressed with Zstandard (method 93)
+
+
+def _zip_with_method_93(name, data, compressed):
+    name = name.encode("ascii")
+    crc = zlib.crc32(data)
+    local_header = (
+        struct.pack(
+            "<IHHHHHIIIHH",
+            0x04034B50,
+            63,
+            0,
+            93,
+            0,
+            0,
+            crc,
+            len(compressed),
+            len(data),
+            len(name),
+            0,
+        )
+        + name
+    )
+    central_dir = (
+        struct.pack(
+            "<IHHHHHHIIIHHHHHII",
+            0x02014B50,
+            63,
+            63,
+            0,
+            93,
+            0,
+            0,
+            crc,
+            len(compressed),
+            len(data),
+            len(name),
+            0,
+            0,
+            0,
+            0,
+            0,
+            0,
+        )
+        + name
+    )
+    offset_central_dir = len(local_header) + len(compressed)
+    end_of_central_dir = struct.pack(
+        "<IHHHHIIH", 0x06054B50, 0, 0, 1, 1, len(central_dir), offset_central_dir, 0
+    )
+    return local_header + compressed + central_dir + end_of_central_dir
+
+
+@pytest.mark.parametrize("seekable", [True, False])
+def test_vsizstd_vsizip(tmp_vsimem, seekable):
+
+    data = _get_data(1000000)
+    compressed = _compress(data, tmp_vsimem)
+    if not seekable:
+        table_size = struct.unpack("<I", compressed[-9:-5])[0] * 8 + 9 + 8
+        compressed = compressed[0:-table_size]
+
+    filename = str(tmp_vsimem / "test.zip")
+    gdal.FileFromMemBuffer(filename, _zip_with_method_93("test.bin", data, compressed))
+
+    assert gdal.ReadDir("/vsizip/" + filename) == ["test.bin"]
+    assert gdal.VSIStatL("/vsizip/" + filename + "/test.bin").size == len(data)
+    md = gdal.GetFileMetadata("/vsizip/" + filename + "/test.bin", "ZIP")
+    assert md["COMPRESSION_METHOD"] == "93 (ZSTD)"
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        with gdal.VSIFile("/vsizip/" + filename + "/test.bin", "rb") as f:
+            assert f.read() == data
+            f.seek(654321)
+            assert f.read(1000) == data[654321:655321]
+            f.seek(1000)
+            assert f.read(1000) == data[1000:2000]
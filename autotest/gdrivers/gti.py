@@ -3098,6 +3098,72 @@ def test_gti_read_multi_threaded_disabled_since_overlapping_sources(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test background opening of the sources of the next window of a sequential
+# scan
+
+
+@pytest.mark.parametrize("prefetch", ["YES", "NO"])
+def test_gti_read_sequential_prefetch(tmp_vsimem, prefetch):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world.tif")
+    tiles_ds = []
+    for i in range(4):
+        tile_filename = str(tmp_vsimem / ("%d.tif" % i))
+        gdal.Translate(tile_filename, src_ds, srcWin=[i * 100, 0, 100, 200])
+        tiles_ds.append(gdal.Open(tile_filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles_ds)
+    del index_ds
+
+    with gdal.config_options({"GTI_PREFETCH": prefetch, "GTI_NUM_THREADS": "2"}):
+        vrt_ds = gdal.Open(index_filename)
+
+        # Left-to-right scan by chunks of 50 columns
+        prefetched_counts = []
+        for x in range(0, 400, 50):
+            assert vrt_ds.ReadRaster(x, 0, 50, 200) == src_ds.ReadRaster(
+                x, 0, 50, 200
+            )
+            prefetched_counts.append(
+                int(
+                    vrt_ds.GetMetadataItem(
+                        "LAST_PREFETCHED_SOURCE_COUNT", "__DEBUG__"
+                    )
+                )
+            )
+        # The first request cannot be predicted, and the last one has
+        # no next window
+        assert prefetched_counts[0] == 0
+        assert prefetched_counts[-1] == 0
+        if prefetch == "YES":
+            assert prefetched_counts[1:-1] == [1] * 6
+        else:
+            assert prefetched_counts == [0] * 8
+
+        # Top-to-bottom scan by chunks of 30 lines, with a last partial chunk
+        vrt_ds.FlushCache()
+        for y in range(0, 200, 30):
+            ysize = min(30, 200 - y)
+            assert vrt_ds.ReadRaster(0, y, 400, ysize) == src_ds.ReadRaster(
+                0, y, 400, ysize
+            )
+            if y == 30:
+                assert vrt_ds.GetMetadataItem(
+                    "LAST_PREFETCHED_SOURCE_COUNT", "__DEBUG__"
+                ) == ("4" if prefetch == "YES" else "0")
+
+        # Non-sequential request
+        assert vrt_ds.ReadRaster(10, 20, 30, 40) == src_ds.ReadRaster(10, 20, 30, 40)
+        assert (
+            vrt_ds.GetMetadataItem("LAST_PREFETCHED_SOURCE_COUNT", "__DEBUG__")
+            == "0"
+        )
+
+        assert vrt_ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+
+
 ###############################################################################
 # Test multi-threaded reading
 
@@ -3757,3 +3823,161 @@ def test_gti_band_count_adjustment(tmp_vsimem, tile_band_count, gti_band_count):
             assert ds.GetRasterBand(3).ReadRaster() == b"\x01"
         if tile_band_count == 4:
             assert ds.GetRasterBand(4).ReadRaster() == expected_alpha
+
+
+###############################################################################
+# Test converting a VRT mosaic to a GTI index
+
+
+def test_gti_create_copy_from_vrt(tmp_path):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world.tif")
+    tile_filenames = []
+    for j in range(2):
+        for i in range(4):
+            tile_filename = str(tmp_path / f"tile_{i}_{j}.tif")
+            gdal.Translate(
+                tile_filename, src_ds, srcWin=[i * 100, j * 100, 100, 100]
+            )
+            tile_filenames.append(tile_filename)
+
+    vrt_filename = str(tmp_path / "mosaic.vrt")
+    vrt_ds = gdal.BuildVRT(vrt_filename, tile_filenames)
+    vrt_ds.GetRasterBand(1).SetOffset(1.5)
+    vrt_ds.SetMetadataItem("FOO", "BAR")
+    vrt_ds.Close()
+
+    gti_filename = str(tmp_path / "mosaic.gti.gpkg")
+    ds = gdal.Translate(gti_filename, vrt_filename, format="GTI")
+    assert ds.GetDriver().ShortName == "GTI"
+    assert ds.RasterXSize == 400
+    assert ds.RasterYSize == 200
+    assert ds.RasterCount == 3
+    assert ds.GetGeoTransform() == pytest.approx(src_ds.GetGeoTransform())
+    assert ds.GetSpatialRef().IsSame(src_ds.GetSpatialRef())
+    assert ds.GetRasterBand(1).GetOffset() == 1.5
+    assert ds.GetMetadataItem("FOO") == "BAR"
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    ds.Close()
+
+    # Locations are relative to the index, as in the VRT
+    index_ds = ogr.Open(gti_filename)
+    lyr = index_ds.GetLayer(0)
+    assert lyr.GetName() == "mosaic"
+    assert lyr.GetFeatureCount() == 8
+    f = lyr.GetNextFeature()
+    assert f["location"] == "tile_0_0.tif"
+    index_ds.Close()
+
+
+def test_gti_create_copy_from_vrt_unsupported(tmp_vsimem):
+
+    src_ds = gdal.Open("../gdrivers/data/byte.tif")
+
+    with pytest.raises(Exception, match="only supports copying VRT datasets"):
+        gdal.Translate(str(tmp_vsimem / "out.gti.gpkg"), src_ds, format="GTI")
+
+    vrt_ds = gdal.Translate(
+        "", "../gdrivers/data/byte.tif", format="VRT", scaleParams=[[0, 255, 0, 1]]
+    )
+    with pytest.raises(Exception, match="cannot be represented in a tile index"):
+        gdal.Translate(str(tmp_vsimem / "out.gti.gpkg"), vrt_ds, format="GTI")
+
+
+@pytest.mark.parametrize(
+    "source,error_msg",
+    [
+        (
+            """<ComplexSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <NODATA>0</NODATA>
+    </ComplexSource>""",
+            "does not use the nodata value or mask of its band",
+        ),
+        (
+            """<ComplexSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <UseMaskBand>true</UseMaskBand>
+    </ComplexSource>""",
+            "does not use the nodata value or mask of its band",
+        ),
+        (
+            """<SimpleSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="10" ySize="10" />
+      <DstRect xOff="0" yOff="0" xSize="10" ySize="10" />
+    </SimpleSource>""",
+            "does not use the full extent of its dataset at full resolution",
+        ),
+        (
+            """<SimpleSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="20" ySize="20" />
+      <DstRect xOff="0" yOff="0" xSize="10" ySize="10" />
+    </SimpleSource>""",
+            "does not use the full extent of its dataset at full resolution",
+        ),
+    ],
+    ids=["nodata", "use_mask_band", "partial_src_rect", "resampled"],
+)
+def test_gti_create_copy_from_vrt_unsupported_source(tmp_vsimem, source, error_msg):
+
+    filename = os.path.join(os.getcwd(), "..", "gdrivers", "data", "byte.tif")
+    vrt_ds = gdal.Open(f"""<VRTDataset rasterXSize="20" rasterYSize="20">
+  <GeoTransform>440720,60,0,3751320,0,-60</GeoTransform>
+  <VRTRasterBand dataType="Byte" band="1">
+    {source.format(filename=filename)}
+  </VRTRasterBand>
+</VRTDataset>""")
+    with pytest.raises(Exception, match=error_msg):
+        gdal.Translate(str(tmp_vsimem / "out.gti.gpkg"), vrt_ds, format="GTI")
+
+
+###############################################################################
+# Test converting a VRT mosaic whose sources have a nodata value
+
+
+def test_gti_create_copy_from_vrt_sources_with_nodata(tmp_vsimem):
+
+    tile_filenames = []
+    for i in range(2):
+        tile_filename = str(tmp_vsimem / f"tile_{i}.tif")
+        with gdal.GetDriverByName("GTiff").Create(tile_filename, 10, 10) as ds:
+            ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+            ds.GetRasterBand(1).SetNoDataValue(0)
+            ds.GetRasterBand(1).WriteRaster(0, 0, 5, 10, b"\x01" * 50)
+        tile_filenames.append(tile_filename)
+
+    # gdalbuildvrt uses ComplexSource with the NODATA of the source bands
+    vrt_ds = gdal.BuildVRT("", tile_filenames)
+    ds = gdal.Translate(str(tmp_vsimem / "ok.gti.gpkg"), vrt_ds, format="GTI")
+    assert ds.ReadRaster() == vrt_ds.ReadRaster()
+    ds.Close()
+
+    # NODATA different from the one of the source band
+    vrt_ds = gdal.BuildVRT("", tile_filenames, srcNodata=1)
+    with pytest.raises(
+        Exception, match="does not use the nodata value or mask of its band"
+    ):
+        gdal.Translate(str(tmp_vsimem / "ko1.gti.gpkg"), vrt_ds, format="GTI")
+
+    # SimpleSource ignores the nodata value of the source band
+    vrt_ds = gdal.Open(f"""<VRTDataset rasterXSize="10" rasterYSize="10">
+  <GeoTransform>0,1,0,0,0,-1</GeoTransform>
+  <VRTRasterBand dataType="Byte" band="1">
+    <SimpleSource>
+      <SourceFilename>{tile_filenames[0]}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="10" ySize="10" />
+      <DstRect xOff="0" yOff="0" xSize="10" ySize="10" />
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>""")
+    with pytest.raises(
+        Exception, match="does not use the nodata value or mask of its band"
+    ):
+        gdal.Translate(str(tmp_vsimem / "ko2.gti.gpkg"), vrt_ds, format="GTI")
@@ -1337,6 +1337,140 @@ def test_vrt_pixelfn_expression_coordinates_no_geotransform():
         gdal.Open(xml).ReadRaster()
 
 
+###############################################################################
+# Test that the vectorized evaluator gives the same results as the
+# expression libraries
+
+
+@pytest.mark.parametrize(
+    "expression,dialects",
+    [
+        ("(B1 - B2) / (B1 + B2)", ("exprtk", "muparser")),
+        ("sqrt(abs(B1 - 100)) * 2^-B2 + min(B1, B2)", ("exprtk", "muparser")),
+        ("(B1 > 110) * B2 + (B1 <= 110) * -B1", ("exprtk", "muparser")),
+        (
+            "B1 != 107 && B2 < 120 ? log10(B1) : fmod(B2, 7) * _pi",
+            ("muparser",),
+        ),
+        ("isnodata(B2) ? -1 : max(B1, B2, 115)", ("muparser",)),
+        ("1.7*_CENTER_X_ + _CENTER_Y_ + B1", ("muparser",)),
+    ],
+)
+@pytest.mark.parametrize("propagate_nodata", (False, True))
+def test_vrt_pixelfn_expression_vectorized(expression, dialects, propagate_nodata):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    escaped_expression = (
+        expression.replace("&", "&amp;").replace("<", "&lt;").replace(">", "&gt;")
+    )
+
+    for dialect in dialects:
+        if not gdaltest.gdal_has_vrt_expression_dialect(dialect):
+            continue
+
+        xml = f"""
+        <VRTDataset rasterXSize="20" rasterYSize="20">
+          <GeoTransform>440720, 60, 0, 3751320, 0, -60</GeoTransform>
+          <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+            <NoDataValue>107</NoDataValue>
+            <PixelFunctionType>expression</PixelFunctionType>
+            <PixelFunctionArguments expression="{escaped_expression}"
+                                    dialect="{dialect}"
+                                    propagateNoData="{propagate_nodata}"/>
+            <SimpleSource>
+               <SourceFilename>data/byte.tif</SourceFilename>
+               <SourceBand>1</SourceBand>
+            </SimpleSource>
+            <ComplexSource>
+               <SourceFilename>data/byte.tif</SourceFilename>
+               <SourceBand>1</SourceBand>
+               <SrcRect xOff="1" yOff="0" xSize="19" ySize="20"/>
+               <DstRect xOff="0" yOff="0" xSize="19" ySize="20"/>
+            </ComplexSource>
+          </VRTRasterBand>
+        </VRTDataset>"""
+
+        with gdal.config_option("VRT_VECTORIZED_EXPRESSION", "NO"):
+            expected = gdal.Open(xml).ReadAsArray()
+
+        messages = []
+
+        def handler(eErrClass, err_no, msg):
+            messages.append(msg)
+
+        with gdaltest.error_handler(handler), gdal.config_option("CPL_DEBUG", "VRT"):
+            got = gdal.Open(xml).ReadAsArray()
+        assert not [m for m in messages if "vectorized evaluator" in m]
+
+        np.testing.assert_array_equal(got, expected)
+
+
+###############################################################################
+# Test that multi-threaded evaluation of large requests gives the same result
+# as single-threaded evaluation
+
+
+@pytest.mark.parametrize(
+    "pixelfn,args",
+    [
+        ("sum", ""),
+        ("norm_diff", ""),
+        ("expression", 'expression="B1 * 2 - B2 + _CENTER_Y_" dialect="muparser"'),
+    ],
+)
+def test_vrt_derived_multithreaded(tmp_vsimem, pixelfn, args):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    if pixelfn == "expression" and not gdaltest.gdal_has_vrt_expression_dialect(
+        "muparser"
+    ):
+        pytest.skip("muparser not available")
+
+    width = 1000
+    height = 1100
+    for i in range(2):
+        with gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / f"src{i}.tif", width, height, options=["TILED=YES"]
+        ) as ds:
+            ds.GetRasterBand(1).WriteArray(
+                (np.arange(width * height) * (i + 3) % 251)
+                .astype(np.uint8)
+                .reshape(height, width)
+            )
+
+    xml = f"""
+    <VRTDataset rasterXSize="{width}" rasterYSize="{height}">
+      <GeoTransform>440720, 60, 0, 3751320, 0, -60</GeoTransform>
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <PixelFunctionType>{pixelfn}</PixelFunctionType>
+        <PixelFunctionArguments {args} />
+        <SimpleSource>
+          <SourceFilename>{tmp_vsimem / "src0.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <SimpleSource>
+          <SourceFilename>{tmp_vsimem / "src1.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdal.config_option("VRT_NUM_THREADS", "1"):
+        expected = gdal.Open(xml).ReadAsArray()
+
+    with gdal.config_option("VRT_NUM_THREADS", "4"):
+        ds = gdal.Open(xml)
+        np.testing.assert_array_equal(ds.ReadAsArray(), expected)
+        # Window not starting at the first line
+        np.testing.assert_array_equal(
+            ds.ReadAsArray(3, 50, width - 3, height - 50), expected[50:, 3:]
+        )
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
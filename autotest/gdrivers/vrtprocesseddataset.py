@@ -1480,6 +1480,69 @@ def test_vrtprocesseddataset_expression_batchsize(tmp_vsimem, batch_size):
     np.testing.assert_equal(actual, expected)
 
 
+###############################################################################
+# Test that consecutive pixel-wise steps give the same result when evaluated
+# together or one after the other
+
+
+@pytest.mark.parametrize("with_expression", [False, True])
+def test_vrtprocesseddataset_fused_steps(tmp_vsimem, with_expression):
+
+    if with_expression and not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("muparser not available")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    with gdal.GetDriverByName("GTiff").Create(src_filename, 301, 203, 4) as src_ds:
+        src_ds.WriteArray(
+            (np.arange(4 * 203 * 301) % 253).astype(np.uint8).reshape(4, 203, 301)
+        )
+        for i in range(4):
+            src_ds.GetRasterBand(i + 1).SetNoDataValue(7)
+
+    expression_step = (
+        """
+        <Step>
+            <Algorithm>Expression</Algorithm>
+            <Argument name="expression">B1 * 0.5 + B2 - B3</Argument>
+        </Step>"""
+        if with_expression
+        else ""
+    )
+
+    vrt_xml = f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">0,1,0.1,0.2,0.3</Argument>
+            <Argument name="coefficients_2">1,0,1,0.4,-0.1</Argument>
+            <Argument name="coefficients_3">2,0,0,1,0.5</Argument>
+            <Argument name="max">255</Argument>
+        </Step>
+        <Step>
+            <Algorithm>LUT</Algorithm>
+            <Argument name="lut_1">0:0,100:200,255:255</Argument>
+            <Argument name="lut_2">0:255,255:0</Argument>
+            <Argument name="lut_3">0:10,255:20</Argument>
+        </Step>{expression_step}
+    </ProcessingSteps>
+    <OutputBands count="FROM_LAST_STEP" dataType="Float64" />
+    </VRTDataset>
+        """
+
+    with gdal.config_option("VRT_PROCESSED_DATASET_FUSE_STEPS", "NO"):
+        with gdal.Open(vrt_xml) as ds:
+            expected = ds.ReadAsArray()
+
+    with gdal.Open(vrt_xml) as ds:
+        np.testing.assert_equal(ds.ReadAsArray(), expected)
+        np.testing.assert_equal(
+            ds.ReadAsArray(5, 10, 200, 100), expected[..., 10:110, 5:205]
+        )
+
+
 ###############################################################################
 # Test that serialization (for example due to statistics computation) properly
 # works
@@ -1148,6 +1148,107 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that attribute filters evaluated directly on Arrow arrays give the same
+# result as the per-feature evaluation
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "int32 = 3",
+        "int32 <> 3",
+        "int32 > 2 AND int32 <= 5",
+        "int32 BETWEEN 2 AND 4",
+        "int32 IN (1, 3)",
+        "int32 IN (1, NULL)",
+        "int32 NOT IN (1, 3)",
+        "int32 IS NULL",
+        "int32 IS NOT NULL OR str = 'b'",
+        "NOT (int32 = 3)",
+        "int32 = 2.5",
+        "int32 + int64 > 10",
+        "int32 * 2 = int64",
+        "int32 / 0 = 2147483647",
+        "int32 % 2 = 1",
+        "int16 < -100",
+        "int64 = 30000000000",
+        "float64 > 1.5",
+        "float64 + int32 < 5",
+        "float64 / 0 > 1",
+        "float32 >= 1.5",
+        "str = 'B'",
+        "str <> 'b'",
+        "str > 'a'",
+        "str IN ('a', 'C')",
+        "str BETWEEN 'B' AND 'c'",
+        "str LIKE 'b%'",
+        "str ILIKE 'B%'",
+        "str LIKE 'a#_%' ESCAPE '#'",
+        "bool = 1",
+        "FID > 2",
+        "FID = 3 OR int32 = 1",
+        # Partially evaluated per feature
+        "int32 > 1 AND datetime IS NULL",
+        "int32 > 1 AND str || 'x' = 'bx'",
+    ],
+)
+def test_ogr_flatgeobuf_arrow_stream_columnar_attribute_filter(tmp_vsimem, filter):
+    gdaltest.importorskip_gdal_array()
+    numpy = pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    field = ogr.FieldDefn("int16", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    field = ogr.FieldDefn("float32", ogr.OFTReal)
+    field.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+
+    values = [
+        ("a", 1, -1, 1, 2, 1.0, 1.0, None),
+        ("a_b", 0, -200, 2, 4, 1.5, 1.5, "2022-05-31T12:34:56Z"),
+        ("B", 1, None, 3, 30000000000, 2.5, 2.5, None),
+        ("b", None, 300, 4, 8, None, None, None),
+        ("c", 0, -150, 5, 100, 0.5, 0.5, None),
+        (None, 1, 12, None, 6, 3.0, 3.0, None),
+        ("abc", 0, 0, 3, None, -1.0, -1.0, None),
+    ]
+    for i, row in enumerate(values):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for j, val in enumerate(row):
+            if val is None:
+                f.SetFieldNull(j)
+            else:
+                f.SetField(j, val)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} 0)"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(filter)
+    expected_fids = [f.GetFID() for f in lyr]
+
+    for columnar in ("YES", "NO"):
+        with gdal.config_option("OGR_ARROW_COLUMNAR_FILTER", columnar):
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            fids = [
+                fid for batch in stream for fid in numpy.array(batch["OGC_FID"])
+            ]
+        assert fids == expected_fids, (filter, columnar)
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -11551,3 +11551,58 @@ def test_ogr_gpkg_spatialite_after_create(tmp_vsimem):
     with ds.ExecuteSQL("SELECT ST_Buffer(geom, 1) FROM test") as sql_lyr:
         f = sql_lyr.GetNextFeature()
         assert f.GetGeometryRef() is not None
+
+
+###############################################################################
+# Test that ogr2ogr passes GeoPackage geometries through as WKB
+
+
+def test_ogr_gpkg_ogr2ogr_wkb_pass_through(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.gpkg")
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(src_filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+    wkts = [
+        "POINT (1 2)",
+        "POINT Z (1 2 3)",
+        "POINT EMPTY",
+        "LINESTRING (1 2,3 4)",
+        "POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1))",
+        "MULTIPOLYGON (((10 10,10 11,11 11,10 10)))",
+        "LINESTRING M (1 2 3,4 5 6)",
+        "GEOMETRYCOLLECTION (POINT (-1 -2))",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        None,
+    ]
+    for wkt in wkts:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    ds = None
+
+    dst_filename = str(tmp_vsimem / "dst.gpkg")
+    # Use the feature based code path
+    with gdal.config_option("OGR2OGR_USE_ARROW_API", "NO"):
+        gdal.VectorTranslate(dst_filename, src_filename)
+
+    src_ds = ogr.Open(src_filename)
+    dst_ds = ogr.Open(dst_filename)
+    src_lyr = src_ds.GetLayer(0)
+    dst_lyr = dst_ds.GetLayer(0)
+    assert dst_lyr.GetExtent() == src_lyr.GetExtent()
+    for f_src, f_dst in zip(src_lyr, dst_lyr):
+        ogrtest.check_feature_geometry(f_dst, f_src.GetGeometryRef())
+
+    # Blobs written from WKB must be identical to the ones written from
+    # geometry objects
+    sql = "SELECT fid, hex(geom) FROM test ORDER BY fid"
+    with src_ds.ExecuteSQL(sql) as src_sql_lyr, dst_ds.ExecuteSQL(
+        sql
+    ) as dst_sql_lyr:
+        for f_src, f_dst in zip(src_sql_lyr, dst_sql_lyr):
+            assert f_dst.GetField(1) == f_src.GetField(1), f_src.GetFID()
+
+    # Check the spatial index
+    dst_lyr.SetSpatialFilterRect(9.5, 9.5, 10.5, 10.5)
+    assert [f.GetFID() for f in dst_lyr] == [6]
@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,186 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that the hash and merge join strategies return the same results as the
+# nested loop
+
+
+@pytest.mark.parametrize(
+    "strategy,max_memory,expected_strategy",
+    [
+        ("HASH", None, "hash join"),
+        ("HASH", "1", "hash join"),
+        ("MERGE", None, "merge join"),
+        ("AUTO", None, "hash join"),
+        ("AUTO", "1", "merge join"),
+    ],
+)
+def test_ogr_join_strategy(strategy, max_memory, expected_strategy):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+
+    def create_layer(name, fields, rows):
+        lyr = ds.CreateLayer(name, geom_type=ogr.wkbNone)
+        for field_name, field_type in fields:
+            lyr.CreateField(ogr.FieldDefn(field_name, field_type))
+        for row in rows:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            for i, val in enumerate(row):
+                if val is None:
+                    f.SetFieldNull(i)
+                else:
+                    f.SetField(i, val)
+            lyr.CreateFeature(f)
+
+    key_fields = [
+        ("int_key", ogr.OFTInteger),
+        ("int64_key", ogr.OFTInteger64),
+        ("real_key", ogr.OFTReal),
+        ("str_key", ogr.OFTString),
+    ]
+
+    # Sorted on all keys
+    secondary_rows = [
+        (0, 0, 0.0, "2022/01/01 12:34:56", "s0"),
+        (1, 1, 1.0, "a", "s1"),
+        (2, 2, 2.0, "B", "s2"),
+        (2, 2, 2.0, "b", "s2bis"),
+        (None, None, None, None, "snull"),
+        (4, 5000000000, 4.5, "c", "s4"),
+        (6, 6000000000, 6.0, "d", "s6"),
+    ]
+    create_layer("s", key_fields + [("val", ogr.OFTString)], secondary_rows)
+    create_layer(
+        "s_unsorted",
+        key_fields + [("val", ogr.OFTString)],
+        list(reversed(secondary_rows)),
+    )
+    create_layer(
+        "p",
+        [("id", ogr.OFTInteger)] + key_fields,
+        [
+            (1, 0, 0, -0.0, "2022/01/01 12:34:56+00"),
+            (2, 1, 1, 1.0, "A"),
+            (3, 2, 2, 2.0, "b"),
+            (4, None, None, None, None),
+            (5, 3, 3, 3.0, "bb"),
+            (6, 4, 5000000000, 4.5, "C"),
+            (7, 4, 5000000000, 4.5, "c"),
+            (8, 7, 7, 7.0, "zz"),
+        ],
+    )
+
+    def run(sql):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            return [(f["id"], f["val"]) for f in sql_lyr]
+
+    queries = []
+    for secondary in ("s", "s_unsorted"):
+        for primary_key, secondary_key in [
+            ("int_key", "int_key"),
+            ("int64_key", "int64_key"),
+            ("real_key", "real_key"),
+            ("int_key", "real_key"),
+            ("str_key", "str_key"),
+        ]:
+            on = f"p.{primary_key} = {secondary}.{secondary_key}"
+            queries.append(f"SELECT id, val FROM p LEFT JOIN {secondary} ON {on}")
+            queries.append(
+                f"SELECT id, val FROM p LEFT JOIN {secondary} ON {on} "
+                "ORDER BY id DESC"
+            )
+
+    with gdal.config_option("OGR_SQL_JOIN_STRATEGY", "NESTED_LOOP"):
+        expected = [run(sql) for sql in queries]
+    assert expected[0] == [
+        (1, "s0"),
+        (2, "s1"),
+        (3, "s2"),
+        (4, None),
+        (5, None),
+        (6, "s4"),
+        (7, "s4"),
+        (8, None),
+    ]
+    assert expected[8] == [
+        (1, "s0"),
+        (2, "s1"),
+        (3, "s2"),
+        (4, None),
+        (5, None),
+        (6, "s4"),
+        (7, "s4"),
+        (8, None),
+    ]
+
+    debug_msgs = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug and msg.startswith("GenSQL: JOIN ON"):
+            debug_msgs.append(msg)
+
+    options = {"OGR_SQL_JOIN_STRATEGY": strategy, "CPL_DEBUG": "ON"}
+    if max_memory:
+        options["OGR_SQL_JOIN_MAX_MEMORY"] = max_memory
+    with gdal.config_options(options), gdaltest.error_handler(my_handler):
+        got = [run(sql) for sql in queries]
+        assert got == expected
+
+        debug_msgs.clear()
+        run(queries[0])
+        assert expected_strategy in debug_msgs[-1]
+
+
+###############################################################################
+# Test that the hash and merge join strategies compare keys as the attribute
+# filter of a GeoPackage secondary table does: case sensitive strings, and
+# exact comparison of Integer64 and Real values
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("strategy", ["HASH", "MERGE", "AUTO"])
+def test_ogr_join_strategy_gpkg(tmp_vsimem, strategy):
+
+    filename = str(tmp_vsimem / "test_ogr_join_strategy_gpkg.gpkg")
+    with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+        for name, rows in [
+            ("s", [("a", 2**53, "s0"), ("B", 2**53 + 2, "s1")]),
+            ("p", [("A", 2**53 + 1, "p0"), ("a", 2**53, "p1"), ("B", 0, "p2")]),
+        ]:
+            lyr = ds.CreateLayer(name, geom_type=ogr.wkbNone)
+            lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+            if name == "s":
+                lyr.CreateField(ogr.FieldDefn("num_key", ogr.OFTReal))
+            else:
+                lyr.CreateField(ogr.FieldDefn("num_key", ogr.OFTInteger64))
+            lyr.CreateField(ogr.FieldDefn(name + "val", ogr.OFTString))
+            for row in rows:
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f.SetField("str_key", row[0])
+                f.SetField("num_key", row[1])
+                f.SetField(name + "val", row[2])
+                lyr.CreateFeature(f)
+
+    queries = [
+        "SELECT pval, sval FROM p LEFT JOIN s ON p.str_key = s.str_key",
+        "SELECT pval, sval FROM p LEFT JOIN s ON p.num_key = s.num_key",
+    ]
+
+    def run(sql):
+        with ds.ExecuteSQL(sql, dialect="OGRSQL") as sql_lyr:
+            return [(f["pval"], f["sval"]) for f in sql_lyr]
+
+    with ogr.Open(filename) as ds:
+        with gdal.config_option("OGR_SQL_JOIN_STRATEGY", "NESTED_LOOP"):
+            expected = [run(sql) for sql in queries]
+        assert expected == [
+            [("p0", None), ("p1", "s0"), ("p2", "s1")],
+            [("p0", None), ("p1", "s0"), ("p2", None)],
+        ]
+
+        with gdal.config_option("OGR_SQL_JOIN_STRATEGY", strategy):
+            got = [run(sql) for sql in queries]
+        assert got == expected
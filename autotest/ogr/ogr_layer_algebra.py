@@ -593,3 +593,83 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test that loading the method layer in a spatial index, and processing the
+# input features in several threads, give the same result as querying the
+# method layer for each input feature.
+
+
+def _create_grid(ds, name, n, offset):
+
+    lyr = ds.CreateLayer(name)
+    lyr.CreateField(ogr.FieldDefn(name, ogr.OFTInteger))
+    for i in range(n):
+        for j in range(n):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f[name] = i * n + j
+            x = i + offset
+            y = j + offset * 0.5
+            x2 = x + 1.2
+            y2 = y + 1.2
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON(({x} {y},{x} {y2},{x2} {y2},{x2} {y},{x} {y}))"
+                )
+            )
+            lyr.CreateFeature(f)
+    # Feature without geometry
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f[name] = -1
+    lyr.CreateFeature(f)
+    return lyr
+
+
+def _get_features(lyr):
+
+    return [
+        (
+            f.GetGeometryRef().ExportToIsoWkt(),
+            [f.GetField(i) for i in range(f.GetFieldCount())],
+        )
+        for f in lyr
+    ]
+
+
+@pytest.mark.parametrize(
+    "operation",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("with_spatial_filter", [False, True])
+def test_algebra_spatial_index(operation, with_spatial_filter):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    input_lyr = _create_grid(ds, "input", 12, 0)
+    method_lyr = _create_grid(ds, "method", 10, 0.5)
+    if with_spatial_filter:
+        method_lyr.SetSpatialFilterRect(2.5, 2.5, 7.5, 9)
+
+    results = []
+    for options in (
+        ["USE_SPATIAL_INDEX=NO"],
+        ["USE_SPATIAL_INDEX=YES", "NUM_THREADS=1"],
+        ["USE_SPATIAL_INDEX=YES", "NUM_THREADS=4"],
+    ):
+        result_lyr = ds.CreateLayer("result_" + options[-1].replace("=", "_"))
+        assert (
+            getattr(input_lyr, operation)(method_lyr, result_lyr, options=options)
+            == ogr.OGRERR_NONE
+        )
+        results.append(_get_features(result_lyr))
+        ds.DeleteLayer(ds.GetLayerCount() - 1)
+
+    assert len(results[0]) > 0
+    assert results[1] == results[0]
+    assert results[2] == results[0]
+
+    # The filter of the method layer is restored
+    if with_spatial_filter:
+        assert method_lyr.GetFeatureCount() < 100
+    else:
+        assert method_lyr.GetFeatureCount() == 101
@@ -2257,3 +2257,112 @@ def test_ogr_sql_test_spatial_filter_on_summary_result_set():
     ) as sql_lyr:
         f = sql_lyr.GetNextFeature()
         assert f.GetField(0) == 2
+
+
+###############################################################################
+# Test ORDER BY with keys that do not fit in OGR_SQL_SORT_MAX_MEMORY
+
+
+@pytest.mark.parametrize(
+    "max_memory,num_threads,feature_count",
+    [
+        (None, "1", 30000),
+        (None, "4", 30000),
+        ("100KB", "1", 30000),
+        ("100KB", "4", 30000),
+        ("1", "4", 100),
+    ],
+)
+def test_ogr_sql_order_by_external_sort(max_memory, num_threads, feature_count):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    values = []
+    for i in range(feature_count):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        int_val = None if i % 13 == 0 else (i * 7919) % 101
+        str_val = None if i % 17 == 0 else "val%d" % ((i * 104729) % 37)
+        if int_val is not None:
+            f["int_field"] = int_val
+        if str_val is not None:
+            f["str_field"] = str_val
+        lyr.CreateFeature(f)
+        values.append((f.GetFID(), int_val, str_val))
+
+    # Nulls sort first in ascending order, and last in descending order.
+    # Python's sort is stable, as is ORDER BY.
+    expected = sorted(
+        values, key=lambda v: (v[2] is not None, v[2] or ""), reverse=True
+    )
+    expected = sorted(expected, key=lambda v: (v[1] is not None, v[1] or 0))
+    expected_fids = [v[0] for v in expected]
+
+    with gdaltest.config_options(
+        {"OGR_SQL_SORT_MAX_MEMORY": max_memory, "GDAL_NUM_THREADS": num_threads}
+    ):
+        with ds.ExecuteSQL(
+            "SELECT * FROM test ORDER BY int_field, str_field DESC"
+        ) as sql_lyr:
+            assert [f.GetFID() for f in sql_lyr] == expected_fids
+
+            sql_lyr.SetNextByIndex(feature_count // 2)
+            assert sql_lyr.GetNextFeature().GetFID() == expected_fids[
+                feature_count // 2
+            ]
+
+    # Already sorted input
+    with gdaltest.config_options(
+        {"OGR_SQL_SORT_MAX_MEMORY": max_memory, "GDAL_NUM_THREADS": num_threads}
+    ):
+        with ds.ExecuteSQL("SELECT * FROM test ORDER BY FID") as sql_lyr:
+            assert [f.GetFID() for f in sql_lyr] == list(range(feature_count))
+
+
+###############################################################################
+# Test DISTINCT with values that do not fit in OGR_SQL_SORT_MAX_MEMORY
+
+
+@pytest.mark.parametrize("max_memory", ["1", "10KB"])
+def test_ogr_sql_distinct_external(max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 13 != 0:
+            f["int_field"] = (i * 7919) % 1009
+        if i % 17 != 0:
+            f["str_field"] = "val%d" % ((i * 104729) % 701)
+        lyr.CreateFeature(f)
+
+    queries = [
+        "SELECT DISTINCT int_field FROM test",
+        "SELECT DISTINCT str_field FROM test",
+        "SELECT DISTINCT int_field FROM test ORDER BY int_field",
+        "SELECT DISTINCT str_field FROM test ORDER BY str_field DESC",
+        "SELECT COUNT(DISTINCT int_field), COUNT(DISTINCT str_field) FROM test",
+    ]
+
+    def run(sql):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            ret = [[f.GetField(i) for i in range(f.GetFieldCount())] for f in sql_lyr]
+            assert sql_lyr.GetFeatureCount() == len(ret)
+            if len(ret) > 1:
+                sql_lyr.SetNextByIndex(len(ret) // 2)
+                f = sql_lyr.GetNextFeature()
+                assert [f.GetField(i) for i in range(f.GetFieldCount())] == ret[
+                    len(ret) // 2
+                ]
+            return ret
+
+    expected = [run(sql) for sql in queries]
+    assert len(expected[0]) == 1010
+    assert expected[4] == [[1009, 701]]
+
+    with gdal.config_option("OGR_SQL_SORT_MAX_MEMORY", max_memory):
+        got = [run(sql) for sql in queries]
+    assert got == expected
@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import os
 import pathlib
 import struct
@@ -1337,3 +1338,113 @@ def test_gdalbuildvrt_cadrg_frames_mixing_transparent_and_not():
     vrt_ds = gdal.BuildVRT("", [src2_ds, src_ds])
     assert vrt_ds.GetRasterBand(1).GetNoDataValue() == 216
     assert vrt_ds.GetRasterBand(1).GetColorTable().GetCount() == 217
+
+
+###############################################################################
+# Test that opening sources in worker threads gives the same result, and
+# emits warnings in the order of the sources
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem, num_threads):
+
+    filenames = []
+    ungeoreferenced_filenames = []
+    for i in range(20):
+        filename = str(tmp_vsimem / f"src_{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+        ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+        ds.GetRasterBand(1).Fill(i)
+        ds.Close()
+        filenames.append(filename)
+        if i % 5 == 2:
+            filename = str(tmp_vsimem / f"ungeoreferenced_{i}.tif")
+            gdal.GetDriverByName("GTiff").Create(filename, 10, 10).Close()
+            filenames.append(filename)
+            ungeoreferenced_filenames.append(filename)
+
+    errors = []
+
+    def my_handler(typ, errno, msg):
+        errors.append(msg)
+
+    with gdaltest.error_handler(my_handler):
+        vrt_ds = gdal.BuildVRT("", filenames, numThreads=num_threads)
+    assert errors == [
+        f"gdalbuildvrt does not support ungeoreferenced image. Skipping {f}"
+        for f in ungeoreferenced_filenames
+    ]
+
+    assert vrt_ds.RasterXSize == 200
+    assert vrt_ds.GetRasterBand(1).ReadRaster() == b"".join(
+        bytes([i] * 10) for i in range(20)
+    ) * 10
+    sources = vrt_ds.GetRasterBand(1).GetMetadata("vrt_sources")
+    assert [
+        s.split("<SourceFilename")[1].split(">")[1].split("<")[0]
+        for s in sources.values()
+    ] == [f for f in filenames if f not in ungeoreferenced_filenames]
+
+
+def test_gdalbuildvrt_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for number of threads"):
+        gdal.BuildVRT("", ["../gcore/data/byte.tif"] * 2, numThreads="invalid")
+
+
+###############################################################################
+# Test -probe_cache
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalbuildvrt_lib_probe_cache(tmp_vsimem, num_threads):
+
+    filenames = []
+    for i in range(4):
+        filename = str(tmp_vsimem / f"src_{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+        ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+        ds.GetRasterBand(1).SetNoDataValue(i)
+        ds.GetRasterBand(1).Fill(i)
+        ds.Close()
+        filenames.append(filename)
+    cache_filename = str(tmp_vsimem / "cache.json")
+
+    def build(options=None):
+        vrt_ds = gdal.BuildVRT(
+            "",
+            filenames,
+            options=options,
+            numThreads=num_threads,
+            probeCache=cache_filename,
+        )
+        sources = vrt_ds.GetRasterBand(1).GetMetadata("vrt_sources").values()
+        return [float(s.split("<NODATA>")[1].split("<")[0]) for s in sources]
+
+    assert build() == [0, 1, 2, 3]
+    cache = json.loads(gdal.VSIFile(cache_filename, "rb").read())
+    assert [s["filename"] for s in cache["sources"]] == filenames
+    assert [s["bands"][0]["nodata"] for s in cache["sources"]] == [
+        "0",
+        "1",
+        "2",
+        "3",
+    ]
+
+    # Tamper with the cache to check that it is used
+    for s in cache["sources"]:
+        s["bands"][0]["nodata"] = "10"
+    gdal.FileFromMemBuffer(cache_filename, json.dumps(cache))
+    assert build() == [10, 10, 10, 10]
+
+    # A source of which the size changed is probed again
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filenames[2], 10, 10, options=["COMPRESS=DEFLATE"]
+    )
+    ds.SetGeoTransform([20, 1, 0, 0, 0, -1])
+    ds.GetRasterBand(1).SetNoDataValue(5)
+    ds.Close()
+    assert build() == [10, 10, 5, 10]
+
+    # Different open options invalidate the cache
+    assert build(["-oo", "NUM_THREADS=1"]) == [0, 1, 5, 3]
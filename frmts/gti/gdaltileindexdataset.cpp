@@ -229,6 +229,12 @@ class GDALTileIndexDataset final : public GDALPamDataset
 
     std::vector<GTISourceDesc> GetSourcesMoreRecentThan(int64_t mTime);
 
+    static GDALDataset *CreateCopy(const char *pszFilename,
+                                   GDALDataset *poSrcDS, int bStrict,
+                                   CSLConstList papszOptions,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressData);
+
   private:
     friend class GDALTileIndexBand;
 
@@ -298,8 +304,10 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Note that the dataset objects are ultimately GDALProxyPoolDataset,
     //! and that the GDALProxyPoolDataset limits the number of simultaneously
     //! opened real datasets (controlled by GDAL_MAX_DATASET_POOL_SIZE). Hence 500 is not too big.
+    //! Its size can be changed with the GTI_SOURCE_CACHE_SIZE configuration
+    //! option.
     lru11::Cache<GTISharedSourceKey, std::shared_ptr<SharedDataset>>
-        m_oMapSharedSources{500};
+        m_oMapSharedSources{GetSourceCacheSize()};
 
     //! Mask band (e.g. for JPEG compressed + mask band)
     std::unique_ptr<GDALTileIndexBand> m_poMaskBand{};
@@ -419,6 +427,32 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Whether the GTI file is a STAC collection
     bool m_bSTACCollection = false;
 
+    //! Whether the sources of the next window of a sequential scan must be
+    //! opened in the background (GTI_PREFETCH configuration option).
+    bool m_bPrefetch = true;
+
+    //! Window (nXOff, nYOff, nXSize, nYSize) of the last IRasterIO() request,
+    //! used to detect sequential scans.
+    std::array<int, 4> m_anLastRequestWindow{-1, -1, 0, 0};
+
+    //! Georeferenced window (minx, miny, maxx, maxy) for which
+    //! m_apoPrefetchedFeatures has been collected.
+    std::array<double, 4> m_adfPrefetchedFilter{
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::quiet_NaN()};
+
+    //! Features of the window predicted by PrefetchNextWindow()
+    std::vector<std::unique_ptr<OGRFeature>> m_apoPrefetchedFeatures{};
+
+    //! Number of sources whose opening was submitted by the last
+    //! PrefetchNextWindow() call.
+    int m_nLastPrefetchedSourceCount = 0;
+
+    //! Job queue of the background opening of sources.
+    CPLJobQueuePtr m_poPrefetchJobQueue{};
+
     std::string m_osWarpMemory{};
 
     //! From a source dataset name, return its SourceDesc description structure.
@@ -426,6 +460,12 @@ class GDALTileIndexDataset final : public GDALPamDataset
                        std::mutex *pMutex, int nBandCount,
                        const int *panBandMap);
 
+    //! Collect the features of the tile index intersecting a georeferenced
+    //! window.
+    bool CollectFeatures(double dfMinX, double dfMinY, double dfMaxX,
+                         double dfMaxY,
+                         std::vector<std::unique_ptr<OGRFeature>> &apoFeatures);
+
     //! Collect sources corresponding to the georeferenced window of interest,
     //! and store them in m_aoSourceDesc[].
     bool CollectSources(double dfXOff, double dfYOff, double dfXSize,
@@ -456,12 +496,40 @@ class GDALTileIndexDataset final : public GDALPamDataset
                         GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg,
                         VRTSource::WorkingState &oWorkingState) const;
 
+    //! Render all sources collected by CollectSources(). Used by IRasterIO()
+    CPLErr RenderSources(bool bNeedInitBuffer, int nBandNrMax, int nXOff,
+                         int nYOff, int nXSize, int nYSize, double dfXOff,
+                         double dfYOff, double dfXSize, double dfYSize,
+                         int nBufXSize, int nBufYSize, void *pData,
+                         GDALDataType eBufType, int nBandCount,
+                         BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                         GSpacing nLineSpace, GSpacing nBandSpace,
+                         GDALRasterIOExtraArg *psExtraArg);
+
     //! Whether m_poVectorDS supports SetMetadata()/SetMetadataItem()
     bool TileIndexSupportsEditingLayerMetadata() const;
 
     //! Return number of threads that can be used
     int GetNumThreads() const;
 
+    //! Return the maximum number of entries of m_oMapSharedSources
+    static size_t GetSourceCacheSize();
+
+    //! Wait for the completion of the jobs submitted by PrefetchNextWindow()
+    void WaitForPrefetch();
+
+    //! Open in the background the sources of the window that follows
+    //! the current request, if the requests follow a sequential scan.
+    void PrefetchNextWindow(int nXOff, int nYOff, int nXSize, int nYSize,
+                            GDALDataType eBufType, int nBandCount,
+                            const int *panBandMap);
+
+    //! Open a source and advise it of the window that is going to be read.
+    //! Run from a worker thread.
+    void PrefetchSource(const std::string &osTileName,
+                        const std::vector<int> &anBands, int nXOff, int nYOff,
+                        int nXSize, int nYSize, GDALDataType eBufType);
+
     /** Structure used to declare a threaded job to satisfy IRasterIO()
      * on a given source.
      */
@@ -2743,6 +2811,8 @@ bool GDALTileIndexDataset::Open(GDALOpenInfo *poOpenInfo)
     m_osWarpMemory = CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                           "WARPING_MEMORY_SIZE", "");
 
+    m_bPrefetch = CPLTestBool(CPLGetConfigOption("GTI_PREFETCH", "YES"));
+
     return true;
 }
 
@@ -2767,6 +2837,10 @@ const char *GDALTileIndexDataset::GetMetadataItem(const char *pszName,
         {
             return m_bLastMustUseMultiThreading ? "1" : "0";
         }
+        else if (EQUAL(pszName, "LAST_PREFETCHED_SOURCE_COUNT"))
+        {
+            return CPLSPrintf("%d", m_nLastPrefetchedSourceCount);
+        }
     }
     return GDALPamDataset::GetMetadataItem(pszName, pszDomain);
 }
@@ -2924,6 +2998,383 @@ static GDALDataset *GDALTileIndexDatasetOpen(GDALOpenInfo *poOpenInfo)
     return poDS.release();
 }
 
+/************************************************************************/
+/*                             CreateCopy()                             */
+/************************************************************************/
+
+/** Convert a VRT mosaic to a tile index.
+ *
+ * Only VRT datasets whose bands are made of the same simple sources, with
+ * source band i used for band i, can be converted. Sources must use the
+ * full extent of their dataset at full resolution, without NODATA or
+ * UseMaskBand, as this is how the GTI driver composites tiles. Sources are
+ * only opened to check their dimensions: the footprint of each source is
+ * computed from its destination window, which assumes that sources are
+ * placed according to their georeferencing, as done by gdalbuildvrt.
+ */
+/* static */ GDALDataset *GDALTileIndexDataset::CreateCopy(
+    const char *pszFilename, GDALDataset *poSrcDS, int /* bStrict */,
+    CSLConstList papszOptions, GDALProgressFunc pfnProgress,
+    void *pProgressData)
+{
+    auto poVRTDS = dynamic_cast<VRTDataset *>(poSrcDS);
+    const int nBandCount = poSrcDS->GetRasterCount();
+    if (!poVRTDS || poVRTDS->GetDriver() == nullptr ||
+        !EQUAL(poVRTDS->GetDriver()->GetDescription(), "VRT") ||
+        nBandCount == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GTI driver only supports copying VRT datasets with at least "
+                 "one band");
+        return nullptr;
+    }
+
+    GDALGeoTransform gt;
+    if (poSrcDS->GetGeoTransform(gt) != CE_None || gt.xrot != 0 ||
+        gt.yrot != 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Source dataset must have a non-rotated geotransform");
+        return nullptr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Check that all bands share the same simple sources.             */
+    /* -------------------------------------------------------------------- */
+    std::vector<VRTSourcedRasterBand *> apoBands;
+    for (int i = 1; i <= nBandCount; ++i)
+    {
+        auto poBand =
+            dynamic_cast<VRTSourcedRasterBand *>(poSrcDS->GetRasterBand(i));
+        if (!poBand || dynamic_cast<VRTDerivedRasterBand *>(poBand) ||
+            (!apoBands.empty() && poBand->m_papoSources.size() !=
+                                      apoBands[0]->m_papoSources.size()))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "All bands of the source VRT must be regular sourced "
+                     "bands with the same number of sources");
+            return nullptr;
+        }
+        apoBands.push_back(poBand);
+    }
+
+    const auto &apoSources = apoBands[0]->m_papoSources;
+    std::string osResampling;
+    for (size_t iSource = 0; iSource < apoSources.size(); ++iSource)
+    {
+        const VRTSimpleSource *poFirstSource = nullptr;
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            const auto &poSource = apoBands[i]->m_papoSources[iSource];
+            if (!poSource->IsSimpleSource())
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Source %d of band %d is not a simple source",
+                         static_cast<int>(iSource) + 1, i + 1);
+                return nullptr;
+            }
+            const auto poSimpleSource =
+                cpl::down_cast<const VRTSimpleSource *>(poSource.get());
+            const auto poComplexSource =
+                dynamic_cast<const VRTComplexSource *>(poSimpleSource);
+            const char *pszType = poSimpleSource->GetType();
+            if ((pszType != VRTSimpleSource::GetTypeStatic() &&
+                 pszType != VRTComplexSource::GetTypeStatic()) ||
+                (poComplexSource && !poComplexSource->AreValuesUnchanged()) ||
+                poSimpleSource->m_bGetMaskBand ||
+                poSimpleSource->m_nBand != i + 1 ||
+                !poSimpleSource->m_aosOpenOptionsOri.empty() ||
+                !poSimpleSource->IsDstWinSet() ||
+                (poFirstSource &&
+                 (!poSimpleSource->IsSameExceptBandNumber(poFirstSource) ||
+                  poSimpleSource->GetResampling() !=
+                      poFirstSource->GetResampling())))
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Source %d of band %d cannot be represented in a "
+                         "tile index",
+                         static_cast<int>(iSource) + 1, i + 1);
+                return nullptr;
+            }
+
+            // The tile index composites sources with the nodata value or
+            // mask of their bands, whereas the VRT only uses the nodata
+            // value of complex sources with a NODATA element.
+            const auto poSrcBand = poSimpleSource->GetRasterBand();
+            if (!poSrcBand)
+                return nullptr;
+            const int nProcessingFlags =
+                poComplexSource ? poComplexSource->m_nProcessingFlags : 0;
+            bool bSameMasking = false;
+            if (nProcessingFlags &
+                VRTComplexSource::PROCESSING_FLAG_USE_MASK_BAND)
+            {
+                // Not worth the trouble of checking that this matches the
+                // masking of the tile index.
+            }
+            else if (nProcessingFlags &
+                     VRTComplexSource::PROCESSING_FLAG_NODATA)
+            {
+                int bSrcHasNoData = false;
+                const double dfSrcNoData =
+                    poSrcBand->GetNoDataValue(&bSrcHasNoData);
+                bSameMasking =
+                    bSrcHasNoData && poSrcBand->GetMaskFlags() == GMF_NODATA &&
+                    IsSameNaNAware(poComplexSource->m_dfNoDataValue,
+                                   dfSrcNoData);
+            }
+            else
+            {
+                bSameMasking = poSrcBand->GetMaskFlags() == GMF_ALL_VALID;
+            }
+            if (!bSameMasking)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Source %d of band %d does not use the nodata value "
+                         "or mask of its band, which cannot be represented in "
+                         "a tile index",
+                         static_cast<int>(iSource) + 1, i + 1);
+                return nullptr;
+            }
+
+            if (!poFirstSource)
+            {
+                poFirstSource = poSimpleSource;
+
+                // The tile index always uses the whole extent of sources at
+                // their native resolution.
+                const double dfSrcXSize = poSrcBand->GetXSize();
+                const double dfSrcYSize = poSrcBand->GetYSize();
+                double dfDstXOff = 0;
+                double dfDstYOff = 0;
+                double dfDstXSize = 0;
+                double dfDstYSize = 0;
+                poSimpleSource->GetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize,
+                                             dfDstYSize);
+                if ((poSimpleSource->IsSrcWinSet() &&
+                     (poSimpleSource->m_dfSrcXOff != 0 ||
+                      poSimpleSource->m_dfSrcYOff != 0 ||
+                      poSimpleSource->m_dfSrcXSize != dfSrcXSize ||
+                      poSimpleSource->m_dfSrcYSize != dfSrcYSize)) ||
+                    dfDstXSize != dfSrcXSize || dfDstYSize != dfSrcYSize)
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Source %d does not use the full extent of its "
+                             "dataset at full resolution, which cannot be "
+                             "represented in a tile index",
+                             static_cast<int>(iSource) + 1);
+                    return nullptr;
+                }
+            }
+        }
+        if (iSource == 0)
+        {
+            osResampling = poFirstSource->GetResampling();
+        }
+        else if (poFirstSource->GetResampling() != osResampling)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "All sources must use the same resampling method");
+            return nullptr;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create the vector dataset.                                      */
+    /* -------------------------------------------------------------------- */
+    const char *pszFormat = CSLFetchNameValue(papszOptions, "FORMAT");
+    if (!pszFormat)
+    {
+        if (ENDS_WITH_CI(pszFilename, ".fgb"))
+            pszFormat = "FlatGeobuf";
+        else if (ENDS_WITH_CI(pszFilename, ".parquet"))
+            pszFormat = "Parquet";
+        else
+            pszFormat = "GPKG";
+    }
+    auto poVectorDriver = GetGDALDriverManager()->GetDriverByName(pszFormat);
+    if (!poVectorDriver ||
+        !poVectorDriver->GetMetadataItem(GDAL_DCAP_CREATE_LAYER))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "%s is not a vector driver supporting layer creation",
+                 pszFormat);
+        return nullptr;
+    }
+
+    auto poVectorDS = std::unique_ptr<GDALDataset>(poVectorDriver->Create(
+        pszFilename, 0, 0, 0, GDT_Unknown, nullptr));
+    if (!poVectorDS)
+        return nullptr;
+
+    std::string osLayerName = CSLFetchNameValueDef(papszOptions, "LAYER", "");
+    if (osLayerName.empty())
+    {
+        osLayerName = CPLGetBasenameSafe(pszFilename);
+        // Strip the ".gti" part of "foo.gti.gpkg"
+        if (ENDS_WITH_CI(osLayerName.c_str(), ".gti"))
+            osLayerName.resize(osLayerName.size() - strlen(".gti"));
+    }
+    const char *pszLocationField =
+        CSLFetchNameValueDef(papszOptions, "LOCATION_FIELD", "location");
+
+    OGRLayer *poLayer = poVectorDS->CreateLayer(
+        osLayerName.c_str(), poSrcDS->GetSpatialRef(), wkbPolygon, nullptr);
+    if (!poLayer)
+        return nullptr;
+    OGRFieldDefn oLocationField(pszLocationField, OFTString);
+    if (poLayer->CreateField(&oLocationField) != OGRERR_NONE)
+        return nullptr;
+    const int iLocationField =
+        poLayer->GetLayerDefn()->GetFieldIndex(pszLocationField);
+
+    /* -------------------------------------------------------------------- */
+    /*      Write the metadata describing the mosaic, so that opening the   */
+    /*      tile index does not require to open any source.                 */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosMD;
+    aosMD.SetNameValue(MD_LOCATION_FIELD, pszLocationField);
+    aosMD.SetNameValue(MD_XSIZE, CPLSPrintf("%d", poSrcDS->GetRasterXSize()));
+    aosMD.SetNameValue(MD_YSIZE, CPLSPrintf("%d", poSrcDS->GetRasterYSize()));
+    aosMD.SetNameValue(MD_GEOTRANSFORM,
+                       CPLSPrintf("%.17g,%.17g,%.17g,%.17g,%.17g,%.17g",
+                                  gt.xorig, gt.xscale, gt.xrot, gt.yorig,
+                                  gt.yrot, gt.yscale));
+    aosMD.SetNameValue(MD_BAND_COUNT, CPLSPrintf("%d", nBandCount));
+    if (!osResampling.empty())
+        aosMD.SetNameValue(MD_RESAMPLING, osResampling.c_str());
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    apoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    aosMD.SetNameValue(MD_BLOCK_X_SIZE, CPLSPrintf("%d", nBlockXSize));
+    aosMD.SetNameValue(MD_BLOCK_Y_SIZE, CPLSPrintf("%d", nBlockYSize));
+
+    std::string osDataType;
+    std::string osNoData;
+    std::string osColorInterp;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand = apoBands[i];
+        if (i > 0)
+        {
+            osDataType += ',';
+            osNoData += ',';
+            osColorInterp += ',';
+        }
+        osDataType += GDALGetDataTypeName(poBand->GetRasterDataType());
+        int bHasNoData = false;
+        const double dfNoData = poBand->GetNoDataValue(&bHasNoData);
+        osNoData += bHasNoData ? CPLSPrintf("%.17g", dfNoData) : "NONE";
+        osColorInterp +=
+            GDALGetColorInterpretationName(poBand->GetColorInterpretation());
+
+        int bHasOffset = false;
+        const double dfOffset = poBand->GetOffset(&bHasOffset);
+        if (bHasOffset)
+            aosMD.SetNameValue(CPLSPrintf("BAND_%d_%s", i + 1, MD_BAND_OFFSET),
+                               CPLSPrintf("%.17g", dfOffset));
+        int bHasScale = false;
+        const double dfScale = poBand->GetScale(&bHasScale);
+        if (bHasScale)
+            aosMD.SetNameValue(CPLSPrintf("BAND_%d_%s", i + 1, MD_BAND_SCALE),
+                               CPLSPrintf("%.17g", dfScale));
+        const char *pszUnitType = poBand->GetUnitType();
+        if (pszUnitType && pszUnitType[0])
+            aosMD.SetNameValue(
+                CPLSPrintf("BAND_%d_%s", i + 1, MD_BAND_UNITTYPE),
+                pszUnitType);
+    }
+    aosMD.SetNameValue(MD_DATA_TYPE, osDataType.c_str());
+    aosMD.SetNameValue(MD_NODATA, osNoData.c_str());
+    aosMD.SetNameValue(MD_COLOR_INTERPRETATION, osColorInterp.c_str());
+
+    // Dataset metadata items are exposed as such by the GTI driver
+    for (const auto &[pszKey, pszValue] :
+         cpl::IterateNameValue(poSrcDS->GetMetadata()))
+    {
+        if (aosMD.FetchNameValue(pszKey) == nullptr &&
+            !STARTS_WITH_CI(pszKey, "BAND_"))
+            aosMD.SetNameValue(pszKey, pszValue);
+    }
+    poLayer->SetMetadata(aosMD.List());
+
+    /* -------------------------------------------------------------------- */
+    /*      Write one feature per source.                                   */
+    /* -------------------------------------------------------------------- */
+    const std::string osOutputDir = CPLGetPathSafe(pszFilename);
+    const bool bUseTransaction = poVectorDS->StartTransaction() == OGRERR_NONE;
+    const size_t nSources = apoSources.size();
+    for (size_t iSource = 0; iSource < nSources; ++iSource)
+    {
+        const auto poSource =
+            cpl::down_cast<const VRTSimpleSource *>(apoSources[iSource].get());
+
+        std::string osLocation = poSource->GetSourceDatasetName();
+        if (poSource->m_bRelativeToVRTOri == 1)
+        {
+            // Tile index resolves relative paths against its own directory
+            int bRelative = FALSE;
+            const char *pszRelative = CPLExtractRelativePath(
+                osOutputDir.c_str(), osLocation.c_str(), &bRelative);
+            if (bRelative)
+                osLocation = pszRelative;
+        }
+
+        double dfDstXOff = 0;
+        double dfDstYOff = 0;
+        double dfDstXSize = 0;
+        double dfDstYSize = 0;
+        poSource->GetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize, dfDstYSize);
+        const double dfX1 = gt.xorig + dfDstXOff * gt.xscale;
+        const double dfX2 = gt.xorig + (dfDstXOff + dfDstXSize) * gt.xscale;
+        const double dfY1 = gt.yorig + dfDstYOff * gt.yscale;
+        const double dfY2 = gt.yorig + (dfDstYOff + dfDstYSize) * gt.yscale;
+
+        auto poLR = std::make_unique<OGRLinearRing>();
+        poLR->addPoint(dfX1, dfY1);
+        poLR->addPoint(dfX1, dfY2);
+        poLR->addPoint(dfX2, dfY2);
+        poLR->addPoint(dfX2, dfY1);
+        poLR->addPoint(dfX1, dfY1);
+        auto poPoly = std::make_unique<OGRPolygon>();
+        poPoly->addRingDirectly(poLR.release());
+
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        oFeature.SetField(iLocationField, osLocation.c_str());
+        oFeature.SetGeometryDirectly(poPoly.release());
+        if (poLayer->CreateFeature(&oFeature) != OGRERR_NONE)
+        {
+            if (bUseTransaction)
+                poVectorDS->RollbackTransaction();
+            return nullptr;
+        }
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(iSource + 1) / nSources, "",
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            if (bUseTransaction)
+                poVectorDS->RollbackTransaction();
+            return nullptr;
+        }
+    }
+    if (bUseTransaction && poVectorDS->CommitTransaction() != OGRERR_NONE)
+        return nullptr;
+    if (poVectorDS->Close() != CE_None)
+        return nullptr;
+    poVectorDS.reset();
+
+    if (pfnProgress && nSources == 0)
+        pfnProgress(1.0, "", pProgressData);
+
+    const char *const apszAllowedDrivers[] = {"GTI", nullptr};
+    return GDALDataset::Open(pszFilename,
+                             GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+                             apszAllowedDrivers);
+}
+
 /************************************************************************/
 /*                       ~GDALTileIndexDataset()                        */
 /************************************************************************/
@@ -2947,6 +3398,8 @@ GDALTileIndexDataset::~GDALTileIndexDataset()
 
 CPLErr GDALTileIndexDataset::FlushCache(bool bAtClosing)
 {
+    WaitForPrefetch();
+
     CPLErr eErr = CE_None;
     if (bAtClosing && m_bXMLModified)
     {
@@ -3082,6 +3535,8 @@ CPLErr GDALTileIndexDataset::FlushCache(bool bAtClosing)
     m_dfLastMaxYFilter = std::numeric_limits<double>::quiet_NaN();
     m_anLastBands.clear();
     m_aoSourceDesc.clear();
+    m_anLastRequestWindow = {-1, -1, 0, 0};
+    m_apoPrefetchedFeatures.clear();
     if (GDALPamDataset::FlushCache(bAtClosing) != CE_None)
         eErr = CE_Failure;
     return eErr;
@@ -4280,36 +4735,176 @@ int GDALTileIndexDataset::GetNumThreads() const
 }
 
 /************************************************************************/
-/*                           CollectSources()                           */
+/*                         GetSourceCacheSize()                         */
 /************************************************************************/
 
-bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
-                                          double dfXSize, double dfYSize,
-                                          int nBandCount, const int *panBandMap,
-                                          bool bMultiThreadAllowed)
+/* static */ size_t GDALTileIndexDataset::GetSourceCacheSize()
 {
-    const double dfMinX = m_gt.xorig + dfXOff * m_gt.xscale;
-    const double dfMaxX = dfMinX + dfXSize * m_gt.xscale;
-    const double dfMaxY = m_gt.yorig + dfYOff * m_gt.yscale;
-    const double dfMinY = dfMaxY + dfYSize * m_gt.yscale;
+    // Note that the dataset objects are ultimately GDALProxyPoolDataset, which
+    // limit the number of simultaneously opened real datasets, so a large
+    // value only costs a bit of memory.
+    const int nSize = atoi(CPLGetConfigOption("GTI_SOURCE_CACHE_SIZE", "500"));
+    return static_cast<size_t>(std::max(1, nSize));
+}
 
-    if (dfMinX == m_dfLastMinXFilter && dfMinY == m_dfLastMinYFilter &&
-        dfMaxX == m_dfLastMaxXFilter && dfMaxY == m_dfLastMaxYFilter &&
-        (!m_bBandInterleave ||
-         (m_anLastBands ==
-          std::vector<int>(panBandMap, panBandMap + nBandCount))))
+/************************************************************************/
+/*                          WaitForPrefetch()                           */
+/************************************************************************/
+
+void GDALTileIndexDataset::WaitForPrefetch()
+{
+    if (m_poPrefetchJobQueue)
+        m_poPrefetchJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                         PrefetchNextWindow()                         */
+/************************************************************************/
+
+void GDALTileIndexDataset::PrefetchNextWindow(int nXOff, int nYOff, int nXSize,
+                                              int nYSize, GDALDataType eBufType,
+                                              int nBandCount,
+                                              const int *panBandMap)
+{
+    const auto anPrevWindow = m_anLastRequestWindow;
+    if (anPrevWindow == std::array<int, 4>{nXOff, nYOff, nXSize, nYSize})
     {
-        return true;
+        // Typically the same block read for another band.
+        return;
     }
+    m_anLastRequestWindow = {nXOff, nYOff, nXSize, nYSize};
+    m_nLastPrefetchedSourceCount = 0;
 
-    m_dfLastMinXFilter = dfMinX;
-    m_dfLastMinYFilter = dfMinY;
-    m_dfLastMaxXFilter = dfMaxX;
-    m_dfLastMaxYFilter = dfMaxY;
-    if (m_bBandInterleave)
-        m_anLastBands = std::vector<int>(panBandMap, panBandMap + nBandCount);
-    m_bLastMustUseMultiThreading = false;
+    // Only left-to-right and top-to-bottom scans with constant window size
+    // are detected, which covers reading a raster block after block, or
+    // by chunks of lines.
+    if (!m_bPrefetch || nXSize != anPrevWindow[2] ||
+        nYSize != anPrevWindow[3] ||
+        !((nYOff == anPrevWindow[1] && nXOff == anPrevWindow[0] + nXSize) ||
+          (nXOff == anPrevWindow[0] && nYOff == anPrevWindow[1] + nYSize)))
+    {
+        return;
+    }
+
+    const int nNextXOff = nYOff == anPrevWindow[1] ? nXOff + nXSize : nXOff;
+    const int nNextYOff = nYOff == anPrevWindow[1] ? nYOff : nYOff + nYSize;
+    if (nNextXOff >= nRasterXSize || nNextYOff >= nRasterYSize)
+        return;
+    const int nNextXSize = std::min(nXSize, nRasterXSize - nNextXOff);
+    const int nNextYSize = std::min(nYSize, nRasterYSize - nNextYOff);
+
+    if (m_nNumThreads < 0)
+        m_nNumThreads = GetNumThreads();
+    if (m_nNumThreads <= 1)
+        return;
+    CPLWorkerThreadPool *psThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    if (!psThreadPool)
+        return;
+
+    const double dfMinX = m_gt.xorig + nNextXOff * m_gt.xscale;
+    const double dfMaxX = dfMinX + nNextXSize * m_gt.xscale;
+    const double dfMaxY = m_gt.yorig + nNextYOff * m_gt.yscale;
+    const double dfMinY = dfMaxY + nNextYSize * m_gt.yscale;
 
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures;
+    {
+        // Errors will be emitted by CollectSources() if the guess is right
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        if (!CollectFeatures(dfMinX, dfMinY, dfMaxX, dfMaxY, apoFeatures))
+            return;
+    }
+
+    // Do not open more sources than what the cache can hold, otherwise
+    // we would evict the ones we are about to use.
+    const size_t nMaxSources = m_oMapSharedSources.getMaxSize() / 2;
+
+    if (!m_poPrefetchJobQueue)
+        m_poPrefetchJobQueue = psThreadPool->CreateJobQueue();
+
+    const std::vector<int> anBands(panBandMap, panBandMap + nBandCount);
+    std::set<std::string> oSetTileNames;
+    for (const auto &poFeature : apoFeatures)
+    {
+        if (oSetTileNames.size() >= nMaxSources)
+            break;
+        std::string osTileName(GetAbsoluteFileName(
+            poFeature->GetFieldAsString(m_nLocationFieldIndex),
+            GetDescription(), m_bSTACCollection));
+        if (!oSetTileNames.insert(osTileName).second)
+            continue;
+        ++m_nLastPrefetchedSourceCount;
+        m_poPrefetchJobQueue->SubmitJob(
+            [this, osTileName = std::move(osTileName), anBands, nNextXOff,
+             nNextYOff, nNextXSize, nNextYSize, eBufType]()
+            {
+                PrefetchSource(osTileName, anBands, nNextXOff, nNextYOff,
+                               nNextXSize, nNextYSize, eBufType);
+            });
+    }
+
+    m_apoPrefetchedFeatures = std::move(apoFeatures);
+    m_adfPrefetchedFilter = {dfMinX, dfMinY, dfMaxX, dfMaxY};
+}
+
+/************************************************************************/
+/*                           PrefetchSource()                           */
+/************************************************************************/
+
+void GDALTileIndexDataset::PrefetchSource(const std::string &osTileName,
+                                          const std::vector<int> &anBands,
+                                          int nXOff, int nYOff, int nXSize,
+                                          int nYSize, GDALDataType eBufType)
+{
+    CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+
+    // Opening the source (and setting up its warped dataset if needed) puts
+    // it into m_oMapSharedSources, from where CollectSources() will get it.
+    SourceDesc oSourceDesc;
+    if (!GetSourceDesc(osTileName, oSourceDesc, &m_oQueueWorkingStates.oMutex,
+                       static_cast<int>(anBands.size()), anBands.data()) ||
+        !oSourceDesc.poDS || oSourceDesc.poDS->GetRasterCount() == 0)
+    {
+        return;
+    }
+
+    double dfReqXOff = 0.0;
+    double dfReqYOff = 0.0;
+    double dfReqXSize = 0.0;
+    double dfReqYSize = 0.0;
+    int nReqXOff = 0;
+    int nReqYOff = 0;
+    int nReqXSize = 0;
+    int nReqYSize = 0;
+    int nOutXOff = 0;
+    int nOutYOff = 0;
+    int nOutXSize = 0;
+    int nOutYSize = 0;
+    bool bError = false;
+
+    auto &poSource = oSourceDesc.poSource;
+    poSource->SetRasterBand(oSourceDesc.poDS->GetRasterBand(1), false);
+    if (poSource->GetSrcDstWindow(
+            nXOff, nYOff, nXSize, nYSize, nXSize, nYSize, m_eResampling,
+            &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+            &nReqYOff, &nReqXSize, &nReqYSize, &nOutXOff, &nOutYOff,
+            &nOutXSize, &nOutYSize, bError))
+    {
+        // For network based sources, this typically triggers the download
+        // of the needed tiles.
+        CPL_IGNORE_RET_VAL(oSourceDesc.poDS->AdviseRead(
+            nReqXOff, nReqYOff, nReqXSize, nReqYSize, nOutXSize, nOutYSize,
+            eBufType, 0, nullptr, nullptr));
+    }
+}
+
+/************************************************************************/
+/*                          CollectFeatures()                           */
+/************************************************************************/
+
+bool GDALTileIndexDataset::CollectFeatures(
+    double dfMinX, double dfMinY, double dfMaxX, double dfMaxY,
+    std::vector<std::unique_ptr<OGRFeature>> &apoFeatures)
+{
     OGRLayer *poSQLLayer = nullptr;
     if (!m_osSpatialSQL.empty())
     {
@@ -4321,7 +4916,7 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
                 .replaceAll("{YMAX}", CPLSPrintf("%.17g", dfMaxY));
         poSQLLayer = m_poVectorDS->ExecuteSQL(osSQL.c_str(), nullptr, nullptr);
         if (!poSQLLayer)
-            return 0;
+            return false;
     }
     else
     {
@@ -4331,7 +4926,7 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
 
     OGRLayer *const poLayer = poSQLLayer ? poSQLLayer : m_poLayer;
 
-    m_aoSourceDesc.clear();
+    apoFeatures.clear();
     while (true)
     {
         auto poFeature = std::unique_ptr<OGRFeature>(poLayer->GetNextFeature());
@@ -4342,16 +4937,16 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
             continue;
         }
 
-        SourceDesc oSourceDesc;
-        oSourceDesc.poFeature = std::move(poFeature);
-        m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
+        apoFeatures.push_back(std::move(poFeature));
 
-        if (m_aoSourceDesc.size() > 10 * 1000 * 1000)
+        if (apoFeatures.size() > 10 * 1000 * 1000)
         {
             // Safety belt...
             CPLError(CE_Failure, CPLE_AppDefined,
                      "More than 10 million contributing sources to a "
                      "single RasterIO() request is not supported");
+            if (poSQLLayer)
+                ReleaseResultSet(poSQLLayer);
             return false;
         }
     }
@@ -4359,6 +4954,70 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     if (poSQLLayer)
         ReleaseResultSet(poSQLLayer);
 
+    return true;
+}
+
+/************************************************************************/
+/*                           CollectSources()                           */
+/************************************************************************/
+
+bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
+                                          double dfXSize, double dfYSize,
+                                          int nBandCount, const int *panBandMap,
+                                          bool bMultiThreadAllowed)
+{
+    // The background jobs of PrefetchNextWindow() use the cached source
+    // datasets, which are going to be used by the caller.
+    WaitForPrefetch();
+
+    const double dfMinX = m_gt.xorig + dfXOff * m_gt.xscale;
+    const double dfMaxX = dfMinX + dfXSize * m_gt.xscale;
+    const double dfMaxY = m_gt.yorig + dfYOff * m_gt.yscale;
+    const double dfMinY = dfMaxY + dfYSize * m_gt.yscale;
+
+    if (dfMinX == m_dfLastMinXFilter && dfMinY == m_dfLastMinYFilter &&
+        dfMaxX == m_dfLastMaxXFilter && dfMaxY == m_dfLastMaxYFilter &&
+        (!m_bBandInterleave ||
+         (m_anLastBands ==
+          std::vector<int>(panBandMap, panBandMap + nBandCount))))
+    {
+        return true;
+    }
+
+    m_dfLastMinXFilter = dfMinX;
+    m_dfLastMinYFilter = dfMinY;
+    m_dfLastMaxXFilter = dfMaxX;
+    m_dfLastMaxYFilter = dfMaxY;
+    if (m_bBandInterleave)
+        m_anLastBands = std::vector<int>(panBandMap, panBandMap + nBandCount);
+    m_bLastMustUseMultiThreading = false;
+
+    // Reuse the features collected by PrefetchNextWindow() if it has
+    // correctly guessed the window of this request.
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures;
+    if (m_adfPrefetchedFilter[0] == dfMinX &&
+        m_adfPrefetchedFilter[1] == dfMinY &&
+        m_adfPrefetchedFilter[2] == dfMaxX &&
+        m_adfPrefetchedFilter[3] == dfMaxY)
+    {
+        apoFeatures = std::move(m_apoPrefetchedFeatures);
+    }
+    else if (!CollectFeatures(dfMinX, dfMinY, dfMaxX, dfMaxY, apoFeatures))
+    {
+        return false;
+    }
+    m_apoPrefetchedFeatures.clear();
+    m_adfPrefetchedFilter.fill(std::numeric_limits<double>::quiet_NaN());
+
+    m_aoSourceDesc.clear();
+    m_aoSourceDesc.reserve(apoFeatures.size());
+    for (auto &poFeature : apoFeatures)
+    {
+        SourceDesc oSourceDesc;
+        oSourceDesc.poFeature = std::move(poFeature);
+        m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
+    }
+
     constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
     if (bMultiThreadAllowed && m_aoSourceDesc.size() > 1 &&
         dfXSize * dfYSize > MINIMUM_PIXEL_COUNT_FOR_THREADED_IO)
@@ -4718,6 +5377,40 @@ void GDALTileIndexDataset::SortSourceDesc()
         });
 }
 
+/************************************************************************/
+/*                 CompositeSrcWithMaskIntoDestPacked()                 */
+/************************************************************************/
+
+// Composite a source into a destination buffer whose pixels are contiguous.
+// T is an unsigned integer type of the size of the data type, as we only
+// copy bits. The blend is written without branch so that the compiler can
+// vectorize it.
+template <class T>
+static void CompositeSrcWithMaskIntoDestPacked(const int nOutXSize,
+                                               const int nOutYSize,
+                                               const GSpacing nLineSpace,
+                                               const GByte *pabySrc,
+                                               const GByte *pabyMask,
+                                               GByte *const pabyDest)
+{
+    for (int iY = 0; iY < nOutYSize; iY++)
+    {
+        GByte *pabyDestLine =
+            pabyDest + static_cast<GPtrDiff_t>(iY * nLineSpace);
+        for (int iX = 0; iX < nOutXSize; iX++)
+        {
+            T nSrc;
+            T nDst;
+            memcpy(&nSrc, pabySrc + iX * sizeof(T), sizeof(T));
+            memcpy(&nDst, pabyDestLine + iX * sizeof(T), sizeof(T));
+            nDst = pabyMask[iX] ? nSrc : nDst;
+            memcpy(pabyDestLine + iX * sizeof(T), &nDst, sizeof(T));
+        }
+        pabySrc += static_cast<size_t>(nOutXSize) * sizeof(T);
+        pabyMask += nOutXSize;
+    }
+}
+
 /************************************************************************/
 /*                    CompositeSrcWithMaskIntoDest()                    */
 /************************************************************************/
@@ -4785,6 +5478,19 @@ CompositeSrcWithMaskIntoDest(const int nOutXSize, const int nOutYSize,
             }
         }
     }
+    else if (nPixelSpace == nBufTypeSize &&
+             (nBufTypeSize == 2 || nBufTypeSize == 4 || nBufTypeSize == 8))
+    {
+        if (nBufTypeSize == 2)
+            CompositeSrcWithMaskIntoDestPacked<uint16_t>(
+                nOutXSize, nOutYSize, nLineSpace, pabySrc, pabyMask, pabyDest);
+        else if (nBufTypeSize == 4)
+            CompositeSrcWithMaskIntoDestPacked<uint32_t>(
+                nOutXSize, nOutYSize, nLineSpace, pabySrc, pabyMask, pabyDest);
+        else
+            CompositeSrcWithMaskIntoDestPacked<uint64_t>(
+                nOutXSize, nOutYSize, nLineSpace, pabySrc, pabyMask, pabyDest);
+    }
     else
     {
         for (int iY = 0; iY < nOutYSize; iY++)
@@ -5386,6 +6092,34 @@ CPLErr GDALTileIndexDataset::IRasterIO(
     const bool bNeedInitBuffer =
         m_bLastMustUseMultiThreading || NeedInitBuffer(nBandCount, panBandMap);
 
+    const CPLErr eErr = RenderSources(
+        bNeedInitBuffer, nBandNrMax, nXOff, nYOff, nXSize, nYSize, dfXOff,
+        dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize, pData, eBufType,
+        nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+
+    if (eErr == CE_None && nBandNrMax > 0 &&
+        !psExtraArg->bFloatingPointWindowValidity)
+    {
+        PrefetchNextWindow(nXOff, nYOff, nXSize, nYSize, eBufType, nBandCount,
+                           panBandMap);
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                           RenderSources()                            */
+/************************************************************************/
+
+// Must be called after CollectSources()
+CPLErr GDALTileIndexDataset::RenderSources(
+    bool bNeedInitBuffer, int nBandNrMax, int nXOff, int nYOff, int nXSize,
+    int nYSize, double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    int nBufXSize, int nBufYSize, void *pData, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
     if (!bNeedInitBuffer)
     {
         return RenderSource(
@@ -5851,6 +6585,20 @@ void GDALRegister_GTI()
 
     poDriver->pfnOpen = GDALTileIndexDatasetOpen;
     poDriver->pfnIdentify = GDALTileIndexDatasetIdentify;
+    poDriver->pfnCreateCopy = GDALTileIndexDataset::CreateCopy;
+
+    poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
+    poDriver->SetMetadataItem(
+        GDAL_DMD_CREATIONOPTIONLIST,
+        "<CreationOptionList>"
+        "  <Option name='FORMAT' type='string' description="
+        "'Vector driver used to write the tile index' default='GPKG'/>"
+        "  <Option name='LAYER' type='string' description="
+        "'Name of the tile index layer'/>"
+        "  <Option name='LOCATION_FIELD' type='string' description="
+        "'Name of the field with the source dataset names' "
+        "default='location'/>"
+        "</CreationOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
 
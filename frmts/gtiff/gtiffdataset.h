@@ -459,6 +459,24 @@ class GTiffDataset final : public GDALPamDataset
                                      GDALProgressFunc pfnProgress,
                                      void *pProgressData);
 
+    //! How encoded striles of a source dataset can be transferred to a target
+    enum class RawStrileCopyMode
+    {
+        //! Pixels must be decoded and re-encoded
+        NONE,
+        //! Encoded bytes are copied verbatim
+        VERBATIM,
+        //! Only the codec is changed, predictor and interleaving are kept
+        RECOMPRESS,
+    };
+
+    static RawStrileCopyMode GetRawStrileCopyMode(GTiffDataset *poDstDS,
+                                                  GTiffDataset *poSrcDS);
+
+    CPLErr CopyRawStriles(GTiffDataset *poSrcDS, RawStrileCopyMode eMode,
+                          int nFirstStrile, int nStrileCount, int nStrileStride,
+                          std::vector<GByte> &abyTmpBuffer, bool &bCopied);
+
     bool GetOverviewParameters(int &nCompression, uint16_t &nPlanarConfig,
                                uint16_t &nPredictor, uint16_t &nPhotometric,
                                int &nOvrJpegQuality, std::string &osNoData,
@@ -29,6 +29,7 @@
 #include <tuple>
 #include <utility>
 
+#include "cpl_compressor.h"
 #include "cpl_error.h"
 #include "cpl_error_internal.h"  // CPLErrorHandlerAccumulatorStruct
 #include "cpl_float.h"
@@ -7001,6 +7002,285 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     return poDS.release();
 }
 
+/************************************************************************/
+/*                        GetRawStrileCopyMode()                        */
+/************************************************************************/
+
+// Determine whether the encoded striles of poSrcDS can be written as such in
+// poDstDS (same lossless codec), or if only the codec needs to be changed
+// (DEFLATE <--> ZSTD). In both cases, predictor, pixel interleaving and
+// byte order must be identical, as the raw strile payload depends on them.
+
+/* static */
+GTiffDataset::RawStrileCopyMode
+GTiffDataset::GetRawStrileCopyMode(GTiffDataset *poDstDS,
+                                   GTiffDataset *poSrcDS)
+{
+    if (!CPLTestBool(CPLGetConfigOption("GTIFF_RAW_STRILE_COPY", "YES")))
+        return RawStrileCopyMode::NONE;
+
+    if (poSrcDS->eAccess != GA_ReadOnly || poSrcDS->m_bStreamingIn ||
+        poDstDS->m_bStreamingOut || poSrcDS->m_bTreatAsSplit ||
+        poSrcDS->m_bTreatAsSplitBitmap || poDstDS->m_bTreatAsSplit ||
+        poDstDS->m_bTreatAsSplitBitmap || poDstDS->m_panMaskOffsetLsb ||
+        poSrcDS->m_bIgnoreReadErrors)
+    {
+        return RawStrileCopyMode::NONE;
+    }
+
+    if (poSrcDS->nRasterXSize != poDstDS->nRasterXSize ||
+        poSrcDS->nRasterYSize != poDstDS->nRasterYSize ||
+        poSrcDS->nBands != poDstDS->nBands ||
+        poSrcDS->m_nBlockXSize != poDstDS->m_nBlockXSize ||
+        poSrcDS->m_nBlockYSize != poDstDS->m_nBlockYSize ||
+        poSrcDS->m_nPlanarConfig != poDstDS->m_nPlanarConfig ||
+        poSrcDS->m_nSamplesPerPixel != poDstDS->m_nSamplesPerPixel ||
+        poSrcDS->m_nBitsPerSample != poDstDS->m_nBitsPerSample ||
+        poSrcDS->m_nSampleFormat != poDstDS->m_nSampleFormat ||
+        poSrcDS->m_nPhotometric == PHOTOMETRIC_YCBCR ||
+        poDstDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+    {
+        return RawStrileCopyMode::NONE;
+    }
+
+    // Overviews and masks share the TIFF handle of their base dataset, so
+    // make sure the tags below are read from the right IFD.
+    if (!poSrcDS->SetDirectory() || !poDstDS->SetDirectory())
+        return RawStrileCopyMode::NONE;
+
+    if (TIFFIsTiled(poSrcDS->m_hTIFF) != TIFFIsTiled(poDstDS->m_hTIFF) ||
+        TIFFIsByteSwapped(poSrcDS->m_hTIFF) !=
+            TIFFIsByteSwapped(poDstDS->m_hTIFF))
+    {
+        return RawStrileCopyMode::NONE;
+    }
+
+    uint16_t nSrcPredictor = PREDICTOR_NONE;
+    uint16_t nDstPredictor = PREDICTOR_NONE;
+    TIFFGetField(poSrcDS->m_hTIFF, TIFFTAG_PREDICTOR, &nSrcPredictor);
+    TIFFGetField(poDstDS->m_hTIFF, TIFFTAG_PREDICTOR, &nDstPredictor);
+    if (nSrcPredictor != nDstPredictor)
+        return RawStrileCopyMode::NONE;
+
+    const auto IsZlib = [](int nCompression)
+    {
+        return nCompression == COMPRESSION_ADOBE_DEFLATE ||
+               nCompression == COMPRESSION_DEFLATE;
+    };
+
+    const int nSrcCompression = poSrcDS->m_nCompression;
+    const int nDstCompression = poDstDS->m_nCompression;
+    if (nSrcCompression == nDstCompression ||
+        (IsZlib(nSrcCompression) && IsZlib(nDstCompression)))
+    {
+        // Only lossless codecs whose payload does not depend on other tags
+        // (JPEGTables, LERC parameters, etc.) or on quality settings.
+        if (nSrcCompression == COMPRESSION_NONE ||
+            nSrcCompression == COMPRESSION_LZW ||
+            nSrcCompression == COMPRESSION_PACKBITS ||
+            nSrcCompression == COMPRESSION_LZMA ||
+            nSrcCompression == COMPRESSION_ZSTD || IsZlib(nSrcCompression))
+        {
+            return RawStrileCopyMode::VERBATIM;
+        }
+        return RawStrileCopyMode::NONE;
+    }
+
+    const auto IsRecompressible = [&IsZlib](int nCompression)
+    {
+        return (IsZlib(nCompression) && CPLGetDecompressor("zlib") &&
+                CPLGetCompressor("zlib")) ||
+               (nCompression == COMPRESSION_ZSTD &&
+                CPLGetDecompressor("zstd") && CPLGetCompressor("zstd"));
+    };
+    if (IsRecompressible(nSrcCompression) && IsRecompressible(nDstCompression))
+    {
+        return RawStrileCopyMode::RECOMPRESS;
+    }
+
+    return RawStrileCopyMode::NONE;
+}
+
+/************************************************************************/
+/*                           CopyRawStriles()                           */
+/************************************************************************/
+
+// Copy striles nFirstStrile + i * nStrileStride, for i in [0, nStrileCount[,
+// from poSrcDS without decoding pixels. If all of them are missing in the
+// source (sparse file) and empty blocks need not be written, they are left
+// missing in this dataset too, as GDALDatasetCopyWholeRaster(SKIP_HOLES=YES)
+// would do. Otherwise, if one of them is missing, bCopied is set to false
+// (without error), in which case the caller must go through the regular
+// decoding/encoding path.
+
+CPLErr GTiffDataset::CopyRawStriles(GTiffDataset *poSrcDS,
+                                    RawStrileCopyMode eMode, int nFirstStrile,
+                                    int nStrileCount, int nStrileStride,
+                                    std::vector<GByte> &abyTmpBuffer,
+                                    bool &bCopied)
+{
+    CPLAssert(eMode != RawStrileCopyMode::NONE);
+    bCopied = false;
+
+    int nMissing = 0;
+    for (int i = 0; i < nStrileCount; ++i)
+    {
+        if (!poSrcDS->IsBlockAvailable(nFirstStrile + i * nStrileStride,
+                                       nullptr, nullptr, nullptr))
+        {
+            ++nMissing;
+        }
+    }
+    if (nMissing == nStrileCount && !m_bWriteEmptyTiles)
+    {
+        bCopied = true;
+        return CE_None;
+    }
+    if (nMissing > 0)
+        return CE_None;
+
+    if (!poSrcDS->SetDirectory())
+        return CE_Failure;
+    Crystalize();
+
+    // Striles must be written in order with respect to the ones that might
+    // be pending in compression worker threads.
+    auto poQueue = m_poBaseDS ? m_poBaseDS->m_poCompressQueue.get()
+                              : m_poCompressQueue.get();
+    if (poQueue)
+    {
+        poQueue->WaitCompletion();
+        // cppcheck-suppress constVariableReference
+        auto &oQueue =
+            m_poBaseDS ? m_poBaseDS->m_asQueueJobIdx : m_asQueueJobIdx;
+        while (!oQueue.empty())
+        {
+            WaitCompletionForJobIdx(oQueue.front());
+        }
+    }
+
+    // Pending jobs may have written striles of a dataset sharing our TIFF
+    // handle (mask, overview), so select our directory only now.
+    if (!SetDirectory())
+        return CE_Failure;
+
+    const CPLCompressor *psDecompressor = nullptr;
+    const CPLCompressor *psCompressor = nullptr;
+    CPLStringList aosCompressorOptions;
+    size_t nUncompressedMaxSize = 0;
+    if (eMode == RawStrileCopyMode::RECOMPRESS)
+    {
+        psDecompressor = CPLGetDecompressor(
+            poSrcDS->m_nCompression == COMPRESSION_ZSTD ? "zstd" : "zlib");
+        if (m_nCompression == COMPRESSION_ZSTD)
+        {
+            psCompressor = CPLGetCompressor("zstd");
+            if (m_nZSTDLevel >= 0)
+                aosCompressorOptions.SetNameValue(
+                    "LEVEL", CPLSPrintf("%d", m_nZSTDLevel));
+        }
+        else
+        {
+            psCompressor = CPLGetCompressor("zlib");
+            if (m_nZLevel >= 0)
+                aosCompressorOptions.SetNameValue("LEVEL",
+                                                  CPLSPrintf("%d", m_nZLevel));
+        }
+        if (!psDecompressor || !psCompressor)
+            return CE_Failure;
+        nUncompressedMaxSize = static_cast<size_t>(
+            TIFFIsTiled(m_hTIFF) ? TIFFTileSize64(m_hTIFF)
+                                 : TIFFStripSize64(m_hTIFF));
+    }
+
+    std::vector<GByte> abyUncompressed;
+    for (int i = 0; i < nStrileCount; ++i)
+    {
+        const int nStrile = nFirstStrile + i * nStrileStride;
+        vsi_l_offset nSize = 0;
+        if (!poSrcDS->IsBlockAvailable(nStrile, nullptr, &nSize, nullptr) ||
+            nSize > static_cast<vsi_l_offset>(
+                        std::numeric_limits<tmsize_t>::max()))
+        {
+            return CE_Failure;
+        }
+        try
+        {
+            abyTmpBuffer.resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in CopyRawStriles()");
+            return CE_Failure;
+        }
+        const auto nStrileSize = static_cast<tmsize_t>(nSize);
+        const tmsize_t nRead =
+            TIFFIsTiled(poSrcDS->m_hTIFF)
+                ? TIFFReadRawTile(poSrcDS->m_hTIFF, nStrile,
+                                  abyTmpBuffer.data(), nStrileSize)
+                : TIFFReadRawStrip(poSrcDS->m_hTIFF, nStrile,
+                                   abyTmpBuffer.data(), nStrileSize);
+        if (nRead != nStrileSize)
+        {
+            ReportError(CE_Failure, CPLE_FileIO,
+                        "Cannot read raw strile %d of source dataset", nStrile);
+            return CE_Failure;
+        }
+
+        if (eMode == RawStrileCopyMode::VERBATIM)
+        {
+            WriteRawStripOrTile(nStrile, abyTmpBuffer.data(), nStrileSize);
+        }
+        else
+        {
+            if (abyUncompressed.empty())
+            {
+                try
+                {
+                    abyUncompressed.resize(nUncompressedMaxSize);
+                }
+                catch (const std::exception &)
+                {
+                    ReportError(CE_Failure, CPLE_OutOfMemory,
+                                "Out of memory in CopyRawStriles()");
+                    return CE_Failure;
+                }
+            }
+            void *pUncompressed = abyUncompressed.data();
+            size_t nUncompressedSize = abyUncompressed.size();
+            if (!psDecompressor->pfnFunc(
+                    abyTmpBuffer.data(), abyTmpBuffer.size(), &pUncompressed,
+                    &nUncompressedSize, nullptr, psDecompressor->user_data))
+            {
+                ReportError(CE_Failure, CPLE_AppDefined,
+                            "Cannot decompress strile %d of source dataset",
+                            nStrile);
+                return CE_Failure;
+            }
+            void *pCompressed = nullptr;
+            size_t nCompressedSize = 0;
+            if (!psCompressor->pfnFunc(pUncompressed, nUncompressedSize,
+                                       &pCompressed, &nCompressedSize,
+                                       aosCompressorOptions.List(),
+                                       psCompressor->user_data))
+            {
+                ReportError(CE_Failure, CPLE_AppDefined,
+                            "Cannot compress strile %d", nStrile);
+                return CE_Failure;
+            }
+            WriteRawStripOrTile(nStrile, static_cast<GByte *>(pCompressed),
+                                static_cast<GPtrDiff_t>(nCompressedSize));
+            VSIFree(pCompressed);
+        }
+        if (m_bWriteError)
+            return CE_Failure;
+    }
+
+    bCopied = true;
+    return CE_None;
+}
+
 /************************************************************************/
 /*                         CopyImageryAndMask()                         */
 /************************************************************************/
@@ -7034,6 +7314,43 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
         CPLAssert(poDstDS->m_poMaskDS->m_nBlockYSize == poDstDS->m_nBlockYSize);
     }
 
+    // Check if we can transfer encoded striles from a GTiff source, instead
+    // of decoding and re-encoding them.
+    auto poSrcGTiffDS = dynamic_cast<GTiffDataset *>(poSrcDS);
+    const RawStrileCopyMode eRawCopyMode =
+        poSrcGTiffDS ? GetRawStrileCopyMode(poDstDS, poSrcGTiffDS)
+                     : RawStrileCopyMode::NONE;
+    GTiffDataset *poSrcGTiffMaskDS = nullptr;
+    RawStrileCopyMode eMaskRawCopyMode = RawStrileCopyMode::NONE;
+    if (poSrcGTiffDS && poSrcGTiffDS->m_poMaskDS && poDstDS->m_poMaskDS &&
+        poSrcMaskBand == poSrcGTiffDS->m_poMaskDS->GetRasterBand(1))
+    {
+        poSrcGTiffMaskDS = poSrcGTiffDS->m_poMaskDS.get();
+        eMaskRawCopyMode = GetRawStrileCopyMode(poDstDS->m_poMaskDS.get(),
+                                                poSrcGTiffMaskDS);
+    }
+    if (eRawCopyMode != RawStrileCopyMode::NONE)
+    {
+        CPLDebug("GTiff", "Copying %s striles from %s",
+                 eRawCopyMode == RawStrileCopyMode::VERBATIM ? "raw"
+                                                             : "recompressed",
+                 poSrcDS->GetDescription());
+    }
+    std::vector<GByte> abyRawStrile;
+    const auto TryCopyRawStriles =
+        [&abyRawStrile](GTiffDataset *poDst, GTiffDataset *poSrc,
+                        RawStrileCopyMode eMode, int nFirstStrile,
+                        int nStrileCount, int nStrileStride, CPLErr &eErrOut)
+    {
+        if (eMode == RawStrileCopyMode::NONE)
+            return false;
+        bool bCopied = false;
+        eErrOut = poDst->CopyRawStriles(poSrc, eMode, nFirstStrile,
+                                        nStrileCount, nStrileStride,
+                                        abyRawStrile, bCopied);
+        return bCopied || eErrOut != CE_None;
+    };
+
     if (poDstDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE &&
         !poDstDS->m_bTileInterleave)
     {
@@ -7056,23 +7373,27 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     const int nReqXSize =
                         std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
-                    {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize * nDataTypeSize);
-                    }
-                    eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    if (!TryCopyRawStriles(poDstDS, poSrcGTiffDS, eRawCopyMode,
+                                           iBlock, 1, 0, eErr))
                     {
-                        eErr = poDstDS->WriteEncodedTileOrStrip(
-                            iBlock, pBlockBuffer, false);
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize * nDataTypeSize);
+                        }
+                        eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
+                            nReqXSize, nReqYSize, eType, nDataTypeSize,
+                            static_cast<GSpacing>(nDataTypeSize) *
+                                poDstDS->m_nBlockXSize,
+                            nullptr);
+                        if (eErr == CE_None)
+                        {
+                            eErr = poDstDS->WriteEncodedTileOrStrip(
+                                iBlock, pBlockBuffer, false);
+                        }
                     }
 
                     iBlock++;
@@ -7107,26 +7428,32 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     const int nReqXSize =
                         std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
-                    {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize);
-                    }
-                    eErr = poSrcMaskBand->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, GDT_UInt8, 1,
-                        poDstDS->m_nBlockXSize, nullptr);
-                    if (eErr == CE_None)
+                    if (!TryCopyRawStriles(poDstDS->m_poMaskDS.get(),
+                                           poSrcGTiffMaskDS, eMaskRawCopyMode,
+                                           iBlockMask, 1, 0, eErr))
                     {
-                        // Avoid any attempt to load from disk
-                        poDstDS->m_poMaskDS->m_nLoadedBlock = iBlockMask;
-                        eErr =
-                            poDstDS->m_poMaskDS->GetRasterBand(1)->WriteBlock(
-                                nXBlock, nYBlock, pBlockBuffer);
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize);
+                        }
+                        eErr = poSrcMaskBand->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
+                            nReqXSize, nReqYSize, GDT_UInt8, 1,
+                            poDstDS->m_nBlockXSize, nullptr);
                         if (eErr == CE_None)
-                            eErr = poDstDS->m_poMaskDS->FlushBlockBuf();
+                        {
+                            // Avoid any attempt to load from disk
+                            poDstDS->m_poMaskDS->m_nLoadedBlock = iBlockMask;
+                            auto poDstMaskBand =
+                                poDstDS->m_poMaskDS->GetRasterBand(1);
+                            eErr = poDstMaskBand->WriteBlock(nXBlock, nYBlock,
+                                                             pBlockBuffer);
+                            if (eErr == CE_None)
+                                eErr = poDstDS->m_poMaskDS->FlushBlockBuf();
+                        }
                     }
 
                     iBlockMask++;
@@ -7163,8 +7490,12 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
             {
                 const int nReqXSize =
                     std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                if (nReqXSize < poDstDS->m_nBlockXSize ||
-                    nReqYSize < poDstDS->m_nBlockYSize)
+                const bool bRawCopied = TryCopyRawStriles(
+                    poDstDS, poSrcGTiffDS, eRawCopyMode, iBlock,
+                    poDstDS->m_bTileInterleave ? l_nBands : 1,
+                    poDstDS->m_nBlocksPerBand, eErr);
+                if (!bRawCopied && (nReqXSize < poDstDS->m_nBlockXSize ||
+                                    nReqYSize < poDstDS->m_nBlockYSize))
                 {
                     memset(pBlockBuffer, 0,
                            static_cast<size_t>(poDstDS->m_nBlockXSize) *
@@ -7172,7 +7503,11 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                                nDataTypeSize);
                 }
 
-                if (poDstDS->m_bTileInterleave)
+                if (bRawCopied)
+                {
+                    // Encoded striles already transferred from the source
+                }
+                else if (poDstDS->m_bTileInterleave)
                 {
                     eErr = poSrcDS->RasterIO(
                         GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
@@ -7269,26 +7604,32 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
 
                 if (eErr == CE_None && poDstDS->m_poMaskDS)
                 {
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
-                    {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize);
-                    }
-                    eErr = poSrcMaskBand->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, GDT_UInt8, 1,
-                        poDstDS->m_nBlockXSize, nullptr);
-                    if (eErr == CE_None)
+                    if (!TryCopyRawStriles(poDstDS->m_poMaskDS.get(),
+                                           poSrcGTiffMaskDS, eMaskRawCopyMode,
+                                           iBlock, 1, 0, eErr))
                     {
-                        // Avoid any attempt to load from disk
-                        poDstDS->m_poMaskDS->m_nLoadedBlock = iBlock;
-                        eErr =
-                            poDstDS->m_poMaskDS->GetRasterBand(1)->WriteBlock(
-                                nXBlock, nYBlock, pBlockBuffer);
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize);
+                        }
+                        eErr = poSrcMaskBand->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
+                            nReqXSize, nReqYSize, GDT_UInt8, 1,
+                            poDstDS->m_nBlockXSize, nullptr);
                         if (eErr == CE_None)
-                            eErr = poDstDS->m_poMaskDS->FlushBlockBuf();
+                        {
+                            // Avoid any attempt to load from disk
+                            poDstDS->m_poMaskDS->m_nLoadedBlock = iBlock;
+                            auto poDstMaskBand =
+                                poDstDS->m_poMaskDS->GetRasterBand(1);
+                            eErr = poDstMaskBand->WriteBlock(nXBlock, nYBlock,
+                                                             pBlockBuffer);
+                            if (eErr == CE_None)
+                                eErr = poDstDS->m_poMaskDS->FlushBlockBuf();
+                        }
                     }
                 }
                 if (poDstDS->m_bWriteError)
@@ -8658,23 +8999,47 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             {
                 auto poDstDS = poDS->m_apoOverviewDS[iOvrLevel].get();
 
-                // Create a fake dataset with the source overview level so that
-                // GDALDatasetCopyWholeRaster can cope with it.
-                GDALDataset *poSrcOvrDS =
-                    poOvrDS
-                        ? (iOvrLevel == 0 ? poOvrDS.get()
-                                          : GDALCreateOverviewDataset(
-                                                poOvrDS.get(), iOvrLevel - 1,
-                                                /* bThisLevelOnly = */ true))
-                        : GDALCreateOverviewDataset(
-                              poSrcDS, iOvrLevel,
-                              /* bThisLevelOnly = */ true);
                 GDALRasterBand *poSrcOvrBand =
                     poOvrDS ? (iOvrLevel == 0
                                    ? poOvrDS->GetRasterBand(1)
                                    : poOvrDS->GetRasterBand(1)->GetOverview(
                                          iOvrLevel - 1))
                             : poSrcDS->GetRasterBand(1)->GetOverview(iOvrLevel);
+
+                // If the source overview is a GeoTIFF overview whose encoded
+                // striles can be reused, use it directly, so that
+                // CopyImageryAndMask() can transfer them without decoding.
+                GDALDataset *poSrcOvrDS = nullptr;
+                if (!poOvrDS && dynamic_cast<GTiffDataset *>(poSrcDS))
+                {
+                    auto poSrcGTiffOvrDS = dynamic_cast<GTiffDataset *>(
+                        poSrcOvrBand->GetDataset());
+                    if (poSrcGTiffOvrDS &&
+                        poSrcGTiffOvrDS->GetRasterCount() == l_nBands &&
+                        GetRawStrileCopyMode(poDstDS, poSrcGTiffOvrDS) !=
+                            RawStrileCopyMode::NONE)
+                    {
+                        poSrcOvrDS = poSrcGTiffOvrDS;
+                    }
+                }
+
+                // Otherwise create a fake dataset with the source overview
+                // level so that GDALDatasetCopyWholeRaster can cope with it.
+                const bool bOwnSrcOvrDS =
+                    poSrcOvrDS == nullptr &&
+                    !(poOvrDS != nullptr && iOvrLevel == 0);
+                if (poSrcOvrDS == nullptr)
+                {
+                    poSrcOvrDS =
+                        poOvrDS ? (iOvrLevel == 0
+                                       ? poOvrDS.get()
+                                       : GDALCreateOverviewDataset(
+                                             poOvrDS.get(), iOvrLevel - 1,
+                                             /* bThisLevelOnly = */ true))
+                                : GDALCreateOverviewDataset(
+                                      poSrcDS, iOvrLevel,
+                                      /* bThisLevelOnly = */ true);
+                }
                 double dfNextCurPixels =
                     dfCurPixels +
                     static_cast<double>(poSrcOvrBand->GetXSize()) *
@@ -8725,7 +9090,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                 dfCurPixels = dfNextCurPixels;
                 GDALDestroyScaledProgress(pScaledData);
 
-                if (poSrcOvrDS != poOvrDS.get())
+                if (bOwnSrcOvrDS)
                     delete poSrcOvrDS;
                 poSrcOvrDS = nullptr;
             }
@@ -8911,6 +9276,28 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                 bWriteMask = false;
             }
         }
+        else if (dynamic_cast<GTiffDataset *>(poSrcDS) &&
+                 GetRawStrileCopyMode(
+                     poDS.get(), cpl::down_cast<GTiffDataset *>(poSrcDS)) !=
+                     RawStrileCopyMode::NONE)
+        {
+            // Transfer encoded striles from the source GeoTIFF file
+            if (poDS->m_poMaskDS)
+            {
+                GDALDestroyScaledProgress(pScaledData);
+                pScaledData =
+                    GDALCreateScaledProgress(dfCurPixels / dfTotalPixels, 1.0,
+                                             pfnProgress, pProgressData);
+            }
+
+            eErr = CopyImageryAndMask(poDS.get(), poSrcDS,
+                                      poSrcDS->GetRasterBand(1)->GetMaskBand(),
+                                      GDALScaledProgress, pScaledData);
+            if (poDS->m_poMaskDS)
+            {
+                bWriteMask = false;
+            }
+        }
         else
         {
             eErr = GDALDatasetCopyWholeRaster(GDALDataset::ToHandle(poSrcDS),
@@ -2938,6 +2938,112 @@ static const char pszExprPixelFuncMetadata[] =
     "   <Argument type='builtin' value='geotransform' />"
     "</PixelFunctionArgumentsList>";
 
+/************************************************************************/
+/*                      ExprPixelFuncVectorized()                       */
+/************************************************************************/
+
+// Evaluates the expression one line at a time, rather than one pixel at a
+// time.
+static CPLErr ExprPixelFuncVectorized(
+    gdal::VectorizedExpression &oExpression, void **papoSources, int nSources,
+    void *pData, int nXSize, int nYSize, GDALDataType eSrcType,
+    GDALDataType eBufType, int nPixelSpace, int nLineSpace,
+    bool bPropagateNoData, double dfNoData, const GDALGeoTransform *pGT,
+    int nXOff, int nYOff)
+{
+    const int nVariables = nSources + (pGT ? 2 : 0);
+    std::unique_ptr<double, VSIFreeReleaser> padfBuffer(
+        static_cast<double *>(VSI_MALLOC3_VERBOSE(nVariables + 1, nXSize,
+                                                  sizeof(double))));
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyNoDataMask(static_cast<GByte *>(
+        VSI_MALLOC_VERBOSE(bPropagateNoData ? nXSize : 1)));
+    if (!padfBuffer || !pabyNoDataMask)
+        return CE_Failure;
+
+    std::vector<const double *> apadfVariables;
+    for (int iVar = 0; iVar < nVariables; ++iVar)
+    {
+        apadfVariables.push_back(padfBuffer.get() +
+                                 static_cast<size_t>(iVar) * nXSize);
+    }
+    double *padfResults =
+        padfBuffer.get() + static_cast<size_t>(nVariables) * nXSize;
+
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+        for (int iSrc = 0; iSrc < nSources; ++iSrc)
+        {
+            GDALCopyWords(static_cast<const GByte *>(papoSources[iSrc]) +
+                              nLineOffset * nSrcTypeSize,
+                          eSrcType, nSrcTypeSize,
+                          const_cast<double *>(apadfVariables[iSrc]),
+                          GDT_Float64, sizeof(double), nXSize);
+        }
+
+        int nNoDataCount = 0;
+        if (bPropagateNoData)
+        {
+            GByte *pabyMask = pabyNoDataMask.get();
+            std::fill_n(pabyMask, nXSize, static_cast<GByte>(0));
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                const double *padfSrc = apadfVariables[iSrc];
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    pabyMask[iCol] |=
+                        static_cast<GByte>(IsNoData(padfSrc[iCol], dfNoData));
+                }
+            }
+            for (int iCol = 0; iCol < nXSize; ++iCol)
+                nNoDataCount += pabyMask[iCol];
+        }
+
+        if (nNoDataCount == nXSize)
+        {
+            std::fill_n(padfResults, nXSize, dfNoData);
+        }
+        else
+        {
+            if (pGT)
+            {
+                double *padfCenterX =
+                    const_cast<double *>(apadfVariables[nSources]);
+                double *padfCenterY =
+                    const_cast<double *>(apadfVariables[nSources + 1]);
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    // Add 0.5 to pixel / line to move from pixel corner to
+                    // cell center
+                    pGT->Apply(static_cast<double>(iCol + nXOff) + 0.5,
+                               static_cast<double>(iLine + nYOff) + 0.5,
+                               &padfCenterX[iCol], &padfCenterY[iCol]);
+                }
+            }
+
+            oExpression.Evaluate(apadfVariables.data(), nXSize, padfResults);
+
+            if (nNoDataCount > 0)
+            {
+                const GByte *pabyMask = pabyNoDataMask.get();
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    if (pabyMask[iCol])
+                        padfResults[iCol] = dfNoData;
+                }
+            }
+        }
+
+        GDALCopyWords(padfResults, GDT_Float64, sizeof(double),
+                      static_cast<GByte *>(pData) +
+                          static_cast<GSpacing>(nLineSpace) * iLine,
+                      eBufType, nPixelSpace, nXSize);
+    }
+
+    return CE_None;
+}
+
 static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -3031,6 +3137,29 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         }
     }
 
+    if (!strstr(pszExpression, "BANDS") &&
+        CPLTestBool(CPLGetConfigOption("VRT_VECTORIZED_EXPRESSION", "YES")))
+    {
+        std::vector<std::string> aosVariables(aosSourceNames.begin(),
+                                              aosSourceNames.end());
+        if (includeCenterCoords)
+        {
+            aosVariables.push_back("_CENTER_X_");
+            aosVariables.push_back("_CENTER_Y_");
+        }
+        auto poVectorizedExpression = gdal::VectorizedExpression::Create(
+            pszExpression, pszDialect, aosVariables,
+            bHasNoData ? &dfNoData : nullptr);
+        if (poVectorizedExpression)
+        {
+            return ExprPixelFuncVectorized(
+                *poVectorizedExpression, papoSources, nSources, pData, nXSize,
+                nYSize, eSrcType, eBufType, nPixelSpace, nLineSpace,
+                bHasNoData && bPropagateNoData, dfNoData,
+                includeCenterCoords ? &gt : nullptr, nXOff, nYOff);
+        }
+    }
+
     {
         int iSource = 0;
         for (const auto &osName : aosSourceNames)
@@ -4374,86 +4503,123 @@ static CPLErr BasicPixelFunc(void **papoSources, int nSources, void *pData,
  */
 CPLErr GDALRegisterDefaultPixelFunc()
 {
-    GDALAddDerivedBandPixelFunc("real", RealPixelFunc);
-    GDALAddDerivedBandPixelFunc("imag", ImagPixelFunc);
-    GDALAddDerivedBandPixelFunc("complex", ComplexPixelFunc);
-    GDALAddDerivedBandPixelFuncWithArgs("polar", PolarPixelFunc,
-                                        pszPolarPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("mod", ModulePixelFunc,
-                                        pszModulePixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("abs", ModulePixelFunc,
-                                        pszModulePixelFuncMetadata);
-    GDALAddDerivedBandPixelFunc("phase", PhasePixelFunc);
-    GDALAddDerivedBandPixelFunc("conj", ConjPixelFunc);
-    GDALAddDerivedBandPixelFuncWithArgs("sum", SumPixelFunc,
-                                        pszSumPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("diff", DiffPixelFunc,
-                                        pszDiffPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("mul", MulPixelFunc,
-                                        pszMulPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("div", DivPixelFunc,
-                                        pszDivPixelFuncMetadata);
-    GDALAddDerivedBandPixelFunc("cmul", CMulPixelFunc);
-    GDALAddDerivedBandPixelFuncWithArgs("inv", InvPixelFunc,
-                                        pszInvPixelFuncMetadata);
-    GDALAddDerivedBandPixelFunc("intensity", IntensityPixelFunc);
-    GDALAddDerivedBandPixelFuncWithArgs("sqrt", SqrtPixelFunc,
-                                        pszSqrtPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("log10", Log10PixelFunc,
-                                        pszLog10PixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("dB", DBPixelFunc,
-                                        pszDBPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("exp", ExpPixelFunc,
-                                        pszExpPixelFuncMetadata);
-    GDALAddDerivedBandPixelFunc("dB2amp",
-                                dB2AmpPixelFunc);  // deprecated in v3.5
-    GDALAddDerivedBandPixelFunc("dB2pow",
-                                dB2PowPixelFunc);  // deprecated in v3.5
-    GDALAddDerivedBandPixelFuncWithArgs("pow", PowPixelFunc,
-                                        pszPowPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("interpolate_linear",
-                                        InterpolatePixelFunc<InterpolateLinear>,
-                                        pszInterpolatePixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs(
+    // None of the below functions has global state, so they may be called
+    // concurrently on different row stripes of a request.
+    constexpr bool bThreadSafe = true;
+
+    VRTDerivedRasterBand::AddPixelFunction("real", RealPixelFunc, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("imag", ImagPixelFunc, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("complex", ComplexPixelFunc,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("polar", PolarPixelFunc,
+                                           pszPolarPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("mod", ModulePixelFunc,
+                                           pszModulePixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("abs", ModulePixelFunc,
+                                           pszModulePixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("phase", PhasePixelFunc,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("conj", ConjPixelFunc, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("sum", SumPixelFunc,
+                                           pszSumPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("diff", DiffPixelFunc,
+                                           pszDiffPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("mul", MulPixelFunc,
+                                           pszMulPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("div", DivPixelFunc,
+                                           pszDivPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("cmul", CMulPixelFunc, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("inv", InvPixelFunc,
+                                           pszInvPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("intensity", IntensityPixelFunc,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("sqrt", SqrtPixelFunc,
+                                           pszSqrtPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("log10", Log10PixelFunc,
+                                           pszLog10PixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("dB", DBPixelFunc,
+                                           pszDBPixelFuncMetadata, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("exp", ExpPixelFunc,
+                                           pszExpPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("dB2amp", dB2AmpPixelFunc,
+                                           bThreadSafe);  // deprecated in v3.5
+    VRTDerivedRasterBand::AddPixelFunction("dB2pow", dB2PowPixelFunc,
+                                           bThreadSafe);  // deprecated in v3.5
+    VRTDerivedRasterBand::AddPixelFunction("pow", PowPixelFunc,
+                                           pszPowPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction(
+        "interpolate_linear", InterpolatePixelFunc<InterpolateLinear>,
+        pszInterpolatePixelFuncMetadata, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction(
         "interpolate_exp", InterpolatePixelFunc<InterpolateExponential>,
-        pszInterpolatePixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("replace_nodata",
-                                        ReplaceNoDataPixelFunc,
-                                        pszReplaceNoDataPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("scale", ScalePixelFunc,
-                                        pszScalePixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("norm_diff", NormDiffPixelFunc,
-                                        pszNormDiffPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("min", MinPixelFunc<ReturnValue>,
-                                        pszMinMaxFuncMetadataNodata);
-    GDALAddDerivedBandPixelFuncWithArgs("argmin", MinPixelFunc<ReturnIndex>,
-                                        pszArgMinMaxFuncMetadataNodata);
-    GDALAddDerivedBandPixelFuncWithArgs("max", MaxPixelFunc<ReturnValue>,
-                                        pszMinMaxFuncMetadataNodata);
-    GDALAddDerivedBandPixelFuncWithArgs("argmax", MaxPixelFunc<ReturnIndex>,
-                                        pszArgMinMaxFuncMetadataNodata);
-    GDALAddDerivedBandPixelFuncWithArgs("expression", ExprPixelFunc,
-                                        pszExprPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("reclassify", ReclassifyPixelFunc,
-                                        pszReclassifyPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("round", RoundPixelFunc,
-                                        pszRoundPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("mean", BasicPixelFunc<MeanKernel>,
-                                        pszBasicPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("geometric_mean",
-                                        BasicPixelFunc<GeoMeanKernel>,
-                                        pszBasicPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("harmonic_mean",
-                                        BasicPixelFunc<HarmonicMeanKernel>,
-                                        pszBasicPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("median", BasicPixelFunc<MedianKernel>,
-                                        pszBasicPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("quantile",
-                                        BasicPixelFunc<QuantileKernel>,
-                                        pszQuantilePixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("mode", BasicPixelFunc<ModeKernel>,
-                                        pszBasicPixelFuncMetadata);
-    GDALAddDerivedBandPixelFuncWithArgs("area", AreaPixelFunc,
-                                        pszAreaPixelFuncMetadata);
+        pszInterpolatePixelFuncMetadata, bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("replace_nodata",
+                                           ReplaceNoDataPixelFunc,
+                                           pszReplaceNoDataPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("scale", ScalePixelFunc,
+                                           pszScalePixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("norm_diff", NormDiffPixelFunc,
+                                           pszNormDiffPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("min", MinPixelFunc<ReturnValue>,
+                                           pszMinMaxFuncMetadataNodata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("argmin", MinPixelFunc<ReturnIndex>,
+                                           pszArgMinMaxFuncMetadataNodata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("max", MaxPixelFunc<ReturnValue>,
+                                           pszMinMaxFuncMetadataNodata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("argmax", MaxPixelFunc<ReturnIndex>,
+                                           pszArgMinMaxFuncMetadataNodata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("expression", ExprPixelFunc,
+                                           pszExprPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("reclassify", ReclassifyPixelFunc,
+                                           pszReclassifyPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("round", RoundPixelFunc,
+                                           pszRoundPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("mean", BasicPixelFunc<MeanKernel>,
+                                           pszBasicPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("geometric_mean",
+                                           BasicPixelFunc<GeoMeanKernel>,
+                                           pszBasicPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("harmonic_mean",
+                                           BasicPixelFunc<HarmonicMeanKernel>,
+                                           pszBasicPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("median",
+                                           BasicPixelFunc<MedianKernel>,
+                                           pszBasicPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("quantile",
+                                           BasicPixelFunc<QuantileKernel>,
+                                           pszQuantilePixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("mode", BasicPixelFunc<ModeKernel>,
+                                           pszBasicPixelFuncMetadata,
+                                           bThreadSafe);
+    VRTDerivedRasterBand::AddPixelFunction("area", AreaPixelFunc,
+                                           pszAreaPixelFuncMetadata,
+                                           bThreadSafe);
     return CE_None;
 }
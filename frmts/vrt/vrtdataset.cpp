@@ -2758,8 +2758,10 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
             auto oQueue = psThreadPool->CreateJobQueue();
             std::atomic<int> nCompletedJobs = 0;
-            for (auto &poSource : poBand->m_papoSources)
+            for (const int iSource : poBand->GetSourcesIntersecting(
+                     dfXOff, dfYOff, dfXSize, dfYSize))
             {
+                auto &poSource = poBand->m_papoSources[iSource];
                 if (!poSource->IsSimpleSource())
                     continue;
                 auto poSimpleSource =
@@ -2817,17 +2819,18 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             GDALProgressFunc pfnProgressGlobal = psExtraArg->pfnProgress;
             void *pProgressDataGlobal = psExtraArg->pProgressData;
 
-            const int nSources = static_cast<int>(poBand->m_papoSources.size());
-            for (int iSource = 0; eErr == CE_None && iSource < nSources;
-                 iSource++)
+            const std::vector<int> anSources = poBand->GetSourcesIntersecting(
+                dfXOff, dfYOff, dfXSize, dfYSize);
+            const int nSources = static_cast<int>(anSources.size());
+            for (int i = 0; eErr == CE_None && i < nSources; i++)
             {
                 psExtraArg->pfnProgress = GDALScaledProgress;
                 psExtraArg->pProgressData = GDALCreateScaledProgress(
-                    1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
+                    1.0 * i / nSources, 1.0 * (i + 1) / nSources,
                     pfnProgressGlobal, pProgressDataGlobal);
 
                 VRTSimpleSource *poSource = static_cast<VRTSimpleSource *>(
-                    poBand->m_papoSources[iSource].get());
+                    poBand->m_papoSources[anSources[i]].get());
 
                 eErr = poSource->DatasetRasterIO(
                     poBand->GetRasterDataType(), nXOff, nYOff, nXSize, nYSize,
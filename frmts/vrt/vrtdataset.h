@@ -18,6 +18,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_driver.h"
 #include "gdal_multidim.h"
 #include "gdal_pam.h"
@@ -788,6 +789,10 @@ class VRTProcessedDataset final : public VRTDataset
                    std::vector<double> &adfOutNoData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize,
                        GDALProgressFunc pfnProgress, void *pProgressData);
+    bool ProcessFusedSteps(int iFirstStep, int nStepCount, size_t nPixelCount,
+                           GDALDataType eInDT, double dfSrcXOff,
+                           double dfSrcYOff, double dfSrcXSize,
+                           double dfSrcYSize, const GDALGeoTransform &srcGT);
 };
 
 /************************************************************************/
@@ -945,10 +950,26 @@ class VRTSimpleSource;
 class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 {
   private:
+    friend class VRTDataset;
+
     CPLString m_osLastLocationInfo{};
     CPLStringList m_aosSourceList{};
     int m_nSkipBufferInitialization = -1;
 
+    // Spatial index of the destination windows of the sources, lazily built
+    // by GetSourcesIntersecting() when there are many sources.
+    mutable std::mutex m_oSourceIndexMutex{};
+    mutable CPLQuadTree *m_hSourceIndex = nullptr;
+    // Value of m_papoSources.data() and size() when m_hSourceIndex was built
+    mutable const void *m_pSourceIndexKey = nullptr;
+    mutable size_t m_nSourceIndexCount = 0;
+    // Sources that are not in m_hSourceIndex, and must always be considered
+    mutable std::vector<int> m_anSourcesNotInIndex{};
+
+    std::vector<int> GetSourcesIntersecting(double dfXOff, double dfYOff,
+                                            double dfXSize,
+                                            double dfYSize) const;
+
     bool CanUseSourcesMinMaxImplementations();
 
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
@@ -1076,6 +1097,8 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 
     void RemoveCoveredSources(CSLConstList papszOptions = nullptr);
 
+    void InvalidateSourceIndex();
+
     bool CanIRasterIOBeForwardedToEachSource(
         GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
         int nBufXSize, int nBufYSize,
@@ -1252,12 +1275,20 @@ class CPL_DLL VRTDerivedRasterBand CPL_NON_FINAL : public VRTSourcedRasterBand
     static CPLErr AddPixelFunction(const char *pszFuncNameIn,
                                    GDALDerivedPixelFuncWithArgs pfnPixelFunc,
                                    const char *pszMetadata);
+    static CPLErr AddPixelFunction(const char *pszFuncNameIn,
+                                   GDALDerivedPixelFunc pfnPixelFunc,
+                                   bool bThreadSafe);
+    static CPLErr AddPixelFunction(const char *pszFuncNameIn,
+                                   GDALDerivedPixelFuncWithArgs pfnPixelFunc,
+                                   const char *pszMetadata, bool bThreadSafe);
 
     static const std::pair<PixelFunc, std::string> *
     GetPixelFunction(const char *pszFuncNameIn);
 
     static std::vector<std::string> GetPixelFunctionNames();
 
+    static bool IsPixelFunctionThreadSafe(const char *pszFuncNameIn);
+
     void SetPixelFunctionName(const char *pszFuncNameIn);
     void AddPixelFunctionArgument(const char *pszArg, const char *pszValue);
     void SetSkipNonContributingSources(bool bSkip);
@@ -1665,6 +1696,8 @@ class CPL_DLL VRTComplexSource CPL_NON_FINAL : public VRTSimpleSource
     CPL_DISALLOW_COPY_ASSIGN(VRTComplexSource)
 
   protected:
+    friend class GDALTileIndexDataset;
+
     static constexpr int PROCESSING_FLAG_NODATA = 1 << 0;
     static constexpr int PROCESSING_FLAG_USE_MASK_BAND =
         1 << 1;  // Mutually exclusive with NODATA
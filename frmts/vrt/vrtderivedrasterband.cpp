@@ -12,17 +12,22 @@
  * SPDX-License-Identifier: MIT
  *****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "vrtdataset.h"
 #include "cpl_multiproc.h"
 #include "gdalpython.h"
 #include "gdalantirecursion.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <map>
+#include <set>
 #include <vector>
 #include <utility>
 
@@ -282,6 +287,51 @@ GetGlobalMapPixelFunction()
     return gosMapPixelFunction;
 }
 
+/************************************************************************/
+/*                GetGlobalSetThreadSafePixelFunction()                 */
+/************************************************************************/
+
+static std::set<std::string> &GetGlobalSetThreadSafePixelFunction()
+{
+    static std::set<std::string> goSetThreadSafePixelFunction;
+    return goSetThreadSafePixelFunction;
+}
+
+/************************************************************************/
+/*                       RegisterPixelFunction()                        */
+/************************************************************************/
+
+static void RegisterPixelFunction(const char *pszName,
+                                  VRTDerivedRasterBand::PixelFunc &&oFunc,
+                                  const char *pszMetadata, bool bThreadSafe)
+{
+    GetGlobalMapPixelFunction()[pszName] = {std::move(oFunc),
+                                            pszMetadata ? pszMetadata : ""};
+    if (bThreadSafe)
+        GetGlobalSetThreadSafePixelFunction().insert(pszName);
+    else
+        GetGlobalSetThreadSafePixelFunction().erase(pszName);
+}
+
+/************************************************************************/
+/*                      WrapPixelFunctionNoArgs()                       */
+/************************************************************************/
+
+static VRTDerivedRasterBand::PixelFunc
+WrapPixelFunctionNoArgs(GDALDerivedPixelFunc pfnNewFunction)
+{
+    return [pfnNewFunction](void **papoSources, int nSources, void *pData,
+                            int nBufXSize, int nBufYSize, GDALDataType eSrcType,
+                            GDALDataType eBufType, int nPixelSpace,
+                            int nLineSpace, CSLConstList papszFunctionArgs)
+    {
+        (void)papszFunctionArgs;
+        return pfnNewFunction(papoSources, nSources, pData, nBufXSize,
+                              nBufYSize, eSrcType, eBufType, nPixelSpace,
+                              nLineSpace);
+    };
+}
+
 /************************************************************************/
 /*                          AddPixelFunction()                          */
 /************************************************************************/
@@ -312,18 +362,8 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFunc(
         return CE_None;
     }
 
-    GetGlobalMapPixelFunction()[pszName] = {
-        [pfnNewFunction](void **papoSources, int nSources, void *pData,
-                         int nBufXSize, int nBufYSize, GDALDataType eSrcType,
-                         GDALDataType eBufType, int nPixelSpace, int nLineSpace,
-                         CSLConstList papszFunctionArgs)
-        {
-            (void)papszFunctionArgs;
-            return pfnNewFunction(papoSources, nSources, pData, nBufXSize,
-                                  nBufYSize, eSrcType, eBufType, nPixelSpace,
-                                  nLineSpace);
-        },
-        ""};
+    RegisterPixelFunction(pszName, WrapPixelFunctionNoArgs(pfnNewFunction),
+                          nullptr, /* bThreadSafe = */ false);
 
     return CE_None;
 }
@@ -355,8 +395,8 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFuncWithArgs(
         return CE_None;
     }
 
-    GetGlobalMapPixelFunction()[pszName] = {pfnNewFunction,
-                                            pszMetadata ? pszMetadata : ""};
+    RegisterPixelFunction(pszName, pfnNewFunction, pszMetadata,
+                          /* bThreadSafe = */ false);
 
     return CE_None;
 }
@@ -391,6 +431,53 @@ CPLErr VRTDerivedRasterBand::AddPixelFunction(
                                                pszMetadata);
 }
 
+/**
+ * This adds a pixel function to the global list of available pixel
+ * functions for derived bands, declaring whether it may be called
+ * concurrently from several threads, on different parts of a request.
+ *
+ * Functions registered through the other overloads, or the C API, are
+ * assumed not to be thread-safe.
+ *
+ * @param pszFuncNameIn Name used to access pixel function
+ * @param pfnNewFunction Pixel function associated with name.  An
+ *  existing pixel function registered with the same name will be
+ *  replaced with the new one.
+ * @param bThreadSafe Whether the pixel function is thread-safe.
+ *
+ * @return CE_None, invalid (NULL) parameters are currently ignored.
+ */
+CPLErr VRTDerivedRasterBand::AddPixelFunction(
+    const char *pszFuncNameIn, GDALDerivedPixelFunc pfnNewFunction,
+    bool bThreadSafe)
+{
+    if (!pszFuncNameIn || pszFuncNameIn[0] == '\0' || !pfnNewFunction)
+    {
+        return CE_None;
+    }
+
+    RegisterPixelFunction(pszFuncNameIn,
+                          WrapPixelFunctionNoArgs(pfnNewFunction), nullptr,
+                          bThreadSafe);
+
+    return CE_None;
+}
+
+CPLErr VRTDerivedRasterBand::AddPixelFunction(
+    const char *pszFuncNameIn, GDALDerivedPixelFuncWithArgs pfnNewFunction,
+    const char *pszMetadata, bool bThreadSafe)
+{
+    if (!pszFuncNameIn || pszFuncNameIn[0] == '\0' || !pfnNewFunction)
+    {
+        return CE_None;
+    }
+
+    RegisterPixelFunction(pszFuncNameIn, pfnNewFunction, pszMetadata,
+                          bThreadSafe);
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                          GetPixelFunction()                          */
 /************************************************************************/
@@ -442,6 +529,23 @@ std::vector<std::string> VRTDerivedRasterBand::GetPixelFunctionNames()
     return res;
 }
 
+/************************************************************************/
+/*                     IsPixelFunctionThreadSafe()                      */
+/************************************************************************/
+
+/**
+ * Return whether a pixel function may be called concurrently from several
+ * threads.
+ */
+/* static */
+bool VRTDerivedRasterBand::IsPixelFunctionThreadSafe(const char *pszFuncNameIn)
+{
+    if (pszFuncNameIn == nullptr)
+        return false;
+    const auto &oSet = GetGlobalSetThreadSafePixelFunction();
+    return oSet.find(pszFuncNameIn) != oSet.end();
+}
+
 /************************************************************************/
 /*                        SetPixelFunctionName()                        */
 /************************************************************************/
@@ -1065,6 +1169,40 @@ static bool CreateMapBufferIdxToSourceIdx(
     return true;
 }
 
+/************************************************************************/
+/*                      CanReadSourcesInParallel()                      */
+/************************************************************************/
+
+// Minimum number of pixels of a request for it to be split among threads
+constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
+
+// Set in the jobs of VRTDerivedRasterBand::IRasterIO(), to avoid nested
+// submissions to the global thread pool, which could deadlock it.
+static thread_local bool gbInVRTDerivedRasterBandJob = false;
+
+static bool CanReadSourcesInParallel(
+    const std::vector<std::unique_ptr<VRTSource>> &apoSources,
+    const std::vector<int> &anMapBufferIdxToSourceIdx)
+{
+    if (gbInVRTDerivedRasterBandJob)
+        return false;
+
+    // Check there are not several sources with the same name, to avoid
+    // the same GDALDataset* to be used from multiple threads.
+    std::set<std::string> oSetDSName;
+    for (const int iSource : anMapBufferIdxToSourceIdx)
+    {
+        if (!apoSources[iSource]->IsSimpleSource())
+            return false;
+        const auto &osDSName =
+            cpl::down_cast<const VRTSimpleSource *>(apoSources[iSource].get())
+                ->GetSourceDatasetName();
+        if (osDSName.empty() || !oSetDSName.insert(osDSName).second)
+            return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1471,25 +1609,22 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
                              nRasterYSize - nYOffExt);
     }
 
-    // Load values for sources into packed buffers.
-    CPLErr eErr = CE_None;
-    VRTSource::WorkingState oWorkingState;
-    for (size_t iBuffer = 0;
-         iBuffer < anMapBufferIdxToSourceIdx.size() && eErr == CE_None;
-         iBuffer++)
+    const auto LoadSourceBuffer =
+        [&](size_t iBuffer, GDALRasterIOExtraArg *psSourceExtraArg,
+            VRTSource::WorkingState &oState)
     {
         const int iSource = anMapBufferIdxToSourceIdx[iBuffer];
         GByte *pabyBuffer = static_cast<GByte *>(apBuffers[iBuffer].get());
-        eErr = static_cast<VRTSource *>(m_papoSources[iSource].get())
-                   ->RasterIO(
-                       eSrcType, nXOffExt, nYOffExt, nXSizeExt, nYSizeExt,
-                       pabyBuffer + (static_cast<size_t>(nYShiftInBuffer) *
-                                         nExtBufXSize +
-                                     nXShiftInBuffer) *
-                                        nSrcTypeSize,
-                       nExtBufXSizeReq, nExtBufYSizeReq, eSrcType, nSrcTypeSize,
-                       static_cast<GSpacing>(nSrcTypeSize) * nExtBufXSize,
-                       &sExtraArg, oWorkingState);
+        const CPLErr eSourceErr =
+            m_papoSources[iSource]->RasterIO(
+                eSrcType, nXOffExt, nYOffExt, nXSizeExt, nYSizeExt,
+                pabyBuffer +
+                    (static_cast<size_t>(nYShiftInBuffer) * nExtBufXSize +
+                     nXShiftInBuffer) *
+                        nSrcTypeSize,
+                nExtBufXSizeReq, nExtBufYSizeReq, eSrcType, nSrcTypeSize,
+                static_cast<GSpacing>(nSrcTypeSize) * nExtBufXSize,
+                psSourceExtraArg, oState);
 
         // Extend first lines
         for (int iY = 0; iY < nYShiftInBuffer; iY++)
@@ -1548,6 +1683,77 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
                 }
             }
         }
+        return eSourceErr;
+    };
+
+    // Load values for sources into packed buffers.
+    CPLErr eErr = CE_None;
+    const int nBufferCount = static_cast<int>(anMapBufferIdxToSourceIdx.size());
+    int nMaxThreads = 0;
+    if (l_poDS && nBufferCount > 1 &&
+        static_cast<int64_t>(nExtBufXSize) * nExtBufYSize >=
+            MINIMUM_PIXEL_COUNT_FOR_THREADED_IO &&
+        CanReadSourcesInParallel(m_papoSources, anMapBufferIdxToSourceIdx) &&
+        (nMaxThreads = VRTDataset::GetNumThreads(l_poDS)) > 1)
+    {
+        // Each source refers to a different dataset, so they can be read
+        // concurrently.
+        l_poDS->m_oMapSharedSources.InitMutex();
+        CPLWorkerThreadPool *psThreadPool =
+            GDALGetGlobalThreadPool(std::min(nBufferCount, nMaxThreads));
+        auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+        if (poQueue)
+        {
+            CPLDebugOnly("VRT", "Reading %d sources in parallel",
+                         nBufferCount);
+            CPLErrorAccumulator oErrorAccumulator;
+            std::atomic<bool> bSuccess = true;
+            for (int iBuffer = 0; iBuffer < nBufferCount; ++iBuffer)
+            {
+                if (!poQueue->SubmitJob(
+                    [iBuffer, &sExtraArg, &LoadSourceBuffer, &oErrorAccumulator,
+                     &bSuccess]()
+                    {
+                        if (!bSuccess)
+                            return;
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        gbInVRTDerivedRasterBandJob = true;
+                        GDALRasterIOExtraArg sJobExtraArg(sExtraArg);
+                        sJobExtraArg.pfnProgress = nullptr;
+                        sJobExtraArg.pProgressData = nullptr;
+                        VRTSource::WorkingState oState;
+                        if (LoadSourceBuffer(iBuffer, &sJobExtraArg, oState) !=
+                            CE_None)
+                        {
+                            bSuccess = false;
+                        }
+                        gbInVRTDerivedRasterBandJob = false;
+                    }))
+                {
+                    bSuccess = false;
+                    break;
+                }
+            }
+            poQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+            if (!bSuccess)
+                eErr = CE_Failure;
+        }
+        else
+        {
+            nMaxThreads = 0;
+        }
+    }
+    if (nMaxThreads <= 1)
+    {
+        VRTSource::WorkingState oWorkingState;
+        for (int iBuffer = 0; iBuffer < nBufferCount && eErr == CE_None;
+             iBuffer++)
+        {
+            eErr = LoadSourceBuffer(iBuffer, &sExtraArg, oWorkingState);
+        }
     }
 
     // Collect any pixel function arguments into oAdditionalArgs
@@ -1562,7 +1768,6 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
     }
 
     // Apply pixel function.
-    const int nBufferCount = static_cast<int>(anMapBufferIdxToSourceIdx.size());
     if (eErr == CE_None && EQUAL(m_poPrivate->m_osLanguage, "Python"))
     {
         // numpy doesn't have native cint16/cint32/cfloat16
@@ -1714,13 +1919,100 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
         }
 
         static_assert(sizeof(apBuffers[0]) == sizeof(void *));
-        eErr = (poPixelFunc->first)(
-            // We cast vector<unique_ptr<void>>.data() as void**. This is OK
-            // given above static_assert
-            reinterpret_cast<void **>(apBuffers.data()), nBufferCount, pData,
-            nBufXSize, nBufYSize, eSrcType, eBufType,
-            static_cast<int>(nPixelSpace), static_cast<int>(nLineSpace),
-            aosArgs.List());
+        // We cast vector<unique_ptr<void>>.data() as void**. This is OK
+        // given above static_assert
+        void **papSources = reinterpret_cast<void **>(apBuffers.data());
+
+        // Split large requests into row stripes processed by the global
+        // thread pool, if the pixel function allows it. Functions using the
+        // "crs" argument are excluded, as they share an OGRSpatialReference.
+        int nStripes = 1;
+        const bool bUsesYOff = aosArgs.FetchNameValue("yoff") != nullptr;
+        if (nBufferRadius == 0 && !gbInVRTDerivedRasterBandJob &&
+            static_cast<int64_t>(nBufXSize) * nBufYSize >=
+                MINIMUM_PIXEL_COUNT_FOR_THREADED_IO &&
+            (!bUsesYOff || nBufYSize == nYSize) &&
+            aosArgs.FetchNameValue("crs") == nullptr &&
+            IsPixelFunctionThreadSafe(osFuncName.c_str()))
+        {
+            nStripes = std::min(VRTDataset::GetNumThreads(poDS), nBufYSize);
+        }
+        CPLWorkerThreadPool *psThreadPool =
+            nStripes > 1 ? GDALGetGlobalThreadPool(nStripes) : nullptr;
+        auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+        if (poQueue)
+        {
+            CPLDebugOnly("VRT", "Applying pixel function on %d row stripes",
+                         nStripes);
+            std::vector<CPLStringList> aosStripeArgs(nStripes, aosArgs);
+            std::vector<std::vector<void *>> aapStripeSources(
+                nStripes, std::vector<void *>(nBufferCount));
+            CPLErrorAccumulator oErrorAccumulator;
+            std::atomic<bool> bSuccess = true;
+            for (int iStripe = 0; iStripe < nStripes; ++iStripe)
+            {
+                const int nStripeYOff = static_cast<int>(
+                    static_cast<int64_t>(nBufYSize) * iStripe / nStripes);
+                const int nStripeYSize =
+                    static_cast<int>(static_cast<int64_t>(nBufYSize) *
+                                     (iStripe + 1) / nStripes) -
+                    nStripeYOff;
+                if (bUsesYOff)
+                {
+                    aosStripeArgs[iStripe].SetNameValue(
+                        "yoff", CPLSPrintf("%d", nYOff + nStripeYOff));
+                }
+                for (int i = 0; i < nBufferCount; ++i)
+                {
+                    aapStripeSources[iStripe][i] =
+                        static_cast<GByte *>(papSources[i]) +
+                        static_cast<size_t>(nStripeYOff) * nBufXSize *
+                            nSrcTypeSize;
+                }
+                GByte *pabyStripeData =
+                    static_cast<GByte *>(pData) + nStripeYOff * nLineSpace;
+                const CSLConstList papszStripeArgs =
+                    aosStripeArgs[iStripe].List();
+                void **papStripeSources = aapStripeSources[iStripe].data();
+                if (!poQueue->SubmitJob(
+                    [poPixelFunc, papStripeSources, nBufferCount,
+                     pabyStripeData, nBufXSize, nStripeYSize, eSrcType,
+                     eBufType, nPixelSpace, nLineSpace, papszStripeArgs,
+                     &oErrorAccumulator, &bSuccess]()
+                    {
+                        if (!bSuccess)
+                            return;
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        gbInVRTDerivedRasterBandJob = true;
+                        if ((poPixelFunc->first)(
+                                papStripeSources, nBufferCount, pabyStripeData,
+                                nBufXSize, nStripeYSize, eSrcType, eBufType,
+                                static_cast<int>(nPixelSpace),
+                                static_cast<int>(nLineSpace),
+                                papszStripeArgs) != CE_None)
+                        {
+                            bSuccess = false;
+                        }
+                        gbInVRTDerivedRasterBandJob = false;
+                    }))
+                {
+                    bSuccess = false;
+                    break;
+                }
+            }
+            poQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+            eErr = bSuccess ? CE_None : CE_Failure;
+        }
+        else
+        {
+            eErr = (poPixelFunc->first)(
+                papSources, nBufferCount, pData, nBufXSize, nBufYSize,
+                eSrcType, eBufType, static_cast<int>(nPixelSpace),
+                static_cast<int>(nLineSpace), aosArgs.List());
+        }
     }
 
     return eErr;
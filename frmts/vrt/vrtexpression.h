@@ -14,6 +14,8 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -101,6 +103,56 @@ class MathExpression /* non final */
 
 /*! @cond Doxygen_Suppress */
 
+/**
+ * Class to evaluate an expression over arrays of values, rather than one
+ * pixel at a time.
+ *
+ * Only a subset of the muparser and exprtk syntaxes is supported: arithmetic
+ * and comparison operators, and the most common mathematical functions.
+ * Create() returns nullptr for any other expression, in which case the
+ * regular MathExpression engine of the dialect must be used.
+ */
+class VectorizedExpression
+{
+  public:
+    ~VectorizedExpression();
+
+    /**
+     * Compile an expression.
+     * @param osExpression The body of the expression, e.g. "(B1 - B2) / B3"
+     * @param osDialect The expression dialect, "muparser" or "exprtk"
+     * @param aosVariables Names of the variables. Their order is the one of
+     *                     the arrays passed to Evaluate().
+     * @param pdfNoData Pointer to the value of the NODATA constant, or nullptr
+     * @return the compiled expression, or nullptr if it is not supported.
+     */
+    static std::unique_ptr<VectorizedExpression>
+    Create(std::string_view osExpression, std::string_view osDialect,
+           const std::vector<std::string> &aosVariables,
+           const double *pdfNoData);
+
+    /**
+     * Evaluate the expression over nCount values.
+     * @param papadfVariables Array of nCount values for each variable.
+     * @param nCount Number of values.
+     * @param padfResults Output array of nCount values.
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nCount,
+                  double *padfResults);
+
+  private:
+    VectorizedExpression();
+
+    struct Instruction;
+
+    std::vector<Instruction> m_aoProgram;
+    std::vector<double> m_adfScratch{};
+    int m_nMaxStackDepth = 0;
+    double m_dfNoData = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(VectorizedExpression)
+};
+
 #if GDAL_VRT_ENABLE_EXPRTK
 
 /**
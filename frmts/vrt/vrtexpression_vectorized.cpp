@@ -0,0 +1,943 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+enum class VecOp
+{
+    PUSH_VARIABLE,
+    PUSH_CONSTANT,
+
+    // unary
+    NEG,
+    SIN,
+    COS,
+    TAN,
+    ASIN,
+    ACOS,
+    ATAN,
+    SINH,
+    COSH,
+    TANH,
+    SQRT,
+    EXP,
+    LOG,
+    LOG10,
+    ABS,
+    ISNAN,
+    ISNODATA,
+
+    // binary
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    MIN,
+    MAX,
+    FMOD,
+    LT,
+    LE,
+    GT,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+
+    // ternary
+    SELECT,
+};
+
+struct Node
+{
+    VecOp eOp = VecOp::PUSH_CONSTANT;
+    double dfValue = 0;
+    int nVariable = -1;
+    bool bParenthesized = false;
+    std::vector<std::unique_ptr<Node>> apoChildren{};
+};
+
+/************************************************************************/
+/*                        VectorizedExprParser                          */
+/************************************************************************/
+
+// Recursive descent parser for the subset of the muparser / exprtk syntax
+// whose semantics are identical in both engines and in this evaluator.
+// Any construct it does not understand makes the whole parse fail, so that
+// the caller can fall back to the regular engine, which will also take care
+// of reporting syntax errors.
+class VectorizedExprParser
+{
+  public:
+    VectorizedExprParser(std::string_view osExpression, bool bMuParser,
+                         const std::vector<std::string> &aosVariables,
+                         const double *pdfNoData)
+        : m_osExpr(osExpression), m_bMuParser(bMuParser),
+          m_aosVariables(aosVariables), m_pdfNoData(pdfNoData)
+    {
+    }
+
+    std::unique_ptr<Node> Parse()
+    {
+        auto poNode = ParseTernary();
+        SkipSpaces();
+        if (!poNode || m_nPos != m_osExpr.size())
+            return nullptr;
+        return poNode;
+    }
+
+  private:
+    std::string_view m_osExpr;
+    size_t m_nPos = 0;
+    const bool m_bMuParser;
+    const std::vector<std::string> &m_aosVariables;
+    const double *const m_pdfNoData;
+
+    void SkipSpaces()
+    {
+        while (m_nPos < m_osExpr.size() &&
+               isspace(static_cast<unsigned char>(m_osExpr[m_nPos])))
+            ++m_nPos;
+    }
+
+    bool Accept(const char *pszToken)
+    {
+        SkipSpaces();
+        const size_t nLen = strlen(pszToken);
+        if (m_osExpr.substr(m_nPos, nLen) == pszToken)
+        {
+            m_nPos += nLen;
+            return true;
+        }
+        return false;
+    }
+
+    bool Peek(const char *pszToken)
+    {
+        SkipSpaces();
+        return m_osExpr.substr(m_nPos, strlen(pszToken)) == pszToken;
+    }
+
+    static std::unique_ptr<Node> MakeNode(VecOp eOp,
+                                          std::unique_ptr<Node> poA,
+                                          std::unique_ptr<Node> poB = nullptr,
+                                          std::unique_ptr<Node> poC = nullptr)
+    {
+        if (!poA)
+            return nullptr;
+        auto poNode = std::make_unique<Node>();
+        poNode->eOp = eOp;
+        poNode->apoChildren.push_back(std::move(poA));
+        for (auto *ppoChild : {&poB, &poC})
+        {
+            if (*ppoChild)
+                poNode->apoChildren.push_back(std::move(*ppoChild));
+        }
+        return poNode;
+    }
+
+    static bool IsBareOp(const Node &oNode, VecOp eOp)
+    {
+        return oNode.eOp == eOp && !oNode.bParenthesized;
+    }
+
+    static std::unique_ptr<Node> MakeConstant(double dfValue)
+    {
+        auto poNode = std::make_unique<Node>();
+        poNode->eOp = VecOp::PUSH_CONSTANT;
+        poNode->dfValue = dfValue;
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseTernary()
+    {
+        auto poCond = ParseOr();
+        if (!poCond || !m_bMuParser || !Accept("?"))
+            return poCond;
+        auto poTrue = ParseTernary();
+        if (!poTrue || !Accept(":"))
+            return nullptr;
+        auto poFalse = ParseTernary();
+        if (!poFalse)
+            return nullptr;
+        return MakeNode(VecOp::SELECT, std::move(poCond), std::move(poTrue),
+                        std::move(poFalse));
+    }
+
+    std::unique_ptr<Node> ParseOr()
+    {
+        auto poLeft = ParseAnd();
+        while (poLeft && m_bMuParser && Accept("||"))
+        {
+            auto poRight = ParseAnd();
+            // Older muparser versions give && a lower precedence than ||
+            if (!poRight || IsBareOp(*poLeft, VecOp::AND) ||
+                IsBareOp(*poRight, VecOp::AND))
+                return nullptr;
+            poLeft = MakeNode(VecOp::OR, std::move(poLeft), std::move(poRight));
+        }
+        return poLeft;
+    }
+
+    std::unique_ptr<Node> ParseAnd()
+    {
+        auto poLeft = ParseComparison();
+        while (poLeft && m_bMuParser && Accept("&&"))
+        {
+            auto poRight = ParseComparison();
+            if (!poRight)
+                return nullptr;
+            poLeft =
+                MakeNode(VecOp::AND, std::move(poLeft), std::move(poRight));
+        }
+        return poLeft;
+    }
+
+    std::unique_ptr<Node> ParseComparison()
+    {
+        auto poLeft = ParseAdditive();
+        while (poLeft)
+        {
+            VecOp eOp;
+            if (Accept("<="))
+                eOp = VecOp::LE;
+            else if (Accept(">="))
+                eOp = VecOp::GE;
+            else if (m_bMuParser && Accept("=="))
+                eOp = VecOp::EQ;
+            else if (m_bMuParser && Accept("!="))
+                eOp = VecOp::NE;
+            else if (Peek("<>"))
+                return nullptr;
+            else if (Accept("<"))
+                eOp = VecOp::LT;
+            else if (Accept(">"))
+                eOp = VecOp::GT;
+            else
+                break;
+            // Chained comparisons are not worth the risk of diverging from
+            // the reference engines.
+            if (poLeft->eOp >= VecOp::LT && poLeft->eOp <= VecOp::NE &&
+                !poLeft->bParenthesized)
+                return nullptr;
+            auto poRight = ParseAdditive();
+            if (!poRight)
+                return nullptr;
+            poLeft = MakeNode(eOp, std::move(poLeft), std::move(poRight));
+        }
+        return poLeft;
+    }
+
+    std::unique_ptr<Node> ParseAdditive()
+    {
+        auto poLeft = ParseMultiplicative();
+        while (poLeft)
+        {
+            VecOp eOp;
+            if (Accept("+"))
+                eOp = VecOp::ADD;
+            else if (Accept("-"))
+                eOp = VecOp::SUB;
+            else
+                break;
+            auto poRight = ParseMultiplicative();
+            if (!poRight)
+                return nullptr;
+            poLeft = MakeNode(eOp, std::move(poLeft), std::move(poRight));
+        }
+        return poLeft;
+    }
+
+    std::unique_ptr<Node> ParseMultiplicative()
+    {
+        auto poLeft = ParseUnary();
+        while (poLeft)
+        {
+            VecOp eOp;
+            if (Accept("*"))
+                eOp = VecOp::MUL;
+            else if (Accept("/"))
+                eOp = VecOp::DIV;
+            else
+                break;
+            auto poRight = ParseUnary();
+            if (!poRight)
+                return nullptr;
+            poLeft = MakeNode(eOp, std::move(poLeft), std::move(poRight));
+        }
+        return poLeft;
+    }
+
+    std::unique_ptr<Node> ParseUnary()
+    {
+        if (Accept("-"))
+        {
+            auto poOperand = ParseUnary();
+            // The relative precedence of unary minus and power differs
+            // between engines and versions: let them deal with "-a^b".
+            if (!poOperand || IsBareOp(*poOperand, VecOp::POW))
+                return nullptr;
+            return MakeNode(VecOp::NEG, std::move(poOperand));
+        }
+        if (Accept("+"))
+        {
+            auto poOperand = ParseUnary();
+            if (!poOperand || IsBareOp(*poOperand, VecOp::POW))
+                return nullptr;
+            return poOperand;
+        }
+        return ParsePower();
+    }
+
+    std::unique_ptr<Node> ParsePower()
+    {
+        auto poBase = ParsePrimary();
+        if (!poBase || !Accept("^"))
+            return poBase;
+        std::unique_ptr<Node> poExponent;
+        if (Accept("-"))
+        {
+            poExponent = MakeNode(VecOp::NEG, ParsePrimary());
+        }
+        else
+        {
+            poExponent = ParsePrimary();
+        }
+        // Same for associativity of chained powers.
+        if (!poExponent || Peek("^"))
+            return nullptr;
+        return MakeNode(VecOp::POW, std::move(poBase), std::move(poExponent));
+    }
+
+    std::unique_ptr<Node> ParseNumber()
+    {
+        const size_t nStart = m_nPos;
+        const auto IsDigit = [this]()
+        {
+            return m_nPos < m_osExpr.size() &&
+                   m_osExpr[m_nPos] >= '0' && m_osExpr[m_nPos] <= '9';
+        };
+        while (IsDigit())
+            ++m_nPos;
+        if (m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == '.')
+        {
+            ++m_nPos;
+            while (IsDigit())
+                ++m_nPos;
+        }
+        if (m_nPos < m_osExpr.size() &&
+            (m_osExpr[m_nPos] == 'e' || m_osExpr[m_nPos] == 'E'))
+        {
+            ++m_nPos;
+            if (m_nPos < m_osExpr.size() &&
+                (m_osExpr[m_nPos] == '+' || m_osExpr[m_nPos] == '-'))
+                ++m_nPos;
+            if (!IsDigit())
+                return nullptr;
+            while (IsDigit())
+                ++m_nPos;
+        }
+        // Reject things like "2x" (implicit multiplication in exprtk)
+        if (m_nPos < m_osExpr.size() &&
+            (isalpha(static_cast<unsigned char>(m_osExpr[m_nPos])) ||
+             m_osExpr[m_nPos] == '_' || m_osExpr[m_nPos] == '.'))
+            return nullptr;
+        const std::string osNumber(m_osExpr.substr(nStart, m_nPos - nStart));
+        if (osNumber == ".")
+            return nullptr;
+        return MakeConstant(CPLAtof(osNumber.c_str()));
+    }
+
+    std::unique_ptr<Node> ParsePrimary()
+    {
+        SkipSpaces();
+        if (m_nPos == m_osExpr.size())
+            return nullptr;
+
+        const char ch = m_osExpr[m_nPos];
+        if ((ch >= '0' && ch <= '9') || ch == '.')
+            return ParseNumber();
+
+        if (ch == '(')
+        {
+            ++m_nPos;
+            auto poNode = ParseTernary();
+            if (!poNode || !Accept(")"))
+                return nullptr;
+            poNode->bParenthesized = true;
+            return poNode;
+        }
+
+        if (!isalpha(static_cast<unsigned char>(ch)) && ch != '_')
+            return nullptr;
+
+        const size_t nStart = m_nPos;
+        while (m_nPos < m_osExpr.size() &&
+               (isalnum(static_cast<unsigned char>(m_osExpr[m_nPos])) ||
+                m_osExpr[m_nPos] == '_'))
+            ++m_nPos;
+        std::string osName(m_osExpr.substr(nStart, m_nPos - nStart));
+
+        if (Peek("("))
+            return ParseFunction(osName);
+
+        // Vector elements exposed as individual variables, e.g. "X[1]"
+        if (m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == '[')
+        {
+            const auto nEnd = m_osExpr.find(']', m_nPos);
+            if (nEnd == std::string_view::npos)
+                return nullptr;
+            osName += m_osExpr.substr(m_nPos, nEnd + 1 - m_nPos);
+            m_nPos = nEnd + 1;
+        }
+
+        const auto oIter =
+            std::find(m_aosVariables.begin(), m_aosVariables.end(), osName);
+        if (oIter != m_aosVariables.end())
+        {
+            auto poNode = std::make_unique<Node>();
+            poNode->eOp = VecOp::PUSH_VARIABLE;
+            poNode->nVariable =
+                static_cast<int>(std::distance(m_aosVariables.begin(), oIter));
+            return poNode;
+        }
+
+        if (osName == "NODATA" && m_pdfNoData)
+            return MakeConstant(*m_pdfNoData);
+
+        if (m_bMuParser)
+        {
+            if (osName == "_pi")
+                return MakeConstant(M_PI);
+            if (osName == "_e")
+                return MakeConstant(std::exp(1.0));
+            if (osName == "nan" || osName == "NaN")
+                return MakeConstant(std::numeric_limits<double>::quiet_NaN());
+        }
+
+        return nullptr;
+    }
+
+    std::unique_ptr<Node> ParseFunction(const std::string &osName)
+    {
+        struct FunctionDef
+        {
+            const char *pszName;
+            VecOp eOp;
+            int nMinArgs;
+            int nMaxArgs;
+            bool bMuParserOnly;
+        };
+
+        static const FunctionDef asFunctions[] = {
+            {"sin", VecOp::SIN, 1, 1, false},
+            {"cos", VecOp::COS, 1, 1, false},
+            {"tan", VecOp::TAN, 1, 1, false},
+            {"asin", VecOp::ASIN, 1, 1, false},
+            {"acos", VecOp::ACOS, 1, 1, false},
+            {"atan", VecOp::ATAN, 1, 1, false},
+            {"sinh", VecOp::SINH, 1, 1, false},
+            {"cosh", VecOp::COSH, 1, 1, false},
+            {"tanh", VecOp::TANH, 1, 1, false},
+            {"sqrt", VecOp::SQRT, 1, 1, false},
+            {"exp", VecOp::EXP, 1, 1, false},
+            {"log", VecOp::LOG, 1, 1, false},
+            {"ln", VecOp::LOG, 1, 1, true},
+            {"log10", VecOp::LOG10, 1, 1, false},
+            {"abs", VecOp::ABS, 1, 1, false},
+            {"isnan", VecOp::ISNAN, 1, 1, true},
+            {"isnodata", VecOp::ISNODATA, 1, 1, true},
+            {"fmod", VecOp::FMOD, 2, 2, true},
+            {"min", VecOp::MIN, 2, 2, false},
+            {"max", VecOp::MAX, 2, 2, false},
+        };
+
+        const FunctionDef *psDef = nullptr;
+        for (const auto &sDef : asFunctions)
+        {
+            if (osName == sDef.pszName && (m_bMuParser || !sDef.bMuParserOnly))
+            {
+                psDef = &sDef;
+                break;
+            }
+        }
+        if (!psDef || !Accept("("))
+            return nullptr;
+        // muparser accepts any number of arguments for min() and max()
+        const bool bVariadic = m_bMuParser && (psDef->eOp == VecOp::MIN ||
+                                               psDef->eOp == VecOp::MAX);
+        const int nMaxArgs = bVariadic ? INT_MAX : psDef->nMaxArgs;
+
+        std::vector<std::unique_ptr<Node>> apoArgs;
+        do
+        {
+            auto poArg = ParseTernary();
+            if (!poArg)
+                return nullptr;
+            apoArgs.push_back(std::move(poArg));
+        } while (Accept(","));
+        const int nArgs = static_cast<int>(apoArgs.size());
+        if (!Accept(")") || nArgs < psDef->nMinArgs || nArgs > nMaxArgs)
+            return nullptr;
+
+        if (psDef->eOp == VecOp::ISNODATA && !m_pdfNoData)
+        {
+            // Consistent with the muparser backend, which binds isnodata()
+            // to a function always returning false when there is no NODATA
+            return MakeConstant(0);
+        }
+
+        // min(a, b, c) is evaluated as min(min(a, b), c), as muparser does
+        auto poNode = std::move(apoArgs[0]);
+        for (size_t i = 1; i < apoArgs.size(); ++i)
+            poNode =
+                MakeNode(psDef->eOp, std::move(poNode), std::move(apoArgs[i]));
+        if (apoArgs.size() == 1)
+            poNode = MakeNode(psDef->eOp, std::move(poNode));
+        return poNode;
+    }
+};
+
+/************************************************************************/
+/*                              Kernels                                 */
+/************************************************************************/
+
+// Loops below are written so that the compiler can auto-vectorize them.
+
+template <class F>
+inline void ApplyUnary(const double *padfA, double *padfOut, size_t nCount,
+                       F f)
+{
+    // padfOut may alias padfA
+    for (size_t i = 0; i < nCount; ++i)
+        padfOut[i] = f(padfA[i]);
+}
+
+template <class F>
+inline void ApplyBinary(const double *padfA, const double *CPL_RESTRICT padfB,
+                        double *padfOut, size_t nCount, F f)
+{
+    // padfOut may alias padfA
+    for (size_t i = 0; i < nCount; ++i)
+        padfOut[i] = f(padfA[i], padfB[i]);
+}
+
+inline double IsNoDataValue(double dfVal, double dfNoData)
+{
+    return (dfVal == dfNoData || (std::isnan(dfVal) && std::isnan(dfNoData)))
+               ? 1.0
+               : 0.0;
+}
+
+double EvaluateScalar(VecOp eOp, const double *padfArgs, double dfNoData)
+{
+    const double a = padfArgs[0];
+    switch (eOp)
+    {
+        case VecOp::PUSH_VARIABLE:
+        case VecOp::PUSH_CONSTANT:
+            break;
+        case VecOp::NEG:
+            return -a;
+        case VecOp::SIN:
+            return std::sin(a);
+        case VecOp::COS:
+            return std::cos(a);
+        case VecOp::TAN:
+            return std::tan(a);
+        case VecOp::ASIN:
+            return std::asin(a);
+        case VecOp::ACOS:
+            return std::acos(a);
+        case VecOp::ATAN:
+            return std::atan(a);
+        case VecOp::SINH:
+            return std::sinh(a);
+        case VecOp::COSH:
+            return std::cosh(a);
+        case VecOp::TANH:
+            return std::tanh(a);
+        case VecOp::SQRT:
+            return std::sqrt(a);
+        case VecOp::EXP:
+            return std::exp(a);
+        case VecOp::LOG:
+            return std::log(a);
+        case VecOp::LOG10:
+            return std::log10(a);
+        case VecOp::ABS:
+            return std::fabs(a);
+        case VecOp::ISNAN:
+            return std::isnan(a) ? 1.0 : 0.0;
+        case VecOp::ISNODATA:
+            return IsNoDataValue(a, dfNoData);
+        case VecOp::ADD:
+            return a + padfArgs[1];
+        case VecOp::SUB:
+            return a - padfArgs[1];
+        case VecOp::MUL:
+            return a * padfArgs[1];
+        case VecOp::DIV:
+            return a / padfArgs[1];
+        case VecOp::POW:
+            return std::pow(a, padfArgs[1]);
+        case VecOp::MIN:
+            return std::min(a, padfArgs[1]);
+        case VecOp::MAX:
+            return std::max(a, padfArgs[1]);
+        case VecOp::FMOD:
+            return std::fmod(a, padfArgs[1]);
+        case VecOp::LT:
+            return a < padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::LE:
+            return a <= padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::GT:
+            return a > padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::GE:
+            return a >= padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::EQ:
+            return a == padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::NE:
+            return a != padfArgs[1] ? 1.0 : 0.0;
+        case VecOp::AND:
+            return (a != 0 && padfArgs[1] != 0) ? 1.0 : 0.0;
+        case VecOp::OR:
+            return (a != 0 || padfArgs[1] != 0) ? 1.0 : 0.0;
+        case VecOp::SELECT:
+            return a != 0 ? padfArgs[1] : padfArgs[2];
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                          FoldConstants()                             */
+/************************************************************************/
+
+void FoldConstants(std::unique_ptr<Node> &poNode, double dfNoData)
+{
+    bool bAllConstant = true;
+    for (auto &poChild : poNode->apoChildren)
+    {
+        FoldConstants(poChild, dfNoData);
+        bAllConstant &= poChild->eOp == VecOp::PUSH_CONSTANT;
+    }
+    if (bAllConstant && !poNode->apoChildren.empty())
+    {
+        double adfArgs[3] = {0, 0, 0};
+        for (size_t i = 0; i < poNode->apoChildren.size(); ++i)
+            adfArgs[i] = poNode->apoChildren[i]->dfValue;
+        const double dfValue = EvaluateScalar(poNode->eOp, adfArgs, dfNoData);
+        poNode->eOp = VecOp::PUSH_CONSTANT;
+        poNode->dfValue = dfValue;
+        poNode->apoChildren.clear();
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                      VectorizedExpression::Instruction               */
+/************************************************************************/
+
+struct VectorizedExpression::Instruction
+{
+    VecOp eOp;
+    int nVariable;
+    double dfValue;
+};
+
+/************************************************************************/
+/*                        VectorizedExpression()                        */
+/************************************************************************/
+
+VectorizedExpression::VectorizedExpression() = default;
+
+VectorizedExpression::~VectorizedExpression() = default;
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+std::unique_ptr<VectorizedExpression>
+VectorizedExpression::Create(std::string_view osExpression,
+                             std::string_view osDialect,
+                             const std::vector<std::string> &aosVariables,
+                             const double *pdfNoData)
+{
+    const bool bMuParser = EQUAL(std::string(osDialect).c_str(), "muparser");
+    if (!bMuParser && !EQUAL(std::string(osDialect).c_str(), "exprtk"))
+        return nullptr;
+
+    VectorizedExprParser oParser(osExpression, bMuParser, aosVariables,
+                                 pdfNoData);
+    auto poRoot = oParser.Parse();
+    if (!poRoot)
+    {
+        CPLDebug("VRT",
+                 "Expression '%s' not supported by the vectorized evaluator",
+                 std::string(osExpression).c_str());
+        return nullptr;
+    }
+
+    const double dfNoData =
+        pdfNoData ? *pdfNoData : std::numeric_limits<double>::quiet_NaN();
+    FoldConstants(poRoot, dfNoData);
+
+    std::unique_ptr<VectorizedExpression> poExpr(new VectorizedExpression());
+    poExpr->m_dfNoData = dfNoData;
+
+    // Post-order emission, tracking the stack depth
+    int nDepth = 0;
+    const std::function<void(const Node &)> Emit = [&](const Node &oNode)
+    {
+        for (const auto &poChild : oNode.apoChildren)
+            Emit(*poChild);
+        poExpr->m_aoProgram.push_back(
+            Instruction{oNode.eOp, oNode.nVariable, oNode.dfValue});
+        if (oNode.apoChildren.empty())
+            ++nDepth;
+        else
+            nDepth -= static_cast<int>(oNode.apoChildren.size()) - 1;
+        poExpr->m_nMaxStackDepth = std::max(poExpr->m_nMaxStackDepth, nDepth);
+    };
+    Emit(*poRoot);
+
+    return poExpr;
+}
+
+/************************************************************************/
+/*                             Evaluate()                               */
+/************************************************************************/
+
+void VectorizedExpression::Evaluate(const double *const *papadfVariables,
+                                    size_t nCount, double *padfResults)
+{
+    constexpr size_t CHUNK_SIZE = 256;
+
+    m_adfScratch.resize(static_cast<size_t>(m_nMaxStackDepth) * CHUNK_SIZE);
+    std::vector<const double *> apadfStack(m_nMaxStackDepth);
+    const double dfNoData = m_dfNoData;
+
+    for (size_t nOffset = 0; nOffset < nCount; nOffset += CHUNK_SIZE)
+    {
+        const size_t n = std::min(CHUNK_SIZE, nCount - nOffset);
+        int iTop = 0;
+        for (const auto &oInstr : m_aoProgram)
+        {
+            double *padfOut = nullptr;
+            const double *a = nullptr;
+            const double *b = nullptr;
+            if (oInstr.eOp == VecOp::PUSH_VARIABLE ||
+                oInstr.eOp == VecOp::PUSH_CONSTANT)
+            {
+                padfOut = m_adfScratch.data() + iTop * CHUNK_SIZE;
+                apadfStack[iTop++] = padfOut;
+            }
+            else if (oInstr.eOp < VecOp::ADD)
+            {
+                a = apadfStack[iTop - 1];
+                padfOut = m_adfScratch.data() + (iTop - 1) * CHUNK_SIZE;
+                apadfStack[iTop - 1] = padfOut;
+            }
+            else if (oInstr.eOp < VecOp::SELECT)
+            {
+                a = apadfStack[iTop - 2];
+                b = apadfStack[iTop - 1];
+                --iTop;
+                padfOut = m_adfScratch.data() + (iTop - 1) * CHUNK_SIZE;
+                apadfStack[iTop - 1] = padfOut;
+            }
+
+            switch (oInstr.eOp)
+            {
+                case VecOp::PUSH_VARIABLE:
+                    apadfStack[iTop - 1] =
+                        papadfVariables[oInstr.nVariable] + nOffset;
+                    break;
+                case VecOp::PUSH_CONSTANT:
+                    std::fill_n(padfOut, n, oInstr.dfValue);
+                    break;
+                case VecOp::NEG:
+                    ApplyUnary(a, padfOut, n, [](double x) { return -x; });
+                    break;
+                case VecOp::SIN:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::sin(x); });
+                    break;
+                case VecOp::COS:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::cos(x); });
+                    break;
+                case VecOp::TAN:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::tan(x); });
+                    break;
+                case VecOp::ASIN:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::asin(x); });
+                    break;
+                case VecOp::ACOS:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::acos(x); });
+                    break;
+                case VecOp::ATAN:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::atan(x); });
+                    break;
+                case VecOp::SINH:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::sinh(x); });
+                    break;
+                case VecOp::COSH:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::cosh(x); });
+                    break;
+                case VecOp::TANH:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::tanh(x); });
+                    break;
+                case VecOp::SQRT:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::sqrt(x); });
+                    break;
+                case VecOp::EXP:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::exp(x); });
+                    break;
+                case VecOp::LOG:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::log(x); });
+                    break;
+                case VecOp::LOG10:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::log10(x); });
+                    break;
+                case VecOp::ABS:
+                    ApplyUnary(a, padfOut, n,
+                               [](double x) { return std::fabs(x); });
+                    break;
+                case VecOp::ISNAN:
+                    ApplyUnary(a, padfOut, n, [](double x)
+                               { return std::isnan(x) ? 1.0 : 0.0; });
+                    break;
+                case VecOp::ISNODATA:
+                    ApplyUnary(a, padfOut, n, [dfNoData](double x)
+                               { return IsNoDataValue(x, dfNoData); });
+                    break;
+                case VecOp::ADD:
+                    ApplyBinary(a, b, padfOut, n,
+                                [](double x, double y) { return x + y; });
+                    break;
+                case VecOp::SUB:
+                    ApplyBinary(a, b, padfOut, n,
+                                [](double x, double y) { return x - y; });
+                    break;
+                case VecOp::MUL:
+                    ApplyBinary(a, b, padfOut, n,
+                                [](double x, double y) { return x * y; });
+                    break;
+                case VecOp::DIV:
+                    ApplyBinary(a, b, padfOut, n,
+                                [](double x, double y) { return x / y; });
+                    break;
+                case VecOp::POW:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return std::pow(x, y); });
+                    break;
+                case VecOp::MIN:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return std::min(x, y); });
+                    break;
+                case VecOp::MAX:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return std::max(x, y); });
+                    break;
+                case VecOp::FMOD:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return std::fmod(x, y); });
+                    break;
+                case VecOp::LT:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x < y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::LE:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x <= y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::GT:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x > y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::GE:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x >= y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::EQ:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x == y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::NE:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return x != y ? 1.0 : 0.0; });
+                    break;
+                case VecOp::AND:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return (x != 0 && y != 0) ? 1.0 : 0.0; });
+                    break;
+                case VecOp::OR:
+                    ApplyBinary(a, b, padfOut, n, [](double x, double y)
+                                { return (x != 0 || y != 0) ? 1.0 : 0.0; });
+                    break;
+                case VecOp::SELECT:
+                {
+                    const double *padfCond = apadfStack[iTop - 3];
+                    const double *padfTrue = apadfStack[iTop - 2];
+                    const double *padfFalse = apadfStack[iTop - 1];
+                    iTop -= 2;
+                    padfOut = m_adfScratch.data() + (iTop - 1) * CHUNK_SIZE;
+                    for (size_t i = 0; i < n; ++i)
+                        padfOut[i] =
+                            padfCond[i] != 0 ? padfTrue[i] : padfFalse[i];
+                    apadfStack[iTop - 1] = padfOut;
+                    break;
+                }
+            }
+        }
+
+        CPLAssert(iTop == 1);
+        memcpy(padfResults + nOffset, apadfStack[0], n * sizeof(double));
+    }
+}
+
+/*! @endcond */
+
+}  // namespace gdal
@@ -70,6 +70,11 @@ struct VRTProcessedDatasetFunc
 
     //! Required processing function
     GDALVRTProcessedDatasetFuncProcess pfnProcess = nullptr;
+
+    //! Whether each output pixel only depends on the input pixel at the
+    //! same position, in which case pfnProcess may be called on arbitrary
+    //! runs of pixels.
+    bool bPixelWise = false;
 };
 
 /************************************************************************/
@@ -1334,12 +1339,47 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
     GDALDataType eLastDT = eFirstDT;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
 
-    int iStep = 0;
-    for (const auto &oStep : m_aoSteps)
+    const bool bFuseSteps = CPLTestBool(
+        CPLGetConfigOption("VRT_PROCESSED_DATASET_FUSE_STEPS", "YES"));
+
+    const int nSteps = static_cast<int>(m_aoSteps.size());
+    for (int iStep = 0; iStep < nSteps;)
     {
+        const auto &oStep = m_aoSteps[iStep];
         const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
         CPLAssert(oIterFunc != oMapFunctions.end());
 
+        // Count the consecutive pixel-wise steps starting with this one
+        int nFusedSteps = 1;
+        if (bFuseSteps && oIterFunc->second.bPixelWise)
+        {
+            while (iStep + nFusedSteps < nSteps)
+            {
+                const auto oIterNextFunc = oMapFunctions.find(
+                    m_aoSteps[iStep + nFusedSteps].osAlgorithm);
+                CPLAssert(oIterNextFunc != oMapFunctions.end());
+                if (!oIterNextFunc->second.bPixelWise)
+                    break;
+                ++nFusedSteps;
+            }
+        }
+
+        if (nFusedSteps > 1)
+        {
+            if (!ProcessFusedSteps(iStep, nFusedSteps, nPixelCount, eLastDT,
+                                   dfSrcXOff, dfSrcYOff, dfSrcXSize,
+                                   dfSrcYSize, srcGT))
+            {
+                return false;
+            }
+            eLastDT = m_aoSteps[iStep + nFusedSteps - 1].eOutDT;
+            iStep += nFusedSteps;
+            if (pfnProgress &&
+                !pfnProgress(0.5 + 0.5 * iStep / nSteps, "", pProgressData))
+                return false;
+            continue;
+        }
+
         // Data type adaptation
         if (eLastDT != oStep.eInDT)
         {
@@ -1394,14 +1434,137 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
 
         ++iStep;
         if (pfnProgress &&
-            !pfnProgress(0.5 + 0.5 * iStep / static_cast<int>(m_aoSteps.size()),
-                         "", pProgressData))
+            !pfnProgress(0.5 + 0.5 * iStep / nSteps, "", pProgressData))
             return false;
     }
 
     return true;
 }
 
+/************************************************************************/
+/*                         ProcessFusedSteps()                          */
+/************************************************************************/
+
+/** Run nStepCount consecutive pixel-wise steps, starting at iFirstStep.
+ *
+ * Instead of running each step over the whole working buffer, which
+ * requires a full read and write of it for each step, all the steps are
+ * run on a run of pixels small enough for its intermediate buffers to
+ * remain in the CPU cache, before moving to the next run.
+ *
+ * On input, m_abyInput contains nPixelCount pixels of data type eInDT.
+ * On output, it contains the result of the last step.
+ */
+bool VRTProcessedDataset::ProcessFusedSteps(
+    int iFirstStep, int nStepCount, size_t nPixelCount, GDALDataType eInDT,
+    double dfSrcXOff, double dfSrcYOff, double dfSrcXSize, double dfSrcYSize,
+    const GDALGeoTransform &srcGT)
+{
+    const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+    const auto &oLastStep = m_aoSteps[iFirstStep + nStepCount - 1];
+    const size_t nOutBytesPerPixel =
+        static_cast<size_t>(oLastStep.nOutBands) *
+        GDALGetDataTypeSizeBytes(oLastStep.eOutDT);
+
+    // Size of the largest intermediate pixel
+    size_t nMaxBytesPerPixel = 0;
+    for (int iStep = iFirstStep; iStep < iFirstStep + nStepCount; ++iStep)
+    {
+        const auto &oStep = m_aoSteps[iStep];
+        nMaxBytesPerPixel = std::max(
+            nMaxBytesPerPixel, static_cast<size_t>(oStep.nInBands) *
+                                   GDALGetDataTypeSizeBytes(oStep.eInDT));
+        nMaxBytesPerPixel = std::max(
+            nMaxBytesPerPixel, static_cast<size_t>(oStep.nOutBands) *
+                                   GDALGetDataTypeSizeBytes(oStep.eOutDT));
+    }
+
+    // Keep the two intermediate buffers well within the L2 cache
+    constexpr size_t TILE_SIZE_BYTES = 64 * 1024;
+    const size_t nTilePixels = std::min(
+        nPixelCount, std::max<size_t>(1, TILE_SIZE_BYTES / nMaxBytesPerPixel));
+
+    std::vector<NoInitByte> abyTmp1, abyTmp2;
+    try
+    {
+        abyTmp1.resize(nTilePixels * nMaxBytesPerPixel);
+        abyTmp2.resize(nTilePixels * nMaxBytesPerPixel);
+        m_abyOutput.resize(nPixelCount * nOutBytesPerPixel);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+    GByte *const pabyTmp1 = reinterpret_cast<GByte *>(abyTmp1.data());
+    GByte *const pabyTmp2 = reinterpret_cast<GByte *>(abyTmp2.data());
+
+    const size_t nInBytesPerPixel =
+        static_cast<size_t>(m_aoSteps[iFirstStep].nInBands) *
+        GDALGetDataTypeSizeBytes(eInDT);
+
+    for (size_t iStart = 0; iStart < nPixelCount; iStart += nTilePixels)
+    {
+        const size_t nTileCount = std::min(nTilePixels, nPixelCount - iStart);
+        const GByte *pabyIn = reinterpret_cast<const GByte *>(
+                                  m_abyInput.data()) +
+                              iStart * nInBytesPerPixel;
+        GDALDataType eLastDT = eInDT;
+
+        for (int iStep = iFirstStep; iStep < iFirstStep + nStepCount; ++iStep)
+        {
+            const auto &oStep = m_aoSteps[iStep];
+
+            // Data type adaptation
+            if (eLastDT != oStep.eInDT)
+            {
+                GByte *pabyConverted = pabyIn == pabyTmp1 ? pabyTmp2 : pabyTmp1;
+                GDALCopyWords64(pabyIn, eLastDT,
+                                GDALGetDataTypeSizeBytes(eLastDT),
+                                pabyConverted, oStep.eInDT,
+                                GDALGetDataTypeSizeBytes(oStep.eInDT),
+                                nTileCount * oStep.nInBands);
+                pabyIn = pabyConverted;
+            }
+
+            GByte *pabyOut;
+            if (&oStep == &oLastStep)
+                pabyOut = reinterpret_cast<GByte *>(m_abyOutput.data()) +
+                          iStart * nOutBytesPerPixel;
+            else
+                pabyOut = pabyIn == pabyTmp1 ? pabyTmp2 : pabyTmp1;
+
+            const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
+            CPLAssert(oIterFunc != oMapFunctions.end());
+            const auto &oFunc = oIterFunc->second;
+            if (oFunc.pfnProcess(
+                    oStep.osAlgorithm.c_str(), oFunc.pUserData,
+                    oStep.pWorkingData, oStep.aosArguments.List(),
+                    static_cast<int>(nTileCount), 1, pabyIn,
+                    nTileCount * oStep.nInBands *
+                        GDALGetDataTypeSizeBytes(oStep.eInDT),
+                    oStep.eInDT, oStep.nInBands, oStep.adfInNoData.data(),
+                    pabyOut,
+                    nTileCount * oStep.nOutBands *
+                        GDALGetDataTypeSizeBytes(oStep.eOutDT),
+                    oStep.eOutDT, oStep.nOutBands, oStep.adfOutNoData.data(),
+                    dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize, srcGT.data(),
+                    m_osVRTPath.c_str(),
+                    /*papszExtra=*/nullptr) != CE_None)
+            {
+                return false;
+            }
+
+            pabyIn = pabyOut;
+            eLastDT = oStep.eOutDT;
+        }
+    }
+
+    std::swap(m_abyInput, m_abyOutput);
+    return true;
+}
+
 /************************************************************************/
 /*                       VRTProcessedRasterBand()                       */
 /************************************************************************/
@@ -1732,7 +1895,19 @@ CPLErr VRTProcessedDataset::IRasterIO(
                 by pfnInit. May be nullptr.
  @param pfnProcess Processing function called to compute pixel values. Must
                    not be nullptr.
- @param papszOptions Unused currently. Must be nullptr.
+ @param papszOptions Null-terminated list of options, or nullptr. Supported
+                     options are:
+                     <ul>
+                     <li>PIXEL_WISE=YES/NO (since 3.14): whether the value
+                     of each output pixel only depends on the value of the
+                     input pixel at the same position. Consecutive pixel-wise
+                     steps are evaluated together on small runs of pixels,
+                     for better cache locality. In that case, pfnProcess is
+                     called with nBufYSize = 1, and the dfSrcXOff,
+                     dfSrcYOff, dfSrcXSize, dfSrcYSize arguments are those of
+                     the whole region being processed.
+                     Defaults to NO.</li>
+                     </ul>
  @return CE_None in case of success, error otherwise.
  @since 3.9
  */
@@ -1743,8 +1918,7 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     size_t nSupportedInputBandCountSize,
     GDALVRTProcessedDatasetFuncInit pfnInit,
     GDALVRTProcessedDatasetFuncFree pfnFree,
-    GDALVRTProcessedDatasetFuncProcess pfnProcess,
-    CPL_UNUSED CSLConstList papszOptions)
+    GDALVRTProcessedDatasetFuncProcess pfnProcess, CSLConstList papszOptions)
 {
     if (pszFuncName == nullptr || pszFuncName[0] == '\0')
     {
@@ -1890,6 +2064,8 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     oFunc.pfnInit = pfnInit;
     oFunc.pfnFree = pfnFree;
     oFunc.pfnProcess = pfnProcess;
+    oFunc.bPixelWise =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "PIXEL_WISE", "NO"));
 
     oMap[pszFuncName] = std::move(oFunc);
 
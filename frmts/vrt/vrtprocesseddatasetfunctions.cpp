@@ -1787,6 +1787,8 @@ static CPLErr ExpressionProcess(
  */
 void GDALVRTRegisterDefaultProcessedDatasetFuncs()
 {
+    const char *const apszPixelWiseOptions[] = {"PIXEL_WISE=YES", nullptr};
+
     GDALVRTRegisterProcessedDatasetFunc(
         "BandAffineCombination", nullptr,
         "<ProcessedDatasetFunctionArgumentsList>"
@@ -1808,7 +1810,8 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "   <Argument name='max' description='clamp max value' type='double'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, BandAffineCombinationInit,
-        BandAffineCombinationFree, BandAffineCombinationProcess, nullptr);
+        BandAffineCombinationFree, BandAffineCombinationProcess,
+        apszPixelWiseOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LUT", nullptr,
@@ -1823,7 +1826,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='string' required='true'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LUTInit, LUTFree, LUTProcess,
-        nullptr);
+        apszPixelWiseOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LocalScaleOffset", nullptr,
@@ -1896,5 +1899,5 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='integer' />"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, ExpressionInit, ExpressionFree,
-        ExpressionProcess, nullptr);
+        ExpressionProcess, apszPixelWiseOptions);
 }
@@ -116,6 +116,7 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
 
 {
     VRTSourcedRasterBand::CloseDependentDatasets();
+    InvalidateSourceIndex();
 }
 
 /************************************************************************/
@@ -300,6 +301,152 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     return true;
 }
 
+/************************************************************************/
+/*                       InvalidateSourceIndex()                        */
+/************************************************************************/
+
+/** Must be called when sources are modified by other means than AddSource().
+ */
+void VRTSourcedRasterBand::InvalidateSourceIndex()
+{
+    std::lock_guard oLock(m_oSourceIndexMutex);
+    if (m_hSourceIndex)
+    {
+        CPLQuadTreeDestroy(m_hSourceIndex);
+        m_hSourceIndex = nullptr;
+    }
+    m_pSourceIndexKey = nullptr;
+    m_nSourceIndexCount = 0;
+    m_anSourcesNotInIndex.clear();
+}
+
+/************************************************************************/
+/*                       GetSourcesIntersecting()                       */
+/************************************************************************/
+
+/** Return the indices, in increasing order, of the sources that may
+ * contribute to the specified window of the band.
+ *
+ * This is a super set of the sources whose destination window intersects
+ * the window. When there are many sources, a spatial index of their
+ * destination windows is built on the first call.
+ */
+std::vector<int>
+VRTSourcedRasterBand::GetSourcesIntersecting(double dfXOff, double dfYOff,
+                                             double dfXSize,
+                                             double dfYSize) const
+{
+    constexpr size_t MIN_SOURCE_COUNT_FOR_INDEX = 64;
+    const size_t nSources = m_papoSources.size();
+    std::vector<int> anSources;
+    if (nSources < MIN_SOURCE_COUNT_FOR_INDEX)
+    {
+        anSources.reserve(nSources);
+        for (int i = 0; i < static_cast<int>(nSources); ++i)
+            anSources.push_back(i);
+        return anSources;
+    }
+
+    std::lock_guard oLock(m_oSourceIndexMutex);
+
+    // m_papoSources is public, and may be modified without going through
+    // AddSource(), so check that the index still corresponds to it.
+    if (m_hSourceIndex && (m_pSourceIndexKey != m_papoSources.data() ||
+                           m_nSourceIndexCount != nSources))
+    {
+        CPLQuadTreeDestroy(m_hSourceIndex);
+        m_hSourceIndex = nullptr;
+        m_anSourcesNotInIndex.clear();
+    }
+
+    if (!m_hSourceIndex)
+    {
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = 0;
+        sGlobalBounds.miny = 0;
+        sGlobalBounds.maxx = nRasterXSize;
+        sGlobalBounds.maxy = nRasterYSize;
+        std::vector<CPLRectObj> asBounds(nSources);
+        for (size_t i = 0; i < nSources; ++i)
+        {
+            const auto &poSource = m_papoSources[i];
+            auto &sBounds = asBounds[i];
+            if (!poSource->IsSimpleSource())
+            {
+                sBounds.minx = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+            const auto poSimpleSource =
+                cpl::down_cast<const VRTSimpleSource *>(poSource.get());
+            double dfDstXOff = 0;
+            double dfDstYOff = 0;
+            double dfDstXSize = 0;
+            double dfDstYSize = 0;
+            poSimpleSource->GetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize,
+                                         dfDstYSize);
+            if (!poSimpleSource->IsDstWinSet() ||
+                !(dfDstXSize >= 0 && dfDstYSize >= 0) ||
+                !std::isfinite(dfDstXOff + dfDstXSize) ||
+                !std::isfinite(dfDstYOff + dfDstYSize))
+            {
+                sBounds.minx = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+            sBounds.minx = dfDstXOff;
+            sBounds.miny = dfDstYOff;
+            sBounds.maxx = dfDstXOff + dfDstXSize;
+            sBounds.maxy = dfDstYOff + dfDstYSize;
+            sGlobalBounds.minx = std::min(sGlobalBounds.minx, sBounds.minx);
+            sGlobalBounds.miny = std::min(sGlobalBounds.miny, sBounds.miny);
+            sGlobalBounds.maxx = std::max(sGlobalBounds.maxx, sBounds.maxx);
+            sGlobalBounds.maxy = std::max(sGlobalBounds.maxy, sBounds.maxy);
+        }
+
+        m_hSourceIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        for (size_t i = 0; i < nSources; ++i)
+        {
+            if (std::isnan(asBounds[i].minx))
+            {
+                m_anSourcesNotInIndex.push_back(static_cast<int>(i));
+            }
+            else
+            {
+                CPLQuadTreeInsertWithBounds(
+                    m_hSourceIndex,
+                    reinterpret_cast<void *>(static_cast<uintptr_t>(i)),
+                    &asBounds[i]);
+            }
+        }
+        m_pSourceIndexKey = m_papoSources.data();
+        m_nSourceIndexCount = nSources;
+        CPLDebugOnly("VRT", "Built spatial index of %d sources",
+                     static_cast<int>(nSources));
+    }
+
+    // Add a margin of one pixel, so that the result is a super set of
+    // the sources intersecting the window, even with rounding errors.
+    CPLRectObj sAOI;
+    sAOI.minx = dfXOff - 1;
+    sAOI.miny = dfYOff - 1;
+    sAOI.maxx = dfXOff + dfXSize + 1;
+    sAOI.maxy = dfYOff + dfYSize + 1;
+    int nFeatureCount = 0;
+    void **pahFeatures =
+        CPLQuadTreeSearch(m_hSourceIndex, &sAOI, &nFeatureCount);
+    anSources.reserve(nFeatureCount + m_anSourcesNotInIndex.size());
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anSources.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+    anSources.insert(anSources.end(), m_anSourcesNotInIndex.begin(),
+                     m_anSourcesNotInIndex.end());
+    // Sources must be composited in their order of declaration
+    std::sort(anSources.begin(), anSources.end());
+    return anSources;
+}
+
 /************************************************************************/
 /*                       CanMultiThreadRasterIO()                       */
 /************************************************************************/
@@ -315,8 +462,8 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     std::set<std::string> oSetDSName;
 
     nContributingSources = 0;
-    for (int iSource = 0; iSource < static_cast<int>(m_papoSources.size());
-         iSource++)
+    for (const int iSource :
+         GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize))
     {
         const auto &poSource = m_papoSources[iSource];
         if (!poSource->IsSimpleSource())
@@ -751,8 +898,10 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
 
         auto oQueue = psThreadPool->CreateJobQueue();
         std::atomic<int> nCompletedJobs = 0;
-        for (auto &poSource : m_papoSources)
+        for (const int iSource :
+             GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize))
         {
+            auto &poSource = m_papoSources[iSource];
             if (!poSource->IsSimpleSource())
                 continue;
             auto poSimpleSource =
@@ -810,17 +959,19 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
         VRTSource::WorkingState oWorkingState;
-        const int nSources = static_cast<int>(m_papoSources.size());
-        for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+        const std::vector<int> anSources =
+            GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize);
+        const int nSources = static_cast<int>(anSources.size());
+        for (int i = 0; eErr == CE_None && i < nSources; i++)
         {
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
-                pfnProgressGlobal, pProgressDataGlobal);
+                1.0 * i / nSources, 1.0 * (i + 1) / nSources, pfnProgressGlobal,
+                pProgressDataGlobal);
             if (psExtraArg->pProgressData == nullptr)
                 psExtraArg->pfnProgress = nullptr;
 
-            eErr = m_papoSources[iSource]->RasterIO(
+            eErr = m_papoSources[anSources[i]]->RasterIO(
                 eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                 nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg,
                 l_poDS ? l_poDS->m_oWorkingState : oWorkingState);
@@ -914,8 +1065,10 @@ int VRTSourcedRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
         poPolyNonCoveredBySources->addRingDirectly(poLR.release());
     }
 
-    for (auto &poSource : m_papoSources)
+    for (const int iSource :
+         GetSourcesIntersecting(nXOff, nYOff, nXSize, nYSize))
     {
+        auto &poSource = m_papoSources[iSource];
         if (!poSource->IsSimpleSource())
         {
             return GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED |
@@ -2320,6 +2473,7 @@ CPLErr VRTSourcedRasterBand::AddSource(std::unique_ptr<VRTSource> poNewSource)
     }
 
     m_papoSources.push_back(std::move(poNewSource));
+    InvalidateSourceIndex();
 
     return CE_None;
 }
@@ -3115,6 +3269,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem(const char *pszName,
             if (poSource != nullptr)
             {
                 m_papoSources[iSource] = std::move(poSource);
+                InvalidateSourceIndex();
                 static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
                 return CE_None;
             }
@@ -3144,6 +3299,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(CSLConstList papszNewMD,
         if (EQUAL(pszDomain, "vrt_sources"))
         {
             m_papoSources.clear();
+            InvalidateSourceIndex();
         }
 
         for (const char *const pszMDItem :
@@ -3203,6 +3359,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
         return ret;
 
     m_papoSources.clear();
+    InvalidateSourceIndex();
 
     return TRUE;
 }
@@ -3394,6 +3551,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
                                        [](const std::unique_ptr<VRTSource> &src)
                                        { return src.get() == nullptr; }),
                         m_papoSources.end());
+    InvalidateSourceIndex();
 
     CPLQuadTreeDestroy(hTree);
 #endif
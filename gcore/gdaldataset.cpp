@@ -4298,6 +4298,9 @@ retry:
         if (poDriver->GetMetadataItem(GDAL_DCAP_OPEN) == nullptr)
             continue;
 
+        // Attribute I/O done by Identify() and Open() to the driver
+        VSITraceCallerContext oTraceCallerContext(poDriver->GetDescription());
+
         if ((nOpenFlags & GDAL_OF_RASTER) != 0 &&
             (nOpenFlags & GDAL_OF_VECTOR) == 0 &&
             poDriver->GetMetadataItem(GDAL_DCAP_RASTER) == nullptr)
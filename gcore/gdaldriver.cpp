@@ -32,6 +32,7 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "ograpispy.h"
 #include "ogr_core.h"
 #include "ogrsf_frmts.h"
@@ -275,6 +276,8 @@ GDALDataset *GDALDriver::Create(const char *pszFilename, int nXSize, int nYSize,
              GetDescription(), pszFilename, nXSize, nYSize, nBands,
              GDALGetDataTypeName(eType), papszOptions);
 
+    VSITraceCallerContext oTraceCallerContext(GetDescription());
+
     GDALDataset *poDS = nullptr;
     if (pfnCreateEx != nullptr)
     {
@@ -1376,6 +1379,8 @@ GDALDataset *GDALDriver::CreateCopy(const char *pszFilename,
     /*      otherwise fallback to the internal implementation using the     */
     /*      Create() method.                                                */
     /* -------------------------------------------------------------------- */
+    VSITraceCallerContext oTraceCallerContext(GetDescription());
+
     GDALDataset *poDstDS = nullptr;
     auto l_pfnCreateCopy = GetCreateCopyCallback();
     if (l_pfnCreateCopy != nullptr &&
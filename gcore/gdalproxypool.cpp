@@ -22,6 +22,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_hash_set.h"
+#include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "gdal.h"
@@ -95,6 +96,18 @@ class GDALDatasetPool
     GDALProxyPoolCacheEntry *firstEntry = nullptr;
     GDALProxyPoolCacheEntry *lastEntry = nullptr;
 
+    /* Hints on how the datasets opened by the pool were opened, kept after */
+    /* they have been evicted, so that re-opening them can skip driver */
+    /* probing. Note that this does not include any parsed header state: */
+    /* the driver still fully re-opens the dataset. */
+    struct ReopenHints
+    {
+        std::string osDriverName{};
+    };
+
+    const bool bUseReopenHints;
+    lru11::Cache<std::string, ReopenHints> oReopenHintsCache;
+
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
     explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
@@ -137,7 +150,10 @@ class GDALDatasetPool
 /************************************************************************/
 
 GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn)
-    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn)
+    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn),
+      bUseReopenHints(CPLTestBool(
+          CPLGetConfigOption("GDAL_DATASET_POOL_REOPEN_HINTS", "YES"))),
+      oReopenHintsCache(10 * static_cast<size_t>(maxSizeIn))
 {
 }
 
@@ -407,12 +423,44 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
     CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
 
+    ReopenHints oReopenHints;
+    const bool bHasReopenHints =
+        bUseReopenHints &&
+        oReopenHintsCache.tryGet(osFilenameAndOO, oReopenHints);
+
     // Release mutex while opening dataset to avoid lock contention.
     CPLReleaseMutex(*pMutex);
-    auto poDS = GDALDataset::Open(pszFileName, nFlag, papszAllowedDrivers,
-                                  papszOpenOptions, nullptr);
+    GDALDataset *poDS = nullptr;
+    if (bHasReopenHints)
+    {
+        // Re-opening of a previously evicted dataset: go directly to the
+        // driver that opened it. Sibling files are not cached, so that
+        // side-car files created in the meantime are taken into account.
+        CPLDebug("GDAL", "GDALDatasetPool: re-opening %s with driver %s",
+                 pszFileName, oReopenHints.osDriverName.c_str());
+        const char *const apszDrivers[] = {
+            oReopenHints.osDriverName.c_str(), nullptr};
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poDS = GDALDataset::Open(pszFileName, nFlag & ~GDAL_OF_VERBOSE_ERROR,
+                                 apszDrivers, papszOpenOptions, nullptr);
+    }
+    if (!poDS)
+    {
+        poDS = GDALDataset::Open(pszFileName, nFlag, papszAllowedDrivers,
+                                 papszOpenOptions, nullptr);
+    }
     CPLAcquireMutex(*pMutex, 1000.0);
 
+    if (poDS && bUseReopenHints && !bHasReopenHints && poDS->GetDriver())
+    {
+        oReopenHints.osDriverName = poDS->GetDriver()->GetDescription();
+        oReopenHintsCache.insert(osFilenameAndOO, std::move(oReopenHints));
+    }
+    else if (!poDS && bHasReopenHints)
+    {
+        oReopenHintsCache.remove(osFilenameAndOO);
+    }
+
     cur->poDS = poDS;
     cur->refCount = 1;
 
@@ -24,6 +24,7 @@
 
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
 #include <string_view>
@@ -1047,7 +1048,54 @@ class CPL_DLL OGRFeature
     char *m_pszNativeData;
     char *m_pszNativeMediaType;
 
+    // WKB of a geometry field whose parsing into papoGeometries is deferred
+    // until the geometry object is requested.
+    struct LazyWKB
+    {
+        std::vector<GByte> abyWKB{};
+        OGRSpatialReferenceRefCountedPtr poSRS{};
+    };
+
+    // Empty when no geometry field has been set from WKB. Its size only
+    // changes in non-const methods.
+    mutable std::vector<LazyWKB> m_aoLazyWKB{};
+
+    // Protects the content of m_aoLazyWKB and the geometries built from it,
+    // as const methods, possibly called concurrently, may build them.
+    mutable std::mutex m_oLazyWKBMutex{};
+
+    // Geometry objects kept by Reset() when m_aoLazyWKB is not empty, so
+    // that the next WKB of the same type can be imported into them in place.
+    // Sized together with m_aoLazyWKB.
+    mutable std::vector<std::unique_ptr<OGRGeometry>> m_apoRecycledGeoms{};
+
     bool SetFieldInternal(int i, const OGRField *puValue);
+    void MaterializeGeomField(int iField) const;
+    bool SetGeomFieldFromWKBInternal(int iField, const GByte *pabyWKB,
+                                     size_t nWKBSize,
+                                     const OGRSpatialReference *poSRS);
+
+    bool HasLazyWKB(int iField) const
+    {
+        return !m_aoLazyWKB.empty() && !m_aoLazyWKB[iField].abyWKB.empty();
+    }
+
+    std::unique_lock<std::mutex> LockLazyWKB() const
+    {
+        return m_aoLazyWKB.empty()
+                   ? std::unique_lock<std::mutex>()
+                   : std::unique_lock<std::mutex>(m_oLazyWKBMutex);
+    }
+
+    void MaterializeGeomFieldIfNeeded(int iField) const
+    {
+        if (!m_aoLazyWKB.empty())
+        {
+            std::lock_guard oLock(m_oLazyWKBMutex);
+            if (HasLazyWKB(iField))
+                MaterializeGeomField(iField);
+        }
+    }
 
   protected:
     //! @cond Doxygen_Suppress
@@ -1341,6 +1389,7 @@ class CPL_DLL OGRFeature
 
     //! @cond Doxygen_Suppress
     void SetFDefnUnsafe(OGRFeatureDefn *poNewFDefn);
+    void SwapContentUnsafe(OGRFeature *poOther);
     //! @endcond
 
     OGRErr SetGeometryDirectly(OGRGeometry *);
@@ -1373,6 +1422,10 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomFieldDirectly(int iField, OGRGeometry *);
     OGRErr SetGeomField(int iField, const OGRGeometry *);
     OGRErr SetGeomField(int iField, std::unique_ptr<OGRGeometry>);
+    OGRErr SetGeomFieldFromWKB(int iField, const GByte *pabyWKB,
+                               size_t nWKBSize);
+    const GByte *GetGeomFieldWKB(int iField, size_t *pnWKBSize) const;
+    bool GetGeomFieldEnvelope(int iField, OGREnvelope *psEnvelope) const;
 
     void Reset();
 
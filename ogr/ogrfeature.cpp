@@ -39,6 +39,7 @@
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogrlibjsonutils.h"
 
 #include "cpl_json_header.h"
@@ -283,7 +284,11 @@ void OGRFeature::DestroyFeature(OGRFeature *poFeature)
 
 /** Reset the state of a OGRFeature to its state after construction.
  *
- * This enables recycling existing OGRFeature instances.
+ * This enables recycling existing OGRFeature instances. Starting with
+ * GDAL 3.14, the buffers and geometry objects of geometry fields set with
+ * SetGeomFieldFromWKB() (currently by the GPKG driver) are kept, and reused
+ * by the next feature read into this instance (see
+ * OGRLayer::GetNextFeatureInto()).
  *
  * @since GDAL 3.5
  */
@@ -339,11 +344,18 @@ void OGRFeature::Reset()
 
         for (int i = 0; i < nGeomFieldCount; i++)
         {
-            delete papoGeometries[i];
+            if (papoGeometries[i] && !m_apoRecycledGeoms.empty())
+                m_apoRecycledGeoms[i].reset(papoGeometries[i]);
+            else
+                delete papoGeometries[i];
             papoGeometries[i] = nullptr;
         }
     }
 
+    // Keep the buffers allocated, so that recycled features can reuse them.
+    for (auto &oLazyWKB : m_aoLazyWKB)
+        oLazyWKB.abyWKB.clear();
+
     if (m_pszStyleString)
     {
         CPLFree(m_pszStyleString);
@@ -375,6 +387,26 @@ void OGRFeature::SetFDefnUnsafe(OGRFeatureDefn *poNewFDefn)
     poDefn = poNewFDefn;
 }
 
+/************************************************************************/
+/*                         SwapContentUnsafe()                          */
+/************************************************************************/
+
+// Exchange FID, fields, geometries, style string and native data with
+// another feature, which must share the same feature definition.
+void OGRFeature::SwapContentUnsafe(OGRFeature *poOther)
+{
+    CPLAssert(poOther->poDefn == poDefn);
+    std::swap(nFID, poOther->nFID);
+    std::swap(papoGeometries, poOther->papoGeometries);
+    std::swap(pauFields, poOther->pauFields);
+    std::swap(m_pszNativeData, poOther->m_pszNativeData);
+    std::swap(m_pszNativeMediaType, poOther->m_pszNativeMediaType);
+    std::swap(m_aoLazyWKB, poOther->m_aoLazyWKB);
+    std::swap(m_apoRecycledGeoms, poOther->m_apoRecycledGeoms);
+    std::swap(m_pszStyleString, poOther->m_pszStyleString);
+    std::swap(m_poStyleTable, poOther->m_poStyleTable);
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -623,6 +655,7 @@ OGRGeometry *OGRFeature::StealGeometry()
 {
     if (GetGeomFieldCount() > 0)
     {
+        MaterializeGeomFieldIfNeeded(0);
         OGRGeometry *poReturn = papoGeometries[0];
         papoGeometries[0] = nullptr;
         return poReturn;
@@ -651,6 +684,7 @@ OGRGeometry *OGRFeature::StealGeometry(int iGeomField)
 {
     if (iGeomField >= 0 && iGeomField < GetGeomFieldCount())
     {
+        MaterializeGeomFieldIfNeeded(iGeomField);
         OGRGeometry *poReturn = papoGeometries[iGeomField];
         papoGeometries[iGeomField] = nullptr;
         return poReturn;
@@ -823,8 +857,9 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(int iField)
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+
+    MaterializeGeomFieldIfNeeded(iField);
+    return papoGeometries[iField];
 }
 
 /**
@@ -842,8 +877,9 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(int iField) const
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+
+    MaterializeGeomFieldIfNeeded(iField);
+    return papoGeometries[iField];
 }
 
 /************************************************************************/
@@ -866,7 +902,7 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName)
     if (iField < 0)
         return nullptr;
 
-    return papoGeometries[iField];
+    return GetGeomFieldRef(iField);
 }
 
 /**
@@ -884,7 +920,7 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName) const
     if (iField < 0)
         return nullptr;
 
-    return papoGeometries[iField];
+    return GetGeomFieldRef(iField);
 }
 
 /************************************************************************/
@@ -952,7 +988,8 @@ OGRGeometryH OGR_F_GetGeomFieldRef(OGRFeatureH hFeat, int iField)
 
 OGRErr OGRFeature::SetGeomFieldDirectly(int iField, OGRGeometry *poGeomIn)
 {
-    if (poGeomIn && poGeomIn == GetGeomFieldRef(iField))
+    if (poGeomIn && iField >= 0 && iField < GetGeomFieldCount() &&
+        poGeomIn == papoGeometries[iField])
     {
         return OGRERR_NONE;
     }
@@ -1024,6 +1061,9 @@ OGRErr OGRFeature::SetGeomField(int iField, const OGRGeometry *poGeomIn)
     if (iField < 0 || iField >= GetGeomFieldCount())
         return OGRERR_FAILURE;
 
+    if (HasLazyWKB(iField))
+        m_aoLazyWKB[iField].abyWKB.clear();
+
     if (papoGeometries[iField] != poGeomIn)
     {
         delete papoGeometries[iField];
@@ -1100,6 +1140,9 @@ OGRErr OGRFeature::SetGeomField(int iField,
         return OGRERR_FAILURE;
     }
 
+    if (HasLazyWKB(iField))
+        m_aoLazyWKB[iField].abyWKB.clear();
+
     if (papoGeometries[iField] != poGeomIn.get())
     {
         delete papoGeometries[iField];
@@ -1109,6 +1152,235 @@ OGRErr OGRFeature::SetGeomField(int iField,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                        SetGeomFieldFromWKB()                         */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from WKB.
+ *
+ * The WKB buffer is copied into the feature, but it is not parsed: the
+ * OGRGeometry object is only built when it is first requested, for example
+ * by GetGeomFieldRef() or StealGeometry(). Until then, GetGeomFieldWKB()
+ * and GetGeomFieldEnvelope() directly operate on the WKB buffer.
+ *
+ * This is intended for drivers that read geometries as WKB, so that callers
+ * that only pass the geometry through, or only need its extent, do not pay
+ * for building the geometry object. Currently, only the GeoPackage driver
+ * returns features with geometries set this way. Other drivers still build
+ * geometry objects when reading features.
+ *
+ * As the WKB is not parsed by this method, an invalid WKB is not detected
+ * here. The error is only reported when the geometry object is built: a
+ * CE_Failure error is then emitted, and the geometry field is set to NULL
+ * (GetGeomFieldRef() returns NULL). GetGeomFieldEnvelope() and
+ * GetGeomFieldWKB() do not build the geometry object when the WKB is valid,
+ * so they do not report any error either.
+ *
+ * Building the geometry object from const methods, such as
+ * GetGeomFieldRef() const, is protected by a mutex, so that several threads
+ * may read the same feature concurrently. The pointer returned by
+ * GetGeomFieldWKB() is however invalidated when the geometry object is built.
+ *
+ * The geometry will be assigned the spatial reference system of the
+ * geometry field definition.
+ *
+ * @param iField geometry field to set.
+ * @param pabyWKB WKB (ISO or OGC variant) buffer. Must not be NULL.
+ * @param nWKBSize size in bytes of pabyWKB. Must not be zero.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid,
+ * or the buffer is empty or cannot be allocated.
+ *
+ * @since GDAL 3.14
+ */
+
+OGRErr OGRFeature::SetGeomFieldFromWKB(int iField, const GByte *pabyWKB,
+                                       size_t nWKBSize)
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+        return OGRERR_FAILURE;
+
+    return SetGeomFieldFromWKBInternal(
+               iField, pabyWKB, nWKBSize,
+               poDefn->GetGeomFieldDefn(iField)->GetSpatialRef())
+               ? OGRERR_NONE
+               : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                    SetGeomFieldFromWKBInternal()                     */
+/************************************************************************/
+
+bool OGRFeature::SetGeomFieldFromWKBInternal(int iField, const GByte *pabyWKB,
+                                             size_t nWKBSize,
+                                             const OGRSpatialReference *poSRS)
+{
+    if (pabyWKB == nullptr || nWKBSize == 0)
+        return false;
+
+    delete papoGeometries[iField];
+    papoGeometries[iField] = nullptr;
+
+    try
+    {
+        if (m_aoLazyWKB.empty())
+        {
+            m_aoLazyWKB.resize(GetGeomFieldCount());
+            m_apoRecycledGeoms.resize(GetGeomFieldCount());
+        }
+        auto &oLazyWKB = m_aoLazyWKB[iField];
+        oLazyWKB.abyWKB.assign(pabyWKB, pabyWKB + nWKBSize);
+        if (oLazyWKB.poSRS.get() != poSRS)
+            oLazyWKB.poSRS.reset(const_cast<OGRSpatialReference *>(poSRS),
+                                 /* add_ref = */ true);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for geometry WKB");
+        if (!m_aoLazyWKB.empty())
+            m_aoLazyWKB[iField].abyWKB.clear();
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        MaterializeGeomField()                        */
+/************************************************************************/
+
+void OGRFeature::MaterializeGeomField(int iField) const
+{
+    auto &oLazyWKB = m_aoLazyWKB[iField];
+    OGRGeometry *poGeom = nullptr;
+
+    // If Reset() kept the geometry of the previous feature and it has the
+    // same type, import the WKB into it to reuse its coordinate arrays.
+    OGRGeometry *poRecycledGeom =
+        static_cast<size_t>(iField) < m_apoRecycledGeoms.size()
+            ? m_apoRecycledGeoms[iField].get()
+            : nullptr;
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (poRecycledGeom && oLazyWKB.abyWKB.size() >= 9 &&
+        OGRReadWKBGeometryType(oLazyWKB.abyWKB.data(), wkbVariantOldOgc,
+                               &eGeomType) == OGRERR_NONE &&
+        eGeomType == poRecycledGeom->getGeometryType() &&
+        !OGR_GT_IsNonLinear(eGeomType))
+    {
+        size_t nBytesConsumed = 0;
+        if (poRecycledGeom->importFromWkb(
+                oLazyWKB.abyWKB.data(), oLazyWKB.abyWKB.size(),
+                wkbVariantOldOgc, nBytesConsumed) == OGRERR_NONE)
+        {
+            poGeom = m_apoRecycledGeoms[iField].release();
+            poGeom->assignSpatialReference(oLazyWKB.poSRS.get());
+        }
+        else
+        {
+            m_apoRecycledGeoms[iField].reset();
+        }
+    }
+
+    if (poGeom == nullptr &&
+        OGRGeometryFactory::createFromWkb(
+            oLazyWKB.abyWKB.data(), oLazyWKB.poSRS.get(), &poGeom,
+            oLazyWKB.abyWKB.size()) != OGRERR_NONE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Unable to read geometry");
+        delete poGeom;
+        poGeom = nullptr;
+    }
+    // Keep the capacity of the buffer, so that recycled features can reuse it.
+    oLazyWKB.abyWKB.clear();
+    papoGeometries[iField] = poGeom;
+}
+
+/************************************************************************/
+/*                          GetGeomFieldWKB()                           */
+/************************************************************************/
+
+/**
+ * \brief Return the WKB of a geometry field set with SetGeomFieldFromWKB().
+ *
+ * This gives zero-copy access to the WKB buffer as long as the geometry
+ * object has not been built. Once the geometry object has been requested
+ * (or if the geometry was set with SetGeomField()), NULL is returned and
+ * GetGeomFieldRef() must be used instead.
+ *
+ * The returned pointer is owned by the feature, and is invalidated by any
+ * change to the geometry field.
+ *
+ * @param iField geometry field to query.
+ * @param[out] pnWKBSize pointer to the size of the WKB buffer. May be NULL.
+ *
+ * @return a pointer to the WKB buffer, or NULL.
+ *
+ * @since GDAL 3.14
+ */
+
+const GByte *OGRFeature::GetGeomFieldWKB(int iField, size_t *pnWKBSize) const
+{
+    const auto oLock = LockLazyWKB();
+    if (iField < 0 || iField >= GetGeomFieldCount() || !HasLazyWKB(iField))
+    {
+        if (pnWKBSize)
+            *pnWKBSize = 0;
+        return nullptr;
+    }
+
+    const auto &abyWKB = m_aoLazyWKB[iField].abyWKB;
+    if (pnWKBSize)
+        *pnWKBSize = abyWKB.size();
+    return abyWKB.data();
+}
+
+/************************************************************************/
+/*                        GetGeomFieldEnvelope()                        */
+/************************************************************************/
+
+/**
+ * \brief Compute the extent of a geometry field.
+ *
+ * If the geometry was set with SetGeomFieldFromWKB() and has not been built
+ * yet, the extent is computed directly from the WKB, without building the
+ * geometry object.
+ *
+ * @param iField geometry field to query.
+ * @param[out] psEnvelope extent of the geometry. Must not be NULL.
+ *
+ * @return true if the geometry is set and not empty.
+ *
+ * @since GDAL 3.14
+ */
+
+bool OGRFeature::GetGeomFieldEnvelope(int iField,
+                                      OGREnvelope *psEnvelope) const
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+        return false;
+
+    const auto oLock = LockLazyWKB();
+    if (HasLazyWKB(iField))
+    {
+        const auto &abyWKB = m_aoLazyWKB[iField].abyWKB;
+        OGREnvelope sEnvelope;
+        if (OGRWKBGetBoundingBox(abyWKB.data(), abyWKB.size(), sEnvelope))
+        {
+            *psEnvelope = sEnvelope;
+            return sEnvelope.IsInit();
+        }
+        // Let the geometry parser report the error.
+        MaterializeGeomField(iField);
+    }
+
+    const OGRGeometry *poGeom = papoGeometries[iField];
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    poGeom->getEnvelope(psEnvelope);
+    return true;
+}
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -1189,6 +1461,7 @@ bool OGRFeature::CopySelfTo(OGRFeature *poNew) const
             return false;
         }
     }
+    const auto oLock = LockLazyWKB();
     if (poNew->papoGeometries)
     {
         for (int i = 0; i < poDefn->GetGeomFieldCount(); i++)
@@ -1203,6 +1476,8 @@ bool OGRFeature::CopySelfTo(OGRFeature *poNew) const
             }
         }
     }
+    // Pending WKB is copied as is, without being parsed.
+    poNew->m_aoLazyWKB = m_aoLazyWKB;
 
     if (m_pszStyleString != nullptr)
     {
@@ -1525,13 +1800,13 @@ int OGRFeature::IsFieldSet(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             case SPF_OGR_GEOMETRY:
-                return GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr;
+                return GetGeomFieldCount() > 0 && GetGeomFieldRef(0) != nullptr;
 
             case SPF_OGR_STYLE:
                 return GetStyleString() != nullptr;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return FALSE;
 
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])) !=
@@ -2020,7 +2295,7 @@ int OGRFeature::GetFieldAsInteger(int iField) const
             }
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2149,7 +2424,7 @@ GIntBig OGRFeature::GetFieldAsInteger64(int iField) const
                 return nFID;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2266,7 +2541,7 @@ double OGRFeature::GetFieldAsDouble(int iField) const
                 return static_cast<double>(GetFID());
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return 0.0;
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0]));
 
@@ -2460,7 +2735,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
             }
 
             case SPF_OGR_GEOMETRY:
-                if (GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr)
+                if (GetGeomFieldCount() > 0 && GetGeomFieldRef(0) != nullptr)
                     return papoGeometries[0]->getGeometryName();
                 else
                     return "";
@@ -2473,7 +2748,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return "";
 
                 if (papoGeometries[0]->exportToWkt(&m_pszTmpFieldValue) ==
@@ -2485,7 +2760,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_AREA:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeomFieldRef(0) == nullptr)
                     return "";
 
                 constexpr size_t MAX_SIZE = 20 + 1;
@@ -5774,8 +6049,9 @@ std::string OGRFeature::DumpReadableAsString(CSLConstList papszOptions) const
             {
                 const OGRGeomFieldDefn *poFDefn =
                     poDefn->GetGeomFieldDefn(iField);
+                const OGRGeometry *poGeom = GetGeomFieldRef(iField);
 
-                if (papoGeometries[iField] != nullptr)
+                if (poGeom != nullptr)
                 {
                     CPLStringList aosGeomOptions(papszOptions);
 
@@ -5806,8 +6082,8 @@ std::string OGRFeature::DumpReadableAsString(CSLConstList papszOptions) const
                     if (strlen(poFDefn->GetNameRef()) > 0 &&
                         GetGeomFieldCount() > 1)
                         osRet += CPLOPrintf("%s = ", poFDefn->GetNameRef());
-                    osRet += papoGeometries[iField]->dumpReadable(
-                        nullptr, aosGeomOptions.List());
+                    osRet += poGeom->dumpReadable(nullptr,
+                                                  aosGeomOptions.List());
                 }
             }
         }
@@ -6352,17 +6628,37 @@ OGRErr OGRFeature::SetFrom(const OGRFeature *poSrcFeature, const int *panMap,
     /* -------------------------------------------------------------------- */
     /*      Set the geometry.                                               */
     /* -------------------------------------------------------------------- */
+    // Pending WKB of the source feature is transferred without being parsed.
+    const auto CopyGeomField = [this, poSrcFeature](int iDst, int iSrc)
+    {
+        if (iSrc < poSrcFeature->GetGeomFieldCount())
+        {
+            const auto oLock = poSrcFeature->LockLazyWKB();
+            if (poSrcFeature->HasLazyWKB(iSrc))
+            {
+                const auto &oLazyWKB = poSrcFeature->m_aoLazyWKB[iSrc];
+                if (SetGeomFieldFromWKBInternal(iDst, oLazyWKB.abyWKB.data(),
+                                                oLazyWKB.abyWKB.size(),
+                                                oLazyWKB.poSRS.get()))
+                {
+                    return;
+                }
+            }
+        }
+        SetGeomField(iDst, poSrcFeature->GetGeomFieldRef(iSrc));
+    };
+
     if (GetGeomFieldCount() == 1)
     {
         const OGRGeomFieldDefn *poGFieldDefn = GetGeomFieldDefnRef(0);
 
         int iSrc = poSrcFeature->GetGeomFieldIndex(poGFieldDefn->GetNameRef());
         if (iSrc >= 0)
-            SetGeomField(0, poSrcFeature->GetGeomFieldRef(iSrc));
+            CopyGeomField(0, iSrc);
         else
             // Whatever the geometry field names are.  For backward
             // compatibility.
-            SetGeomField(0, poSrcFeature->GetGeomFieldRef(0));
+            CopyGeomField(0, 0);
     }
     else
     {
@@ -6373,7 +6669,7 @@ OGRErr OGRFeature::SetFrom(const OGRFeature *poSrcFeature, const int *panMap,
             const int iSrc =
                 poSrcFeature->GetGeomFieldIndex(poGFieldDefn->GetNameRef());
             if (iSrc >= 0)
-                SetGeomField(i, poSrcFeature->GetGeomFieldRef(iSrc));
+                CopyGeomField(i, iSrc);
             else
                 SetGeomField(i, nullptr);
         }
@@ -6935,6 +7231,11 @@ OGRErr OGRFeature::RemapGeomFields(const OGRFeatureDefn *poNewDefn,
     if (poNewDefn == nullptr)
         poNewDefn = poDefn;
 
+    for (int i = 0; i < poDefn->GetGeomFieldCount(); i++)
+        MaterializeGeomFieldIfNeeded(i);
+    m_aoLazyWKB.clear();
+    m_apoRecycledGeoms.clear();
+
     OGRGeometry **papoNewGeomFields = static_cast<OGRGeometry **>(
         CPLCalloc(poNewDefn->GetGeomFieldCount(), sizeof(OGRGeometry *)));
 
@@ -7843,8 +8144,17 @@ bool OGRFeature::SerializeToBinary(std::vector<GByte> &abyBuffer) const
                 }
             }
         }
+        const auto oLock = LockLazyWKB();
         for (int i = 0; i < nGeomFieldCount; ++i)
         {
+            if (HasLazyWKB(i))
+            {
+                const auto &abyWKB = m_aoLazyWKB[i].abyWKB;
+                WriteVarUInt(abyBuffer, abyWKB.size());
+                abyBuffer.insert(abyBuffer.end(), abyWKB.begin(),
+                                 abyWKB.end());
+                continue;
+            }
             if (!papoGeometries[i])
             {
                 const int iBit = 2 * nFieldCount + i;
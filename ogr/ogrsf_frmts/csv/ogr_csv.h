@@ -82,6 +82,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     bool bHasFieldNames = false;
 
     OGRFeature *GetNextUnfilteredFeature();
+    bool GetNextUnfilteredFeature(OGRFeature *poFeature);
 
     bool bNew = false;
     bool bInWriteMode = false;
@@ -214,6 +215,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool IGetNextFeatureInto(OGRFeature *poFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
 
     using OGRLayer::GetLayerDefn;
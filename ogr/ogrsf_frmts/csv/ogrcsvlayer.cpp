@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cinttypes>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -1331,16 +1332,24 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
 {
-    if (fpCSV == nullptr)
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn.get());
+    if (!GetNextUnfilteredFeature(poFeature.get()))
         return nullptr;
+    return poFeature.release();
+}
+
+// Fill poFeature, which must be in the state of a newly created or reset
+// feature of the layer definition.
+bool OGRCSVLayer::GetNextUnfilteredFeature(OGRFeature *poFeature)
+
+{
+    if (fpCSV == nullptr)
+        return false;
 
     // Read the CSV record.
     char **papszTokens = GetNextLineTokens();
     if (papszTokens == nullptr)
-        return nullptr;
-
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn.get());
+        return false;
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1726,7 +1735,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
     m_nFeaturesRead++;
 
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
@@ -1735,24 +1744,35 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
 OGRFeature *OGRCSVLayer::GetNextFeature()
 
+{
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn.get());
+    if (!IGetNextFeatureInto(poFeature.get()))
+        return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                        IGetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRCSVLayer::IGetNextFeatureInto(OGRFeature *poFeature)
+
 {
     if (bNeedRewindBeforeRead)
         ResetReading();
 
     // Read features till we find one that satisfies our current
-    // spatial criteria.
+    // spatial criteria. Rejected records are read into the same feature.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
-        if (poFeature == nullptr)
-            return nullptr;
+        poFeature->Reset();
+        if (!GetNextUnfilteredFeature(poFeature))
+            return false;
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
-            return poFeature;
-
-        delete poFeature;
+            return true;
     }
 }
 
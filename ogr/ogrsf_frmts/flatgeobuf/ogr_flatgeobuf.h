@@ -166,6 +166,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRFeature *GetNextFeature() override;
+    bool IGetNextFeatureInto(OGRFeature *poFeature) override;
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = true) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -988,38 +988,50 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
     if (m_create)
         return nullptr;
 
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+    if (!IGetNextFeatureInto(poFeature.get()))
+        return nullptr;
+    return poFeature.release();
+}
+
+bool OGRFlatGeobufLayer::IGetNextFeatureInto(OGRFeature *poFeature)
+{
+    if (m_create)
+        return false;
+
+    // Rejected features are read into the same feature.
     while (true)
     {
         if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
         {
             CPLDebugOnly("FlatGeobuf", "GetNextFeature: iteration end at %lu",
                          static_cast<long unsigned int>(m_featuresPos));
-            return nullptr;
+            return false;
         }
 
         if (readIndex() != OGRERR_NONE)
         {
-            return nullptr;
+            return false;
         }
 
         if (m_queriedSpatialIndex && m_featuresCount == 0)
         {
             CPLDebugOnly("FlatGeobuf", "GetNextFeature: no features found");
-            return nullptr;
+            return false;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
+        poFeature->Reset();
+        if (parseFeature(poFeature) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Fatal error parsing feature");
-            return nullptr;
+            return false;
         }
 
         if (VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
         {
             CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
-            return nullptr;
+            return false;
         }
 
         m_featuresPos++;
@@ -1027,8 +1039,8 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
         if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
             (m_poAttrQuery == nullptr || m_ignoreAttributeFilter ||
-             m_poAttrQuery->Evaluate(poFeature.get())))
-            return poFeature.release();
+             m_poAttrQuery->Evaluate(poFeature)))
+            return true;
     }
 }
 
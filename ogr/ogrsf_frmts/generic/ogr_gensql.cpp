@@ -19,10 +19,17 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
+#include <numeric>
+#include <queue>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -74,6 +81,1279 @@ static bool OGRGenSQLResultsLayerHasSpecialField(swq_expr_node *expr,
     return false;
 }
 
+/************************************************************************/
+/*                          OGRGenSQLTempFile                           */
+/************************************************************************/
+
+/** Temporary file to which data is appended, and from which it is read back
+ * at random offsets. It is created on the first write, and removed when the
+ * object is destroyed.
+ */
+class OGRGenSQLTempFile
+{
+  public:
+    explicit OGRGenSQLTempFile(const char *pszStem) : m_osStem(pszStem)
+    {
+    }
+
+    ~OGRGenSQLTempFile();
+
+    bool Append(const void *pData, size_t nSize);
+    bool Read(vsi_l_offset nOffset, void *pData, size_t nSize);
+
+    vsi_l_offset GetSize() const
+    {
+        return m_nSize;
+    }
+
+  private:
+    std::string m_osStem{};
+    std::string m_osFilename{};
+    VSILFILE *m_fp = nullptr;
+    vsi_l_offset m_nSize = 0;
+    bool m_bAtEnd = true;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLTempFile)
+};
+
+/************************************************************************/
+/*               OGRGenSQLTempFile::~OGRGenSQLTempFile()                */
+/************************************************************************/
+
+OGRGenSQLTempFile::~OGRGenSQLTempFile()
+{
+    if (m_fp)
+    {
+        VSIFCloseL(m_fp);
+        VSIUnlink(m_osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                     OGRGenSQLTempFile::Append()                      */
+/************************************************************************/
+
+bool OGRGenSQLTempFile::Append(const void *pData, size_t nSize)
+{
+    if (m_fp == nullptr)
+    {
+        m_osFilename = CPLGenerateTempFilenameSafe(m_osStem.c_str());
+        m_fp = VSIFOpenL(m_osFilename.c_str(), "wb+");
+        if (m_fp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot create temporary file %s", m_osFilename.c_str());
+            return false;
+        }
+    }
+
+    if ((!m_bAtEnd && VSIFSeekL(m_fp, m_nSize, SEEK_SET) != 0) ||
+        VSIFWriteL(pData, 1, nSize, m_fp) != nSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write temporary file %s",
+                 m_osFilename.c_str());
+        return false;
+    }
+    m_bAtEnd = true;
+    m_nSize += nSize;
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRGenSQLTempFile::Read()                       */
+/************************************************************************/
+
+bool OGRGenSQLTempFile::Read(vsi_l_offset nOffset, void *pData, size_t nSize)
+{
+    m_bAtEnd = false;
+    if (m_fp == nullptr || nOffset + nSize > m_nSize ||
+        VSIFSeekL(m_fp, nOffset, SEEK_SET) != 0 ||
+        VSIFReadL(pData, 1, nSize, m_fp) != nSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read temporary file %s",
+                 m_osFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          GetSortMaxMemory()                          */
+/************************************************************************/
+
+/** Memory budget for the ORDER BY keys and the DISTINCT values, beyond which
+ * they are sorted in runs written to a temporary file. */
+static GIntBig GetSortMaxMemory()
+{
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_SORT_MAX_MEMORY", nullptr);
+    GIntBig nMaxMemory = 0;
+    if (pszMaxMemory &&
+        CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr) == CE_None)
+    {
+        return nMaxMemory;
+    }
+    const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+    return nUsableRAM > 0 ? nUsableRAM / 10 : 100 * 1024 * 1024;
+}
+
+/************************************************************************/
+/*                       OGRGenSQLTempFileReader                        */
+/************************************************************************/
+
+/** Buffered sequential reader of a range of an OGRGenSQLTempFile */
+class OGRGenSQLTempFileReader
+{
+  public:
+    OGRGenSQLTempFileReader(OGRGenSQLTempFile &oFile, vsi_l_offset nStart,
+                            vsi_l_offset nEnd, size_t nBufferSize)
+        : m_poFile(&oFile), m_nOffset(nStart), m_nEnd(nEnd),
+          m_nBufferSize(nBufferSize)
+    {
+    }
+
+    bool IsAtEnd() const
+    {
+        return m_nBufferPos == m_abyBuffer.size() && m_nOffset == m_nEnd;
+    }
+
+    /** Offset in the file of the next byte to be read */
+    vsi_l_offset GetOffset() const
+    {
+        return m_nOffset - (m_abyBuffer.size() - m_nBufferPos);
+    }
+
+    const GByte *Read(size_t nBytes);
+
+  private:
+    OGRGenSQLTempFile *m_poFile = nullptr;
+    vsi_l_offset m_nOffset = 0;
+    vsi_l_offset m_nEnd = 0;
+    size_t m_nBufferSize = 0;
+    std::vector<GByte> m_abyBuffer{};
+    size_t m_nBufferPos = 0;
+};
+
+/************************************************************************/
+/*                   OGRGenSQLTempFileReader::Read()                    */
+/************************************************************************/
+
+/** Returns a pointer to the next nBytes bytes, valid until the next call,
+ * or nullptr in case of error or if they go beyond the end of the range.
+ */
+const GByte *OGRGenSQLTempFileReader::Read(size_t nBytes)
+{
+    const size_t nAvailable = m_abyBuffer.size() - m_nBufferPos;
+    if (nAvailable < nBytes)
+    {
+        if (static_cast<vsi_l_offset>(nBytes - nAvailable) >
+            m_nEnd - m_nOffset)
+            return nullptr;
+        m_abyBuffer.erase(m_abyBuffer.begin(),
+                          m_abyBuffer.begin() + m_nBufferPos);
+        m_nBufferPos = 0;
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(std::max(m_nBufferSize, nBytes) - nAvailable,
+                                   m_nEnd - m_nOffset));
+        m_abyBuffer.resize(nAvailable + nToRead);
+        if (!m_poFile->Read(m_nOffset, m_abyBuffer.data() + nAvailable,
+                            nToRead))
+            return nullptr;
+        m_nOffset += nToRead;
+    }
+    const GByte *pabyRet = m_abyBuffer.data() + m_nBufferPos;
+    m_nBufferPos += nBytes;
+    return pabyRet;
+}
+
+/************************************************************************/
+/*                        OGRGenSQLDistinctRuns                         */
+/************************************************************************/
+
+/** DISTINCT values of a column, written to a temporary file by runs when the
+ * set of its swq_summary does not fit in OGR_SQL_SORT_MAX_MEMORY.
+ *
+ * Each run is sorted with the comparator of the set, and each of its records
+ * is made of the sequence number of the value, its size and its bytes.
+ * Sequence numbers follow the order in which values were first met, so that
+ * when merging the runs, the first value of a group of equivalent values is
+ * kept, as with the set. Unless the DISTINCT list is sorted, the values are
+ * also written in that order to a second file, from which the list is
+ * eventually read.
+ */
+class OGRGenSQLDistinctRuns
+{
+  public:
+    explicit OGRGenSQLDistinctRuns(bool bKeepOrder) : m_bKeepOrder(bKeepOrder)
+    {
+    }
+
+    bool AddRun(swq_summary &oSummary);
+    bool Finish(swq_summary &oSummary, bool bBuildList, GIntBig nMaxMemory);
+    bool GetValue(GIntBig nIndex, std::string &osValue);
+
+  private:
+    struct Run
+    {
+        vsi_l_offset nOffset = 0;
+        vsi_l_offset nSize = 0;
+    };
+
+    const bool m_bKeepOrder;
+    OGRGenSQLTempFile m_oFile{"ogr_sql_distinct"};
+    OGRGenSQLTempFile m_oOrderFile{"ogr_sql_distinct_order"};
+    std::vector<Run> m_asRuns{};
+    GIntBig m_nSeq = 0;
+
+    // Offsets of the records of the DISTINCT list, in m_oOrderFile if
+    // m_bKeepOrder, or in m_oFile otherwise
+    OGRGenSQLTempFile m_oListFile{"ogr_sql_distinct_list"};
+    GIntBig m_nListSize = 0;
+
+    static bool ReadRecord(OGRGenSQLTempFileReader &oReader, GIntBig &nSeq,
+                           std::string &osValue);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLDistinctRuns)
+};
+
+/************************************************************************/
+/*                  OGRGenSQLDistinctRuns::AddRun()                     */
+/************************************************************************/
+
+/** Write the values of the set of oSummary as a run, and clear it */
+bool OGRGenSQLDistinctRuns::AddRun(swq_summary &oSummary)
+{
+    const size_t nValues = oSummary.oSetDistinctValues.size();
+    if (nValues == 0)
+        return true;
+
+    std::vector<GByte> abyBuffer;
+    constexpr size_t BUFFER_SIZE = 1024 * 1024;
+    const auto AppendRecord = [&abyBuffer](GIntBig nSeq, const CPLString &osVal)
+    {
+        const uint32_t nLen = static_cast<uint32_t>(osVal.size());
+        const GByte *pabySeq = reinterpret_cast<const GByte *>(&nSeq);
+        const GByte *pabyLen = reinterpret_cast<const GByte *>(&nLen);
+        abyBuffer.insert(abyBuffer.end(), pabySeq, pabySeq + sizeof(nSeq));
+        abyBuffer.insert(abyBuffer.end(), pabyLen, pabyLen + sizeof(nLen));
+        abyBuffer.insert(abyBuffer.end(), osVal.begin(), osVal.end());
+    };
+    const auto Flush = [&abyBuffer](OGRGenSQLTempFile &oFile, bool bForce)
+    {
+        if (abyBuffer.empty() || (!bForce && abyBuffer.size() < BUFFER_SIZE))
+            return true;
+        const bool bRet = oFile.Append(abyBuffer.data(), abyBuffer.size());
+        abyBuffer.clear();
+        return bRet;
+    };
+
+    Run sRun;
+    sRun.nOffset = m_oFile.GetSize();
+    try
+    {
+        if (m_bKeepOrder)
+        {
+            // The vector has the values in the order they were first met
+            const auto &aosValues = oSummary.oVectorDistinctValues;
+            CPLAssert(aosValues.size() == nValues);
+            for (size_t i = 0; i < nValues; ++i)
+            {
+                AppendRecord(m_nSeq + static_cast<GIntBig>(i), aosValues[i]);
+                if (!Flush(m_oOrderFile, i + 1 == nValues))
+                    return false;
+            }
+
+            const auto oComparator = oSummary.oSetDistinctValues.key_comp();
+            std::vector<size_t> anIndex(nValues);
+            std::iota(anIndex.begin(), anIndex.end(), 0);
+            std::sort(anIndex.begin(), anIndex.end(),
+                      [&aosValues, &oComparator](size_t a, size_t b)
+                      { return oComparator(aosValues[a], aosValues[b]); });
+            for (size_t i = 0; i < nValues; ++i)
+            {
+                AppendRecord(m_nSeq + static_cast<GIntBig>(anIndex[i]),
+                             aosValues[anIndex[i]]);
+                if (!Flush(m_oFile, i + 1 == nValues))
+                    return false;
+            }
+        }
+        else
+        {
+            size_t i = 0;
+            for (const auto &osValue : oSummary.oSetDistinctValues)
+            {
+                AppendRecord(m_nSeq + static_cast<GIntBig>(i), osValue);
+                ++i;
+                if (!Flush(m_oFile, i == nValues))
+                    return false;
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "PrepareSummary(): out of memory");
+        return false;
+    }
+    sRun.nSize = m_oFile.GetSize() - sRun.nOffset;
+    m_asRuns.push_back(sRun);
+    m_nSeq += static_cast<GIntBig>(nValues);
+
+    oSummary.oSetDistinctValues.clear();
+    oSummary.oVectorDistinctValues.clear();
+    oSummary.oVectorDistinctValues.shrink_to_fit();
+    return true;
+}
+
+/************************************************************************/
+/*                OGRGenSQLDistinctRuns::ReadRecord()                   */
+/************************************************************************/
+
+bool OGRGenSQLDistinctRuns::ReadRecord(OGRGenSQLTempFileReader &oReader,
+                                       GIntBig &nSeq, std::string &osValue)
+{
+    uint32_t nLen = 0;
+    const GByte *pabyHeader = oReader.Read(sizeof(nSeq) + sizeof(nLen));
+    if (!pabyHeader)
+        return false;
+    memcpy(&nSeq, pabyHeader, sizeof(nSeq));
+    memcpy(&nLen, pabyHeader + sizeof(nSeq), sizeof(nLen));
+    osValue.clear();
+    if (nLen > 0)
+    {
+        const GByte *pabyValue = oReader.Read(nLen);
+        if (!pabyValue)
+            return false;
+        osValue.assign(reinterpret_cast<const char *>(pabyValue), nLen);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRGenSQLDistinctRuns::Finish()                     */
+/************************************************************************/
+
+/** Merge the runs, including the values still in oSummary, and set its
+ * count to the number of distinct values. If bBuildList, also build the
+ * DISTINCT list, read by GetValue().
+ */
+bool OGRGenSQLDistinctRuns::Finish(swq_summary &oSummary, bool bBuildList,
+                                   GIntBig nMaxMemory)
+{
+    const auto oComparator = oSummary.oSetDistinctValues.key_comp();
+    if (!AddRun(oSummary))
+        return false;
+
+    const size_t nRuns = m_asRuns.size();
+    const size_t nBufferSize = static_cast<size_t>(std::clamp<GIntBig>(
+        nMaxMemory / static_cast<GIntBig>(2 * std::max<size_t>(nRuns, 1)),
+        4096, 1024 * 1024));
+
+    struct RunCursor
+    {
+        OGRGenSQLTempFileReader oReader;
+        vsi_l_offset nRecordOffset = 0;
+        GIntBig nSeq = 0;
+        std::string osValue{};
+    };
+
+    std::vector<RunCursor> aoCursors;
+    bool bError = false;
+    const auto ReadNext = [&bError](RunCursor &oCursor)
+    {
+        if (oCursor.oReader.IsAtEnd())
+            return false;
+        oCursor.nRecordOffset = oCursor.oReader.GetOffset();
+        if (!ReadRecord(oCursor.oReader, oCursor.nSeq, oCursor.osValue))
+        {
+            bError = true;
+            return false;
+        }
+        return true;
+    };
+
+    // Cursors with the smallest value first, and for equivalent values, the
+    // one with the smallest sequence number.
+    const auto Greater = [&aoCursors, &oComparator](size_t i, size_t j)
+    {
+        const RunCursor &oFirst = aoCursors[i];
+        const RunCursor &oSecond = aoCursors[j];
+        if (oComparator(oSecond.osValue, oFirst.osValue))
+            return true;
+        if (oComparator(oFirst.osValue, oSecond.osValue))
+            return false;
+        return oFirst.nSeq > oSecond.nSeq;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(Greater)> oQueue(
+        Greater);
+
+    GIntBig nCount = 0;
+    // Sequence numbers of the values kept, if the list is in that order
+    std::vector<bool> abKept;
+    std::vector<vsi_l_offset> anOffsets;
+    constexpr size_t OFFSET_BUFFER_SIZE = 65536;
+    const auto FlushOffsets = [this, &anOffsets](bool bForce)
+    {
+        if (anOffsets.empty() ||
+            (!bForce && anOffsets.size() < OFFSET_BUFFER_SIZE))
+            return true;
+        const bool bRet = m_oListFile.Append(
+            anOffsets.data(), anOffsets.size() * sizeof(vsi_l_offset));
+        m_nListSize += static_cast<GIntBig>(anOffsets.size());
+        anOffsets.clear();
+        return bRet;
+    };
+
+    try
+    {
+        if (bBuildList && m_bKeepOrder)
+            abKept.resize(static_cast<size_t>(m_nSeq));
+
+        aoCursors.reserve(nRuns);
+        for (size_t i = 0; i < nRuns; ++i)
+        {
+            aoCursors.push_back(
+                RunCursor{OGRGenSQLTempFileReader(
+                              m_oFile, m_asRuns[i].nOffset,
+                              m_asRuns[i].nOffset + m_asRuns[i].nSize,
+                              nBufferSize),
+                          0, 0, std::string()});
+            if (ReadNext(aoCursors[i]))
+                oQueue.push(i);
+            else if (bError)
+                return false;
+        }
+
+        std::string osLastValue;
+        while (!oQueue.empty())
+        {
+            const size_t iRun = oQueue.top();
+            oQueue.pop();
+            RunCursor &oCursor = aoCursors[iRun];
+
+            // Values come in increasing order, so a value is equivalent to
+            // the last distinct one unless it is greater.
+            if (nCount == 0 || oComparator(osLastValue, oCursor.osValue))
+            {
+                ++nCount;
+                osLastValue = oCursor.osValue;
+                if (bBuildList && m_bKeepOrder)
+                {
+                    abKept[static_cast<size_t>(oCursor.nSeq)] = true;
+                }
+                else if (bBuildList)
+                {
+                    anOffsets.push_back(oCursor.nRecordOffset);
+                    if (!FlushOffsets(false))
+                        return false;
+                }
+            }
+
+            if (ReadNext(oCursor))
+                oQueue.push(iRun);
+            else if (bError)
+                return false;
+        }
+
+        if (bBuildList && m_bKeepOrder)
+        {
+            // Records of m_oOrderFile are in the order of their sequence
+            // numbers
+            OGRGenSQLTempFileReader oReader(m_oOrderFile, 0,
+                                            m_oOrderFile.GetSize(),
+                                            1024 * 1024);
+            GIntBig nSeq = 0;
+            std::string osValue;
+            while (!oReader.IsAtEnd())
+            {
+                const vsi_l_offset nRecordOffset = oReader.GetOffset();
+                if (!ReadRecord(oReader, nSeq, osValue) || nSeq < 0 ||
+                    nSeq >= m_nSeq)
+                {
+                    return false;
+                }
+                if (abKept[static_cast<size_t>(nSeq)])
+                {
+                    anOffsets.push_back(nRecordOffset);
+                    if (!FlushOffsets(false))
+                        return false;
+                }
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "PrepareSummary(): out of memory");
+        return false;
+    }
+    if (!FlushOffsets(true))
+        return false;
+
+    oSummary.count = nCount;
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGenSQLDistinctRuns::GetValue()                    */
+/************************************************************************/
+
+/** Returns the value at nIndex in the DISTINCT list */
+bool OGRGenSQLDistinctRuns::GetValue(GIntBig nIndex, std::string &osValue)
+{
+    if (nIndex < 0 || nIndex >= m_nListSize)
+        return false;
+
+    vsi_l_offset nOffset = 0;
+    if (!m_oListFile.Read(static_cast<vsi_l_offset>(nIndex) * sizeof(nOffset),
+                          &nOffset, sizeof(nOffset)))
+    {
+        return false;
+    }
+
+    OGRGenSQLTempFile &oFile = m_bKeepOrder ? m_oOrderFile : m_oFile;
+    GIntBig nSeq = 0;
+    uint32_t nLen = 0;
+    GByte abyHeader[sizeof(nSeq) + sizeof(nLen)];
+    if (!oFile.Read(nOffset, abyHeader, sizeof(abyHeader)))
+        return false;
+    memcpy(&nLen, abyHeader + sizeof(nSeq), sizeof(nLen));
+    osValue.resize(nLen);
+    return nLen == 0 ||
+           oFile.Read(nOffset + sizeof(abyHeader), osValue.data(), nLen);
+}
+
+/************************************************************************/
+/*                         OGRGenSQLJoinLookup                          */
+/************************************************************************/
+
+/** Finds the secondary feature matching a primary feature for a JOIN whose
+ * ON clause is an equality between a field of the primary table and a field
+ * of the secondary table, without re-querying the secondary layer for each
+ * primary feature.
+ *
+ * The secondary layer is scanned once to build a hash table from the join
+ * key to the first feature with that key. Features are stored serialized,
+ * and spilled to a temporary file when the memory budget is exceeded. If the
+ * secondary layer is sorted on the join key, and the hash table does not fit
+ * in the memory budget (or OGR_SQL_JOIN_STRATEGY=MERGE), a merge join reading
+ * the secondary layer in lockstep with the primary layer is used instead. It
+ * falls back to the hash join as soon as the primary keys are found not to be
+ * sorted.
+ *
+ * Keys are encoded such that the bytewise order of the encoded keys matches
+ * the order of the values: numeric for integers and reals, integers being
+ * compared exactly to reals, and for strings case insensitive or not,
+ * depending on how the attribute filter of the secondary layer (used by the
+ * nested loop) compares them.
+ */
+class OGRGenSQLJoinLookup
+{
+  public:
+    static std::unique_ptr<OGRGenSQLJoinLookup>
+    Create(const swq_join_def *psJoinInfo,
+           const std::vector<OGRLayer *> &apoTableLayers);
+
+    ~OGRGenSQLJoinLookup();
+
+    bool Lookup(const OGRFeature *poSrcFeat,
+                std::unique_ptr<OGRFeature> &poJoinFeature);
+
+    void ResetReading();
+
+  private:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    enum class Strategy
+    {
+        NESTED_LOOP,
+        HASH,
+        MERGE
+    };
+
+    OGRLayer *m_poJoinLayer = nullptr;
+    std::string m_osDescription{};
+    int m_iPrimaryField = -1;
+    int m_iSecondaryField = -1;
+    KeyType m_eKeyType = KeyType::INTEGER;
+    bool m_bCaseSensitivityKnown = false;
+    bool m_bCaseInsensitive = false;
+    bool m_bAllowMerge = false;
+    bool m_bPreferMerge = false;
+    GIntBig m_nMemoryBudget = 0;
+    bool m_bPrepared = false;
+    Strategy m_eStrategy = Strategy::NESTED_LOOP;
+
+    // Hash join: map from the key to the offset and size of the serialized
+    // feature. Offsets below m_nSpilledSize are in the temporary file, the
+    // other ones in m_abyBuffer.
+    std::unordered_map<std::string, std::pair<vsi_l_offset, size_t>> m_oMap{};
+    std::vector<GByte> m_abyBuffer{};
+    std::vector<GByte> m_abyTmp{};
+    GIntBig m_nMemoryUsage = 0;
+    std::unique_ptr<OGRGenSQLTempFile> m_poSpillFile{};
+    vsi_l_offset m_nSpilledSize = 0;
+
+    // Merge join
+    std::unique_ptr<OGRFeature> m_poMergeFeature{};
+    std::string m_osMergeKey{};
+    std::string m_osLastPrimaryKey{};
+    bool m_bHasLastPrimaryKey = false;
+    bool m_bMergeEOF = false;
+    bool m_bMergeRestart = true;
+
+    OGRGenSQLJoinLookup() = default;
+
+    bool GetKey(const OGRFeature *poFeature, int iField,
+                std::string &osKey) const;
+    bool ProbeCaseInsensitivity(const std::string &osValue,
+                                bool &bCaseInsensitive);
+    void BuildHashTable(bool bAllowMerge);
+    bool StoreFeature(const std::string &osKey, const OGRFeature *poFeature);
+    bool Spill();
+    void ClearHashTable();
+    void LookupHash(const std::string &osKey,
+                    std::unique_ptr<OGRFeature> &poJoinFeature);
+    bool LookupMerge(const std::string &osKey,
+                     std::unique_ptr<OGRFeature> &poJoinFeature);
+    void SwitchToHash(const char *pszReason);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLJoinLookup)
+};
+
+/************************************************************************/
+/*                    OGRGenSQLJoinLookup::Create()                     */
+/************************************************************************/
+
+/** Returns nullptr if the JOIN must be evaluated with a nested loop */
+std::unique_ptr<OGRGenSQLJoinLookup>
+OGRGenSQLJoinLookup::Create(const swq_join_def *psJoinInfo,
+                            const std::vector<OGRLayer *> &apoTableLayers)
+{
+    swq_expr_node *poExpr = psJoinInfo->poExpr;
+    char *pszExpr = poExpr->Unparse(nullptr, '"');
+    const std::string osDescription(pszExpr ? pszExpr : "");
+    CPLFree(pszExpr);
+
+    const char *pszStrategy =
+        CPLGetConfigOption("OGR_SQL_JOIN_STRATEGY", "AUTO");
+    if (EQUAL(pszStrategy, "NESTED_LOOP"))
+    {
+        CPLDebug("GenSQL", "JOIN ON %s: nested loop (forced)",
+                 osDescription.c_str());
+        return nullptr;
+    }
+
+    const auto NestedLoop = [&osDescription](const char *pszReason)
+    {
+        CPLDebug("GenSQL", "JOIN ON %s: nested loop (%s)",
+                 osDescription.c_str(), pszReason);
+        return nullptr;
+    };
+
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return NestedLoop("ON clause is not an equality between two fields");
+    }
+
+    const swq_expr_node *poPrimaryNode = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondaryNode = poExpr->papoSubExpr[1];
+    if (poPrimaryNode->table_index != 0)
+        std::swap(poPrimaryNode, poSecondaryNode);
+    if (poPrimaryNode->table_index != 0 ||
+        poSecondaryNode->table_index != psJoinInfo->secondary_table)
+    {
+        return NestedLoop("ON clause does not compare the primary and "
+                          "secondary tables");
+    }
+
+    OGRLayer *poPrimaryLayer = apoTableLayers[0];
+    OGRLayer *poJoinLayer = apoTableLayers[psJoinInfo->secondary_table];
+    if (poJoinLayer == poPrimaryLayer)
+        return NestedLoop("self join");
+
+    const OGRFeatureDefn *poPrimaryDefn = poPrimaryLayer->GetLayerDefn();
+    const OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+    if (poPrimaryNode->field_index >= poPrimaryDefn->GetFieldCount() ||
+        poSecondaryNode->field_index >= poJoinDefn->GetFieldCount())
+    {
+        return NestedLoop("join on special field");
+    }
+
+    const OGRFieldType ePrimaryType =
+        poPrimaryDefn->GetFieldDefn(poPrimaryNode->field_index)->GetType();
+    const OGRFieldType eSecondaryType =
+        poJoinDefn->GetFieldDefn(poSecondaryNode->field_index)->GetType();
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const auto IsNumeric = [&IsInteger](OGRFieldType eType)
+    { return IsInteger(eType) || eType == OFTReal; };
+
+    KeyType eKeyType;
+    if (IsInteger(ePrimaryType) && IsInteger(eSecondaryType))
+        eKeyType = KeyType::INTEGER;
+    else if (IsNumeric(ePrimaryType) && IsNumeric(eSecondaryType))
+        eKeyType = KeyType::REAL;
+    else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        eKeyType = KeyType::STRING;
+    else
+        return NestedLoop("unsupported field types");
+
+    auto poLookup =
+        std::unique_ptr<OGRGenSQLJoinLookup>(new OGRGenSQLJoinLookup());
+    poLookup->m_poJoinLayer = poJoinLayer;
+    poLookup->m_osDescription = osDescription;
+    poLookup->m_iPrimaryField = poPrimaryNode->field_index;
+    poLookup->m_iSecondaryField = poSecondaryNode->field_index;
+    poLookup->m_eKeyType = eKeyType;
+
+    // A merge join reads the secondary layer in lockstep with the primary
+    // one, which is not possible if it is used by another JOIN.
+    const bool bSharedLayer =
+        std::count(apoTableLayers.begin(), apoTableLayers.end(),
+                   poJoinLayer) > 1;
+    poLookup->m_bAllowMerge = !bSharedLayer && !EQUAL(pszStrategy, "HASH");
+    poLookup->m_bPreferMerge = EQUAL(pszStrategy, "MERGE");
+
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_JOIN_MAX_MEMORY", nullptr);
+    GIntBig nMaxMemory = 0;
+    if (pszMaxMemory &&
+        CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr) == CE_None)
+    {
+        poLookup->m_nMemoryBudget = nMaxMemory;
+    }
+    else
+    {
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        poLookup->m_nMemoryBudget =
+            nUsableRAM > 0 ? nUsableRAM / 10 : 100 * 1024 * 1024;
+    }
+
+    return poLookup;
+}
+
+/************************************************************************/
+/*             OGRGenSQLJoinLookup::~OGRGenSQLJoinLookup()              */
+/************************************************************************/
+
+OGRGenSQLJoinLookup::~OGRGenSQLJoinLookup()
+{
+    ClearHashTable();
+}
+
+/************************************************************************/
+/*                    OGRGenSQLJoinLookup::GetKey()                     */
+/************************************************************************/
+
+/** Returns false if the field is null, or cannot be equal to anything */
+bool OGRGenSQLJoinLookup::GetKey(const OGRFeature *poFeature, int iField,
+                                 std::string &osKey) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    osKey.clear();
+    const auto AppendBigEndian = [&osKey](uint64_t nVal)
+    {
+        for (int nShift = 56; nShift >= 0; nShift -= 8)
+            osKey += static_cast<char>((nVal >> nShift) & 0xff);
+    };
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+            AppendBigEndian(static_cast<uint64_t>(nVal) ^
+                            (static_cast<uint64_t>(1) << 63));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            // Integers are encoded as the nearest double followed by their
+            // difference to it, so that Integer64 values beyond 2^53 are
+            // still compared exactly.
+            double dfVal;
+            GIntBig nDiff = 0;
+            const OGRFieldType eType =
+                poFeature->GetFieldDefnRef(iField)->GetType();
+            if (eType == OFTInteger || eType == OFTInteger64)
+            {
+                const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+                dfVal = static_cast<double>(nVal);
+                // Values rounded to 2^63 cannot be cast back to GIntBig
+                if (dfVal >= static_cast<double>(
+                                 std::numeric_limits<GIntBig>::max()))
+                    nDiff = nVal - std::numeric_limits<GIntBig>::max() - 1;
+                else
+                    nDiff = nVal - static_cast<GIntBig>(dfVal);
+            }
+            else
+            {
+                dfVal = poFeature->GetFieldAsDouble(iField);
+                if (std::isnan(dfVal))
+                    return false;
+            }
+            if (dfVal == 0)
+                dfVal = 0;  // -0 == +0
+            uint64_t nBits;
+            memcpy(&nBits, &dfVal, sizeof(nBits));
+            if (nBits >> 63)
+                nBits = ~nBits;
+            else
+                nBits |= static_cast<uint64_t>(1) << 63;
+            AppendBigEndian(nBits);
+            AppendBigEndian(static_cast<uint64_t>(nDiff) ^
+                            (static_cast<uint64_t>(1) << 63));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            const char *pszVal = poFeature->GetFieldAsString(iField);
+            if (!m_bCaseInsensitive)
+            {
+                osKey = pszVal;
+                break;
+            }
+            for (; *pszVal; ++pszVal)
+            {
+                osKey += static_cast<char>(
+                    CPLTolower(static_cast<unsigned char>(*pszVal)));
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                OGRGenSQLJoinLookup::ClearHashTable()                 */
+/************************************************************************/
+
+void OGRGenSQLJoinLookup::ClearHashTable()
+{
+    m_oMap.clear();
+    m_abyBuffer.clear();
+    m_abyBuffer.shrink_to_fit();
+    m_nMemoryUsage = 0;
+    m_nSpilledSize = 0;
+    m_poSpillFile.reset();
+}
+
+/************************************************************************/
+/*                 OGRGenSQLJoinLookup::StoreFeature()                  */
+/************************************************************************/
+
+bool OGRGenSQLJoinLookup::StoreFeature(const std::string &osKey,
+                                       const OGRFeature *poFeature)
+{
+    // Only the first feature with a given key is used
+    if (m_oMap.find(osKey) != m_oMap.end())
+        return true;
+
+    if (!poFeature->SerializeToBinary(m_abyTmp))
+        return false;
+    const vsi_l_offset nOffset = m_nSpilledSize + m_abyBuffer.size();
+    m_abyBuffer.insert(m_abyBuffer.end(), m_abyTmp.begin(), m_abyTmp.end());
+    m_oMap.emplace(osKey, std::make_pair(nOffset, m_abyTmp.size()));
+    // Rough estimate of the memory used by the hash table entry
+    m_nMemoryUsage +=
+        static_cast<GIntBig>(m_abyTmp.size() + osKey.size() +
+                             sizeof(decltype(m_oMap)::value_type) +
+                             4 * sizeof(void *));
+    return true;
+}
+
+/************************************************************************/
+/*                     OGRGenSQLJoinLookup::Spill()                     */
+/************************************************************************/
+
+/** Move the serialized features from m_abyBuffer to the temporary file */
+bool OGRGenSQLJoinLookup::Spill()
+{
+    if (m_abyBuffer.empty())
+        return true;
+
+    if (!m_poSpillFile)
+        m_poSpillFile = std::make_unique<OGRGenSQLTempFile>("ogr_sql_join");
+    if (!m_poSpillFile->Append(m_abyBuffer.data(), m_abyBuffer.size()))
+        return false;
+    m_nSpilledSize += m_abyBuffer.size();
+    m_nMemoryUsage -= static_cast<GIntBig>(m_abyBuffer.size());
+    m_abyBuffer.clear();
+    return true;
+}
+
+/************************************************************************/
+/*            OGRGenSQLJoinLookup::ProbeCaseInsensitivity()             */
+/************************************************************************/
+
+/** Determine whether the attribute filter of the secondary layer compares
+ * strings case insensitively, as the OGR SQL engine does, or not, as most
+ * databases do, by querying osValue, a value of the layer, with the case of
+ * its letters swapped. Returns false if the filter cannot be set.
+ */
+bool OGRGenSQLJoinLookup::ProbeCaseInsensitivity(const std::string &osValue,
+                                                 bool &bCaseInsensitive)
+{
+    std::string osSwapped(osValue);
+    for (char &ch : osSwapped)
+    {
+        if (ch >= 'a' && ch <= 'z')
+            ch = static_cast<char>(ch - 'a' + 'A');
+        else if (ch >= 'A' && ch <= 'Z')
+            ch = static_cast<char>(ch - 'A' + 'a');
+    }
+
+    char *pszEscaped = CPLEscapeString(osSwapped.c_str(), -1, CPLES_SQL);
+    std::string osFilter("\"");
+    osFilter += m_poJoinLayer->GetLayerDefn()
+                    ->GetFieldDefn(m_iSecondaryField)
+                    ->GetNameRef();
+    osFilter += "\" = '";
+    osFilter += pszEscaped;
+    osFilter += "'";
+    CPLFree(pszEscaped);
+
+    // A case insensitive filter also returns the feature with osValue
+    bCaseInsensitive = false;
+    const bool bOK =
+        m_poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE;
+    if (bOK)
+    {
+        m_poJoinLayer->ResetReading();
+        while (true)
+        {
+            std::unique_ptr<OGRFeature> poFeature(
+                m_poJoinLayer->GetNextFeature());
+            if (!poFeature)
+                break;
+            if (poFeature->IsFieldSetAndNotNull(m_iSecondaryField) &&
+                osSwapped != poFeature->GetFieldAsString(m_iSecondaryField))
+            {
+                bCaseInsensitive = true;
+                break;
+            }
+        }
+    }
+    m_poJoinLayer->SetAttributeFilter(nullptr);
+    m_poJoinLayer->ResetReading();
+    return bOK;
+}
+
+/************************************************************************/
+/*                OGRGenSQLJoinLookup::BuildHashTable()                 */
+/************************************************************************/
+
+void OGRGenSQLJoinLookup::BuildHashTable(bool bAllowMerge)
+{
+    ClearHashTable();
+
+    // When a merge join is possible, stop storing features as soon as the
+    // memory budget is exceeded, and only go on scanning the keys to check
+    // whether they are sorted.
+    bool bStoreFeatures = !(bAllowMerge && m_bPreferMerge);
+    bool bSorted = true;
+    bool bError = false;
+    std::string osKey;
+    std::string osPrevKey;
+    bool bHasPrevKey = false;
+    // First string key with letters, to determine the case sensitivity
+    std::string osCasedValue;
+    bool bScanComplete = false;
+
+    m_poJoinLayer->SetAttributeFilter(nullptr);
+    m_poJoinLayer->ResetReading();
+    while (true)
+    {
+        std::unique_ptr<OGRFeature> poFeature(m_poJoinLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            bScanComplete = true;
+            break;
+        }
+        if (!GetKey(poFeature.get(), m_iSecondaryField, osKey))
+            continue;
+        if (m_eKeyType == KeyType::STRING && !m_bCaseSensitivityKnown &&
+            osCasedValue.empty() &&
+            std::any_of(osKey.begin(), osKey.end(),
+                        [](char ch)
+                        {
+                            return (ch >= 'a' && ch <= 'z') ||
+                                   (ch >= 'A' && ch <= 'Z');
+                        }))
+        {
+            osCasedValue = osKey;
+        }
+
+        if (bHasPrevKey && osKey < osPrevKey)
+        {
+            bSorted = false;
+            if (!bStoreFeatures)
+                break;
+        }
+        bHasPrevKey = true;
+        std::swap(osPrevKey, osKey);
+
+        if (bStoreFeatures)
+        {
+            if (!StoreFeature(osPrevKey, poFeature.get()))
+            {
+                bError = true;
+                break;
+            }
+            if (m_nMemoryUsage > m_nMemoryBudget)
+            {
+                if (bAllowMerge && bSorted)
+                {
+                    ClearHashTable();
+                    bStoreFeatures = false;
+                }
+                else if (!Spill())
+                {
+                    bError = true;
+                    break;
+                }
+            }
+        }
+    }
+    m_poJoinLayer->ResetReading();
+
+    // Until the case sensitivity is known, string keys are case sensitive,
+    // which is correct as long as no key has letters.
+    if (!bError && m_eKeyType == KeyType::STRING && !m_bCaseSensitivityKnown)
+    {
+        if (!osCasedValue.empty())
+        {
+            bool bCaseInsensitive = false;
+            if (!ProbeCaseInsensitivity(osCasedValue, bCaseInsensitive))
+            {
+                bError = true;
+            }
+            else
+            {
+                m_bCaseSensitivityKnown = true;
+                if (bCaseInsensitive)
+                {
+                    CPLDebug("GenSQL",
+                             "JOIN ON %s: case insensitive string keys",
+                             m_osDescription.c_str());
+                    m_bCaseInsensitive = true;
+                    BuildHashTable(bAllowMerge);
+                    return;
+                }
+            }
+        }
+        else if (bScanComplete)
+        {
+            m_bCaseSensitivityKnown = true;
+        }
+    }
+
+    if (bError)
+    {
+        ClearHashTable();
+        m_eStrategy = Strategy::NESTED_LOOP;
+        CPLDebug("GenSQL", "JOIN ON %s: nested loop (hash table build failed)",
+                 m_osDescription.c_str());
+    }
+    else if (!bStoreFeatures)
+    {
+        if (bSorted)
+        {
+            m_eStrategy = Strategy::MERGE;
+            m_bMergeRestart = true;
+            CPLDebug("GenSQL",
+                     "JOIN ON %s: merge join (secondary table sorted on "
+                     "join key)",
+                     m_osDescription.c_str());
+        }
+        else
+        {
+            BuildHashTable(false);
+        }
+    }
+    else
+    {
+        m_eStrategy = Strategy::HASH;
+        CPLDebug("GenSQL",
+                 "JOIN ON %s: hash join (%d distinct keys, " CPL_FRMT_GUIB
+                 " bytes in memory, " CPL_FRMT_GUIB " bytes spilled to disk)",
+                 m_osDescription.c_str(), static_cast<int>(m_oMap.size()),
+                 static_cast<GUIntBig>(m_abyBuffer.size()),
+                 static_cast<GUIntBig>(m_nSpilledSize));
+    }
+}
+
+/************************************************************************/
+/*                 OGRGenSQLJoinLookup::SwitchToHash()                  */
+/************************************************************************/
+
+void OGRGenSQLJoinLookup::SwitchToHash(const char *pszReason)
+{
+    CPLDebug("GenSQL",
+             "JOIN ON %s: switching from merge join to hash join (%s)",
+             m_osDescription.c_str(), pszReason);
+    m_poMergeFeature.reset();
+    BuildHashTable(false);
+}
+
+/************************************************************************/
+/*                  OGRGenSQLJoinLookup::LookupHash()                   */
+/************************************************************************/
+
+void OGRGenSQLJoinLookup::LookupHash(const std::string &osKey,
+                                     std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    poJoinFeature.reset();
+
+    const auto oIter = m_oMap.find(osKey);
+    if (oIter == m_oMap.end())
+        return;
+
+    const vsi_l_offset nOffset = oIter->second.first;
+    const size_t nSize = oIter->second.second;
+    const GByte *pabyData;
+    if (nOffset >= m_nSpilledSize)
+    {
+        pabyData = m_abyBuffer.data() + (nOffset - m_nSpilledSize);
+    }
+    else
+    {
+        m_abyTmp.resize(nSize);
+        if (!m_poSpillFile->Read(nOffset, m_abyTmp.data(), nSize))
+            return;
+        pabyData = m_abyTmp.data();
+    }
+
+    auto poFeature =
+        std::make_unique<OGRFeature>(m_poJoinLayer->GetLayerDefn());
+    if (poFeature->DeserializeFromBinary(pabyData, nSize))
+        poJoinFeature = std::move(poFeature);
+}
+
+/************************************************************************/
+/*                  OGRGenSQLJoinLookup::LookupMerge()                  */
+/************************************************************************/
+
+/** Returns false if the keys are found not to be sorted */
+bool OGRGenSQLJoinLookup::LookupMerge(
+    const std::string &osKey, std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    if (m_bMergeRestart)
+    {
+        m_bMergeRestart = false;
+        m_poMergeFeature.reset();
+        m_bMergeEOF = false;
+        m_bHasLastPrimaryKey = false;
+        m_poJoinLayer->SetAttributeFilter(nullptr);
+        m_poJoinLayer->ResetReading();
+    }
+
+    if (m_bHasLastPrimaryKey && osKey < m_osLastPrimaryKey)
+        return false;
+    m_bHasLastPrimaryKey = true;
+    m_osLastPrimaryKey = osKey;
+
+    std::string osNewKey;
+    while (!m_bMergeEOF && (!m_poMergeFeature || m_osMergeKey < osKey))
+    {
+        std::unique_ptr<OGRFeature> poFeature(m_poJoinLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            m_bMergeEOF = true;
+            m_poMergeFeature.reset();
+            break;
+        }
+        if (!GetKey(poFeature.get(), m_iSecondaryField, osNewKey))
+            continue;
+        // Can only happen if the secondary layer has been modified since
+        // we checked it was sorted.
+        if (m_poMergeFeature && osNewKey < m_osMergeKey)
+            return false;
+        m_poMergeFeature = std::move(poFeature);
+        std::swap(m_osMergeKey, osNewKey);
+    }
+
+    if (m_poMergeFeature && m_osMergeKey == osKey)
+        poJoinFeature.reset(m_poMergeFeature->Clone());
+    else
+        poJoinFeature.reset();
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRGenSQLJoinLookup::Lookup()                     */
+/************************************************************************/
+
+/** Returns false if the nested loop must be used for that feature */
+bool OGRGenSQLJoinLookup::Lookup(const OGRFeature *poSrcFeat,
+                                 std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    if (!m_bPrepared)
+    {
+        m_bPrepared = true;
+        BuildHashTable(m_bAllowMerge);
+    }
+    if (m_eStrategy == Strategy::NESTED_LOOP)
+        return false;
+
+    if (m_eKeyType == KeyType::STRING &&
+        poSrcFeat->IsFieldSetAndNotNull(m_iPrimaryField))
+    {
+        // The OGR SQL = operator ignores a trailing "+00" when comparing
+        // timestamp-like strings. Leave those cases to the nested loop.
+        const char *pszVal = poSrcFeat->GetFieldAsString(m_iPrimaryField);
+        const size_t nLen = strlen(pszVal);
+        if (nLen > 3 &&
+            (strcmp(pszVal + nLen - 3, "+00") == 0 || pszVal[nLen - 3] == ':'))
+        {
+            if (m_eStrategy == Strategy::MERGE)
+                SwitchToHash("timestamp-like key");
+            return false;
+        }
+    }
+
+    std::string osKey;
+    if (!GetKey(poSrcFeat, m_iPrimaryField, osKey))
+    {
+        poJoinFeature.reset();
+        return true;
+    }
+
+    if (m_eStrategy == Strategy::MERGE)
+    {
+        if (LookupMerge(osKey, poJoinFeature))
+            return true;
+        SwitchToHash("keys not sorted");
+        if (m_eStrategy == Strategy::NESTED_LOOP)
+            return false;
+    }
+
+    LookupHash(osKey, poJoinFeature);
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGenSQLJoinLookup::ResetReading()                  */
+/************************************************************************/
+
+void OGRGenSQLJoinLookup::ResetReading()
+{
+    m_bMergeRestart = true;
+}
+
 /************************************************************************/
 /*                       OGRGenSQLResultsLayer()                        */
 /************************************************************************/
@@ -481,6 +1761,16 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 
     FindAndSetIgnoredFields();
 
+    /* -------------------------------------------------------------------- */
+    /*      Check which JOINs can avoid re-querying the secondary layer     */
+    /*      for each primary feature.                                       */
+    /* -------------------------------------------------------------------- */
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        m_apoJoinLookups.push_back(OGRGenSQLJoinLookup::Create(
+            psSelectInfo->join_defs + iJoin, m_apoTableLayers));
+    }
+
     if (!m_bForwardWhereToSourceLayer)
         OGRLayer::SetAttributeFilter(m_osInitialWHERE.c_str());
 }
@@ -611,6 +1901,12 @@ void OGRGenSQLResultsLayer::ResetReading()
         ApplyFiltersToSource();
     }
 
+    for (auto &poJoinLookup : m_apoJoinLookups)
+    {
+        if (poJoinLookup)
+            poJoinLookup->ResetReading();
+    }
+
     m_nNextIndexFID = psSelectInfo->offset;
     m_nIteratedFeatures = -1;
     m_bEOF = false;
@@ -653,7 +1949,7 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_NON_EXISTING_FEATURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || HasFIDIndex())
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -743,8 +2039,7 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap) const
     if (EQUAL(pszCap, OLCFastSetNextByIndex))
     {
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-            psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
-            !m_anFIDIndex.empty())
+            psSelectInfo->query_mode == SWQM_DISTINCT_LIST || HasFIDIndex())
             return TRUE;
         else
             return m_poSrcLayer->TestCapability(pszCap);
@@ -976,8 +2271,40 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
     /* -------------------------------------------------------------------- */
     /*      Otherwise, process all source feature through the summary       */
     /*      building facilities of SWQ.                                     */
+    /*                                                                      */
+    /*      When the sets of DISTINCT values do not fit in                  */
+    /*      OGR_SQL_SORT_MAX_MEMORY, they are written by runs to temporary  */
+    /*      files, which are merged once all features have been read.       */
     /* -------------------------------------------------------------------- */
 
+    const GIntBig nMaxMemory = GetSortMaxMemory();
+    GIntBig nDistinctMemory = 0;
+    m_apoDistinctRuns.clear();
+    m_apoDistinctRuns.resize(psSelectInfo->result_columns());
+
+    const auto Summarize =
+        [psSelectInfo, &nDistinctMemory](int iField, const char *pszValue,
+                                         const double *pdfValue)
+    {
+        const bool bDistinct = psSelectInfo->column_defs[iField].distinct_flag;
+        const GIntBig nCountBefore =
+            bDistinct && !psSelectInfo->column_summary.empty()
+                ? psSelectInfo->column_summary[iField].count
+                : 0;
+        const char *pszError =
+            swq_select_summarize(psSelectInfo, iField, pszValue, pdfValue);
+        if (bDistinct && !pszError &&
+            psSelectInfo->column_summary[iField].count != nCountBefore)
+        {
+            // Rough estimate of the memory used by the set node, and the
+            // vector item, of the new value
+            nDistinctMemory += static_cast<GIntBig>(
+                2 * (sizeof(CPLString) + (pszValue ? strlen(pszValue) : 0)) +
+                4 * sizeof(void *));
+        }
+        return pszError;
+    };
+
     for (auto &&poSrcFeature : *m_poSrcLayer)
     {
         for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
@@ -989,8 +2316,7 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
             {
                 /* psColDef->field_index can be -1 in the case of a COUNT(*) */
                 if (psColDef->field_index < 0)
-                    pszError =
-                        swq_select_summarize(psSelectInfo, iField, "", nullptr);
+                    pszError = Summarize(iField, "", nullptr);
                 else if (IS_GEOM_FIELD_INDEX(poSrcLayerDefn,
                                              psColDef->field_index))
                 {
@@ -1000,23 +2326,20 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                     const OGRGeometry *poGeom =
                         poSrcFeature->GetGeomFieldRef(iSrcGeomField);
                     if (poGeom != nullptr)
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        "", nullptr);
+                        pszError = Summarize(iField, "", nullptr);
                 }
                 else if (poSrcFeature->IsFieldSetAndNotNull(
                              psColDef->field_index))
                 {
                     if (!psColDef->distinct_flag)
                     {
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        "", nullptr);
+                        pszError = Summarize(iField, "", nullptr);
                     }
                     else
                     {
                         const char *pszVal = poSrcFeature->GetFieldAsString(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        pszVal, nullptr);
+                        pszError = Summarize(iField, pszVal, nullptr);
                     }
                 }
             }
@@ -1032,21 +2355,18 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                     {
                         const double dfValue = poSrcFeature->GetFieldAsDouble(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        nullptr, &dfValue);
+                        pszError = Summarize(iField, nullptr, &dfValue);
                     }
                     else
                     {
                         const char *pszVal = poSrcFeature->GetFieldAsString(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        pszVal, nullptr);
+                        pszError = Summarize(iField, pszVal, nullptr);
                     }
                 }
                 else
                 {
-                    pszError = swq_select_summarize(psSelectInfo, iField,
-                                                    nullptr, nullptr);
+                    pszError = Summarize(iField, nullptr, nullptr);
                 }
             }
 
@@ -1058,6 +2378,42 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                 return false;
             }
         }
+
+        if (nDistinctMemory > nMaxMemory)
+        {
+            nDistinctMemory = 0;
+            for (int iField = 0; iField < psSelectInfo->result_columns();
+                 iField++)
+            {
+                if (!psSelectInfo->column_defs[iField].distinct_flag)
+                    continue;
+                auto &poRuns = m_apoDistinctRuns[iField];
+                if (!poRuns)
+                {
+                    poRuns = std::make_unique<OGRGenSQLDistinctRuns>(
+                        psSelectInfo->query_mode == SWQM_DISTINCT_LIST &&
+                        psSelectInfo->order_specs == 0);
+                }
+                if (!poRuns->AddRun(psSelectInfo->column_summary[iField]))
+                {
+                    m_poSummaryFeature.reset();
+                    return false;
+                }
+            }
+        }
+    }
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        auto &poRuns = m_apoDistinctRuns[iField];
+        if (poRuns &&
+            !poRuns->Finish(psSelectInfo->column_summary[iField],
+                            psSelectInfo->query_mode == SWQM_DISTINCT_LIST,
+                            nMaxMemory))
+        {
+            m_poSummaryFeature.reset();
+            return false;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1522,6 +2878,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        std::unique_ptr<OGRFeature> poJoinFeature;
+
+        const auto &poJoinLookup = m_apoJoinLookups[iJoin];
+        if (poJoinLookup && poJoinLookup->Lookup(poSrcFeat, poJoinFeature))
+        {
+            apoFeatures.push_back(std::move(poJoinFeature));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1536,8 +2901,6 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
             continue;
         }
 
-        std::unique_ptr<OGRFeature> poJoinFeature;
-
         poJoinLayer->ResetReading();
         if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
             poJoinFeature.reset(poJoinLayer->GetNextFeature());
@@ -1879,7 +3242,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
+    if (!HasFIDIndex() && m_nIteratedFeatures < 0 &&
         psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         m_poSrcLayer->SetNextByIndex(psSelectInfo->offset);
@@ -1905,7 +3268,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     while (true)
     {
         std::unique_ptr<OGRFeature> poSrcFeat;
-        if (!m_anFIDIndex.empty())
+        if (HasFIDIndex())
         {
             /* --------------------------------------------------------------------
              */
@@ -1915,11 +3278,11 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
             /* --------------------------------------------------------------------
              */
 
-            if (m_nNextIndexFID >= static_cast<GIntBig>(m_anFIDIndex.size()))
+            if (m_nNextIndexFID >= GetFIDIndexSize())
                 return nullptr;
 
-            poSrcFeat.reset(m_poSrcLayer->GetFeature(
-                m_anFIDIndex[static_cast<size_t>(m_nNextIndexFID)]));
+            poSrcFeat.reset(
+                m_poSrcLayer->GetFeature(GetFIDFromIndex(m_nNextIndexFID)));
             m_nNextIndexFID++;
         }
         else
@@ -1979,7 +3342,17 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
             return nullptr;
 
         swq_summary &oSummary = psSelectInfo->column_summary[0];
-        if (psSelectInfo->order_specs == 0)
+        if (!m_apoDistinctRuns.empty() && m_apoDistinctRuns[0])
+        {
+            std::string osValue;
+            if (!m_apoDistinctRuns[0]->GetValue(nFID, osValue))
+                return nullptr;
+            if (osValue != SZ_OGR_NULL)
+                m_poSummaryFeature->SetField(0, osValue.c_str());
+            else
+                m_poSummaryFeature->SetFieldNull(0);
+        }
+        else if (psSelectInfo->order_specs == 0)
         {
             if (nFID < 0 || nFID >= static_cast<GIntBig>(
                                         oSummary.oVectorDistinctValues.size()))
@@ -2098,39 +3471,15 @@ void OGRGenSQLResultsLayer::FreeIndexFields(OGRField *pasIndexFields,
     /* -------------------------------------------------------------------- */
     for (int iKey = 0; iKey < nOrderItems; iKey++)
     {
-        swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-
-        if (psKeyDef->field_index >= m_iFIDFieldIndex)
-        {
-            CPLAssert(psKeyDef->field_index <
-                      m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
-            /* warning: only special fields of type string should be deallocated
-             */
-            if (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
-                SWQ_STRING)
-            {
-                for (size_t i = 0; i < l_nIndexSize; i++)
-                {
-                    OGRField *psField = pasIndexFields + iKey + i * nOrderItems;
-                    CPLFree(psField->String);
-                }
-            }
+        if (m_aeOrderByFieldTypes[iKey] != OFTString)
             continue;
-        }
-
-        OGRFieldDefn *poFDefn =
-            m_poSrcLayer->GetLayerDefn()->GetFieldDefn(psKeyDef->field_index);
 
-        if (poFDefn->GetType() == OFTString)
+        for (size_t i = 0; i < l_nIndexSize; i++)
         {
-            for (size_t i = 0; i < l_nIndexSize; i++)
-            {
-                OGRField *psField = pasIndexFields + iKey + i * nOrderItems;
+            OGRField *psField = pasIndexFields + iKey + i * nOrderItems;
 
-                if (!OGR_RawField_IsUnset(psField) &&
-                    !OGR_RawField_IsNull(psField))
-                    CPLFree(psField->String);
-            }
+            if (!OGR_RawField_IsUnset(psField) && !OGR_RawField_IsNull(psField))
+                CPLFree(psField->String);
         }
     }
 }
@@ -2154,48 +3503,340 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
             CPLAssert(psKeyDef->field_index <
                       m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
 
-            switch (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex])
+            switch (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    // Yes, store Integer as Integer64.
+                    // This is consistent with the test in Compare()
+                    psDstField->Integer64 =
+                        poSrcFeat->GetFieldAsInteger64(psKeyDef->field_index);
+                    break;
+
+                case SWQ_FLOAT:
+                    psDstField->Real =
+                        poSrcFeat->GetFieldAsDouble(psKeyDef->field_index);
+                    break;
+
+                default:
+                    psDstField->String = CPLStrdup(
+                        poSrcFeat->GetFieldAsString(psKeyDef->field_index));
+                    break;
+            }
+
+            continue;
+        }
+
+        OGRFieldDefn *poFDefn =
+            m_poSrcLayer->GetLayerDefn()->GetFieldDefn(psKeyDef->field_index);
+
+        OGRField *psSrcField = poSrcFeat->GetRawFieldRef(psKeyDef->field_index);
+
+        if (poFDefn->GetType() == OFTInteger ||
+            poFDefn->GetType() == OFTInteger64 ||
+            poFDefn->GetType() == OFTReal || poFDefn->GetType() == OFTDate ||
+            poFDefn->GetType() == OFTTime || poFDefn->GetType() == OFTDateTime)
+            memcpy(psDstField, psSrcField, sizeof(OGRField));
+        else if (poFDefn->GetType() == OFTString)
+        {
+            if (poSrcFeat->IsFieldSetAndNotNull(psKeyDef->field_index))
+                psDstField->String = CPLStrdup(psSrcField->String);
+            else
+                memcpy(psDstField, psSrcField, sizeof(OGRField));
+        }
+    }
+}
+
+/************************************************************************/
+/*                        SerializeIndexFields()                        */
+/************************************************************************/
+
+/** Append the ORDER BY keys of a feature to abyBuffer. */
+static void SerializeIndexFields(const OGRField *pasIndexFields,
+                                 const std::vector<OGRFieldType> &aeTypes,
+                                 std::vector<GByte> &abyBuffer)
+{
+    const auto Append = [&abyBuffer](const void *pData, size_t nSize)
+    {
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+        abyBuffer.insert(abyBuffer.end(), pabyData, pabyData + nSize);
+    };
+
+    for (size_t iKey = 0; iKey < aeTypes.size(); ++iKey)
+    {
+        const OGRField *psField = pasIndexFields + iKey;
+        const GByte bIsSet = !OGR_RawField_IsUnset(psField) &&
+                             !OGR_RawField_IsNull(psField);
+        abyBuffer.push_back(bIsSet);
+        if (!bIsSet)
+            continue;
+        if (aeTypes[iKey] == OFTString)
+        {
+            const uint32_t nLen =
+                static_cast<uint32_t>(strlen(psField->String));
+            Append(&nLen, sizeof(nLen));
+            Append(psField->String, nLen);
+        }
+        else
+        {
+            Append(psField, sizeof(OGRField));
+        }
+    }
+}
+
+/************************************************************************/
+/*                       DeserializeIndexFields()                       */
+/************************************************************************/
+
+/** Decode the ORDER BY keys encoded by SerializeIndexFields(). String values
+ * point to aosStrings. */
+static bool DeserializeIndexFields(const GByte *pabyData, size_t nSize,
+                                   const std::vector<OGRFieldType> &aeTypes,
+                                   OGRField *pasIndexFields,
+                                   std::vector<std::string> &aosStrings)
+{
+    const GByte *pabyEnd = pabyData + nSize;
+    for (size_t iKey = 0; iKey < aeTypes.size(); ++iKey)
+    {
+        OGRField *psField = pasIndexFields + iKey;
+        if (pabyData == pabyEnd)
+            return false;
+        if (*(pabyData++) == 0)
+        {
+            OGR_RawField_SetNull(psField);
+            continue;
+        }
+        if (aeTypes[iKey] == OFTString)
+        {
+            uint32_t nLen = 0;
+            if (static_cast<size_t>(pabyEnd - pabyData) < sizeof(nLen))
+                return false;
+            memcpy(&nLen, pabyData, sizeof(nLen));
+            pabyData += sizeof(nLen);
+            if (static_cast<size_t>(pabyEnd - pabyData) < nLen)
+                return false;
+            aosStrings[iKey].assign(reinterpret_cast<const char *>(pabyData),
+                                    nLen);
+            pabyData += nLen;
+            psField->String = aosStrings[iKey].data();
+        }
+        else
+        {
+            if (static_cast<size_t>(pabyEnd - pabyData) < sizeof(OGRField))
+                return false;
+            memcpy(psField, pabyData, sizeof(OGRField));
+            pabyData += sizeof(OGRField);
+        }
+    }
+    return pabyData == pabyEnd;
+}
+
+/************************************************************************/
+/*                          OGRGenSQLSortRuns                           */
+/************************************************************************/
+
+/** Runs of features sorted on the ORDER BY keys, written to a temporary
+ * file when the keys of all the features do not fit in memory.
+ *
+ * Each run is sorted and written by a job of the thread pool, if there is
+ * one, while the features of the next run are read. Each record of a run is
+ * made of its size, the FID of the feature, its sequence number in the
+ * source layer, and the serialized keys.
+ */
+class OGRGenSQLSortRuns
+{
+  public:
+    struct Run
+    {
+        vsi_l_offset nOffset = 0;
+        vsi_l_offset nSize = 0;
+    };
+
+    OGRGenSQLSortRuns(OGRGenSQLResultsLayer &oLayer,
+                      CPLWorkerThreadPool *poThreadPool)
+        : m_oLayer(oLayer),
+          m_poJobQueue(poThreadPool ? poThreadPool->CreateJobQueue()
+                                    : nullptr)
+    {
+    }
+
+    ~OGRGenSQLSortRuns()
+    {
+        WaitCompletion();
+    }
+
+    bool AddRun(std::vector<OGRField> &&asIndexFields,
+                std::vector<GIntBig> &&anFIDList, size_t nIndexSize,
+                GIntBig nFirstSeq);
+
+    bool Finish()
+    {
+        WaitCompletion();
+        return !m_bError;
+    }
+
+    const std::vector<Run> &GetRuns() const
+    {
+        return m_asRuns;
+    }
+
+    OGRGenSQLTempFile &GetFile()
+    {
+        return m_oFile;
+    }
+
+    GIntBig GetFeatureCount() const
+    {
+        return m_nFeatureCount;
+    }
+
+  private:
+    struct RunData
+    {
+        std::vector<OGRField> asIndexFields{};
+        std::vector<GIntBig> anFIDList{};
+        size_t nIndexSize = 0;
+        GIntBig nFirstSeq = 0;
+    };
+
+    OGRGenSQLResultsLayer &m_oLayer;
+    OGRGenSQLTempFile m_oFile{"ogr_sql_sort"};
+    std::vector<Run> m_asRuns{};
+    GIntBig m_nFeatureCount = 0;
+    bool m_bError = false;
+    CPLJobQueuePtr m_poJobQueue{};
+    // Errors emitted by WriteRun() in worker threads
+    CPLErrorAccumulator m_oErrorAccumulator{};
+
+    void WaitCompletion();
+    void WriteRun(RunData &oData);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLSortRuns)
+};
+
+/************************************************************************/
+/*                     OGRGenSQLSortRuns::AddRun()                      */
+/************************************************************************/
+
+bool OGRGenSQLSortRuns::AddRun(std::vector<OGRField> &&asIndexFields,
+                               std::vector<GIntBig> &&anFIDList,
+                               size_t nIndexSize, GIntBig nFirstSeq)
+{
+    // Only one run is written at a time, so that they are in the file in
+    // the order of the source layer.
+    WaitCompletion();
+
+    auto poData = std::make_shared<RunData>();
+    poData->asIndexFields = std::move(asIndexFields);
+    poData->anFIDList = std::move(anFIDList);
+    poData->nIndexSize = nIndexSize;
+    poData->nFirstSeq = nFirstSeq;
+    m_nFeatureCount += static_cast<GIntBig>(nIndexSize);
+
+    if (m_bError)
+    {
+        m_oLayer.FreeIndexFields(poData->asIndexFields.data(), nIndexSize);
+        return false;
+    }
+
+    if (m_poJobQueue)
+    {
+        return m_poJobQueue->SubmitJob(
+            [this, poData]()
             {
-                case SWQ_INTEGER:
-                case SWQ_INTEGER64:
-                    // Yes, store Integer as Integer64.
-                    // This is consistent with the test in Compare()
-                    psDstField->Integer64 =
-                        poSrcFeat->GetFieldAsInteger64(psKeyDef->field_index);
-                    break;
+                auto oAccumulator =
+                    m_oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                WriteRun(*poData);
+            });
+    }
 
-                case SWQ_FLOAT:
-                    psDstField->Real =
-                        poSrcFeat->GetFieldAsDouble(psKeyDef->field_index);
-                    break;
+    WriteRun(*poData);
+    return !m_bError;
+}
 
-                default:
-                    psDstField->String = CPLStrdup(
-                        poSrcFeat->GetFieldAsString(psKeyDef->field_index));
-                    break;
-            }
+/************************************************************************/
+/*                 OGRGenSQLSortRuns::WaitCompletion()                  */
+/************************************************************************/
 
-            continue;
-        }
+/** Wait for the run being written, and re-emit its errors in the calling
+ * thread.
+ */
+void OGRGenSQLSortRuns::WaitCompletion()
+{
+    if (m_poJobQueue)
+    {
+        m_poJobQueue->WaitCompletion();
+        m_oErrorAccumulator.ReplayErrors();
+        m_oErrorAccumulator.ClearErrors();
+    }
+}
 
-        OGRFieldDefn *poFDefn =
-            m_poSrcLayer->GetLayerDefn()->GetFieldDefn(psKeyDef->field_index);
+/************************************************************************/
+/*                    OGRGenSQLSortRuns::WriteRun()                     */
+/************************************************************************/
 
-        OGRField *psSrcField = poSrcFeat->GetRawFieldRef(psKeyDef->field_index);
+void OGRGenSQLSortRuns::WriteRun(RunData &oData)
+{
+    const size_t nIndexSize = oData.nIndexSize;
+    const int nOrderItems = m_oLayer.m_pSelectInfo->order_specs;
+    const OGRField *pasIndexFields = oData.asIndexFields.data();
 
-        if (poFDefn->GetType() == OFTInteger ||
-            poFDefn->GetType() == OFTInteger64 ||
-            poFDefn->GetType() == OFTReal || poFDefn->GetType() == OFTDate ||
-            poFDefn->GetType() == OFTTime || poFDefn->GetType() == OFTDateTime)
-            memcpy(psDstField, psSrcField, sizeof(OGRField));
-        else if (poFDefn->GetType() == OFTString)
+    try
+    {
+        std::vector<GIntBig> anIndex(nIndexSize);
+        std::vector<GIntBig> anMerged(nIndexSize);
+        std::iota(anIndex.begin(), anIndex.end(), 0);
+        m_oLayer.SortIndexSection(pasIndexFields, anIndex.data(),
+                                  anMerged.data(), 0, nIndexSize);
+
+        Run sRun;
+        sRun.nOffset = m_oFile.GetSize();
+        std::vector<GByte> abyBuffer;
+        constexpr size_t BUFFER_SIZE = 1024 * 1024;
+        abyBuffer.reserve(BUFFER_SIZE);
+        for (size_t i = 0; i < nIndexSize && !m_bError; ++i)
         {
-            if (poSrcFeat->IsFieldSetAndNotNull(psKeyDef->field_index))
-                psDstField->String = CPLStrdup(psSrcField->String);
-            else
-                memcpy(psDstField, psSrcField, sizeof(OGRField));
+            const size_t nIdx = static_cast<size_t>(anIndex[i]);
+            const size_t nRecordStart = abyBuffer.size();
+            const uint32_t nPlaceHolder = 0;
+            const GIntBig nFID = oData.anFIDList[nIdx];
+            const GIntBig nSeq = oData.nFirstSeq + static_cast<GIntBig>(nIdx);
+            const auto Append = [&abyBuffer](const void *pData, size_t nSize)
+            {
+                const GByte *pabyData = static_cast<const GByte *>(pData);
+                abyBuffer.insert(abyBuffer.end(), pabyData, pabyData + nSize);
+            };
+            Append(&nPlaceHolder, sizeof(nPlaceHolder));
+            Append(&nFID, sizeof(nFID));
+            Append(&nSeq, sizeof(nSeq));
+            SerializeIndexFields(pasIndexFields + nIdx * nOrderItems,
+                                 m_oLayer.m_aeOrderByFieldTypes, abyBuffer);
+            const uint32_t nRecordSize = static_cast<uint32_t>(
+                abyBuffer.size() - nRecordStart - sizeof(uint32_t));
+            memcpy(abyBuffer.data() + nRecordStart, &nRecordSize,
+                   sizeof(nRecordSize));
+
+            if (abyBuffer.size() >= BUFFER_SIZE || i + 1 == nIndexSize)
+            {
+                if (!m_oFile.Append(abyBuffer.data(), abyBuffer.size()))
+                    m_bError = true;
+                abyBuffer.clear();
+            }
         }
+        sRun.nSize = m_oFile.GetSize() - sRun.nOffset;
+        m_asRuns.push_back(sRun);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        m_bError = true;
     }
+
+    m_oLayer.FreeIndexFields(oData.asIndexFields.data(), nIndexSize);
+    oData.asIndexFields.clear();
+    oData.anFIDList.clear();
 }
 
 /************************************************************************/
@@ -2207,12 +3848,14 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*                                                                      */
 /*      This is accomplished by making one pass through all the         */
 /*      eligible source features, and capturing the order by fields     */
-/*      of all records in memory.  A quick sort is then applied to      */
+/*      of all records in memory.  A merge sort is then applied to      */
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the order by fields do not fit in OGR_SQL_SORT_MAX_MEMORY, */
+/*      they are sorted by runs written to a temporary file, which are  */
+/*      then merged.  The resulting index is also written to a          */
+/*      temporary file if it does not fit in memory.                    */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2229,6 +3872,43 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     m_bOrderByValid = true;
     m_anFIDIndex.clear();
+    m_poFIDIndexFile.reset();
+    m_nFIDIndexFileCount = 0;
+    m_anFIDIndexFileCache.clear();
+
+    /* -------------------------------------------------------------------- */
+    /*      Establish the type of the keys, as stored by ReadIndexFields(). */
+    /* -------------------------------------------------------------------- */
+    m_aeOrderByFieldTypes.clear();
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+        {
+            CPLAssert(psKeyDef->field_index <
+                      m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
+            switch (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    m_aeOrderByFieldTypes.push_back(OFTInteger64);
+                    break;
+                case SWQ_FLOAT:
+                    m_aeOrderByFieldTypes.push_back(OFTReal);
+                    break;
+                default:
+                    m_aeOrderByFieldTypes.push_back(OFTString);
+                    break;
+            }
+        }
+        else
+        {
+            m_aeOrderByFieldTypes.push_back(
+                m_poSrcLayer->GetLayerDefn()
+                    ->GetFieldDefn(psKeyDef->field_index)
+                    ->GetType());
+        }
+    }
 
     ResetReading();
 
@@ -2272,6 +3952,23 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    const int nThreads = GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                           /* bDefaultAllCPUs = */ false);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    // When a run is sorted in a worker thread while the next one is read,
+    // two of them are in memory at the same time.
+    const GIntBig nMaxMemory = GetSortMaxMemory();
+    const GIntBig nMaxRunMemory = poThreadPool ? nMaxMemory / 2 : nMaxMemory;
+    // Keys, FID, and index and merge buffer used by the sort
+    const GIntBig nFeatureMemory =
+        static_cast<GIntBig>(sizeof(OGRField) * nOrderItems +
+                             3 * sizeof(GIntBig));
+    GIntBig nRunMemory = 0;
+    GIntBig nRunFirstSeq = 0;
+    std::unique_ptr<OGRGenSQLSortRuns> poRuns;
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2353,16 +4050,95 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             nFeaturesAlloc = nNewFeaturesAlloc;
         }
 
-        ReadIndexFields(poSrcFeat.get(), nOrderItems,
-                        asIndexFields.data() + nIndexSize * nOrderItems);
+        OGRField *pasFeatureFields =
+            asIndexFields.data() + nIndexSize * nOrderItems;
+        ReadIndexFields(poSrcFeat.get(), nOrderItems, pasFeatureFields);
 
         anFIDList.push_back(poSrcFeat->GetFID());
 
         nIndexSize++;
+
+        nRunMemory += nFeatureMemory;
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const OGRField *psField = pasFeatureFields + iKey;
+            if (m_aeOrderByFieldTypes[iKey] == OFTString &&
+                !OGR_RawField_IsUnset(psField) && !OGR_RawField_IsNull(psField))
+            {
+                nRunMemory += static_cast<GIntBig>(strlen(psField->String) + 1);
+            }
+        }
+
+        /* ---------------------------------------------------------------- */
+        /*      Sort and write the keys read so far to a temporary file     */
+        /*      if they exceed the memory budget.                           */
+        /* ---------------------------------------------------------------- */
+        if (nRunMemory > nMaxRunMemory)
+        {
+            if (!poRuns)
+            {
+                poRuns =
+                    std::make_unique<OGRGenSQLSortRuns>(*this, poThreadPool);
+            }
+            const size_t nRunSize = nIndexSize;
+            nIndexSize = 0;
+            if (!poRuns->AddRun(std::move(asIndexFields), std::move(anFIDList),
+                                nRunSize, nRunFirstSeq))
+            {
+                return;
+            }
+            nRunFirstSeq += static_cast<GIntBig>(nRunSize);
+            nRunMemory = 0;
+
+            try
+            {
+                asIndexFields.clear();
+                asIndexFields.resize(nOrderItems * nFeaturesAlloc);
+                anFIDList.clear();
+                anFIDList.reserve(nFeaturesAlloc);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "CreateOrderByIndex(): out of memory");
+                return;
+            }
+            memset(asIndexFields.data(), 0,
+                   sizeof(OGRField) * nOrderItems * nFeaturesAlloc);
+        }
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
 
+    if (poRuns)
+    {
+        /* ---------------------------------------------------------------- */
+        /*      Merge the sorted runs.                                      */
+        /* ---------------------------------------------------------------- */
+        const size_t nRunSize = nIndexSize;
+        nIndexSize = 0;
+        if ((nRunSize == 0 ||
+             poRuns->AddRun(std::move(asIndexFields), std::move(anFIDList),
+                            nRunSize, nRunFirstSeq)) &&
+            poRuns->Finish())
+        {
+            CPLDebug("GenSQL",
+                     "ORDER BY: " CPL_FRMT_GIB " features sorted in %d runs "
+                     "(" CPL_FRMT_GUIB " bytes in temporary file)",
+                     poRuns->GetFeatureCount(),
+                     static_cast<int>(poRuns->GetRuns().size()),
+                     static_cast<GUIntBig>(poRuns->GetFile().GetSize()));
+            if (!MergeSortRuns(*poRuns, nMaxMemory))
+            {
+                m_anFIDIndex.clear();
+                m_poFIDIndexFile.reset();
+                m_nFIDIndexFileCount = 0;
+            }
+        }
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Initialize m_anFIDIndex                                         */
     /* -------------------------------------------------------------------- */
@@ -2380,7 +4156,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         m_anFIDIndex.push_back(static_cast<GIntBig>(i));
 
     /* -------------------------------------------------------------------- */
-    /*      Quick sort the records.                                         */
+    /*      Merge sort the records.                                         */
     /* -------------------------------------------------------------------- */
 
     GIntBig *panMerged = static_cast<GIntBig *>(
@@ -2392,7 +4168,8 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     }
 
     // Note: this merge sort is slightly faster than std::sort()
-    SortIndexSection(asIndexFields.data(), panMerged, 0, nIndexSize);
+    SortIndex(asIndexFields.data(), m_anFIDIndex.data(), panMerged, nIndexSize,
+              poThreadPool);
     VSIFree(panMerged);
 
     /* -------------------------------------------------------------------- */
@@ -2419,6 +4196,252 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     ResetReading();
 }
 
+/************************************************************************/
+/*                           MergeSortRuns()                            */
+/*                                                                      */
+/*      Merge the runs written by CreateOrderByIndex() into             */
+/*      m_anFIDIndex, or m_poFIDIndexFile if the FIDs do not fit in     */
+/*      memory.                                                         */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeSortRuns(OGRGenSQLSortRuns &oRuns,
+                                          GIntBig nMaxMemory)
+{
+    const int nOrderItems = m_pSelectInfo->order_specs;
+    const auto &asRuns = oRuns.GetRuns();
+    const size_t nRuns = asRuns.size();
+    const GIntBig nFeatureCount = oRuns.GetFeatureCount();
+    OGRGenSQLTempFile &oFile = oRuns.GetFile();
+
+    // Read buffer of each run
+    const size_t nBufferSize = static_cast<size_t>(std::clamp<GIntBig>(
+        nMaxMemory / static_cast<GIntBig>(2 * nRuns), 4096, 1024 * 1024));
+
+    struct RunCursor
+    {
+        vsi_l_offset nOffset = 0;
+        vsi_l_offset nEnd = 0;
+        std::vector<GByte> abyBuffer{};
+        size_t nBufferPos = 0;
+        std::vector<OGRField> asFields{};
+        std::vector<std::string> aosStrings{};
+        GIntBig nFID = 0;
+        GIntBig nSeq = 0;
+    };
+
+    std::vector<RunCursor> aoCursors;
+    bool bError = false;
+
+    // Make sure that nBytes are available from the current position in the
+    // buffer of the cursor
+    const auto Ensure = [&oFile, nBufferSize](RunCursor &oCursor,
+                                              size_t nBytes)
+    {
+        const size_t nAvailable = oCursor.abyBuffer.size() - oCursor.nBufferPos;
+        if (nAvailable >= nBytes)
+            return true;
+        if (static_cast<vsi_l_offset>(nBytes - nAvailable) >
+            oCursor.nEnd - oCursor.nOffset)
+            return false;
+        oCursor.abyBuffer.erase(oCursor.abyBuffer.begin(),
+                                oCursor.abyBuffer.begin() + oCursor.nBufferPos);
+        oCursor.nBufferPos = 0;
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(std::max(nBufferSize, nBytes) - nAvailable,
+                                   oCursor.nEnd - oCursor.nOffset));
+        oCursor.abyBuffer.resize(nAvailable + nToRead);
+        if (!oFile.Read(oCursor.nOffset, oCursor.abyBuffer.data() + nAvailable,
+                        nToRead))
+            return false;
+        oCursor.nOffset += nToRead;
+        return true;
+    };
+
+    // Load the next record of a run. Returns false at its end.
+    const auto ReadNext = [&](RunCursor &oCursor)
+    {
+        if (oCursor.nBufferPos == oCursor.abyBuffer.size() &&
+            oCursor.nOffset == oCursor.nEnd)
+            return false;
+        uint32_t nRecordSize = 0;
+        if (!Ensure(oCursor, sizeof(nRecordSize)))
+        {
+            bError = true;
+            return false;
+        }
+        memcpy(&nRecordSize, oCursor.abyBuffer.data() + oCursor.nBufferPos,
+               sizeof(nRecordSize));
+        oCursor.nBufferPos += sizeof(nRecordSize);
+        if (nRecordSize < 2 * sizeof(GIntBig) || !Ensure(oCursor, nRecordSize))
+        {
+            bError = true;
+            return false;
+        }
+        const GByte *pabyRecord = oCursor.abyBuffer.data() + oCursor.nBufferPos;
+        oCursor.nBufferPos += nRecordSize;
+        memcpy(&oCursor.nFID, pabyRecord, sizeof(GIntBig));
+        memcpy(&oCursor.nSeq, pabyRecord + sizeof(GIntBig), sizeof(GIntBig));
+        if (!DeserializeIndexFields(
+                pabyRecord + 2 * sizeof(GIntBig),
+                nRecordSize - 2 * sizeof(GIntBig), m_aeOrderByFieldTypes,
+                oCursor.asFields.data(), oCursor.aosStrings))
+        {
+            bError = true;
+            return false;
+        }
+        return true;
+    };
+
+    // Cursors with the smallest key first, and for equal keys, the one of
+    // the first run, to keep the sort stable.
+    const auto Greater = [this, &aoCursors](size_t i, size_t j)
+    {
+        const int nCmp =
+            Compare(aoCursors[i].asFields.data(), aoCursors[j].asFields.data());
+        return nCmp > 0 || (nCmp == 0 && i > j);
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(Greater)> oQueue(
+        Greater);
+
+    // Sorted FIDs, flushed to m_poFIDIndexFile if they do not fit in memory
+    const bool bFIDIndexInMemory =
+        nFeatureCount <= nMaxMemory / static_cast<GIntBig>(sizeof(GIntBig));
+    std::vector<GIntBig> anFIDBuffer;
+    constexpr size_t FID_BUFFER_SIZE = 65536;
+    if (!bFIDIndexInMemory)
+        m_poFIDIndexFile = std::make_unique<OGRGenSQLTempFile>("ogr_sql_fid");
+    bool bAlreadySorted = true;
+    GIntBig nSeq = 0;
+
+    try
+    {
+        aoCursors.resize(nRuns);
+        for (size_t i = 0; i < nRuns; ++i)
+        {
+            aoCursors[i].nOffset = asRuns[i].nOffset;
+            aoCursors[i].nEnd = asRuns[i].nOffset + asRuns[i].nSize;
+            aoCursors[i].asFields.resize(nOrderItems);
+            aoCursors[i].aosStrings.resize(nOrderItems);
+            if (ReadNext(aoCursors[i]))
+                oQueue.push(i);
+            else if (bError)
+                return false;
+        }
+        if (bFIDIndexInMemory)
+            m_anFIDIndex.reserve(static_cast<size_t>(nFeatureCount));
+        else
+            anFIDBuffer.reserve(FID_BUFFER_SIZE);
+
+        while (!oQueue.empty())
+        {
+            const size_t iRun = oQueue.top();
+            oQueue.pop();
+            RunCursor &oCursor = aoCursors[iRun];
+
+            if (oCursor.nSeq != nSeq)
+                bAlreadySorted = false;
+            ++nSeq;
+            if (bFIDIndexInMemory)
+            {
+                m_anFIDIndex.push_back(oCursor.nFID);
+            }
+            else
+            {
+                anFIDBuffer.push_back(oCursor.nFID);
+                if (anFIDBuffer.size() == FID_BUFFER_SIZE &&
+                    !m_poFIDIndexFile->Append(
+                        anFIDBuffer.data(),
+                        anFIDBuffer.size() * sizeof(GIntBig)))
+                {
+                    return false;
+                }
+                if (anFIDBuffer.size() == FID_BUFFER_SIZE)
+                    anFIDBuffer.clear();
+            }
+
+            if (ReadNext(oCursor))
+                oQueue.push(iRun);
+            else if (bError)
+                return false;
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return false;
+    }
+
+    if (!anFIDBuffer.empty() &&
+        !m_poFIDIndexFile->Append(anFIDBuffer.data(),
+                                  anFIDBuffer.size() * sizeof(GIntBig)))
+    {
+        return false;
+    }
+
+    if (bAlreadySorted)
+    {
+        // See the corresponding comment in CreateOrderByIndex()
+        m_anFIDIndex.clear();
+        m_poFIDIndexFile.reset();
+    }
+    else if (!bFIDIndexInMemory)
+    {
+        m_nFIDIndexFileCount = nSeq;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            HasFIDIndex()                             */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::HasFIDIndex() const
+{
+    return !m_anFIDIndex.empty() || m_nFIDIndexFileCount > 0;
+}
+
+/************************************************************************/
+/*                          GetFIDIndexSize()                           */
+/************************************************************************/
+
+GIntBig OGRGenSQLResultsLayer::GetFIDIndexSize() const
+{
+    return m_anFIDIndex.empty() ? m_nFIDIndexFileCount
+                                : static_cast<GIntBig>(m_anFIDIndex.size());
+}
+
+/************************************************************************/
+/*                          GetFIDFromIndex()                           */
+/************************************************************************/
+
+GIntBig OGRGenSQLResultsLayer::GetFIDFromIndex(GIntBig nIndex)
+{
+    if (!m_anFIDIndex.empty())
+        return m_anFIDIndex[static_cast<size_t>(nIndex)];
+
+    constexpr GIntBig CACHE_SIZE = 8192;
+    if (nIndex < m_nFIDIndexFileCacheStart ||
+        nIndex >= m_nFIDIndexFileCacheStart +
+                      static_cast<GIntBig>(m_anFIDIndexFileCache.size()))
+    {
+        const GIntBig nStart = nIndex - nIndex % CACHE_SIZE;
+        const size_t nCount = static_cast<size_t>(
+            std::min(CACHE_SIZE, m_nFIDIndexFileCount - nStart));
+        m_nFIDIndexFileCacheStart = nStart;
+        m_anFIDIndexFileCache.resize(nCount);
+        if (!m_poFIDIndexFile->Read(
+                static_cast<vsi_l_offset>(nStart) * sizeof(GIntBig),
+                m_anFIDIndexFileCache.data(), nCount * sizeof(GIntBig)))
+        {
+            m_anFIDIndexFileCache.clear();
+            return OGRNullFID;
+        }
+    }
+    return m_anFIDIndexFileCache[static_cast<size_t>(
+        nIndex - m_nFIDIndexFileCacheStart)];
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -2426,6 +4449,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
+                                             GIntBig *panIndex,
                                              GIntBig *panMerged, size_t nStart,
                                              size_t nEntries)
 
@@ -2433,17 +4457,36 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
     if (nEntries < 2)
         return;
 
+    const size_t nFirstGroup = nEntries / 2;
+    const size_t nSecondGroup = nEntries - nFirstGroup;
+
+    SortIndexSection(pasIndexFields, panIndex, panMerged, nStart, nFirstGroup);
+    SortIndexSection(pasIndexFields, panIndex, panMerged, nStart + nFirstGroup,
+                     nSecondGroup);
+    MergeIndexSections(pasIndexFields, panIndex, panMerged, nStart,
+                       nFirstGroup, nSecondGroup);
+}
+
+/************************************************************************/
+/*                         MergeIndexSections()                         */
+/*                                                                      */
+/*      Merge two consecutive sorted sections of the index.             */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::MergeIndexSections(const OGRField *pasIndexFields,
+                                               GIntBig *panIndex,
+                                               GIntBig *panMerged,
+                                               size_t nStart,
+                                               size_t nFirstGroup,
+                                               size_t nSecondGroup)
+{
     swq_select *psSelectInfo = m_pSelectInfo.get();
     const int nOrderItems = psSelectInfo->order_specs;
 
-    size_t nFirstGroup = nEntries / 2;
+    const size_t nEntries = nFirstGroup + nSecondGroup;
     size_t nFirstStart = nStart;
-    size_t nSecondGroup = nEntries - nFirstGroup;
     size_t nSecondStart = nStart + nFirstGroup;
 
-    SortIndexSection(pasIndexFields, panMerged, nFirstStart, nFirstGroup);
-    SortIndexSection(pasIndexFields, panMerged, nSecondStart, nSecondGroup);
-
     for (size_t iMerge = 0; iMerge < nEntries; ++iMerge)
     {
         int nResult = 0;
@@ -2454,25 +4497,96 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
             nResult = -1;
         else
             nResult = Compare(
-                pasIndexFields + m_anFIDIndex[nFirstStart] * nOrderItems,
-                pasIndexFields + m_anFIDIndex[nSecondStart] * nOrderItems);
+                pasIndexFields + panIndex[nFirstStart] * nOrderItems,
+                pasIndexFields + panIndex[nSecondStart] * nOrderItems);
 
         if (nResult > 0)
         {
-            panMerged[iMerge] = m_anFIDIndex[nSecondStart];
+            panMerged[iMerge] = panIndex[nSecondStart];
             nSecondStart++;
             nSecondGroup--;
         }
         else
         {
-            panMerged[iMerge] = m_anFIDIndex[nFirstStart];
+            panMerged[iMerge] = panIndex[nFirstStart];
             nFirstStart++;
             nFirstGroup--;
         }
     }
 
     /* Copy the merge list back into the main index */
-    memcpy(m_anFIDIndex.data() + nStart, panMerged, sizeof(GIntBig) * nEntries);
+    memcpy(panIndex + nStart, panMerged, sizeof(GIntBig) * nEntries);
+}
+
+/************************************************************************/
+/*                             SortIndex()                              */
+/*                                                                      */
+/*      Sort the whole index, with sections sorted and merged in        */
+/*      parallel if a thread pool is provided.                          */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::SortIndex(const OGRField *pasIndexFields,
+                                      GIntBig *panIndex, GIntBig *panMerged,
+                                      size_t nEntries,
+                                      CPLWorkerThreadPool *poThreadPool)
+{
+    // Below that size, sorting a section is not worth a job
+    constexpr size_t MIN_ENTRIES_PER_JOB = 10000;
+    const size_t nSections =
+        poThreadPool
+            ? std::min(static_cast<size_t>(poThreadPool->GetThreadCount()),
+                       nEntries / MIN_ENTRIES_PER_JOB)
+            : 1;
+    auto poJobQueue = nSections > 1 ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        SortIndexSection(pasIndexFields, panIndex, panMerged, 0, nEntries);
+        return;
+    }
+
+    // Each job uses the part of panMerged corresponding to its section
+    std::vector<size_t> anBounds;
+    for (size_t i = 0; i <= nSections; ++i)
+        anBounds.push_back(nEntries / nSections * i +
+                           std::min(i, nEntries % nSections));
+    for (size_t i = 0; i < nSections; ++i)
+    {
+        const size_t nStart = anBounds[i];
+        const size_t nCount = anBounds[i + 1] - nStart;
+        poJobQueue->SubmitJob(
+            [this, pasIndexFields, panIndex, panMerged, nStart, nCount]()
+            {
+                SortIndexSection(pasIndexFields, panIndex, panMerged + nStart,
+                                 nStart, nCount);
+            });
+    }
+    poJobQueue->WaitCompletion();
+
+    // Merge pairs of consecutive sections until there is only one left
+    while (anBounds.size() > 2)
+    {
+        std::vector<size_t> anNewBounds;
+        size_t i = 0;
+        for (; i + 2 < anBounds.size(); i += 2)
+        {
+            const size_t nStart = anBounds[i];
+            const size_t nFirstGroup = anBounds[i + 1] - nStart;
+            const size_t nSecondGroup = anBounds[i + 2] - anBounds[i + 1];
+            poJobQueue->SubmitJob(
+                [this, pasIndexFields, panIndex, panMerged, nStart, nFirstGroup,
+                 nSecondGroup]()
+                {
+                    MergeIndexSections(pasIndexFields, panIndex,
+                                       panMerged + nStart, nStart, nFirstGroup,
+                                       nSecondGroup);
+                });
+            anNewBounds.push_back(nStart);
+        }
+        for (; i < anBounds.size(); ++i)
+            anNewBounds.push_back(anBounds[i]);
+        poJobQueue->WaitCompletion();
+        anBounds = std::move(anNewBounds);
+    }
 }
 
 /************************************************************************/
@@ -2502,13 +4616,9 @@ int OGRGenSQLResultsLayer::Compare(const OGRField *pasFirstTuple,
     for (iKey = 0; nResult == 0 && iKey < psSelectInfo->order_specs; iKey++)
     {
         swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-        OGRFieldDefn *poFDefn = nullptr;
-
-        if (psKeyDef->field_index >= m_iFIDFieldIndex)
-            poFDefn = nullptr;
-        else
-            poFDefn = m_poSrcLayer->GetLayerDefn()->GetFieldDefn(
-                psKeyDef->field_index);
+        // Special fields are stored as Integer64, Real or String by
+        // ReadIndexFields()
+        const OGRFieldType eType = m_aeOrderByFieldTypes[iKey];
 
         if (OGR_RawField_IsUnset(&pasFirstTuple[iKey]) ||
             OGR_RawField_IsNull(&pasFirstTuple[iKey]))
@@ -2524,56 +4634,27 @@ int OGRGenSQLResultsLayer::Compare(const OGRField *pasFirstTuple,
         {
             nResult = 1;
         }
-        else if (poFDefn == nullptr)
-        {
-            CPLAssert(psKeyDef->field_index <
-                      m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
-            switch (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex])
-            {
-                case SWQ_INTEGER:
-                    // Yes, read Integer in Integer64.
-                    // This is consistent with what is done ReadIndexFields()
-                case SWQ_INTEGER64:
-                    nResult = ComparePrimitive(pasFirstTuple[iKey].Integer64,
-                                               pasSecondTuple[iKey].Integer64);
-                    break;
-                case SWQ_FLOAT:
-                    nResult = ComparePrimitive(pasFirstTuple[iKey].Real,
-                                               pasSecondTuple[iKey].Real);
-                    break;
-                case SWQ_STRING:
-                    nResult = strcmp(pasFirstTuple[iKey].String,
-                                     pasSecondTuple[iKey].String);
-                    break;
-
-                default:
-                    CPLAssert(false);
-                    nResult = 0;
-            }
-        }
-        else if (poFDefn->GetType() == OFTInteger)
+        else if (eType == OFTInteger)
         {
             nResult = ComparePrimitive(pasFirstTuple[iKey].Integer,
                                        pasSecondTuple[iKey].Integer);
         }
-        else if (poFDefn->GetType() == OFTInteger64)
+        else if (eType == OFTInteger64)
         {
             nResult = ComparePrimitive(pasFirstTuple[iKey].Integer64,
                                        pasSecondTuple[iKey].Integer64);
         }
-        else if (poFDefn->GetType() == OFTString)
+        else if (eType == OFTString)
         {
             nResult =
                 strcmp(pasFirstTuple[iKey].String, pasSecondTuple[iKey].String);
         }
-        else if (poFDefn->GetType() == OFTReal)
+        else if (eType == OFTReal)
         {
             nResult = ComparePrimitive(pasFirstTuple[iKey].Real,
                                        pasSecondTuple[iKey].Real);
         }
-        else if (poFDefn->GetType() == OFTDate ||
-                 poFDefn->GetType() == OFTTime ||
-                 poFDefn->GetType() == OFTDateTime)
+        else if (eType == OFTDate || eType == OFTTime || eType == OFTDateTime)
         {
             nResult =
                 OGRCompareDate(&pasFirstTuple[iKey], &pasSecondTuple[iKey]);
@@ -2747,6 +4828,9 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
 void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     m_anFIDIndex.clear();
+    m_poFIDIndexFile.reset();
+    m_nFIDIndexFileCount = 0;
+    m_anFIDIndexFileCache.clear();
     m_bOrderByValid = false;
 }
 
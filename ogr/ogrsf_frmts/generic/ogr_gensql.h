@@ -39,6 +39,11 @@
 /************************************************************************/
 
 class swq_select;
+class OGRGenSQLJoinLookup;
+class OGRGenSQLSortRuns;
+class OGRGenSQLDistinctRuns;
+class OGRGenSQLTempFile;
+class CPLWorkerThreadPool;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -66,6 +71,15 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     std::vector<GIntBig> m_anFIDIndex{};
     bool m_bOrderByValid = false;
 
+    // Sorted FIDs, when they do not fit in memory (instead of m_anFIDIndex)
+    std::unique_ptr<OGRGenSQLTempFile> m_poFIDIndexFile{};
+    GIntBig m_nFIDIndexFileCount = 0;
+    std::vector<GIntBig> m_anFIDIndexFileCache{};
+    GIntBig m_nFIDIndexFileCacheStart = 0;
+
+    // Type of the ORDER BY keys, as stored by ReadIndexFields()
+    std::vector<OGRFieldType> m_aeOrderByFieldTypes{};
+
     GIntBig m_nNextIndexFID = 0;
     mutable std::unique_ptr<OGRFeature> m_poSummaryFeature{};
 
@@ -74,14 +88,32 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // DISTINCT values written to temporary files, per column, when they do
+    // not fit in memory
+    mutable std::vector<std::unique_ptr<OGRGenSQLDistinctRuns>>
+        m_apoDistinctRuns{};
+
+    // One per JOIN, or nullptr when it is evaluated with a nested loop
+    std::vector<std::unique_ptr<OGRGenSQLJoinLookup>> m_apoJoinLookups{};
+
     bool PrepareSummary() const;
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
-    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
-                          size_t nStart, size_t nEntries);
+    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panIndex,
+                          GIntBig *panMerged, size_t nStart, size_t nEntries);
+    void MergeIndexSections(const OGRField *pasIndexFields, GIntBig *panIndex,
+                            GIntBig *panMerged, size_t nStart,
+                            size_t nFirstGroup, size_t nSecondGroup);
+    void SortIndex(const OGRField *pasIndexFields, GIntBig *panIndex,
+                   GIntBig *panMerged, size_t nEntries,
+                   CPLWorkerThreadPool *poThreadPool);
+    bool MergeSortRuns(OGRGenSQLSortRuns &oRuns, GIntBig nMaxMemory);
+    bool HasFIDIndex() const;
+    GIntBig GetFIDIndexSize() const;
+    GIntBig GetFIDFromIndex(GIntBig nIndex);
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize);
     int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
 
@@ -135,6 +167,7 @@ class OGRGenSQLResultsLayer final : public OGRLayer
 
   protected:
     friend struct OGRGenSQLResultsLayerArrowStreamPrivateData;
+    friend class OGRGenSQLSortRuns;
 
     int GetArrowSchemaForwarded(struct ArrowArrayStream *stream,
                                 struct ArrowSchema *out_schema) const;
@@ -20,9 +20,15 @@
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <set>
@@ -1209,6 +1215,152 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                    OGRLayer::GetNextFeatureInto()                    */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature.
+
+ This method is an alternative to GetNextFeature() for read loops: instead of
+ returning a new feature, the content of the next feature is stored into
+ poFeature, which remains owned by the caller. Its previous content is
+ discarded. Drivers that implement this method natively (currently CSV,
+ FlatGeobuf, GPKG and Shapefile) reuse the field storage of poFeature, which
+ saves part of the dynamic memory allocations of GetNextFeature(). The GPKG
+ driver also reuses the WKB buffers and geometry objects of poFeature. Other
+ drivers fall back to GetNextFeature().
+
+ poFeature must have been created with the feature definition returned by
+ GetLayerDefn().
+
+ The same filtering rules as GetNextFeature() apply, and calls to this method
+ and GetNextFeature() may be interleaved. When false is returned, the content
+ of poFeature is unspecified.
+
+ Typical usage is:
+ \code{.cpp}
+ auto poFeature = std::make_unique<OGRFeature>(poLayer->GetLayerDefn());
+ while (poLayer->GetNextFeatureInto(poFeature.get()))
+ {
+     // do something with poFeature
+ }
+ \endcode
+
+ This method is the same as the C function OGR_L_GetNextFeatureInto().
+
+ @param poFeature feature into which the next feature is read.
+ @return true if a feature has been read, or false if no more features are
+ available (or in case of error).
+
+ @since GDAL 3.14
+*/
+
+bool OGRLayer::GetNextFeatureInto(OGRFeature *poFeature)
+
+{
+    if (poFeature->GetDefnRef() != GetLayerDefn())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GetNextFeatureInto(): the feature must have been created "
+                 "with the layer definition");
+        return false;
+    }
+    return IGetNextFeatureInto(poFeature);
+}
+
+/************************************************************************/
+/*                   OGRLayer::IGetNextFeatureInto()                    */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature.
+
+ This method is implemented by drivers and not called directly. User code
+ should use GetNextFeatureInto() instead, which checks that poFeature uses
+ the layer definition.
+
+ The default implementation calls GetNextFeature() and moves the content of
+ the returned feature into poFeature.
+
+ @param poFeature feature into which the next feature is read.
+ @return true if a feature has been read, or false if no more features are
+ available (or in case of error).
+
+ @since GDAL 3.14
+*/
+
+bool OGRLayer::IGetNextFeatureInto(OGRFeature *poFeature)
+
+{
+    std::unique_ptr<OGRFeature> poNextFeature(GetNextFeature());
+    if (!poNextFeature)
+        return false;
+    if (poNextFeature->GetDefnRef() == poFeature->GetDefnRef())
+    {
+        poFeature->SwapContentUnsafe(poNextFeature.get());
+    }
+    else
+    {
+        poFeature->Reset();
+        poFeature->SetFrom(poNextFeature.get());
+        poFeature->SetFID(poNextFeature->GetFID());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_GetNextFeatureInto()                      */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature.
+
+ This function is an alternative to OGR_L_GetNextFeature() for read loops:
+ instead of returning a new feature, the content of the next feature is
+ stored into hFeat, which remains owned by the caller. Its previous content
+ is discarded. Drivers that implement this function natively (currently CSV,
+ FlatGeobuf, GPKG and Shapefile) reuse the field storage of hFeat, which saves
+ part of the dynamic memory allocations of OGR_L_GetNextFeature(). The GPKG
+ driver also reuses the WKB buffers and geometry objects of hFeat.
+
+ hFeat must have been created with the feature definition returned by
+ OGR_L_GetLayerDefn(). When false is returned, the content of hFeat is
+ unspecified.
+
+ Typical usage is:
+ \code{.c}
+ OGRFeatureH hFeat = OGR_F_Create(OGR_L_GetLayerDefn(hLayer));
+ while (OGR_L_GetNextFeatureInto(hLayer, hFeat))
+ {
+     // do something with hFeat
+ }
+ OGR_F_Destroy(hFeat);
+ \endcode
+
+ This function is the same as the C++ method OGRLayer::GetNextFeatureInto().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeat handle to the feature into which the next feature is read.
+ @return true if a feature has been read, or false if no more features are
+ available (or in case of error).
+
+ @since GDAL 3.14
+*/
+
+bool OGR_L_GetNextFeatureInto(OGRLayerH hLayer, OGRFeatureH hFeat)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureInto", false);
+    VALIDATE_POINTER1(hFeat, "OGR_L_GetNextFeatureInto", false);
+
+    return OGRLayer::FromHandle(hLayer)->GetNextFeatureInto(
+        OGRFeature::FromHandle(hFeat));
+}
+
 /************************************************************************/
 /*                      ConvertGeomsIfNecessary()                       */
 /************************************************************************/
@@ -5304,308 +5456,832 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
 }
 
 /************************************************************************/
-/*                            Intersection()                            */
+/*                           STRSortEntries()                           */
 /************************************************************************/
-/**
- * \brief Intersection of two layers.
- *
- * The result layer contains features whose geometries represent areas
- * that are common between features in the input layer and in the
- * method layer. The features in the result layer have attributes from
- * both input and method layers. The schema of the result layer can be
- * set by the user or, if it is empty, is initialized to contain all
- * fields in the input and method layers.
- *
- * \note If the schema of the result is set by user and contains
- * fields that have the same name as a field in input and in method
- * layer, then the attribute in the result feature will get the value
- * from the feature of the method layer.
- *
- * \note For best performance use the minimum amount of features in
- * the method layer and copy it into a memory layer.
- *
- * \note This method relies on GEOS support. Do not use unless the
- * GEOS support is compiled in.
- *
- * The recognized list of options is:
- * <ul>
- * <li>SKIP_FAILURES=YES/NO. Set to YES to go on, even when a
- *     feature could not be inserted or a GEOS call failed.
- * </li>
- * <li>PROMOTE_TO_MULTI=YES/NO. Set to YES to convert Polygons
- *     into MultiPolygons, LineStrings to MultiLineStrings or
- *     Points to MultiPoints (only since GDAL 3.9.2 for the later)
- * </li>
- * <li>INPUT_PREFIX=string. Set a prefix for the field names that
- *     will be created from the fields of the input layer.
- * </li>
- * <li>METHOD_PREFIX=string. Set a prefix for the field names that
- *     will be created from the fields of the method layer.
- * </li>
- * <li>USE_PREPARED_GEOMETRIES=YES/NO. Set to NO to not use prepared
- *     geometries to pretest intersection of features of method layer
- *     with features of this layer.
- * </li>
- * <li>PRETEST_CONTAINMENT=YES/NO. Set to YES to pretest the
- *     containment of features of method layer within the features of
- *     this layer. This will speed up the method significantly in some
- *     cases. Requires that the prepared geometries are in effect.
- * </li>
- * <li>KEEP_LOWER_DIMENSION_GEOMETRIES=YES/NO. Set to NO to skip
- *     result features with lower dimension geometry that would
- *     otherwise be added to the result layer. The default is YES, to add
- *     features with lower dimension geometry, but only if the result layer
- *     has an unknown geometry type.
- * </li>
- * </ul>
- *
- * This method is the same as the C function OGR_L_Intersection().
- *
- * @param pLayerMethod the method layer. Should not be NULL.
- *
- * @param pLayerResult the layer where the features resulting from the
- * operation are inserted. Should not be NULL. See above the note
- * about the schema.
- *
- * @param papszOptions NULL terminated list of options (may be NULL).
- *
- * @param pfnProgress a GDALProgressFunc() compatible callback function for
- * reporting progress or NULL.
- *
- * @param pProgressArg argument to be passed to pfnProgress. May be NULL.
- *
- * @return an error code if there was an error or the execution was
- * interrupted, OGRERR_NONE otherwise.
- *
- * @note The first geometry field is always used.
- *
- * @since OGR 1.10
- */
 
-OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
-                              CSLConstList papszOptions,
-                              GDALProgressFunc pfnProgress, void *pProgressArg)
+/** Order entries following the Sort-Tile-Recursive algorithm, so that
+ * consecutive groups of nNodeCapacity entries are spatially compact. */
+template <class T, class GetEnvelope>
+static void STRSortEntries(std::vector<T> &aoEntries, GetEnvelope getEnvelope,
+                           size_t nNodeCapacity)
 {
-    OGRErr ret = OGRERR_NONE;
-    OGRFeatureDefn *poDefnInput = GetLayerDefn();
-    OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
-    OGRGeometry *pGeometryMethodFilter = nullptr;
-    int *mapInput = nullptr;
-    int *mapMethod = nullptr;
-    OGREnvelope sEnvelopeMethod;
-    GBool bEnvelopeSet;
-    double progress_max = static_cast<double>(GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
-    const bool bSkipFailures =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
-    const bool bUsePreparedGeometries = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
-    const bool bPretestContainment = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PRETEST_CONTAINMENT", "NO"));
-    bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
-        papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
+    const size_t nEntries = aoEntries.size();
+    const size_t nNodes = (nEntries + nNodeCapacity - 1) / nNodeCapacity;
+    const size_t nSlices = static_cast<size_t>(
+        std::ceil(std::sqrt(static_cast<double>(nNodes))));
+    const size_t nSliceSize = std::max<size_t>(1, nSlices) * nNodeCapacity;
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
+    std::sort(aoEntries.begin(), aoEntries.end(),
+              [&getEnvelope](const T &a, const T &b)
+              {
+                  const OGREnvelope &sA = getEnvelope(a);
+                  const OGREnvelope &sB = getEnvelope(b);
+                  return sA.MinX + sA.MaxX < sB.MinX + sB.MaxX;
+              });
+    for (size_t i = 0; i < nEntries; i += nSliceSize)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "OGRLayer::Intersection() requires GEOS support");
-        return OGRERR_UNSUPPORTED_OPERATION;
+        std::sort(aoEntries.begin() + i,
+                  aoEntries.begin() + std::min(nEntries, i + nSliceSize),
+                  [&getEnvelope](const T &a, const T &b)
+                  {
+                      const OGREnvelope &sA = getEnvelope(a);
+                      const OGREnvelope &sB = getEnvelope(b);
+                      return sA.MinY + sA.MaxY < sB.MinY + sB.MaxY;
+                  });
     }
+}
 
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
-    if (bKeepLowerDimGeom)
+/************************************************************************/
+/*                         OGRLayerOverlayIndex                         */
+/************************************************************************/
+
+/** Features of a layer, loaded in memory and indexed with a packed R-tree
+ * bulk loaded with the Sort-Tile-Recursive algorithm.
+ *
+ * Once loaded, the index may be queried concurrently from several threads.
+ */
+class OGRLayerOverlayIndex
+{
+  public:
+    OGRLayerOverlayIndex() = default;
+
+    bool Load(OGRLayer *poLayer);
+
+    void Query(const OGRGeometry *poFilter,
+               std::vector<OGRFeature *> &apoFeatures) const;
+
+  private:
+    static constexpr size_t NODE_CAPACITY = 16;
+
+    struct Node
     {
-        // require that the result layer is of geom type unknown
-        if (pLayerResult->GetGeomType() != wkbUnknown)
+        OGREnvelope sEnvelope{};
+        // Index of the first child in the level below, or in m_anItems
+        size_t nFirst = 0;
+        size_t nCount = 0;
+    };
+
+    std::vector<OGRFeatureUniquePtr> m_apoFeatures{};
+    std::vector<OGREnvelope> m_asEnvelopes{};
+    // Index of features in m_apoFeatures, in the order of the leaf nodes
+    std::vector<size_t> m_anItems{};
+    // Levels of the tree, from the leaves to the root
+    std::vector<std::vector<Node>> m_aaoLevels{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerOverlayIndex)
+};
+
+/************************************************************************/
+/*                     OGRLayerOverlayIndex::Load()                     */
+/************************************************************************/
+
+/** Read the features of the layer, with its current filters, and build the
+ * index. Features without geometry are skipped. */
+bool OGRLayerOverlayIndex::Load(OGRLayer *poLayer)
+{
+    try
+    {
+        for (auto &&poFeature : poLayer)
         {
-            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
-                            "since the result layer does not allow it.");
-            bKeepLowerDimGeom = false;
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (!poGeom || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            m_asEnvelopes.push_back(sEnvelope);
+            m_apoFeatures.push_back(std::move(poFeature));
         }
-    }
 
-    for (auto &&x : this)
-    {
+        m_anItems.resize(m_apoFeatures.size());
+        for (size_t i = 0; i < m_anItems.size(); ++i)
+            m_anItems[i] = i;
+        STRSortEntries(
+            m_anItems, [this](size_t i) -> const OGREnvelope &
+            { return m_asEnvelopes[i]; }, NODE_CAPACITY);
 
-        if (pfnProgress)
+        std::vector<Node> aoLevel;
+        for (size_t i = 0; i < m_anItems.size(); i += NODE_CAPACITY)
         {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
+            Node oNode;
+            oNode.nFirst = i;
+            oNode.nCount = std::min(NODE_CAPACITY, m_anItems.size() - i);
+            oNode.sEnvelope = m_asEnvelopes[m_anItems[i]];
+            for (size_t j = 1; j < oNode.nCount; ++j)
+                oNode.sEnvelope.Merge(m_asEnvelopes[m_anItems[i + j]]);
+            aoLevel.push_back(oNode);
         }
 
-        // is it worth to proceed?
-        if (bEnvelopeSet)
+        while (!aoLevel.empty())
         {
-            OGRGeometry *x_geom = x->GetGeometryRef();
-            if (x_geom)
+            const bool bIsRoot = aoLevel.size() == 1;
+            if (!bIsRoot)
             {
-                OGREnvelope x_env;
-                x_geom->getEnvelope(&x_env);
-                if (x_env.MaxX < sEnvelopeMethod.MinX ||
-                    x_env.MaxY < sEnvelopeMethod.MinY ||
-                    sEnvelopeMethod.MaxX < x_env.MinX ||
-                    sEnvelopeMethod.MaxY < x_env.MinY)
-                {
-                    continue;
-                }
+                STRSortEntries(
+                    aoLevel, [](const Node &oNode) -> const OGREnvelope &
+                    { return oNode.sEnvelope; }, NODE_CAPACITY);
             }
-            else
+            std::vector<Node> aoUpperLevel;
+            if (!bIsRoot)
             {
-                continue;
+                for (size_t i = 0; i < aoLevel.size(); i += NODE_CAPACITY)
+                {
+                    Node oNode;
+                    oNode.nFirst = i;
+                    oNode.nCount = std::min(NODE_CAPACITY, aoLevel.size() - i);
+                    oNode.sEnvelope = aoLevel[i].sEnvelope;
+                    for (size_t j = 1; j < oNode.nCount; ++j)
+                        oNode.sEnvelope.Merge(aoLevel[i + j].sEnvelope);
+                    aoUpperLevel.push_back(oNode);
+                }
             }
+            m_aaoLevels.push_back(std::move(aoLevel));
+            aoLevel = std::move(aoUpperLevel);
         }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot load layer %s in memory", poLayer->GetName());
+        return false;
+    }
+    return true;
+}
 
-        // set up the filter for method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
+/************************************************************************/
+/*                    OGRLayerOverlayIndex::Query()                     */
+/************************************************************************/
+
+/** Return the features whose geometry intersects poFilter, in their order
+ * in the layer. */
+void OGRLayerOverlayIndex::Query(const OGRGeometry *poFilter,
+                                 std::vector<OGRFeature *> &apoFeatures) const
+{
+    apoFeatures.clear();
+    if (m_aaoLevels.empty() || poFilter->IsEmpty())
+        return;
+
+    OGREnvelope sFilterEnvelope;
+    poFilter->getEnvelope(&sFilterEnvelope);
+
+    std::vector<size_t> anHits;
+    // Pairs of (level, index of node in level)
+    std::vector<std::pair<size_t, size_t>> anStack;
+    anStack.emplace_back(m_aaoLevels.size() - 1, 0);
+    while (!anStack.empty())
+    {
+        const auto [iLevel, iNode] = anStack.back();
+        anStack.pop_back();
+        const Node &oNode = m_aaoLevels[iLevel][iNode];
+        if (!oNode.sEnvelope.Intersects(sFilterEnvelope))
+            continue;
+        for (size_t i = oNode.nFirst; i < oNode.nFirst + oNode.nCount; ++i)
         {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
+            if (iLevel > 0)
+                anStack.emplace_back(iLevel - 1, i);
+            else if (m_asEnvelopes[m_anItems[i]].Intersects(sFilterEnvelope))
+                anHits.push_back(m_anItems[i]);
         }
-        if (!x_geom)
+    }
+    if (anHits.empty())
+        return;
+    std::sort(anHits.begin(), anHits.end());
+
+    // Same test as OGRLayer::FilterGeometry()
+    OGRPreparedGeometryUniquePtr poPreparedFilter(OGRCreatePreparedGeometry(
+        OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poFilter))));
+    for (const size_t i : anHits)
+    {
+        OGRFeature *poFeature = m_apoFeatures[i].get();
+        OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poPreparedFilter ? OGRPreparedGeometryIntersects(
+                                   poPreparedFilter.get(),
+                                   OGRGeometry::ToHandle(poGeom))
+                             : poFilter->Intersects(poGeom))
         {
-            continue;
+            apoFeatures.push_back(poFeature);
         }
+    }
+}
 
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
+/************************************************************************/
+/*                        OGRLayerOverlayResult                         */
+/************************************************************************/
+
+/** Geometry of a feature of the result layer of an overlay operation. Its
+ * fields are set from the processed feature and, if not null, from poOther */
+struct OGRLayerOverlayResult
+{
+    OGRGeometryUniquePtr poGeom{};
+    const OGRFeature *poOther = nullptr;
+};
+
+/** Computes the results of an overlay operation for a feature of geometry
+ * x_geom, from the features of the other layer intersecting it, in their
+ * order in that layer. */
+using OGRLayerOverlayFunc = std::function<OGRErr(
+    OGRGeometry *x_geom, const std::vector<OGRFeature *> &apoOthers,
+    std::vector<OGRLayerOverlayResult> &aoResults)>;
+
+/************************************************************************/
+/*                           overlay_layers()                           */
+/************************************************************************/
+
+/** Run an overlay operation on each feature of pLayerIter, against the
+ * features of pLayerOther, and write the results in pLayerResult.
+ *
+ * Unless USE_SPATIAL_INDEX=NO, pLayerOther is loaded in memory in a spatial
+ * index, and the features of pLayerIter are processed by batches in the
+ * threads of the global thread pool (NUM_THREADS). The results are written in
+ * the same order as if the features were processed one after the other.
+ */
+static OGRErr overlay_layers(OGRLayer *pLayerIter, OGRLayer *pLayerOther,
+                             OGRGeometry *pGeometryOtherFilter,
+                             const OGREnvelope *psOtherEnvelope,
+                             OGRLayer *pLayerResult, const int *mapIter,
+                             const int *mapOther, CSLConstList papszOptions,
+                             const OGRLayerOverlayFunc &pfnProcess,
+                             GDALProgressFunc pfnProgress, void *pProgressArg,
+                             double &progress_counter, double progress_max)
+{
+    const bool bSkipFailures =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
+    const bool bPromoteToMulti = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRFeatureDefn *poDefnResult = pLayerResult->GetLayerDefn();
+
+    const auto Progress = [&]()
+    {
+        if (pfnProgress)
+        {
+            double p = progress_counter / progress_max;
+            if (p > 0 && !pfnProgress(p, "", pProgressArg))
             {
-                goto done;
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+            progress_counter += 1.0;
+        }
+        return true;
+    };
+
+    // is it worth to proceed?
+    const auto IsInOtherEnvelope = [psOtherEnvelope](const OGRGeometry *x_geom)
+    {
+        if (!psOtherEnvelope)
+            return true;
+        OGREnvelope x_env;
+        x_geom->getEnvelope(&x_env);
+        return CPL_TO_BOOL(x_env.Intersects(*psOtherEnvelope));
+    };
+
+    const auto WriteResults =
+        [&](const OGRFeature *x, std::vector<OGRLayerOverlayResult> &aoResults)
+    {
+        OGRErr ret = OGRERR_NONE;
+        for (auto &oResult : aoResults)
+        {
+            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+            z->SetFieldsFrom(x, mapIter);
+            if (oResult.poOther)
+                z->SetFieldsFrom(oResult.poOther, mapOther);
+            if (bPromoteToMulti)
+                oResult.poGeom.reset(
+                    promote_to_multi(oResult.poGeom.release()));
+            z->SetGeometryDirectly(oResult.poGeom.release());
+            ret = pLayerResult->CreateFeature(z.get());
+            if (ret != OGRERR_NONE)
+            {
+                if (!bSkipFailures)
+                    break;
+                CPLErrorReset();
+                ret = OGRERR_NONE;
             }
         }
+        aoResults.clear();
+        return ret;
+    };
 
-        for (auto &&y : pLayerMethod)
+    std::vector<OGRLayerOverlayResult> aoResults;
+
+    if (!bUseSpatialIndex)
+    {
+        std::vector<OGRFeatureUniquePtr> apoOthers;
+        std::vector<OGRFeature *> apoOtherPtrs;
+        for (auto &&x : pLayerIter)
         {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
+            if (!Progress())
+                return OGRERR_FAILURE;
+
+            if (psOtherEnvelope && (!x->GetGeometryRef() ||
+                                    !IsInOtherEnvelope(x->GetGeometryRef())))
                 continue;
-            OGRGeometryUniquePtr z_geom;
 
-            if (x_prepared_geom)
+            // set up the filter on the other layer
+            CPLErrorReset();
+            OGRGeometry *x_geom =
+                set_filter_from(pLayerOther, pGeometryOtherFilter, x.get());
+            if (CPLGetLastErrorType() != CE_None)
             {
+                if (!bSkipFailures)
+                    return OGRERR_FAILURE;
                 CPLErrorReset();
-                ret = OGRERR_NONE;
-                if (bPretestContainment &&
-                    OGRPreparedGeometryContains(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom)))
+            }
+            if (!x_geom)
+                continue;
+
+            apoOthers.clear();
+            apoOtherPtrs.clear();
+            for (auto &&y : pLayerOther)
+            {
+                if (y->GetGeometryRef())
+                {
+                    apoOtherPtrs.push_back(y.get());
+                    apoOthers.push_back(std::move(y));
+                }
+            }
+
+            OGRErr ret = pfnProcess(x_geom, apoOtherPtrs, aoResults);
+            if (ret == OGRERR_NONE)
+                ret = WriteResults(x.get(), aoResults);
+            if (ret != OGRERR_NONE)
+                return ret;
+        }
+        return OGRERR_NONE;
+    }
+
+    OGRLayerOverlayIndex oIndex;
+    if (!oIndex.Load(pLayerOther))
+        return OGRERR_NOT_ENOUGH_MEMORY;
+
+    struct Item
+    {
+        OGRFeatureUniquePtr poFeature{};
+        std::vector<OGRLayerOverlayResult> aoResults{};
+        OGRErr eErr = OGRERR_NONE;
+    };
+
+    const auto ProcessItem = [&](Item &oItem)
+    {
+        OGRGeometry *x_geom = oItem.poFeature->GetGeometryRef();
+        if (!x_geom || !IsInOtherEnvelope(x_geom))
+            return;
+
+        // same filter as set_filter_from()
+        CPLErrorReset();
+        OGRGeometryUniquePtr poFilterOwner;
+        const OGRGeometry *poFilter = x_geom;
+        if (pGeometryOtherFilter)
+        {
+            poFilter = nullptr;
+            if (x_geom->Intersects(pGeometryOtherFilter))
+            {
+                poFilterOwner.reset(x_geom->Intersection(pGeometryOtherFilter));
+                poFilter = poFilterOwner.get();
+            }
+        }
+        if (CPLGetLastErrorType() != CE_None)
+        {
+            if (!bSkipFailures)
+            {
+                oItem.eErr = OGRERR_FAILURE;
+                return;
+            }
+            CPLErrorReset();
+        }
+        if (!poFilter)
+            return;
+
+        std::vector<OGRFeature *> apoOthers;
+        oIndex.Query(poFilter, apoOthers);
+        oItem.eErr = pfnProcess(x_geom, apoOthers, oItem.aoResults);
+    };
+
+    const int nThreads = GDALGetNumThreads(
+        papszOptions, "NUM_THREADS", GDAL_DEFAULT_MAX_THREAD_COUNT,
+        /* bDefaultAllCPUs = */ false);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    // Number of features read before being processed in parallel
+    const size_t nBatchSize =
+        poJobQueue ? static_cast<size_t>(nThreads) * 256 : 1;
+    std::vector<Item> aoBatch;
+
+    const auto ProcessBatch = [&]()
+    {
+        if (poJobQueue && aoBatch.size() > 1)
+        {
+            CPLErrorAccumulator oErrorAccumulator;
+            const size_t nJobs =
+                std::min(aoBatch.size(), static_cast<size_t>(nThreads) * 4);
+            for (size_t iJob = 0; iJob < nJobs; ++iJob)
+            {
+                const size_t nStart = aoBatch.size() * iJob / nJobs;
+                const size_t nEnd = aoBatch.size() * (iJob + 1) / nJobs;
+                poJobQueue->SubmitJob(
+                    [&aoBatch, &ProcessItem, &oErrorAccumulator, nStart, nEnd]()
+                    {
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        for (size_t i = nStart; i < nEnd; ++i)
+                            ProcessItem(aoBatch[i]);
+                    });
+            }
+            poJobQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+            if (bSkipFailures)
+                CPLErrorReset();
+        }
+        else
+        {
+            for (auto &oItem : aoBatch)
+                ProcessItem(oItem);
+        }
+
+        OGRErr ret = OGRERR_NONE;
+        for (auto &oItem : aoBatch)
+        {
+            if (!Progress())
+                ret = OGRERR_FAILURE;
+            else if (oItem.eErr != OGRERR_NONE)
+                ret = oItem.eErr;
+            else
+                ret = WriteResults(oItem.poFeature.get(), oItem.aoResults);
+            if (ret != OGRERR_NONE)
+                break;
+        }
+        aoBatch.clear();
+        return ret;
+    };
+
+    for (auto &&x : pLayerIter)
+    {
+        aoBatch.emplace_back();
+        aoBatch.back().poFeature = std::move(x);
+        if (aoBatch.size() == nBatchSize)
+        {
+            const OGRErr ret = ProcessBatch();
+            if (ret != OGRERR_NONE)
+                return ret;
+        }
+    }
+    return ProcessBatch();
+}
+
+/************************************************************************/
+/*                          overlay_identity()                          */
+/************************************************************************/
+
+/** Intersections of x_geom with each of apoOthers, followed by the part of
+ * x_geom outside of them. */
+static OGRErr overlay_identity(OGRGeometry *x_geom,
+                               const std::vector<OGRFeature *> &apoOthers,
+                               std::vector<OGRLayerOverlayResult> &aoResults,
+                               bool bSkipFailures, bool bUsePreparedGeometries,
+                               bool bKeepLowerDimGeom)
+{
+    OGRPreparedGeometryUniquePtr x_prepared_geom;
+    if (bUsePreparedGeometries)
+    {
+        x_prepared_geom.reset(
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+        if (!x_prepared_geom)
+        {
+            return OGRERR_FAILURE;
+        }
+    }
+
+    OGRGeometryUniquePtr x_geom_diff(
+        x_geom->clone());  // this will be the geometry of the result feature
+    for (OGRFeature *y : apoOthers)
+    {
+        OGRGeometry *y_geom = y->GetGeometryRef();
+
+        CPLErrorReset();
+        if (x_prepared_geom &&
+            !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
+                                            OGRGeometry::ToHandle(y_geom))))
+        {
+            if (CPLGetLastErrorType() == CE_None)
+            {
+                continue;
+            }
+        }
+        if (CPLGetLastErrorType() != CE_None)
+        {
+            if (!bSkipFailures)
+                return OGRERR_FAILURE;
+            CPLErrorReset();
+        }
+
+        CPLErrorReset();
+        OGRGeometryUniquePtr poIntersection(x_geom->Intersection(y_geom));
+        if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
+        {
+            if (!bSkipFailures)
+                return OGRERR_FAILURE;
+            CPLErrorReset();
+            continue;
+        }
+        if (poIntersection->IsEmpty() ||
+            (!bKeepLowerDimGeom &&
+             (x_geom->getDimension() == y_geom->getDimension() &&
+              poIntersection->getDimension() < x_geom->getDimension())))
+        {
+            continue;
+        }
+
+        if (x_geom_diff)
+        {
+            CPLErrorReset();
+            OGRGeometryUniquePtr x_geom_diff_new(
+                x_geom_diff->Difference(y_geom));
+            if (CPLGetLastErrorType() != CE_None || x_geom_diff_new == nullptr)
+            {
+                if (!bSkipFailures)
+                    return OGRERR_FAILURE;
+                CPLErrorReset();
+            }
+            else
+            {
+                x_geom_diff.swap(x_geom_diff_new);
+            }
+        }
+
+        aoResults.push_back({std::move(poIntersection), y});
+    }
+
+    if (x_geom_diff && !x_geom_diff->IsEmpty())
+        aoResults.push_back({std::move(x_geom_diff), nullptr});
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         overlay_difference()                         */
+/************************************************************************/
+
+/** Part of x_geom outside of apoOthers. */
+static OGRErr overlay_difference(OGRGeometry *x_geom,
+                                 const std::vector<OGRFeature *> &apoOthers,
+                                 std::vector<OGRLayerOverlayResult> &aoResults,
+                                 bool bSkipFailures)
+{
+    OGRGeometryUniquePtr geom(
+        x_geom->clone());  // this will be the geometry of the result feature
+    // incrementally erase y from geom
+    for (OGRFeature *y : apoOthers)
+    {
+        CPLErrorReset();
+        OGRGeometryUniquePtr geom_new(geom->Difference(y->GetGeometryRef()));
+        if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+        {
+            if (!bSkipFailures)
+                return OGRERR_FAILURE;
+            CPLErrorReset();
+        }
+        else
+        {
+            geom.swap(geom_new);
+            if (geom->IsEmpty())
+                break;
+        }
+    }
+
+    // add a new feature if there is remaining area
+    if (!geom->IsEmpty())
+        aoResults.push_back({std::move(geom), nullptr});
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            Intersection()                            */
+/************************************************************************/
+/**
+ * \brief Intersection of two layers.
+ *
+ * The result layer contains features whose geometries represent areas
+ * that are common between features in the input layer and in the
+ * method layer. The features in the result layer have attributes from
+ * both input and method layers. The schema of the result layer can be
+ * set by the user or, if it is empty, is initialized to contain all
+ * fields in the input and method layers.
+ *
+ * \note If the schema of the result is set by user and contains
+ * fields that have the same name as a field in input and in method
+ * layer, then the attribute in the result feature will get the value
+ * from the feature of the method layer.
+ *
+ * \note For best performance use the minimum amount of features in
+ * the method layer and copy it into a memory layer.
+ *
+ * \note This method relies on GEOS support. Do not use unless the
+ * GEOS support is compiled in.
+ *
+ * The recognized list of options is:
+ * <ul>
+ * <li>SKIP_FAILURES=YES/NO. Set to YES to go on, even when a
+ *     feature could not be inserted or a GEOS call failed.
+ * </li>
+ * <li>PROMOTE_TO_MULTI=YES/NO. Set to YES to convert Polygons
+ *     into MultiPolygons, LineStrings to MultiLineStrings or
+ *     Points to MultiPoints (only since GDAL 3.9.2 for the later)
+ * </li>
+ * <li>INPUT_PREFIX=string. Set a prefix for the field names that
+ *     will be created from the fields of the input layer.
+ * </li>
+ * <li>METHOD_PREFIX=string. Set a prefix for the field names that
+ *     will be created from the fields of the method layer.
+ * </li>
+ * <li>USE_PREPARED_GEOMETRIES=YES/NO. Set to NO to not use prepared
+ *     geometries to pretest intersection of features of method layer
+ *     with features of this layer.
+ * </li>
+ * <li>PRETEST_CONTAINMENT=YES/NO. Set to YES to pretest the
+ *     containment of features of method layer within the features of
+ *     this layer. This will speed up the method significantly in some
+ *     cases. Requires that the prepared geometries are in effect.
+ * </li>
+ * <li>KEEP_LOWER_DIMENSION_GEOMETRIES=YES/NO. Set to NO to skip
+ *     result features with lower dimension geometry that would
+ *     otherwise be added to the result layer. The default is YES, to add
+ *     features with lower dimension geometry, but only if the result layer
+ *     has an unknown geometry type.
+ * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
+ * </ul>
+ *
+ * This method is the same as the C function OGR_L_Intersection().
+ *
+ * @param pLayerMethod the method layer. Should not be NULL.
+ *
+ * @param pLayerResult the layer where the features resulting from the
+ * operation are inserted. Should not be NULL. See above the note
+ * about the schema.
+ *
+ * @param papszOptions NULL terminated list of options (may be NULL).
+ *
+ * @param pfnProgress a GDALProgressFunc() compatible callback function for
+ * reporting progress or NULL.
+ *
+ * @param pProgressArg argument to be passed to pfnProgress. May be NULL.
+ *
+ * @return an error code if there was an error or the execution was
+ * interrupted, OGRERR_NONE otherwise.
+ *
+ * @note The first geometry field is always used.
+ *
+ * @since OGR 1.10
+ */
+
+OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
+                              CSLConstList papszOptions,
+                              GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    OGRErr ret = OGRERR_NONE;
+    OGRFeatureDefn *poDefnInput = GetLayerDefn();
+    OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
+    OGRGeometry *pGeometryMethodFilter = nullptr;
+    int *mapInput = nullptr;
+    int *mapMethod = nullptr;
+    OGREnvelope sEnvelopeMethod;
+    GBool bEnvelopeSet;
+    double progress_max = static_cast<double>(GetFeatureCount(FALSE));
+    double progress_counter = 0;
+    const bool bSkipFailures =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
+    const bool bUsePreparedGeometries = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
+    const bool bPretestContainment = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "PRETEST_CONTAINMENT", "NO"));
+    bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
+        papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "OGRLayer::Intersection() requires GEOS support");
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
+
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
+    if (bKeepLowerDimGeom)
+    {
+        // require that the result layer is of geom type unknown
+        if (pLayerResult->GetGeomType() != wkbUnknown)
+        {
+            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
+                            "since the result layer does not allow it.");
+            bKeepLowerDimGeom = false;
+        }
+    }
+
+    {
+        const auto Process =
+            [bSkipFailures, bUsePreparedGeometries, bPretestContainment,
+             bKeepLowerDimGeom](OGRGeometry *x_geom,
+                                const std::vector<OGRFeature *> &apoMethod,
+                                std::vector<OGRLayerOverlayResult> &aoResults)
+        {
+            OGRPreparedGeometryUniquePtr x_prepared_geom;
+            if (bUsePreparedGeometries)
+            {
+                x_prepared_geom.reset(
+                    OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+                if (!x_prepared_geom)
                 {
-                    if (CPLGetLastErrorType() == CE_None)
-                        z_geom.reset(y_geom->clone());
+                    return OGRERR_FAILURE;
                 }
-                else if (!(OGRPreparedGeometryIntersects(
-                             x_prepared_geom.get(),
-                             OGRGeometry::ToHandle(y_geom))))
+            }
+
+            for (OGRFeature *y : apoMethod)
+            {
+                OGRGeometry *y_geom = y->GetGeometryRef();
+                OGRGeometryUniquePtr z_geom;
+
+                if (x_prepared_geom)
                 {
-                    if (CPLGetLastErrorType() == CE_None)
+                    CPLErrorReset();
+                    if (bPretestContainment &&
+                        OGRPreparedGeometryContains(
+                            x_prepared_geom.get(),
+                            OGRGeometry::ToHandle(y_geom)))
                     {
-                        continue;
+                        if (CPLGetLastErrorType() == CE_None)
+                            z_geom.reset(y_geom->clone());
                     }
-                }
-                if (CPLGetLastErrorType() != CE_None)
-                {
-                    if (!bSkipFailures)
+                    else if (!(OGRPreparedGeometryIntersects(
+                                 x_prepared_geom.get(),
+                                 OGRGeometry::ToHandle(y_geom))))
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        if (CPLGetLastErrorType() == CE_None)
+                        {
+                            continue;
+                        }
                     }
-                    else
+                    if (CPLGetLastErrorType() != CE_None)
                     {
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                         continue;
                     }
                 }
-            }
-            if (!z_geom)
-            {
-                CPLErrorReset();
-                z_geom.reset(x_geom->Intersection(y_geom));
-                if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
+                if (!z_geom)
                 {
-                    if (!bSkipFailures)
+                    CPLErrorReset();
+                    z_geom.reset(x_geom->Intersection(y_geom));
+                    if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
+                        CPLErrorReset();
+                        continue;
                     }
-                    else
+                    if (z_geom->IsEmpty() ||
+                        (!bKeepLowerDimGeom &&
+                         (x_geom->getDimension() == y_geom->getDimension() &&
+                          z_geom->getDimension() < x_geom->getDimension())))
                     {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
                         continue;
                     }
                 }
-                if (z_geom->IsEmpty() ||
-                    (!bKeepLowerDimGeom &&
-                     (x_geom->getDimension() == y_geom->getDimension() &&
-                      z_geom->getDimension() < x_geom->getDimension())))
-                {
-                    continue;
-                }
-            }
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            z->SetFieldsFrom(y.get(), mapMethod);
-            if (bPromoteToMulti)
-                z_geom.reset(promote_to_multi(z_geom.release()));
-            z->SetGeometryDirectly(z_geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
+                aoResults.push_back({std::move(z_geom), y});
             }
-        }
+            return OGRERR_NONE;
+        };
+
+        ret = overlay_layers(this, pLayerMethod, pGeometryMethodFilter,
+                             bEnvelopeSet ? &sEnvelopeMethod : nullptr,
+                             pLayerResult, mapInput, mapMethod, papszOptions,
+                             Process, pfnProgress, pProgressArg,
+                             progress_counter, progress_max);
+        if (ret != OGRERR_NONE)
+            goto done;
     }
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
@@ -5679,6 +6355,14 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -5775,6 +6459,14 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -5807,7 +6499,6 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRErr ret = OGRERR_NONE;
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
@@ -5816,346 +6507,81 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
     const bool bUsePreparedGeometries = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
     // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "OGRLayer::Union() requires GEOS support");
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(this, &pGeometryInputFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-    if (bKeepLowerDimGeom)
-    {
-        // require that the result layer is of geom type unknown
-        if (pLayerResult->GetGeomType() != wkbUnknown)
-        {
-            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
-                            "since the result layer does not allow it.");
-            bKeepLowerDimGeom = FALSE;
-        }
-    }
-
-    // add features based on input layer
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
-            {
-                goto done;
-            }
-        }
-
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
-
-            CPLErrorReset();
-            if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom))))
-            {
-                if (CPLGetLastErrorType() == CE_None)
-                {
-                    continue;
-                }
-            }
-            if (CPLGetLastErrorType() != CE_None)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(x_geom->Intersection(y_geom));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                    continue;
-                }
-            }
-            if (poIntersection->IsEmpty() ||
-                (!bKeepLowerDimGeom &&
-                 (x_geom->getDimension() == y_geom->getDimension() &&
-                  poIntersection->getDimension() < x_geom->getDimension())))
-            {
-                // ok
-            }
-            else
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-
-                if (x_geom_diff)
-                {
-                    CPLErrorReset();
-                    OGRGeometryUniquePtr x_geom_diff_new(
-                        x_geom_diff->Difference(y_geom));
-                    if (CPLGetLastErrorType() != CE_None ||
-                        x_geom_diff_new == nullptr)
-                    {
-                        if (!bSkipFailures)
-                        {
-                            ret = OGRERR_FAILURE;
-                            goto done;
-                        }
-                        else
-                        {
-                            CPLErrorReset();
-                        }
-                    }
-                    else
-                    {
-                        x_geom_diff.swap(x_geom_diff_new);
-                    }
-                }
-
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-            }
-        }
-        x_prepared_geom.reset();
-
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            // ok
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
-
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on input layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "OGRLayer::Union() requires GEOS support");
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
 
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+    // get resources
+    ret = clone_spatial_filter(this, &pGeometryInputFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    if (bKeepLowerDimGeom)
+    {
+        // require that the result layer is of geom type unknown
+        if (pLayerResult->GetGeomType() != wkbUnknown)
         {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
-
-            if (x_geom_diff)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr x_geom_diff_new(
-                    x_geom_diff->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None ||
-                    x_geom_diff_new == nullptr)
-                {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-                else
-                {
-                    x_geom_diff.swap(x_geom_diff_new);
-                }
-            }
+            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
+                            "since the result layer does not allow it.");
+            bKeepLowerDimGeom = FALSE;
         }
+    }
 
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
+    // add features based on input layer
+    ret = overlay_layers(
+        this, pLayerMethod, pGeometryMethodFilter, nullptr, pLayerResult,
+        mapInput, mapMethod, papszOptions,
+        [bSkipFailures, bUsePreparedGeometries,
+         bKeepLowerDimGeom](OGRGeometry *x_geom,
+                            const std::vector<OGRFeature *> &apoMethod,
+                            std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            // ok
-        }
-        else
+            return overlay_identity(x_geom, apoMethod, aoResults, bSkipFailures,
+                                    bUsePreparedGeometries, bKeepLowerDimGeom);
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    // restore filter on method layer and add features based on it
+    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    ret = overlay_layers(
+        pLayerMethod, this, pGeometryInputFilter, nullptr, pLayerResult,
+        mapMethod, nullptr, papszOptions,
+        [bSkipFailures](OGRGeometry *x_geom,
+                        const std::vector<OGRFeature *> &apoInput,
+                        std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
+            return overlay_difference(x_geom, apoInput, aoResults,
+                                      bSkipFailures);
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -6229,6 +6655,14 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -6312,6 +6746,14 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -6344,246 +6786,65 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRErr ret = OGRERR_NONE;
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     double progress_max =
-        static_cast<double>(GetFeatureCount(FALSE)) +
-        static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
-    const bool bSkipFailures =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
-
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "OGRLayer::SymDifference() requires GEOS support");
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(this, &pGeometryInputFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-
-    // add features based on input layer
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
-            if (geom)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
-                {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-                else
-                {
-                    geom.swap(geom_new);
-                }
-            }
-            if (geom && geom->IsEmpty())
-                break;
-        }
-
-        if (geom && !geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
-
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on input layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (geom)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
-                {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-                else
-                {
-                    geom.swap(geom_new);
-                }
-            }
-            if (geom == nullptr || geom->IsEmpty())
-                break;
-        }
+        static_cast<double>(GetFeatureCount(FALSE)) +
+        static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
+    double progress_counter = 0;
+    const bool bSkipFailures =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
+    const auto Process =
+        [bSkipFailures](OGRGeometry *x_geom,
+                        const std::vector<OGRFeature *> &apoOthers,
+                        std::vector<OGRLayerOverlayResult> &aoResults)
+    { return overlay_difference(x_geom, apoOthers, aoResults, bSkipFailures); };
 
-        if (geom && !geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "OGRLayer::SymDifference() requires GEOS support");
+        return OGRERR_UNSUPPORTED_OPERATION;
     }
+
+    // get resources
+    ret = clone_spatial_filter(this, &pGeometryInputFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    // add features based on input layer
+    ret = overlay_layers(this, pLayerMethod, pGeometryMethodFilter, nullptr,
+                         pLayerResult, mapInput, nullptr, papszOptions, Process,
+                         pfnProgress, pProgressArg, progress_counter,
+                         progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    // restore filter on method layer and add features based on it
+    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    ret = overlay_layers(pLayerMethod, this, pGeometryInputFilter, nullptr,
+                         pLayerResult, mapMethod, nullptr, papszOptions,
+                         Process, pfnProgress, pProgressArg, progress_counter,
+                         progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -6647,6 +6908,14 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -6742,6 +7011,14 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -6774,17 +7051,13 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRErr ret = OGRERR_NONE;
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
     const bool bUsePreparedGeometries = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
@@ -6822,192 +7095,23 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                             mapMethod, true, papszOptions);
     if (ret != OGRERR_NONE)
         goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
 
     // split the features in input layer to the result layer
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
-            {
-                goto done;
-            }
-        }
-
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+    ret = overlay_layers(
+        this, pLayerMethod, pGeometryMethodFilter, nullptr, pLayerResult,
+        mapInput, mapMethod, papszOptions,
+        [bSkipFailures, bUsePreparedGeometries,
+         bKeepLowerDimGeom](OGRGeometry *x_geom,
+                            const std::vector<OGRFeature *> &apoMethod,
+                            std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-
-            CPLErrorReset();
-            if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom))))
-            {
-                if (CPLGetLastErrorType() == CE_None)
-                {
-                    continue;
-                }
-            }
-            if (CPLGetLastErrorType() != CE_None)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(x_geom->Intersection(y_geom));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-            else if (poIntersection->IsEmpty() ||
-                     (!bKeepLowerDimGeom &&
-                      (x_geom->getDimension() == y_geom->getDimension() &&
-                       poIntersection->getDimension() <
-                           x_geom->getDimension())))
-            {
-                /* ok*/
-            }
-            else
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-                if (x_geom_diff)
-                {
-                    CPLErrorReset();
-                    OGRGeometryUniquePtr x_geom_diff_new(
-                        x_geom_diff->Difference(y_geom));
-                    if (CPLGetLastErrorType() != CE_None ||
-                        x_geom_diff_new == nullptr)
-                    {
-                        if (!bSkipFailures)
-                        {
-                            ret = OGRERR_FAILURE;
-                            goto done;
-                        }
-                        else
-                        {
-                            CPLErrorReset();
-                        }
-                    }
-                    else
-                    {
-                        x_geom_diff.swap(x_geom_diff_new);
-                    }
-                }
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-            }
-        }
-
-        x_prepared_geom.reset();
+            return overlay_identity(x_geom, apoMethod, aoResults, bSkipFailures,
+                                    bUsePreparedGeometries, bKeepLowerDimGeom);
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
 
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            /* ok */
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -7076,6 +7180,14 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -7160,6 +7272,14 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -7203,133 +7323,45 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
-
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "OGRLayer::Update() requires GEOS support");
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, false, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-
-    // add clipped features from the input layer
-    for (auto &&x : this)
-    {
 
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "OGRLayer::Update() requires GEOS support");
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
 
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom->clone());  // this will be the geometry of a result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (x_geom_diff)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr x_geom_diff_new(
-                    x_geom_diff->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None ||
-                    x_geom_diff_new == nullptr)
-                {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
-                else
-                {
-                    x_geom_diff.swap(x_geom_diff_new);
-                }
-            }
-        }
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, false, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
 
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            /* ok */
-        }
-        else
+    // add clipped features from the input layer
+    ret = overlay_layers(
+        this, pLayerMethod, pGeometryMethodFilter, nullptr, pLayerResult,
+        mapInput, nullptr, papszOptions,
+        [bSkipFailures](OGRGeometry *x_geom,
+                        const std::vector<OGRFeature *> &apoMethod,
+                        std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
+            return overlay_difference(x_geom, apoMethod, aoResults,
+                                      bSkipFailures);
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
 
     // restore the original filter and add features from the update layer
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
@@ -7432,6 +7464,14 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -7509,6 +7549,14 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -7540,16 +7588,12 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 {
     OGRErr ret = OGRERR_NONE;
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
@@ -7570,126 +7614,65 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
 
-    poDefnResult = pLayerResult->GetLayerDefn();
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
+    ret = overlay_layers(
+        this, pLayerMethod, pGeometryMethodFilter, nullptr, pLayerResult,
+        mapInput, nullptr, papszOptions,
+        [bSkipFailures](OGRGeometry *x_geom,
+                        const std::vector<OGRFeature *> &apoMethod,
+                        std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+            OGRGeometryUniquePtr
+                geom;  // this will be the geometry of the result feature
+            // incrementally add area from y to geom
+            for (OGRFeature *y : apoMethod)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                OGRGeometry *y_geom = y->GetGeometryRef();
+                if (!geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    geom.reset(y_geom->clone());
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr
-            geom;  // this will be the geometry of the result feature
-        // incrementally add area from y to geom
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (!geom)
-            {
-                geom.reset(y_geom->clone());
-            }
-            else
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+                else
                 {
-                    if (!bSkipFailures)
+                    CPLErrorReset();
+                    OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
+                    if (CPLGetLastErrorType() != CE_None ||
+                        geom_new == nullptr)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
+                        CPLErrorReset();
                     }
                     else
                     {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        geom.swap(geom_new);
                     }
                 }
-                else
-                {
-                    geom.swap(geom_new);
-                }
             }
-        }
 
-        // possibly add a new feature with area x intersection sum of y
-        if (geom)
-        {
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(
-                x_geom->Intersection(geom.get()));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
+            // possibly add a new feature with area x intersection sum of y
+            if (geom)
             {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
+                CPLErrorReset();
+                OGRGeometryUniquePtr poIntersection(
+                    x_geom->Intersection(geom.get()));
+                if (CPLGetLastErrorType() != CE_None ||
+                    poIntersection == nullptr)
                 {
+                    if (!bSkipFailures)
+                        return OGRERR_FAILURE;
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
-            }
-            else if (!poIntersection->IsEmpty())
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
+                else if (!poIntersection->IsEmpty())
                 {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
+                    aoResults.push_back({std::move(poIntersection), nullptr});
                 }
             }
-        }
-    }
+            return OGRERR_NONE;
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -7741,6 +7724,14 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -7818,6 +7809,14 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -7849,16 +7848,12 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 {
     OGRErr ret = OGRERR_NONE;
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
-    OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
-    const bool bPromoteToMulti = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
@@ -7879,105 +7874,21 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                             nullptr, false, papszOptions);
     if (ret != OGRERR_NONE)
         goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on the method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
 
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        // incrementally erase y from geom
-        for (auto &&y : pLayerMethod)
+    ret = overlay_layers(
+        this, pLayerMethod, pGeometryMethodFilter, nullptr, pLayerResult,
+        mapInput, nullptr, papszOptions,
+        [bSkipFailures](OGRGeometry *x_geom,
+                        const std::vector<OGRFeature *> &apoMethod,
+                        std::vector<OGRLayerOverlayResult> &aoResults)
         {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            CPLErrorReset();
-            OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-            if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-            else
-            {
-                geom.swap(geom_new);
-                if (geom->IsEmpty())
-                {
-                    break;
-                }
-            }
-        }
+            return overlay_difference(x_geom, apoMethod, aoResults,
+                                      bSkipFailures);
+        },
+        pfnProgress, pProgressArg, progress_counter, progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
 
-        // add a new feature if there is remaining area
-        if (!geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -8029,6 +7940,14 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to query the method layer
+ *     with a spatial filter for each feature of this layer, instead of
+ *     loading it in memory in a spatial index (since GDAL 3.14)
+ * </li>
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process
+ *     the features of this layer when the spatial index is used. Defaults
+ *     to the GDAL_NUM_THREADS configuration option (since GDAL 3.14)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -8084,6 +8003,7 @@ struct OGRLayer::FeatureIterator::Private
     OGRLayer *m_poLayer = nullptr;
     bool m_bError = false;
     bool m_bEOF = true;
+    bool m_bRecycleFeature = false;
 };
 
 /************************************************************************/
@@ -8091,9 +8011,16 @@ struct OGRLayer::FeatureIterator::Private
 /************************************************************************/
 
 OGRLayer::FeatureIterator::FeatureIterator(OGRLayer *poLayer, bool bStart)
+    : FeatureIterator(poLayer, bStart, false)
+{
+}
+
+OGRLayer::FeatureIterator::FeatureIterator(OGRLayer *poLayer, bool bStart,
+                                           bool bRecycleFeature)
     : m_poPrivate(new OGRLayer::FeatureIterator::Private())
 {
     m_poPrivate->m_poLayer = poLayer;
+    m_poPrivate->m_bRecycleFeature = bRecycleFeature;
     if (bStart)
     {
         if (m_poPrivate->m_poLayer->m_poPrivate->m_bInFeatureIterator)
@@ -8139,8 +8066,20 @@ OGRFeatureUniquePtr &OGRLayer::FeatureIterator::operator*()
 
 OGRLayer::FeatureIterator &OGRLayer::FeatureIterator::operator++()
 {
-    m_poPrivate->m_poFeature.reset(m_poPrivate->m_poLayer->GetNextFeature());
-    m_poPrivate->m_bEOF = m_poPrivate->m_poFeature == nullptr;
+    auto &poFeature = m_poPrivate->m_poFeature;
+    auto poLayer = m_poPrivate->m_poLayer;
+    // Recycle the current feature, unless the caller took ownership of it.
+    if (m_poPrivate->m_bRecycleFeature && poFeature &&
+        poFeature->GetDefnRef() == poLayer->GetLayerDefn())
+    {
+        if (!poLayer->GetNextFeatureInto(poFeature.get()))
+            poFeature.reset();
+    }
+    else
+    {
+        poFeature.reset(poLayer->GetNextFeature());
+    }
+    m_poPrivate->m_bEOF = poFeature == nullptr;
     return *this;
 }
 
@@ -8172,6 +8111,37 @@ OGRLayer::FeatureIterator OGRLayer::end()
     return {this, false};
 }
 
+/************************************************************************/
+/*                   OGRLayer::GetRecycledFeatures()                    */
+/************************************************************************/
+
+/**
+ \brief Return a range of features that recycles the feature of the iterator.
+
+ Contrary to iterating directly over the layer, which returns a new feature
+ at each step, the iterator of this range reads the next feature into the
+ current one with GetNextFeatureInto(). The feature is thus only valid until
+ the next step. A caller may still take ownership of it with release(), in
+ which case a new feature is allocated for the next step.
+
+ Typical usage is:
+ \code{.cpp}
+ for (const auto &poFeature : poLayer->GetRecycledFeatures())
+ {
+     // do something with poFeature
+ }
+ \endcode
+
+ The same restrictions as OGRLayer::begin() apply.
+
+ @since GDAL 3.14
+*/
+
+OGRLayer::RecycledFeatureRange OGRLayer::GetRecycledFeatures()
+{
+    return RecycledFeatureRange(this);
+}
+
 /************************************************************************/
 /*                     OGRLayer::GetGeometryTypes()                     */
 /************************************************************************/
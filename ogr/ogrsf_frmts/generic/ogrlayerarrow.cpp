@@ -23,6 +23,7 @@
 
 #include "cpl_float.h"
 #include "cpl_json.h"
+#include "cpl_safemaths.hpp"
 #include "cpl_time.h"
 
 #include <algorithm>
@@ -5178,6 +5179,1077 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                        OGRArrowColumnarValue                         */
+/************************************************************************/
+
+namespace
+{
+
+/** Values taken by a swq expression node on all the rows of an Arrow batch.
+ *
+ * Mirrors the int_value / float_value / string_value / is_null members of the
+ * swq_expr_node returned by swq_expr_node::Evaluate() for a single feature.
+ */
+struct OGRArrowColumnarValue
+{
+    enum class Type
+    {
+        INTEGER,  // also used for booleans
+        FLOAT,
+        STRING
+    };
+
+    Type eType = Type::INTEGER;
+
+    //! If true, vectors have a single element, valid for all rows
+    bool bConstant = false;
+
+    std::vector<int64_t> anValues{};
+    std::vector<double> adfValues{};
+    std::vector<std::string_view> aosValues{};
+    std::vector<uint8_t> abyNull{};
+
+    inline size_t Idx(size_t i) const
+    {
+        return bConstant ? 0 : i;
+    }
+
+    inline bool IsNull(size_t i) const
+    {
+        return abyNull[Idx(i)] != 0;
+    }
+
+    void PromoteToFloat()
+    {
+        if (eType == Type::INTEGER)
+        {
+            adfValues.resize(anValues.size());
+            for (size_t i = 0; i < anValues.size(); ++i)
+                adfValues[i] = static_cast<double>(anValues[i]);
+            eType = Type::FLOAT;
+        }
+    }
+};
+
+template <class T>
+inline T GetColumnarValue(const OGRArrowColumnarValue &oVal, size_t i);
+
+template <>
+inline int64_t GetColumnarValue<int64_t>(const OGRArrowColumnarValue &oVal,
+                                         size_t i)
+{
+    return oVal.anValues[oVal.Idx(i)];
+}
+
+template <>
+inline double GetColumnarValue<double>(const OGRArrowColumnarValue &oVal,
+                                       size_t i)
+{
+    return oVal.adfValues[oVal.Idx(i)];
+}
+
+template <>
+inline std::string_view
+GetColumnarValue<std::string_view>(const OGRArrowColumnarValue &oVal, size_t i)
+{
+    return oVal.aosValues[oVal.Idx(i)];
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                          GetColumnarType()                           */
+/************************************************************************/
+
+static bool GetColumnarType(swq_field_type eFieldType,
+                            OGRArrowColumnarValue::Type &eType)
+{
+    switch (eFieldType)
+    {
+        case SWQ_INTEGER:
+        case SWQ_INTEGER64:
+        case SWQ_BOOLEAN:
+            eType = OGRArrowColumnarValue::Type::INTEGER;
+            return true;
+        case SWQ_FLOAT:
+            eType = OGRArrowColumnarValue::Type::FLOAT;
+            return true;
+        case SWQ_STRING:
+            eType = OGRArrowColumnarValue::Type::STRING;
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       IsCompatibleArrowFormat()                      */
+/************************************************************************/
+
+/** Whether values of an Arrow array of that format, once set in a OGRFeature
+ * as FillValidityArrayFromAttrQuery() does, are fetched by OGRFeatureFetcher()
+ * without any conversion other than widening.
+ */
+static bool IsCompatibleArrowFormat(swq_field_type eFieldType,
+                                    const char *format)
+{
+    const bool bSmallInt = IsBoolean(format) || IsInt8(format) ||
+                           IsUInt8(format) || IsInt16(format) ||
+                           IsUInt16(format) || IsInt32(format);
+    switch (eFieldType)
+    {
+        case SWQ_INTEGER:
+        case SWQ_BOOLEAN:
+            return bSmallInt;
+        case SWQ_INTEGER64:
+            return bSmallInt || IsUInt32(format) || IsInt64(format);
+        case SWQ_FLOAT:
+            return (bSmallInt && !IsBoolean(format)) || IsUInt32(format) ||
+                   IsInt64(format) || IsUInt64(format) || IsFloat32(format) ||
+                   IsFloat64(format);
+        case SWQ_STRING:
+            return IsString(format) || IsLargeString(format) ||
+                   IsStringView(format);
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           TruncateAtNul()                            */
+/************************************************************************/
+
+/** OGRFeatureFetcher() returns C strings, which stop at the first nul
+ * character. */
+static inline std::string_view TruncateAtNul(std::string_view s)
+{
+    const auto nPos = s.find('\0');
+    return nPos == std::string_view::npos ? s : s.substr(0, nPos);
+}
+
+/************************************************************************/
+/*                            CompareNoCase()                           */
+/************************************************************************/
+
+/** Equivalent of strcasecmp() */
+static int CompareNoCase(std::string_view a, std::string_view b)
+{
+    const size_t nLen = std::min(a.size(), b.size());
+    for (size_t i = 0; i < nLen; ++i)
+    {
+        const int ca = CPLTolower(static_cast<unsigned char>(a[i]));
+        const int cb = CPLTolower(static_cast<unsigned char>(b[i]));
+        if (ca != cb)
+            return ca - cb;
+    }
+    return a.size() < b.size() ? -1 : a.size() > b.size() ? 1 : 0;
+}
+
+/** Equivalent of EQUALN(a, b, n) */
+static bool EqualNNoCase(std::string_view a, std::string_view b, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        const int ca =
+            i < a.size() ? CPLTolower(static_cast<unsigned char>(a[i])) : 0;
+        const int cb =
+            i < b.size() ? CPLTolower(static_cast<unsigned char>(b[i])) : 0;
+        if (ca != cb)
+            return false;
+        if (ca == 0)
+            break;
+    }
+    return true;
+}
+
+/** String equality as done by SWQGeneralEvaluator(), which ignores a
+ * trailing "+00" timezone when the other member has no timezone. */
+static bool EqualStrings(std::string_view a, std::string_view b)
+{
+    if (a.size() > 3 && b.size() > 3)
+    {
+        if (a.substr(a.size() - 3) == "+00" && b[b.size() - 3] == ':')
+            return EqualNNoCase(a, b, b.size());
+        if (a[a.size() - 3] == ':' && b.substr(b.size() - 3) == "+00")
+            return EqualNNoCase(a, b, a.size());
+    }
+    return CompareNoCase(a, b) == 0;
+}
+
+/************************************************************************/
+/*                      OGRArrowColumnarEvaluator                       */
+/************************************************************************/
+
+namespace
+{
+
+/** Evaluates swq expressions directly on the arrays of an Arrow batch,
+ * instead of building a OGRFeature for each row.
+ *
+ * Only handles a subset of the expressions (comparisons, IN, BETWEEN, LIKE,
+ * IS NULL, AND, OR, NOT and arithmetic operations on integer, real and
+ * string columns), with the same semantics as SWQGeneralEvaluator(),
+ * including regarding null values.
+ */
+class OGRArrowColumnarEvaluator
+{
+    const OGRFeatureDefn *const m_poFeatureDefn;
+    const struct ArrowSchema *const m_schema;
+    const struct ArrowArray *const m_array;
+    const std::map<std::string, std::vector<int>> &m_oMapFieldNameToArrowPath;
+    const GIntBig m_nBaseSeqFID;
+    const std::vector<int> &m_anArrowPathToFIDColumn;
+    //! Rows on which the per-feature evaluation would have been done
+    const std::vector<bool> m_abyCandidates;
+    const bool m_bUTF8Strings;
+    const size_t m_nLength;
+
+    bool IsFIDColumn(const swq_expr_node *poNode) const;
+    bool
+    GetArrowColumn(const swq_expr_node *poNode,
+                   const struct ArrowSchema *&psSchema,
+                   const struct ArrowArray *&psArray,
+                   std::vector<const struct ArrowArray *> &apsParents) const;
+    bool IsSupportedColumn(const swq_expr_node *poNode) const;
+    void FetchFID(OGRArrowColumnarValue &oRes) const;
+    bool FetchColumn(const swq_expr_node *poNode,
+                     OGRArrowColumnarValue &oRes) const;
+    bool Evaluate(const swq_expr_node *poNode, OGRArrowColumnarValue &oRes,
+                  int nRecLevel);
+    void EvaluateLike(const swq_expr_node *poNode,
+                      const std::vector<OGRArrowColumnarValue> &aoArgs,
+                      OGRArrowColumnarValue &oRes) const;
+    void EvaluateIntArithmetic(swq_op eOp, const OGRArrowColumnarValue &oA,
+                               const OGRArrowColumnarValue &oB,
+                               OGRArrowColumnarValue &oRes) const;
+    void EvaluateFloatArithmetic(swq_op eOp, const OGRArrowColumnarValue &oA,
+                                 const OGRArrowColumnarValue &oB,
+                                 OGRArrowColumnarValue &oRes) const;
+
+    template <class T, class Cmp>
+    void CompareLoop(const OGRArrowColumnarValue &oA,
+                     const OGRArrowColumnarValue &oB, Cmp cmp,
+                     OGRArrowColumnarValue &oRes) const
+    {
+        for (size_t i = 0; i < m_nLength; ++i)
+        {
+            if (!oRes.abyNull[i])
+                oRes.anValues[i] = cmp(GetColumnarValue<T>(oA, i),
+                                       GetColumnarValue<T>(oB, i));
+        }
+    }
+
+    template <class T, class Equal, class Less>
+    void EvaluateComparison(swq_op eOp,
+                            const std::vector<OGRArrowColumnarValue> &aoArgs,
+                            Equal equal, Less less,
+                            OGRArrowColumnarValue &oRes) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowColumnarEvaluator)
+
+  public:
+    OGRArrowColumnarEvaluator(
+        const OGRLayer *poLayer, const struct ArrowSchema *schema,
+        const struct ArrowArray *array,
+        const std::map<std::string, std::vector<int>>
+            &oMapFieldNameToArrowPath,
+        GIntBig nBaseSeqFID, const std::vector<int> &anArrowPathToFIDColumn,
+        const std::vector<bool> &abyCandidates)
+        : m_poFeatureDefn(const_cast<OGRLayer *>(poLayer)->GetLayerDefn()),
+          m_schema(schema), m_array(array),
+          m_oMapFieldNameToArrowPath(oMapFieldNameToArrowPath),
+          m_nBaseSeqFID(nBaseSeqFID),
+          m_anArrowPathToFIDColumn(anArrowPathToFIDColumn),
+          m_abyCandidates(abyCandidates),
+          m_bUTF8Strings(CPL_TO_BOOL(const_cast<OGRLayer *>(poLayer)
+                                         ->TestCapability(OLCStringsAsUTF8))),
+          m_nLength(abyCandidates.size())
+    {
+    }
+
+    bool IsSupported(const swq_expr_node *poNode, int nRecLevel = 0) const;
+
+    bool Filter(const swq_expr_node *poNode, std::vector<bool> &abyValidity);
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                            IsFIDColumn()                             */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::IsFIDColumn(const swq_expr_node *poNode) const
+{
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    // Second case: see OGRFeatureFetcherFixFieldIndex()
+    return poNode->field_index == nFieldCount + SPF_FID ||
+           poNode->field_index == nFieldCount + SPECIAL_FIELD_COUNT +
+                                      m_poFeatureDefn->GetGeomFieldCount();
+}
+
+/************************************************************************/
+/*                           GetArrowColumn()                           */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::GetArrowColumn(
+    const swq_expr_node *poNode, const struct ArrowSchema *&psSchema,
+    const struct ArrowArray *&psArray,
+    std::vector<const struct ArrowArray *> &apsParents) const
+{
+    if (poNode->field_index < 0 ||
+        poNode->field_index >= m_poFeatureDefn->GetFieldCount())
+        return false;
+    const auto oIter = m_oMapFieldNameToArrowPath.find(
+        m_poFeatureDefn->GetFieldDefn(poNode->field_index)->GetNameRef());
+    if (oIter == m_oMapFieldNameToArrowPath.end())
+        return false;
+
+    psSchema = m_schema;
+    psArray = m_array;
+    for (size_t i = 0; i < oIter->second.size(); ++i)
+    {
+        // Same as FillValidityArrayFromAttrQuery(): the validity of the
+        // top-level array is not taken into account.
+        if (i > 0)
+            apsParents.push_back(psArray);
+        psSchema = psSchema->children[oIter->second[i]];
+        psArray = psArray->children[oIter->second[i]];
+    }
+    return psSchema->dictionary == nullptr;
+}
+
+/************************************************************************/
+/*                         IsSupportedColumn()                          */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::IsSupportedColumn(
+    const swq_expr_node *poNode) const
+{
+    if (IsFIDColumn(poNode))
+    {
+        return poNode->field_type == SWQ_INTEGER64 &&
+               (m_nBaseSeqFID >= 0 || m_anArrowPathToFIDColumn.size() <= 1);
+    }
+
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    std::vector<const struct ArrowArray *> apsParents;
+    return GetArrowColumn(poNode, psSchema, psArray, apsParents) &&
+           IsCompatibleArrowFormat(poNode->field_type, psSchema->format);
+}
+
+/************************************************************************/
+/*                             FetchFID()                               */
+/************************************************************************/
+
+void OGRArrowColumnarEvaluator::FetchFID(OGRArrowColumnarValue &oRes) const
+{
+    oRes.eType = OGRArrowColumnarValue::Type::INTEGER;
+    oRes.anValues.resize(m_nLength);
+    oRes.abyNull.assign(m_nLength, 0);
+    if (m_nBaseSeqFID >= 0)
+    {
+        for (size_t i = 0; i < m_nLength; ++i)
+            oRes.anValues[i] = m_nBaseSeqFID + static_cast<int64_t>(i);
+        return;
+    }
+
+    // When the FID is unknown, OGRFeature::GetFID() returns OGRNullFID, and
+    // the FID special field is considered as null.
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    if (!m_anArrowPathToFIDColumn.empty())
+    {
+        psSchema = m_schema->children[m_anArrowPathToFIDColumn[0]];
+        psArray = m_array->children[m_anArrowPathToFIDColumn[0]];
+    }
+    const uint8_t *pabyValidity =
+        psArray && psArray->null_count != 0
+            ? static_cast<const uint8_t *>(psArray->buffers[0])
+            : nullptr;
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        const size_t nOffsettedIndex =
+            psArray ? static_cast<size_t>(i + psArray->offset) : 0;
+        if (!psArray ||
+            (pabyValidity && !TestBit(pabyValidity, nOffsettedIndex)))
+        {
+            oRes.anValues[i] = OGRNullFID;
+        }
+        else if (IsInt32(psSchema->format))
+        {
+            oRes.anValues[i] = static_cast<const int32_t *>(
+                psArray->buffers[1])[nOffsettedIndex];
+        }
+        else if (IsInt64(psSchema->format))
+        {
+            oRes.anValues[i] = static_cast<const int64_t *>(
+                psArray->buffers[1])[nOffsettedIndex];
+        }
+        else
+        {
+            oRes.anValues[i] = OGRNullFID;
+        }
+        oRes.abyNull[i] = oRes.anValues[i] == OGRNullFID;
+    }
+}
+
+/************************************************************************/
+/*                          CopyArrowValues()                           */
+/************************************************************************/
+
+template <class T>
+static void CopyArrowValues(const void *pData, size_t nOffset, size_t nLength,
+                            OGRArrowColumnarValue &oRes)
+{
+    const T *panData = static_cast<const T *>(pData) + nOffset;
+    if (oRes.eType == OGRArrowColumnarValue::Type::FLOAT)
+    {
+        oRes.adfValues.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            oRes.adfValues[i] =
+                oRes.abyNull[i] ? 0.0 : static_cast<double>(panData[i]);
+    }
+    else
+    {
+        oRes.anValues.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            oRes.anValues[i] =
+                oRes.abyNull[i] ? 0 : static_cast<int64_t>(panData[i]);
+    }
+}
+
+/************************************************************************/
+/*                            FetchColumn()                             */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::FetchColumn(const swq_expr_node *poNode,
+                                            OGRArrowColumnarValue &oRes) const
+{
+    if (IsFIDColumn(poNode))
+    {
+        FetchFID(oRes);
+        return true;
+    }
+
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    std::vector<const struct ArrowArray *> apsParents;
+    if (!GetArrowColumn(poNode, psSchema, psArray, apsParents) ||
+        !GetColumnarType(poNode->field_type, oRes.eType))
+        return false;
+
+    oRes.abyNull.assign(m_nLength, 0);
+    apsParents.push_back(psArray);
+    for (const auto *psParent : apsParents)
+    {
+        const uint8_t *pabyValidity =
+            psParent->null_count == 0
+                ? nullptr
+                : static_cast<const uint8_t *>(psParent->buffers[0]);
+        if (pabyValidity)
+        {
+            const size_t nOffset = static_cast<size_t>(psParent->offset);
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                if (!TestBit(pabyValidity, i + nOffset))
+                    oRes.abyNull[i] = 1;
+            }
+        }
+    }
+
+    const char *format = psSchema->format;
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const void *pData = psArray->buffers[1];
+    if (IsBoolean(format))
+    {
+        oRes.anValues.resize(m_nLength);
+        const uint8_t *pabyData = static_cast<const uint8_t *>(pData);
+        for (size_t i = 0; i < m_nLength; ++i)
+            oRes.anValues[i] =
+                !oRes.abyNull[i] && TestBit(pabyData, i + nOffset);
+    }
+    else if (IsInt8(format))
+        CopyArrowValues<int8_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsUInt8(format))
+        CopyArrowValues<uint8_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsInt16(format))
+        CopyArrowValues<int16_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsUInt16(format))
+        CopyArrowValues<uint16_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsInt32(format))
+        CopyArrowValues<int32_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsUInt32(format))
+        CopyArrowValues<uint32_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsInt64(format))
+        CopyArrowValues<int64_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsUInt64(format))
+        CopyArrowValues<uint64_t>(pData, nOffset, m_nLength, oRes);
+    else if (IsFloat32(format))
+        CopyArrowValues<float>(pData, nOffset, m_nLength, oRes);
+    else if (IsFloat64(format))
+        CopyArrowValues<double>(pData, nOffset, m_nLength, oRes);
+    else if (IsString(format) || IsLargeString(format) || IsStringView(format))
+    {
+        oRes.aosValues.resize(m_nLength);
+        for (size_t i = 0; i < m_nLength; ++i)
+        {
+            if (oRes.abyNull[i])
+                continue;
+            oRes.aosValues[i] = TruncateAtNul(
+                IsString(format) ? GetStringAsStringView<uint32_t>(psArray, i)
+                : IsLargeString(format)
+                    ? GetStringAsStringView<uint64_t>(psArray, i)
+                    : GetStringView(psArray, i));
+        }
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            IsSupported()                             */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::IsSupported(const swq_expr_node *poNode,
+                                            int nRecLevel) const
+{
+    using Type = OGRArrowColumnarValue::Type;
+
+    // Same limit as swq_expr_node::Evaluate()
+    if (nRecLevel == 32)
+        return false;
+
+    Type eType = Type::INTEGER;
+    if (poNode->eNodeType == SNT_CONSTANT)
+    {
+        return GetColumnarType(poNode->field_type, eType) &&
+               (eType != Type::STRING || poNode->is_null ||
+                poNode->string_value != nullptr);
+    }
+    if (poNode->eNodeType == SNT_COLUMN)
+        return IsSupportedColumn(poNode);
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    const int nArgs = poNode->nSubExprCount;
+    std::vector<Type> aeArgTypes;
+    for (int i = 0; i < nArgs; ++i)
+    {
+        if (!IsSupported(poNode->papoSubExpr[i], nRecLevel + 1) ||
+            !GetColumnarType(poNode->papoSubExpr[i]->field_type, eType))
+        {
+            return false;
+        }
+        aeArgTypes.push_back(eType);
+    }
+
+    bool bArithmetic = false;
+    switch (poNode->nOperation)
+    {
+        case SWQ_ISNULL:
+            return nArgs == 1;
+
+        case SWQ_NOT:
+            return nArgs == 1 && aeArgTypes[0] == Type::INTEGER;
+
+        case SWQ_AND:
+        case SWQ_OR:
+            return nArgs == 2 && aeArgTypes[0] == Type::INTEGER &&
+                   aeArgTypes[1] == Type::INTEGER;
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            return (nArgs == 2 ||
+                    (nArgs == 3 &&
+                     poNode->papoSubExpr[2]->eNodeType == SNT_CONSTANT &&
+                     poNode->papoSubExpr[2]->string_value != nullptr)) &&
+                   std::all_of(aeArgTypes.begin(), aeArgTypes.end(),
+                               [](Type e) { return e == Type::STRING; });
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GT:
+        case SWQ_LT:
+        case SWQ_GE:
+        case SWQ_LE:
+            if (nArgs != 2)
+                return false;
+            break;
+
+        case SWQ_BETWEEN:
+            if (nArgs != 3)
+                return false;
+            break;
+
+        case SWQ_IN:
+            if (nArgs < 2)
+                return false;
+            break;
+
+        case SWQ_ADD:
+        case SWQ_SUBTRACT:
+        case SWQ_MULTIPLY:
+        case SWQ_DIVIDE:
+        case SWQ_MODULUS:
+            if (nArgs != 2)
+                return false;
+            bArithmetic = true;
+            break;
+
+        default:
+            return false;
+    }
+
+    // Same choice of the evaluation branch as SWQGeneralEvaluator()
+    const bool bFloat =
+        aeArgTypes[0] == Type::FLOAT || aeArgTypes[1] == Type::FLOAT;
+    if (bArithmetic)
+    {
+        if (bFloat ? poNode->field_type != SWQ_FLOAT
+                   : (poNode->field_type != SWQ_INTEGER &&
+                      poNode->field_type != SWQ_INTEGER64))
+            return false;
+    }
+    else if (poNode->field_type != SWQ_BOOLEAN)
+    {
+        return false;
+    }
+
+    if (aeArgTypes[0] == Type::STRING && !bFloat)
+    {
+        // String comparisons (ADD is a concatenation)
+        return !bArithmetic &&
+               std::all_of(aeArgTypes.begin(), aeArgTypes.end(),
+                           [](Type e) { return e == Type::STRING; });
+    }
+
+    for (int i = 0; i < nArgs; ++i)
+    {
+        if (aeArgTypes[i] == Type::STRING)
+            return false;
+        // Beyond the first 2 arguments, SWQGeneralEvaluator() reads
+        // float_value / int_value without conversion, which only makes sense
+        // for constants.
+        if (i >= 2 && aeArgTypes[i] != (bFloat ? Type::FLOAT : Type::INTEGER) &&
+            poNode->papoSubExpr[i]->eNodeType != SNT_CONSTANT)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         EvaluateComparison()                         */
+/************************************************************************/
+
+template <class T, class Equal, class Less>
+void OGRArrowColumnarEvaluator::EvaluateComparison(
+    swq_op eOp, const std::vector<OGRArrowColumnarValue> &aoArgs, Equal equal,
+    Less less, OGRArrowColumnarValue &oRes) const
+{
+    const auto &oA = aoArgs[0];
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            CompareLoop<T>(oA, aoArgs[1], equal, oRes);
+            break;
+        case SWQ_NE:
+            CompareLoop<T>(
+                oA, aoArgs[1], [equal](const T &a, const T &b)
+                { return !equal(a, b); }, oRes);
+            break;
+        case SWQ_LT:
+            CompareLoop<T>(oA, aoArgs[1], less, oRes);
+            break;
+        case SWQ_GT:
+            CompareLoop<T>(
+                oA, aoArgs[1], [less](const T &a, const T &b)
+                { return less(b, a); }, oRes);
+            break;
+        case SWQ_LE:
+            CompareLoop<T>(
+                oA, aoArgs[1], [equal, less](const T &a, const T &b)
+                { return less(a, b) || equal(a, b); }, oRes);
+            break;
+        case SWQ_GE:
+            CompareLoop<T>(
+                oA, aoArgs[1], [equal, less](const T &a, const T &b)
+                { return less(b, a) || equal(a, b); }, oRes);
+            break;
+        case SWQ_BETWEEN:
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                if (oRes.abyNull[i])
+                    continue;
+                const T a = GetColumnarValue<T>(oA, i);
+                const T lo = GetColumnarValue<T>(aoArgs[1], i);
+                const T hi = GetColumnarValue<T>(aoArgs[2], i);
+                oRes.anValues[i] = (less(lo, a) || equal(a, lo)) &&
+                                   (less(a, hi) || equal(a, hi));
+            }
+            break;
+        case SWQ_IN:
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                if (oA.IsNull(i))
+                {
+                    oRes.abyNull[i] = 1;
+                    continue;
+                }
+                const T a = GetColumnarValue<T>(oA, i);
+                bool bNullFound = false;
+                for (size_t j = 1; j < aoArgs.size(); ++j)
+                {
+                    if (aoArgs[j].IsNull(i))
+                    {
+                        bNullFound = true;
+                    }
+                    else if (equal(a, GetColumnarValue<T>(aoArgs[j], i)))
+                    {
+                        oRes.anValues[i] = 1;
+                        break;
+                    }
+                }
+                if (bNullFound && !oRes.anValues[i])
+                    oRes.abyNull[i] = 1;
+            }
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                            EvaluateLike()                            */
+/************************************************************************/
+
+void OGRArrowColumnarEvaluator::EvaluateLike(
+    const swq_expr_node *poNode,
+    const std::vector<OGRArrowColumnarValue> &aoArgs,
+    OGRArrowColumnarValue &oRes) const
+{
+    const char chEscape =
+        poNode->nSubExprCount == 3 ? poNode->papoSubExpr[2]->string_value[0]
+                                   : '\0';
+    const bool bInsensitive =
+        poNode->nOperation == SWQ_ILIKE ||
+        CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+
+    // swq_test_like() works on nul-terminated strings
+    std::string osInput;
+    std::string osPattern;
+    if (aoArgs[1].bConstant)
+        osPattern = aoArgs[1].aosValues[0];
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (oRes.abyNull[i])
+            continue;
+        osInput = GetColumnarValue<std::string_view>(aoArgs[0], i);
+        if (!aoArgs[1].bConstant)
+            osPattern = GetColumnarValue<std::string_view>(aoArgs[1], i);
+        oRes.anValues[i] =
+            swq_test_like(osInput.c_str(), osPattern.c_str(), chEscape,
+                          bInsensitive, m_bUTF8Strings);
+    }
+}
+
+/************************************************************************/
+/*                       EvaluateIntArithmetic()                        */
+/************************************************************************/
+
+void OGRArrowColumnarEvaluator::EvaluateIntArithmetic(
+    swq_op eOp, const OGRArrowColumnarValue &oA,
+    const OGRArrowColumnarValue &oB, OGRArrowColumnarValue &oRes) const
+{
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (oRes.abyNull[i])
+            continue;
+        const int64_t a = GetColumnarValue<int64_t>(oA, i);
+        const int64_t b = GetColumnarValue<int64_t>(oB, i);
+        if ((eOp == SWQ_DIVIDE || eOp == SWQ_MODULUS) && b == 0)
+        {
+            oRes.anValues[i] = INT_MAX;
+            continue;
+        }
+        try
+        {
+            switch (eOp)
+            {
+                case SWQ_ADD:
+                    oRes.anValues[i] = (CPLSM(a) + CPLSM(b)).v();
+                    break;
+                case SWQ_SUBTRACT:
+                    oRes.anValues[i] = (CPLSM(a) - CPLSM(b)).v();
+                    break;
+                case SWQ_MULTIPLY:
+                    oRes.anValues[i] = (CPLSM(a) * CPLSM(b)).v();
+                    break;
+                case SWQ_DIVIDE:
+                    oRes.anValues[i] = (CPLSM(a) / CPLSM(b)).v();
+                    break;
+                case SWQ_MODULUS:
+                    oRes.anValues[i] = b == -1 ? 0 : a % b;
+                    break;
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+        }
+        catch (const std::exception &)
+        {
+            // Only report errors for rows the per-feature evaluation would
+            // have processed.
+            if (m_abyCandidates[i])
+                CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+            oRes.abyNull[i] = 1;
+        }
+    }
+}
+
+/************************************************************************/
+/*                      EvaluateFloatArithmetic()                       */
+/************************************************************************/
+
+void OGRArrowColumnarEvaluator::EvaluateFloatArithmetic(
+    swq_op eOp, const OGRArrowColumnarValue &oA,
+    const OGRArrowColumnarValue &oB, OGRArrowColumnarValue &oRes) const
+{
+    oRes.eType = OGRArrowColumnarValue::Type::FLOAT;
+    oRes.adfValues.assign(m_nLength, 0.0);
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (oRes.abyNull[i])
+            continue;
+        const double a = GetColumnarValue<double>(oA, i);
+        const double b = GetColumnarValue<double>(oB, i);
+        switch (eOp)
+        {
+            case SWQ_ADD:
+                oRes.adfValues[i] = a + b;
+                break;
+            case SWQ_SUBTRACT:
+                oRes.adfValues[i] = a - b;
+                break;
+            case SWQ_MULTIPLY:
+                oRes.adfValues[i] = a * b;
+                break;
+            case SWQ_DIVIDE:
+                oRes.adfValues[i] = b == 0 ? INT_MAX : a / b;
+                break;
+            case SWQ_MODULUS:
+                oRes.adfValues[i] = b == 0 ? INT_MAX : fmod(a, b);
+                break;
+            default:
+                CPLAssert(false);
+                break;
+        }
+    }
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+/** Evaluate a node, which must have been accepted by IsSupported() */
+bool OGRArrowColumnarEvaluator::Evaluate(const swq_expr_node *poNode,
+                                         OGRArrowColumnarValue &oRes,
+                                         int nRecLevel)
+{
+    using Type = OGRArrowColumnarValue::Type;
+
+    if (poNode->eNodeType == SNT_CONSTANT)
+    {
+        GetColumnarType(poNode->field_type, oRes.eType);
+        oRes.bConstant = true;
+        oRes.anValues.assign(1, poNode->int_value);
+        oRes.adfValues.assign(1, poNode->float_value);
+        oRes.aosValues.assign(1, poNode->string_value
+                                     ? std::string_view(poNode->string_value)
+                                     : std::string_view());
+        oRes.abyNull.assign(1, poNode->is_null ? 1 : 0);
+        return true;
+    }
+    if (poNode->eNodeType == SNT_COLUMN)
+        return FetchColumn(poNode, oRes);
+
+    std::vector<OGRArrowColumnarValue> aoArgs(poNode->nSubExprCount);
+    for (int i = 0; i < poNode->nSubExprCount; ++i)
+    {
+        if (!Evaluate(poNode->papoSubExpr[i], aoArgs[i], nRecLevel + 1))
+            return false;
+    }
+
+    const swq_op eOp = poNode->nOperation;
+    oRes.eType = Type::INTEGER;
+    oRes.anValues.assign(m_nLength, 0);
+    oRes.abyNull.assign(m_nLength, 0);
+
+    switch (eOp)
+    {
+        case SWQ_ISNULL:
+            for (size_t i = 0; i < m_nLength; ++i)
+                oRes.anValues[i] = aoArgs[0].IsNull(i);
+            return true;
+
+        case SWQ_NOT:
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                const bool bNull = aoArgs[0].IsNull(i);
+                oRes.anValues[i] =
+                    !GetColumnarValue<int64_t>(aoArgs[0], i) && !bNull;
+                oRes.abyNull[i] = bNull;
+            }
+            return true;
+
+        case SWQ_AND:
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                oRes.anValues[i] = GetColumnarValue<int64_t>(aoArgs[0], i) &&
+                                   GetColumnarValue<int64_t>(aoArgs[1], i);
+                oRes.abyNull[i] = aoArgs[0].IsNull(i) && aoArgs[1].IsNull(i);
+            }
+            return true;
+
+        case SWQ_OR:
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                oRes.anValues[i] = GetColumnarValue<int64_t>(aoArgs[0], i) ||
+                                   GetColumnarValue<int64_t>(aoArgs[1], i);
+                oRes.abyNull[i] = aoArgs[0].IsNull(i) || aoArgs[1].IsNull(i);
+            }
+            return true;
+
+        default:
+            break;
+    }
+
+    // For other operations, a null argument gives a null result, except
+    // for IN, which handles it itself.
+    if (eOp != SWQ_IN)
+    {
+        for (const auto &oArg : aoArgs)
+        {
+            if (oArg.bConstant)
+            {
+                if (oArg.abyNull[0])
+                    oRes.abyNull.assign(m_nLength, 1);
+            }
+            else
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                    oRes.abyNull[i] |= oArg.abyNull[i];
+            }
+        }
+    }
+
+    if (eOp == SWQ_LIKE || eOp == SWQ_ILIKE)
+    {
+        EvaluateLike(poNode, aoArgs, oRes);
+        return true;
+    }
+
+    const bool bArithmetic = eOp == SWQ_ADD || eOp == SWQ_SUBTRACT ||
+                             eOp == SWQ_MULTIPLY || eOp == SWQ_DIVIDE ||
+                             eOp == SWQ_MODULUS;
+    if (aoArgs[0].eType == Type::FLOAT || aoArgs[1].eType == Type::FLOAT)
+    {
+        aoArgs[0].PromoteToFloat();
+        aoArgs[1].PromoteToFloat();
+        if (bArithmetic)
+        {
+            EvaluateFloatArithmetic(eOp, aoArgs[0], aoArgs[1], oRes);
+        }
+        else
+        {
+            EvaluateComparison<double>(
+                eOp, aoArgs, [](double a, double b) { return a == b; },
+                [](double a, double b) { return a < b; }, oRes);
+        }
+    }
+    else if (aoArgs[0].eType == Type::INTEGER)
+    {
+        if (bArithmetic)
+        {
+            EvaluateIntArithmetic(eOp, aoArgs[0], aoArgs[1], oRes);
+        }
+        else
+        {
+            EvaluateComparison<int64_t>(
+                eOp, aoArgs, [](int64_t a, int64_t b) { return a == b; },
+                [](int64_t a, int64_t b) { return a < b; }, oRes);
+        }
+    }
+    else if (eOp == SWQ_EQ)
+    {
+        CompareLoop<std::string_view>(aoArgs[0], aoArgs[1], EqualStrings,
+                                      oRes);
+    }
+    else
+    {
+        EvaluateComparison<std::string_view>(
+            eOp, aoArgs,
+            [](std::string_view a, std::string_view b)
+            { return CompareNoCase(a, b) == 0; },
+            [](std::string_view a, std::string_view b)
+            { return CompareNoCase(a, b) < 0; },
+            oRes);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Filter()                               */
+/************************************************************************/
+
+/** Evaluate a boolean expression, and unset in abyValidity the rows for which
+ * it is not true.
+ *
+ * @return false if the expression cannot be evaluated in a columnar way.
+ */
+bool OGRArrowColumnarEvaluator::Filter(const swq_expr_node *poNode,
+                                       std::vector<bool> &abyValidity)
+{
+    if (poNode->field_type != SWQ_BOOLEAN || !IsSupported(poNode))
+        return false;
+
+    OGRArrowColumnarValue oRes;
+    if (!Evaluate(poNode, oRes, 0))
+        return false;
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (abyValidity[i] && GetColumnarValue<int64_t>(oRes, i) == 0)
+            abyValidity[i] = false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          CollectANDTerms()                           */
+/************************************************************************/
+
+static void CollectANDTerms(const swq_expr_node *poNode,
+                            std::vector<const swq_expr_node *> &apoTerms)
+{
+    if (poNode->eNodeType == SNT_OPERATION && poNode->nOperation == SWQ_AND &&
+        poNode->nSubExprCount == 2)
+    {
+        CollectANDTerms(poNode->papoSubExpr[0], apoTerms);
+        CollectANDTerms(poNode->papoSubExpr[1], apoTerms);
+    }
+    else
+    {
+        apoTerms.push_back(poNode);
+    }
+}
+
 /************************************************************************/
 /*                   FillValidityArrayFromAttrQuery()                   */
 /************************************************************************/
@@ -5290,6 +6362,30 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
+    // Evaluate directly on the Arrow arrays the terms of the filter that can
+    // be, so that features only have to be built for the other ones.
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_COLUMNAR_FILTER", "YES")))
+    {
+        OGRArrowColumnarEvaluator oEvaluator(
+            poLayer, schema, array, oMapFieldNameToArrowPath, nBaseSeqFID,
+            anArrowPathToFIDColumn, abyValidityFromFilters);
+        std::vector<const swq_expr_node *> apoTerms;
+        CollectANDTerms(static_cast<swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+                        apoTerms);
+        bool bAllTermsEvaluated = true;
+        for (const auto *poTerm : apoTerms)
+        {
+            if (!oEvaluator.Filter(poTerm, abyValidityFromFilters))
+                bAllTermsEvaluated = false;
+        }
+        if (bAllTermsEvaluated)
+        {
+            return static_cast<size_t>(std::count(
+                abyValidityFromFilters.begin(), abyValidityFromFilters.end(),
+                true));
+        }
+    }
+
     for (size_t iRow = 0; iRow < nLength; ++iRow)
     {
         if (!abyValidityFromFilters[iRow])
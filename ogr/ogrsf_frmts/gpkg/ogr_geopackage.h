@@ -604,6 +604,8 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
     OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    void TranslateFeature(sqlite3_stmt *hStmt, OGRFeature *poFeature);
+    bool GetNextFeatureInternal(OGRFeature *poFeature);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -836,6 +838,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     void CancelAsyncNextArrowArray();
 
   protected:
+    bool IGetNextFeatureInto(OGRFeature *poFeature) override;
+
     friend void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext,
                                                    int /*argc*/,
                                                    sqlite3_value **argv);
@@ -81,11 +81,27 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
     if (m_bEOF)
         return nullptr;
 
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+    if (!GetNextFeatureInternal(poFeature.get()))
+        return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+bool OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeature)
+
+{
+    if (m_bEOF)
+        return false;
+
     if (m_poQueryStatement == nullptr)
     {
         ResetStatement();
         if (m_poQueryStatement == nullptr)
-            return nullptr;
+            return false;
     }
 
     for (; true;)
@@ -111,7 +127,7 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
                 ClearStatement();
                 m_bEOF = true;
 
-                return nullptr;
+                return false;
             }
         }
         else
@@ -119,14 +135,14 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        // Rows rejected by the filters are translated into the same feature.
+        poFeature->Reset();
+        TranslateFeature(m_poQueryStatement, poFeature);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
-            return poFeature;
-
-        delete poFeature;
+            return true;
     }
 }
 
@@ -335,7 +351,16 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
     /*      Create a feature from the current result.                       */
     /* -------------------------------------------------------------------- */
     OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    TranslateFeature(hStmt, poFeature);
+    return poFeature;
+}
+
+/** Fill poFeature, which must be in the state of a newly created or reset
+ * feature of m_poFeatureDefn, from the current result of hStmt. */
+void OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                          OGRFeature *poFeature)
 
+{
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
     /* -------------------------------------------------------------------- */
@@ -370,29 +395,43 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
-            OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
-            if (poGeom == nullptr)
+            // Unless coordinates must be post-processed, only keep the WKB,
+            // and let OGRFeature build the geometry object if requested.
+            GPkgHeader oHeader;
+            const bool bLazyGeometry =
+                !m_bUndoDiscardCoordLSBOnReading &&
+                GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) ==
+                    OGRERR_NONE &&
+                static_cast<size_t>(iGpkgSize) > oHeader.nHeaderLen &&
+                poFeature->SetGeomFieldFromWKB(
+                    0, pabyGpkg + oHeader.nHeaderLen,
+                    iGpkgSize - oHeader.nHeaderLen) == OGRERR_NONE;
+            if (!bLazyGeometry)
             {
-                // Try also spatialite geometry blobs
-                if (OGRSQLiteImportSpatiaLiteGeometry(pabyGpkg, iGpkgSize,
-                                                      &poGeom) != OGRERR_NONE)
+                OGRGeometry *poGeom =
+                    GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+                if (poGeom == nullptr)
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to read geometry");
+                    // Try also spatialite geometry blobs
+                    if (OGRSQLiteImportSpatiaLiteGeometry(
+                            pabyGpkg, iGpkgSize, &poGeom) != OGRERR_NONE)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Unable to read geometry");
+                    }
                 }
-            }
-            if (poGeom)
-            {
-                if (m_bUndoDiscardCoordLSBOnReading)
+                if (poGeom)
                 {
-                    poGeom->roundCoordinates(
-                        poGeomFieldDefn->GetCoordinatePrecision());
+                    if (m_bUndoDiscardCoordLSBOnReading)
+                    {
+                        poGeom->roundCoordinates(
+                            poGeomFieldDefn->GetCoordinatePrecision());
+                    }
+                    poGeom->assignSpatialReference(poSrs);
                 }
-                poGeom->assignSpatialReference(poSrs);
-            }
 
-            poFeature->SetGeometryDirectly(poGeom);
+                poFeature->SetGeometryDirectly(poGeom);
+            }
         }
     }
 
@@ -493,7 +532,6 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
         }
     }
 
-    return poFeature;
 }
 
 /************************************************************************/
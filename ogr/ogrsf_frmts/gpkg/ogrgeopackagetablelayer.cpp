@@ -240,15 +240,33 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
     if ((nUpdatedGeomFieldsCount < 0 || nUpdatedGeomFieldsCount == 1) &&
         poFeatureDefn->GetGeomFieldCount())
     {
+        // If the feature geometry has not been built from its WKB, and no
+        // coordinate precision must be applied, directly reuse the WKB.
+        size_t szWkb = 0;
+        GByte *pabyWkb = nullptr;
+        size_t nFeatureWKBSize = 0;
+        const GByte *pabyFeatureWKB =
+            poFeature->GetGeomFieldWKB(0, &nFeatureWKBSize);
+        if (pabyFeatureWKB && m_sBinaryPrecision.nXYBitPrecision == INT_MIN &&
+            m_sBinaryPrecision.nZBitPrecision == INT_MIN &&
+            m_sBinaryPrecision.nMBitPrecision == INT_MIN)
+        {
+            pabyWkb = GPkgGeometryFromWKB(pabyFeatureWKB, nFeatureWKBSize,
+                                          m_iSrs, &szWkb);
+        }
+
         // Non-NULL geometry.
-        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
-        if (poGeom)
+        OGRGeometry *poGeom =
+            pabyWkb ? nullptr : poFeature->GetGeomFieldRef(0);
+        if (pabyWkb || poGeom)
         {
-            size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
             if (!pabyWkb)
-                return OGRERR_FAILURE;
+            {
+                pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                              &m_sBinaryPrecision, &szWkb);
+                if (!pabyWkb)
+                    return OGRERR_FAILURE;
+            }
             int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
                                         static_cast<int>(szWkb), CPLFree);
             if (err != SQLITE_OK)
@@ -2157,13 +2175,24 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
 {
     const OGRwkbGeometryType eLayerGeomType = GetGeomType();
     const OGRwkbGeometryType eFlattenLayerGeomType = wkbFlatten(eLayerGeomType);
-    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+
+    // Avoid building the geometry object when only its WKB is available
+    OGRwkbGeometryType eFeatureGeomType = wkbNone;
+    size_t nWKBSize = 0;
+    const GByte *pabyWKB = poFeature->GetGeomFieldWKB(0, &nWKBSize);
+    if (pabyWKB == nullptr || nWKBSize < 5 ||
+        OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eFeatureGeomType) !=
+            OGRERR_NONE)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        eFeatureGeomType = poGeom ? poGeom->getGeometryType() : wkbNone;
+    }
+
     if (eFlattenLayerGeomType != wkbNone && eFlattenLayerGeomType != wkbUnknown)
     {
-        if (poGeom != nullptr)
+        if (eFeatureGeomType != wkbNone)
         {
-            OGRwkbGeometryType eGeomType =
-                wkbFlatten(poGeom->getGeometryType());
+            OGRwkbGeometryType eGeomType = wkbFlatten(eFeatureGeomType);
             if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
                 !cpl::contains(m_eSetBadGeomTypeWarned, eGeomType))
             {
@@ -2188,10 +2217,10 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
     // if we have geometries with Z and M components
     if (m_nZFlag == 0 || m_nMFlag == 0)
     {
-        if (poGeom != nullptr)
+        if (eFeatureGeomType != wkbNone)
         {
             bool bUpdateGpkgGeometryColumnsTable = false;
-            const OGRwkbGeometryType eGeomType = poGeom->getGeometryType();
+            const OGRwkbGeometryType eGeomType = eFeatureGeomType;
             if (m_nZFlag == 0 && wkbHasZ(eGeomType))
             {
                 if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
@@ -2573,88 +2602,83 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
     }
 
     /* Update the layer extents with this new object */
-    if (IsGeomFieldSet(poFeature))
+    /* (computed from the WKB if the geometry has not been built) */
+    OGREnvelope oEnv;
+    if (poFeature->GetGeomFieldEnvelope(0, &oEnv))
     {
-        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
-        if (!poGeom->IsEmpty())
-        {
-            OGREnvelope oEnv;
-            poGeom->getEnvelope(&oEnv);
-            UpdateExtent(&oEnv);
+        UpdateExtent(&oEnv);
 
-            if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
-                HasSpatialIndex() && m_poDS->IsInTransaction())
+        if (!bUpsert && !m_bDeferredSpatialIndexCreation && HasSpatialIndex() &&
+            m_poDS->IsInTransaction())
+        {
+            m_nCountInsertInTransaction++;
+            if (m_nCountInsertInTransactionThreshold < 0)
             {
-                m_nCountInsertInTransaction++;
-                if (m_nCountInsertInTransactionThreshold < 0)
-                {
-                    m_nCountInsertInTransactionThreshold =
-                        atoi(CPLGetConfigOption(
-                            "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
-                }
-                if (m_nCountInsertInTransaction ==
-                    m_nCountInsertInTransactionThreshold)
-                {
-                    StartDeferredSpatialIndexUpdate();
-                }
-                else if (!m_aoRTreeTriggersSQL.empty())
-                {
-                    if (m_aoRTreeEntries.size() == 1000 * 1000)
-                    {
-                        if (!FlushPendingSpatialIndexUpdate())
-                            return OGRERR_FAILURE;
-                    }
-                    GPKGRTreeEntry sEntry;
-                    sEntry.nId = nFID;
-                    sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                    sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                    sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                    sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                    m_aoRTreeEntries.push_back(sEntry);
-                }
+                m_nCountInsertInTransactionThreshold =
+                    atoi(CPLGetConfigOption(
+                        "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
             }
-            else if (!bUpsert && m_bAllowedRTreeThread &&
-                     !m_bErrorDuringRTreeThread)
+            if (m_nCountInsertInTransaction ==
+                m_nCountInsertInTransactionThreshold)
             {
+                StartDeferredSpatialIndexUpdate();
+            }
+            else if (!m_aoRTreeTriggersSQL.empty())
+            {
+                if (m_aoRTreeEntries.size() == 1000 * 1000)
+                {
+                    if (!FlushPendingSpatialIndexUpdate())
+                        return OGRERR_FAILURE;
+                }
                 GPKGRTreeEntry sEntry;
-#ifdef DEBUG_VERBOSE
-                if (m_aoRTreeEntries.empty())
-                    CPLDebug("GPKG",
-                             "Starting to fill m_aoRTreeEntries at "
-                             "FID " CPL_FRMT_GIB,
-                             nFID);
-#endif
                 sEntry.nId = nFID;
                 sEntry.fMinX = rtreeValueDown(oEnv.MinX);
                 sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
                 sEntry.fMinY = rtreeValueDown(oEnv.MinY);
                 sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                try
+                m_aoRTreeEntries.push_back(sEntry);
+            }
+        }
+        else if (!bUpsert && m_bAllowedRTreeThread &&
+                 !m_bErrorDuringRTreeThread)
+        {
+            GPKGRTreeEntry sEntry;
+#ifdef DEBUG_VERBOSE
+            if (m_aoRTreeEntries.empty())
+                CPLDebug("GPKG",
+                         "Starting to fill m_aoRTreeEntries at "
+                         "FID " CPL_FRMT_GIB,
+                         nFID);
+#endif
+            sEntry.nId = nFID;
+            sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+            sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+            sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+            sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+            try
+            {
+                m_aoRTreeEntries.push_back(sEntry);
+                if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
                 {
-                    m_aoRTreeEntries.push_back(sEntry);
-                    if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
-                    {
-                        m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
-                        m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
-                    }
-                    if (!m_bThreadRTreeStarted &&
-                        m_oQueueRTreeEntries.size() ==
-                            m_nRTreeBatchesBeforeStart)
-                    {
-                        StartAsyncRTree();
-                    }
+                    m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
+                    m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
                 }
-                catch (const std::bad_alloc &)
+                if (!m_bThreadRTreeStarted &&
+                    m_oQueueRTreeEntries.size() == m_nRTreeBatchesBeforeStart)
                 {
-                    CPLDebug("GPKG",
-                             "Memory allocation error regarding RTree "
-                             "structures. Falling back to slower method");
-                    if (m_bThreadRTreeStarted)
-                        CancelAsyncRTree();
-                    else
-                        m_bAllowedRTreeThread = false;
+                    StartAsyncRTree();
                 }
             }
+            catch (const std::bad_alloc &)
+            {
+                CPLDebug("GPKG",
+                         "Memory allocation error regarding RTree "
+                         "structures. Falling back to slower method");
+                if (m_bThreadRTreeStarted)
+                    CancelAsyncRTree();
+                else
+                    m_bAllowedRTreeThread = false;
+            }
         }
     }
 
@@ -3635,8 +3659,25 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         return nullptr;
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
-    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+    if (!IGetNextFeatureInto(poFeature.get()))
         return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                        IGetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::IGetNextFeatureInto(OGRFeature *poFeature)
+{
+    if (m_bEOF)
+        return false;
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
 
     CancelAsyncNextArrowArray();
 
@@ -3645,15 +3686,16 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         // Both are exclusive
         CreateSpatialIndexIfNecessary();
         if (!RunDeferredSpatialIndexUpdate())
-            return nullptr;
+            return false;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
-    if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
+    if (!GetNextFeatureInternal(poFeature))
+        return false;
+    if (m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
     }
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
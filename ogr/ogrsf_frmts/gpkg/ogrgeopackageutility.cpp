@@ -349,6 +349,93 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     return pabyWkb;
 }
 
+/************************************************************************/
+/*                        GPkgGeometryFromWKB()                         */
+/************************************************************************/
+
+/* Same as GPkgGeometryFromOGR(), but from a WKB buffer that is copied as is
+ * after the GeoPackage header, without building an OGRGeometry.
+ * Only ISO WKB of Point, LineString, Polygon and their Multi variants is
+ * handled, as other types may require creating a geometry type extension.
+ * Returns nullptr if the WKB is not handled or corrupted, in which case the
+ * caller should fallback to GPkgGeometryFromOGR().
+ */
+
+GByte *GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                           size_t *pnGpkgLen)
+{
+    bool bNeedSwap = false;
+    uint32_t nType = 0;
+    if (!OGRWKBGetGeomType(pabyWKB, nWKBSize, bNeedSwap, nType))
+        return nullptr;
+    const uint32_t nFlatType = nType % 1000;
+    if (nType >= 4000 || nFlatType < wkbPoint || nFlatType > wkbMultiPolygon)
+        return nullptr;
+    const bool bHasZ = ((nType / 1000) % 2) == 1;
+
+    OGREnvelope3D oEnv3d;
+    if (!OGRWKBGetBoundingBox(pabyWKB, nWKBSize, oEnv3d))
+        return nullptr;
+
+    const bool bPoint = nFlatType == wkbPoint;
+    const bool bEmpty = !oEnv3d.IsInit();
+    const int iDims = bHasZ ? 3 : 2;
+
+    /* Header has 8 bytes for sure, and optional extra space for bounds */
+    size_t nHeaderLen = 2 + 1 + 1 + 4;
+    if (!bPoint && !bEmpty)
+    {
+        nHeaderLen += 8 * 2 * iDims;
+    }
+
+    if (nWKBSize > static_cast<size_t>(std::numeric_limits<int>::max()) -
+                       nHeaderLen)
+    {
+        return nullptr;
+    }
+    const size_t nGpkgLen = nHeaderLen + nWKBSize;
+    GByte *pabyGpkg = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nGpkgLen));
+    if (!pabyGpkg)
+        return nullptr;
+    if (pnGpkgLen)
+        *pnGpkgLen = nGpkgLen;
+
+    /* Header Magic and GPKG BLOB Version */
+    pabyGpkg[0] = 0x47;
+    pabyGpkg[1] = 0x50;
+    pabyGpkg[2] = 0;
+
+    GByte byEnv = 0;
+    if (!bPoint && !bEmpty)
+        byEnv = (iDims == 3) ? 2 : 1;
+    GByte byFlags = static_cast<GByte>(byEnv << 1);
+    if (bEmpty)
+        byFlags |= (1 << 4);
+    /* Use native endianness for the header */
+    byFlags |= static_cast<GByte>(CPL_IS_LSB);
+    pabyGpkg[3] = byFlags;
+
+    memcpy(pabyGpkg + 4, &iSrsId, 4);
+
+    if (byEnv != 0)
+    {
+        double *padPtr = reinterpret_cast<double *>(pabyGpkg + 8);
+        padPtr[0] = oEnv3d.MinX;
+        padPtr[1] = oEnv3d.MaxX;
+        padPtr[2] = oEnv3d.MinY;
+        padPtr[3] = oEnv3d.MaxY;
+        if (iDims == 3)
+        {
+            padPtr[4] = oEnv3d.MinZ;
+            padPtr[5] = oEnv3d.MaxZ;
+        }
+    }
+
+    memcpy(pabyGpkg + nHeaderLen, pabyWKB, nWKBSize);
+
+    return pabyGpkg;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
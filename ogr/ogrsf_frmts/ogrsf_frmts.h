@@ -72,6 +72,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
       public:
         FeatureIterator(OGRLayer *poLayer, bool bStart);
+        FeatureIterator(OGRLayer *poLayer, bool bStart, bool bRecycleFeature);
         FeatureIterator(
             FeatureIterator &&oOther) noexcept;  // declared but not defined.
                                                  // Needed for gcc 5.4 at least
@@ -114,6 +115,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual OGRErr ISetSpatialFilter(int iGeomField, const OGRGeometry *);
 
+    virtual bool IGetNextFeatureInto(OGRFeature *poFeature);
+
     virtual OGRErr ISetFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
     virtual OGRErr
         ISetFeatureUniqPtr(std::unique_ptr<OGRFeature>) CPL_WARN_UNUSED_RESULT;
@@ -202,6 +205,36 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     /** Return end of feature iterator. */
     FeatureIterator end();
 
+    /** Range of features that recycles the feature of the iterator.
+     *
+     * @see OGRLayer::GetRecycledFeatures()
+     * @since GDAL 3.14
+     */
+    class RecycledFeatureRange
+    {
+        OGRLayer *m_poLayer;
+
+      public:
+        /** Constructor */
+        explicit RecycledFeatureRange(OGRLayer *poLayer) : m_poLayer(poLayer)
+        {
+        }
+
+        /** Return begin of feature iterator. */
+        FeatureIterator begin()
+        {
+            return {m_poLayer, true, true};
+        }
+
+        /** Return end of feature iterator. */
+        FeatureIterator end()
+        {
+            return {m_poLayer, false, true};
+        }
+    };
+
+    RecycledFeatureRange GetRecycledFeatures();
+
     virtual OGRGeometry *GetSpatialFilter();
 
     OGRErr SetSpatialFilter(const OGRGeometry *);
@@ -216,6 +249,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    bool GetNextFeatureInto(OGRFeature *poFeature);
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
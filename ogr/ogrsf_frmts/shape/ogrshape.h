@@ -40,6 +40,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
                               bool &bHasWarnedWrongWindingOrder);
+bool SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF, OGRFeatureDefn *poDefn,
+                       int iShape, SHPObject *psShape,
+                       const char *pszSHPEncoding,
+                       bool &bHasWarnedWrongWindingOrder,
+                       OGRFeature *poFeature);
 std::unique_ptr<OGRGeometry>
 SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                  bool &bHasWarnedWrongWindingOrder,
@@ -215,7 +220,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    bool FetchShape(int iShapeId, OGRFeature *poFeature);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -229,6 +234,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool IGetNextFeatureInto(OGRFeature *poFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
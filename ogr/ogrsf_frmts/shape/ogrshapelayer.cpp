@@ -902,11 +902,9 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+bool OGRShapeLayer::FetchShape(int iShapeId, OGRFeature *poFeature)
 
 {
-    OGRFeature *poFeature = nullptr;
-
     if (m_poFilterGeom != nullptr && m_hSHP != nullptr)
     {
         SHPObject *psShape = SHPReadObject(m_hSHP, iShapeId);
@@ -921,9 +919,9 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
               psShape->dfYMin == psShape->dfYMax)) ||
             psShape->nSHPType == SHPT_NULL)
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
-                                          iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+            return SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
+                                     iShapeId, psShape, m_osEncoding,
+                                     m_bHasWarnedWrongWindingOrder, poFeature);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -931,23 +929,21 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
                  psShape->dfYMax < m_sFilterEnvelope.MinY)
         {
             SHPDestroyObject(psShape);
-            poFeature = nullptr;
+            return false;
         }
         else
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
-                                          iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+            return SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
+                                     iShapeId, psShape, m_osEncoding,
+                                     m_bHasWarnedWrongWindingOrder, poFeature);
         }
     }
     else
     {
-        poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
-                                      iShapeId, nullptr, m_osEncoding,
-                                      m_bHasWarnedWrongWindingOrder);
+        return SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn.get(),
+                                 iShapeId, nullptr, m_osEncoding,
+                                 m_bHasWarnedWrongWindingOrder, poFeature);
     }
-
-    return poFeature;
 }
 
 /************************************************************************/
@@ -957,8 +953,21 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
 {
-    if (!TouchLayer())
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn.get());
+    if (!IGetNextFeatureInto(poFeature.get()))
         return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                        IGetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::IGetNextFeatureInto(OGRFeature *poFeature)
+
+{
+    if (!TouchLayer())
+        return false;
 
     /* -------------------------------------------------------------------- */
     /*      Collect a matching list if we have attribute or spatial         */
@@ -973,22 +982,24 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
 
     /* -------------------------------------------------------------------- */
     /*      Loop till we find a feature matching our criteria.              */
+    /*      Rejected shapes are read into the same feature.                 */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = nullptr;
-
     while (true)
     {
+        bool bFetched = false;
+        poFeature->Reset();
+
         if (m_panMatchingFIDs != nullptr)
         {
             if (m_panMatchingFIDs[m_iMatchingFID] == OGRNullFID)
             {
-                return nullptr;
+                return false;
             }
 
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
-            poFeature =
-                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]));
+            bFetched = FetchShape(
+                static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]), poFeature);
 
             m_iMatchingFID++;
         }
@@ -996,26 +1007,26 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
         {
             if (m_iNextShapeId >= m_nTotalShapeCount)
             {
-                return nullptr;
+                return false;
             }
 
             if (m_hDBF)
             {
                 if (DBFIsRecordDeleted(m_hDBF, m_iNextShapeId))
-                    poFeature = nullptr;
+                    bFetched = false;
                 else if (VSIFEofL(VSI_SHP_GetVSIL(m_hDBF->fp)) ||
                          VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
-                    return nullptr;  //* I/O error.
+                    return false;  //* I/O error.
                 else
-                    poFeature = FetchShape(m_iNextShapeId);
+                    bFetched = FetchShape(m_iNextShapeId, poFeature);
             }
             else
-                poFeature = FetchShape(m_iNextShapeId);
+                bFetched = FetchShape(m_iNextShapeId, poFeature);
 
             m_iNextShapeId++;
         }
 
-        if (poFeature != nullptr)
+        if (bFetched)
         {
             OGRGeometry *poGeom = poFeature->GetGeometryRef();
             if (poGeom != nullptr)
@@ -1029,10 +1040,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 (m_poAttrQuery == nullptr ||
                  m_poAttrQuery->Evaluate(poFeature)))
             {
-                return poFeature;
+                return true;
             }
-
-            delete poFeature;
         }
     }
 }
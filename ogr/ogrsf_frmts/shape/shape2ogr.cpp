@@ -1416,6 +1416,22 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               SHPObject *psShape, const char *pszSHPEncoding,
                               bool &bHasWarnedWrongWindingOrder)
 
+{
+    auto poFeature = std::make_unique<OGRFeature>(poDefn);
+    if (!SHPReadOGRFeature(hSHP, hDBF, poDefn, iShape, psShape, pszSHPEncoding,
+                           bHasWarnedWrongWindingOrder, poFeature.get()))
+        return nullptr;
+    return poFeature.release();
+}
+
+// Fill poFeature, which must be in the state of a newly created or reset
+// feature of poDefn.
+bool SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF, OGRFeatureDefn *poDefn,
+                       int iShape, SHPObject *psShape,
+                       const char *pszSHPEncoding,
+                       bool &bHasWarnedWrongWindingOrder,
+                       OGRFeature *poFeature)
+
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
         (hDBF != nullptr && iShape >= hDBF->nRecords))
@@ -1424,7 +1440,7 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                  "Attempt to read shape with feature id (%d) out of available"
                  " range.",
                  iShape);
-        return nullptr;
+        return false;
     }
 
     if (hDBF && DBFIsRecordDeleted(hDBF, iShape))
@@ -1435,11 +1451,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                  iShape);
         if (psShape != nullptr)
             SHPDestroyObject(psShape);
-        return nullptr;
+        return false;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
-
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
     /* -------------------------------------------------------------------- */
@@ -1601,10 +1615,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         }
     }
 
-    if (poFeature != nullptr)
-        poFeature->SetFID(iShape);
+    poFeature->SetFID(iShape);
 
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
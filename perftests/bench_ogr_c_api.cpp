@@ -22,7 +22,8 @@ static void Usage()
 {
     printf(
         "Usage: bench_ogr_c_api [-where filter] [-spat xmin ymin xmax ymax]\n");
-    printf("                       [-oo NAME=VALUE]* filename [layer_name]\n");
+    printf("                       [-oo NAME=VALUE]* [-reuse_feature]\n");
+    printf("                       filename [layer_name]\n");
     exit(1);
 }
 
@@ -44,6 +45,7 @@ int main(int argc, char *argv[])
     std::unique_ptr<OGRPolygon> poSpatialFilter;
     const char *pszLayerName = nullptr;
     CPLStringList aosOpenOptions;
+    bool bReuseFeature = false;
     for (int iArg = 1; iArg < argc; ++iArg)
     {
         if (iArg + 1 < argc && strcmp(argv[iArg], "-where") == 0)
@@ -70,6 +72,10 @@ int main(int argc, char *argv[])
             ++iArg;
             aosOpenOptions.AddString(argv[iArg]);
         }
+        else if (strcmp(argv[iArg], "-reuse_feature") == 0)
+        {
+            bReuseFeature = true;
+        }
         else if (argv[iArg][0] == '-')
         {
             Usage();
@@ -131,11 +137,21 @@ int main(int argc, char *argv[])
         aeTypes.push_back(OGR_Fld_GetType(OGR_FD_GetFieldDefn(hFDefn, i)));
     int nYear, nMonth, nDay, nHour, nMin, nSecond, nTZ;
     std::vector<GByte> abyWKB;
+    OGRFeatureH hReusedFeat = bReuseFeature ? OGR_F_Create(hFDefn) : nullptr;
     while (true)
     {
-        OGRFeatureH hFeat = OGR_L_GetNextFeature(hLayer);
-        if (hFeat == nullptr)
-            break;
+        OGRFeatureH hFeat = hReusedFeat;
+        if (hReusedFeat)
+        {
+            if (!OGR_L_GetNextFeatureInto(hLayer, hReusedFeat))
+                break;
+        }
+        else
+        {
+            hFeat = OGR_L_GetNextFeature(hLayer);
+            if (hFeat == nullptr)
+                break;
+        }
         OGR_F_GetFID(hFeat);
         for (int i = 0; i < nFields; i++)
         {
@@ -158,8 +174,11 @@ int main(int argc, char *argv[])
             abyWKB.resize(size);
             OGR_G_ExportToIsoWkb(hGeom, wkbNDR, abyWKB.data());
         }
-        OGR_F_Destroy(hFeat);
+        if (hFeat != hReusedFeat)
+            OGR_F_Destroy(hFeat);
     }
+    if (hReusedFeat)
+        OGR_F_Destroy(hReusedFeat);
 
     poDS.reset();
 
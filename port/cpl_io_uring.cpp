@@ -0,0 +1,505 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Minimal io_uring based reader for local files (Linux only)
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_io_uring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+
+//! Number of submission queue entries of each ring
+constexpr unsigned RING_ENTRIES = 64;
+
+//! Maximum number of bytes requested by a single submission queue entry
+constexpr size_t MAX_BYTES_PER_REQUEST = 1U << 30;
+
+//! Number and size of the bounce buffers used for O_DIRECT reads
+constexpr int DIRECT_IO_BUFFER_COUNT = 4;
+constexpr size_t DIRECT_IO_BUFFER_SIZE = 1024 * 1024;
+
+static std::atomic<bool> gbIOUringUnavailable{false};
+
+/************************************************************************/
+/*                            ~CPLIOUring()                             */
+/************************************************************************/
+
+CPLIOUring::~CPLIOUring()
+{
+    Close();
+    for (GByte *pabyBuffer : m_apabyDirectIOBuffers)
+        VSIFreeAligned(pabyBuffer);
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+void CPLIOUring::Close()
+{
+    if (m_pSQEs)
+        munmap(m_pSQEs, m_nSQEsSize);
+    m_pSQEs = nullptr;
+    if (m_pCQRing && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    m_pCQRing = nullptr;
+    if (m_pSQRing)
+        munmap(m_pSQRing, m_nSQRingSize);
+    m_pSQRing = nullptr;
+    // Closing the ring also unregisters the buffers and cancels the
+    // requests that have not completed.
+    if (m_fd >= 0)
+        close(m_fd);
+    m_fd = -1;
+}
+
+/************************************************************************/
+/*                        GetForCurrentThread()                         */
+/************************************************************************/
+
+CPLIOUring *CPLIOUring::GetForCurrentThread()
+{
+    static thread_local std::unique_ptr<CPLIOUring> tlpoRing;
+    static thread_local bool tlbTried = false;
+    if (gbIOUringUnavailable)
+    {
+        // io_uring may have been disabled after a failure in any thread
+        tlpoRing.reset();
+        return nullptr;
+    }
+    if (!tlbTried)
+    {
+        tlbTried = true;
+        if (!gbIOUringUnavailable)
+        {
+            std::unique_ptr<CPLIOUring> poRing(new CPLIOUring());
+            if (poRing->Init())
+                tlpoRing = std::move(poRing);
+            else
+                gbIOUringUnavailable = true;
+        }
+    }
+    return tlpoRing.get();
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool CPLIOUring::Init()
+{
+    struct io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    m_fd = static_cast<int>(
+        syscall(__NR_io_uring_setup, RING_ENTRIES, &sParams));
+    if (m_fd < 0)
+    {
+        CPLDebug("VSI", "io_uring_setup() failed: %s. Using regular I/O",
+                 strerror(errno));
+        return false;
+    }
+
+    m_nEntries = sParams.sq_entries;
+    m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    m_nCQRingSize = sParams.cq_off.cqes +
+                    sParams.cq_entries * sizeof(struct io_uring_cqe);
+    const bool bSingleMmap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMmap)
+    {
+        m_nSQRingSize = std::max(m_nSQRingSize, m_nCQRingSize);
+        m_nCQRingSize = m_nSQRingSize;
+    }
+
+    const auto MapRegion = [this](size_t nSize, off_t nOffset) -> void *
+    {
+        void *pRet = mmap(nullptr, nSize, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, m_fd, nOffset);
+        return pRet == MAP_FAILED ? nullptr : pRet;
+    };
+
+    m_pSQRing = MapRegion(m_nSQRingSize, IORING_OFF_SQ_RING);
+    if (!m_pSQRing)
+        return false;
+    m_pCQRing =
+        bSingleMmap ? m_pSQRing : MapRegion(m_nCQRingSize, IORING_OFF_CQ_RING);
+    if (!m_pCQRing)
+        return false;
+    m_nSQEsSize = sParams.sq_entries * sizeof(struct io_uring_sqe);
+    m_pSQEs = MapRegion(m_nSQEsSize, IORING_OFF_SQES);
+    if (!m_pSQEs)
+        return false;
+
+    GByte *pabySQ = static_cast<GByte *>(m_pSQRing);
+    m_pnSQTail = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.tail);
+    m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.ring_mask);
+    m_panSQArray = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.array);
+
+    GByte *pabyCQ = static_cast<GByte *>(m_pCQRing);
+    m_pnCQHead = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.head);
+    m_pnCQTail = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.tail);
+    m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.ring_mask);
+    m_pCQEs = pabyCQ + sParams.cq_off.cqes;
+
+    // IORING_OP_READ is only available since Linux 5.6, as is the probing
+    // interface.
+    constexpr int N_PROBE_OPS = 256;
+    std::vector<GByte> abyProbe(sizeof(struct io_uring_probe) +
+                                N_PROBE_OPS * sizeof(struct io_uring_probe_op));
+    auto psProbe = reinterpret_cast<struct io_uring_probe *>(abyProbe.data());
+    if (syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_PROBE, psProbe,
+                N_PROBE_OPS) < 0 ||
+        psProbe->ops_len <= IORING_OP_READ ||
+        (psProbe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) == 0)
+    {
+        CPLDebug("VSI", "io_uring does not support IORING_OP_READ. "
+                        "Using regular I/O");
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                        InitDirectIOBuffers()                         */
+/************************************************************************/
+
+bool CPLIOUring::InitDirectIOBuffers()
+{
+    if (m_bDirectIOBuffersInitialized)
+        return !m_apabyDirectIOBuffers.empty();
+    m_bDirectIOBuffersInitialized = true;
+
+    std::vector<struct iovec> asIOVec;
+    for (int i = 0; i < DIRECT_IO_BUFFER_COUNT; ++i)
+    {
+        GByte *pabyBuffer = static_cast<GByte *>(
+            VSIMallocAligned(DIRECT_IO_ALIGNMENT, DIRECT_IO_BUFFER_SIZE));
+        if (!pabyBuffer)
+            break;
+        m_apabyDirectIOBuffers.push_back(pabyBuffer);
+        struct iovec sIOVec;
+        sIOVec.iov_base = pabyBuffer;
+        sIOVec.iov_len = DIRECT_IO_BUFFER_SIZE;
+        asIOVec.push_back(sIOVec);
+    }
+    if (asIOVec.empty())
+        return false;
+
+    // Registering buffers saves the kernel from mapping them at each
+    // request, but counts against RLIMIT_MEMLOCK, so failure is not fatal.
+    m_bRegisteredBuffers =
+        syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_BUFFERS,
+                asIOVec.data(), static_cast<unsigned>(asIOVec.size())) == 0;
+    if (!m_bRegisteredBuffers)
+    {
+        CPLDebug("VSI", "Cannot register io_uring buffers: %s",
+                 strerror(errno));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            QueueRequest()                            */
+/************************************************************************/
+
+void CPLIOUring::QueueRequest(const Request &oReq, size_t nIdx,
+                              size_t nAlreadyRead)
+{
+    // We are the only producer, so no need for an atomic load of the tail
+    const unsigned nTail = *m_pnSQTail;
+    const unsigned nIndex = nTail & m_nSQMask;
+    auto psSQE = static_cast<struct io_uring_sqe *>(m_pSQEs) + nIndex;
+    memset(psSQE, 0, sizeof(*psSQE));
+    psSQE->opcode = static_cast<__u8>(
+        oReq.nBufIndex >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ);
+    psSQE->fd = oReq.fd;
+    psSQE->off = oReq.nOffset + nAlreadyRead;
+    psSQE->addr = reinterpret_cast<uintptr_t>(oReq.pabyData + nAlreadyRead);
+    psSQE->len = static_cast<__u32>(oReq.nSize - nAlreadyRead);
+    if (oReq.nBufIndex >= 0)
+        psSQE->buf_index = static_cast<__u16>(oReq.nBufIndex);
+    psSQE->user_data = nIdx;
+    m_panSQArray[nIndex] = nIndex;
+    __atomic_store_n(m_pnSQTail, nTail + 1, __ATOMIC_RELEASE);
+}
+
+/************************************************************************/
+/*                               Submit()                               */
+/************************************************************************/
+
+/** Submit the nToSubmit last queued requests.
+ *
+ * On return, nToSubmit is the number of requests that could not be
+ * submitted.
+ */
+bool CPLIOUring::Submit(unsigned &nToSubmit)
+{
+    while (nToSubmit > 0)
+    {
+        const int nRet = static_cast<int>(syscall(
+            __NR_io_uring_enter, m_fd, nToSubmit, 0, 0, nullptr, 0));
+        if (nRet < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            CPLDebug("VSI", "io_uring_enter() failed: %s", strerror(errno));
+            return false;
+        }
+        nToSubmit -= static_cast<unsigned>(nRet);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         WaitForCompletion()                          */
+/************************************************************************/
+
+bool CPLIOUring::WaitForCompletion()
+{
+    while (*m_pnCQHead == __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE))
+    {
+        if (syscall(__NR_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS,
+                    nullptr, 0) < 0 &&
+            errno != EINTR)
+        {
+            CPLDebug("VSI", "io_uring_enter() failed: %s", strerror(errno));
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Drain()                                */
+/************************************************************************/
+
+/** Wait for the completion of the nInFlight requests still owned by the
+ * kernel, so that it no longer writes into buffers that may be released once
+ * we return.
+ */
+void CPLIOUring::Drain(unsigned nInFlight)
+{
+    while (nInFlight > 0 && WaitForCompletion())
+    {
+        unsigned nHead = *m_pnCQHead;
+        const unsigned nTail = __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE);
+        for (; nHead != nTail && nInFlight > 0; ++nHead)
+            --nInFlight;
+        __atomic_store_n(m_pnCQHead, nHead, __ATOMIC_RELEASE);
+    }
+}
+
+/************************************************************************/
+/*                              Execute()                               */
+/************************************************************************/
+
+/** Run all requests, keeping the ring as full as possible.
+ *
+ * anRead[i] receives the number of bytes read for aoRequests[i]. When
+ * bRetryShortReads is false, a short read is considered as the end of file,
+ * which is required for O_DIRECT whose offsets must remain aligned.
+ */
+bool CPLIOUring::Execute(const std::vector<Request> &aoRequests,
+                         std::vector<size_t> &anRead, bool bRetryShortReads)
+{
+    anRead.clear();
+    anRead.resize(aoRequests.size());
+
+    std::vector<size_t> anToRequeue;
+    size_t nNext = 0;
+    unsigned nInFlight = 0;
+    bool bError = false;
+    while (nInFlight > 0 ||
+           (!bError && (nNext < aoRequests.size() || !anToRequeue.empty())))
+    {
+        unsigned nToSubmit = 0;
+        while (!bError && nInFlight < m_nEntries &&
+               (!anToRequeue.empty() || nNext < aoRequests.size()))
+        {
+            size_t nIdx;
+            if (!anToRequeue.empty())
+            {
+                nIdx = anToRequeue.back();
+                anToRequeue.pop_back();
+            }
+            else
+            {
+                nIdx = nNext++;
+            }
+            QueueRequest(aoRequests[nIdx], nIdx, anRead[nIdx]);
+            ++nInFlight;
+            ++nToSubmit;
+        }
+
+        // If submission or waiting fails, requests might still be in flight
+        // with the kernel writing into the caller buffers: reap what can be
+        // reaped and give up on io_uring for good. The ring of each thread
+        // is released by its next call to GetForCurrentThread().
+        const bool bSubmitOK = Submit(nToSubmit);
+        nInFlight -= nToSubmit;
+        if (!bSubmitOK || !WaitForCompletion())
+        {
+            Drain(nInFlight);
+            Close();
+            gbIOUringUnavailable = true;
+            return false;
+        }
+
+        unsigned nHead = *m_pnCQHead;
+        const unsigned nTail = __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE);
+        for (; nHead != nTail; ++nHead)
+        {
+            const auto psCQE =
+                static_cast<const struct io_uring_cqe *>(m_pCQEs) +
+                (nHead & m_nCQMask);
+            const size_t nIdx = static_cast<size_t>(psCQE->user_data);
+            const int nRes = psCQE->res;
+            if (nIdx >= aoRequests.size())
+            {
+                // Not a request of this batch
+                CPLDebug("VSI", "Ignoring unexpected io_uring completion");
+                continue;
+            }
+            --nInFlight;
+            if (nRes == -EINTR || nRes == -EAGAIN)
+            {
+                anToRequeue.push_back(nIdx);
+            }
+            else if (nRes < 0)
+            {
+                CPLDebug("VSI", "io_uring read failed: %s", strerror(-nRes));
+                bError = true;
+            }
+            else if (nRes > 0)
+            {
+                anRead[nIdx] += static_cast<size_t>(nRes);
+                if (bRetryShortReads &&
+                    anRead[nIdx] < aoRequests[nIdx].nSize)
+                {
+                    anToRequeue.push_back(nIdx);
+                }
+            }
+        }
+        __atomic_store_n(m_pnCQHead, nHead, __ATOMIC_RELEASE);
+    }
+
+    return !bError;
+}
+
+/************************************************************************/
+/*                             ReadRanges()                             */
+/************************************************************************/
+
+bool CPLIOUring::ReadRanges(int fd, int nRanges, void *const *ppData,
+                            const vsi_l_offset *panOffsets,
+                            const size_t *panSizes)
+{
+    std::vector<Request> aoRequests;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        for (size_t nDone = 0; nDone < panSizes[i];
+             nDone += MAX_BYTES_PER_REQUEST)
+        {
+            Request oReq;
+            oReq.fd = fd;
+            oReq.pabyData = static_cast<GByte *>(ppData[i]) + nDone;
+            oReq.nSize = std::min(MAX_BYTES_PER_REQUEST, panSizes[i] - nDone);
+            oReq.nOffset = panOffsets[i] + nDone;
+            aoRequests.push_back(oReq);
+        }
+    }
+
+    std::vector<size_t> anRead;
+    if (!Execute(aoRequests, anRead, /* bRetryShortReads = */ true))
+        return false;
+    for (size_t i = 0; i < aoRequests.size(); ++i)
+    {
+        if (anRead[i] != aoRequests[i].nSize)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             ReadDirect()                             */
+/************************************************************************/
+
+bool CPLIOUring::ReadDirect(int fdDirect, void *pBuffer, size_t nSize,
+                            vsi_l_offset nOffset, size_t &nRead)
+{
+    nRead = 0;
+    if (!InitDirectIOBuffers())
+        return false;
+
+    GByte *pabyDest = static_cast<GByte *>(pBuffer);
+    const vsi_l_offset nEnd = nOffset + nSize;
+    vsi_l_offset nCur = nOffset & ~static_cast<vsi_l_offset>(
+                                      DIRECT_IO_ALIGNMENT - 1);
+    std::vector<Request> aoRequests;
+    std::vector<size_t> anRead;
+    while (nCur < nEnd)
+    {
+        // Read one aligned chunk per bounce buffer, all in parallel
+        aoRequests.clear();
+        for (size_t i = 0; i < m_apabyDirectIOBuffers.size() && nCur < nEnd;
+             ++i)
+        {
+            Request oReq;
+            oReq.fd = fdDirect;
+            oReq.pabyData = m_apabyDirectIOBuffers[i];
+            oReq.nSize = static_cast<size_t>(std::min<vsi_l_offset>(
+                DIRECT_IO_BUFFER_SIZE,
+                (nEnd - nCur + DIRECT_IO_ALIGNMENT - 1) &
+                    ~static_cast<vsi_l_offset>(DIRECT_IO_ALIGNMENT - 1)));
+            oReq.nOffset = nCur;
+            oReq.nBufIndex = m_bRegisteredBuffers ? static_cast<int>(i) : -1;
+            aoRequests.push_back(oReq);
+            nCur += oReq.nSize;
+        }
+
+        if (!Execute(aoRequests, anRead, /* bRetryShortReads = */ false))
+            return false;
+
+        for (size_t i = 0; i < aoRequests.size(); ++i)
+        {
+            const auto &oReq = aoRequests[i];
+            const vsi_l_offset nCopyStart = nOffset + nRead;
+            const vsi_l_offset nCopyEnd =
+                std::min<vsi_l_offset>(oReq.nOffset + anRead[i], nEnd);
+            if (nCopyEnd > nCopyStart)
+            {
+                memcpy(pabyDest + nRead,
+                       oReq.pabyData + (nCopyStart - oReq.nOffset),
+                       static_cast<size_t>(nCopyEnd - nCopyStart));
+                nRead = static_cast<size_t>(nCopyEnd - nOffset);
+            }
+            if (anRead[i] < oReq.nSize)
+            {
+                // End of file reached
+                return true;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Minimal io_uring based reader for local files (Linux only)
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_IO_URING_H_INCLUDED
+#define CPL_IO_URING_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/************************************************************************/
+/*                              CPLIOUring                              */
+/************************************************************************/
+
+/** Submission/completion ring bound to the calling thread.
+ *
+ * The kernel interface is used directly through the io_uring_setup(),
+ * io_uring_enter() and io_uring_register() system calls, so no external
+ * library is required. Instances are not thread-safe, and are meant to be
+ * obtained with GetForCurrentThread().
+ */
+class CPLIOUring
+{
+  public:
+    ~CPLIOUring();
+
+    /** Return the ring of the current thread, creating it if needed, or
+     * nullptr if io_uring is not available (old kernel, seccomp filter,...)
+     */
+    static CPLIOUring *GetForCurrentThread();
+
+    /** Read nRanges ranges from fd in as few system calls as possible.
+     *
+     * @return true if all ranges have been entirely read.
+     */
+    bool ReadRanges(int fd, int nRanges, void *const *ppData,
+                    const vsi_l_offset *panOffsets, const size_t *panSizes);
+
+    /** Read nSize bytes at nOffset from a file descriptor opened with
+     * O_DIRECT, through aligned and registered bounce buffers.
+     *
+     * @param[out] nRead Number of bytes read.
+     * @return false in case of error (nRead is then meaningless).
+     */
+    bool ReadDirect(int fdDirect, void *pBuffer, size_t nSize,
+                    vsi_l_offset nOffset, size_t &nRead);
+
+    /** Alignment constraint of O_DIRECT reads */
+    static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+  private:
+    CPLIOUring() = default;
+    CPL_DISALLOW_COPY_ASSIGN(CPLIOUring)
+
+    struct Request
+    {
+        int fd = -1;
+        GByte *pabyData = nullptr;
+        size_t nSize = 0;
+        vsi_l_offset nOffset = 0;
+        int nBufIndex = -1;
+    };
+
+    bool Init();
+    void Close();
+    bool InitDirectIOBuffers();
+    void QueueRequest(const Request &oReq, size_t nIdx, size_t nAlreadyRead);
+    bool Submit(unsigned &nToSubmit);
+    bool WaitForCompletion();
+    void Drain(unsigned nInFlight);
+    bool Execute(const std::vector<Request> &aoRequests,
+                 std::vector<size_t> &anRead, bool bRetryShortReads);
+
+    int m_fd = -1;
+    unsigned m_nEntries = 0;
+
+    void *m_pSQRing = nullptr;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = nullptr;
+    size_t m_nCQRingSize = 0;
+    void *m_pSQEs = nullptr;
+    size_t m_nSQEsSize = 0;
+
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    void *m_pCQEs = nullptr;
+
+    bool m_bDirectIOBuffersInitialized = false;
+    bool m_bRegisteredBuffers = false;
+    std::vector<GByte *> m_apabyDirectIOBuffers{};
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* CPL_IO_URING_H_INCLUDED */
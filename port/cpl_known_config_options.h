@@ -137,21 +137,35 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HEADER_FILE_KVP_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_REQUESTS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_SPACING", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_IO_URING_DIRECT_IO_MIN_SIZE", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_MULTIPART_UPLOAD_BUFFERS", // from cpl_vsil_s3.cpp
+   "CPL_VSIL_TRACE", // from cpl_vsil_trace.cpp
+   "CPL_VSIL_TRACE_FORMAT", // from cpl_vsil_trace.cpp
+   "CPL_VSIL_TRACE_MAX_EVENTS", // from cpl_vsil_trace.cpp
+   "CPL_VSIL_TRACE_OUTPUT", // from cpl_vsil_trace.cpp
+   "CPL_VSIL_USE_IO_URING", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_ZSTD_FRAME_SIZE", // from cpl_vsil_zstd.cpp
+   "CPL_VSIL_ZSTD_LEVEL", // from cpl_vsil_zstd.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_LIST_OBJECTS_VERSION", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_LIST_UPLOADS_MAX", // from cpl_vsil_s3.cpp
@@ -252,6 +266,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_DAAS_SERVER_BYTE_LIMIT", // from daasdataset.cpp
    "GDAL_DAAS_X_FORWARDED_USER", // from daasdataset.cpp
    "GDAL_DATA", // from cpl_csv.cpp, cpl_findfile.cpp, gdaldrivermanager.cpp
+   "GDAL_DATASET_POOL_REOPEN_HINTS", // from gdalproxypool.cpp
    "GDAL_DEBUG_BLOCK_CACHE", // from gdalrasterblock.cpp
    "GDAL_DEBUG_PROCESS_DYNAMIC_METADATA", // from gdaljp2metadata.cpp
    "GDAL_DEFAULT_CREATE_COPY", // from gdaldriver.cpp
@@ -528,6 +543,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GS_SECRET_ACCESS_KEY", // from cpl_google_cloud.cpp
    "GS_USER_PROJECT", // from cpl_google_cloud.cpp
    "GTI_NUM_THREADS", // from gdaltileindexdataset.cpp
+   "GTI_PREFETCH", // from gdaltileindexdataset.cpp
+   "GTI_SOURCE_CACHE_SIZE", // from gdaltileindexdataset.cpp
    "GTIFF_ALLOW_PREAD", // from gtiffdataset_read.cpp
    "GTIFF_ALPHA", // from gtiffdataset_write.cpp, gtiffrasterband_write.cpp
    "GTIFF_DELETE_ON_ERROR", // from gtiffdataset_write.cpp
@@ -543,6 +560,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTIFF_LINEAR_UNITS", // from gt_wkt_srs.cpp
    "GTIFF_MAX_CUMULATED_MEM_USAGE", // from tifvsi.cpp
    "GTIFF_POINT_GEO_IGNORE", // from gt_wkt_srs.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp
+   "GTIFF_RAW_STRILE_COPY", // from gtiffdataset_write.cpp
    "GTIFF_READ_ANGULAR_PARAMS_IN_DEGREE", // from gt_wkt_srs.cpp
    "GTIFF_REPORT_COMPD_CS", // from gtiffdataset_read.cpp, gtiffdataset_write.cpp
    "GTIFF_SRS_SOURCE", // from gt_wkt_srs.cpp
@@ -710,6 +728,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_APPLY_GEOM_SET_PRECISION", // from ogr2ogr_lib.cpp, ogrlayer.cpp
    "OGR_ARC_MAX_GAP", // from ogrgeometryfactory.cpp
    "OGR_ARC_STEPSIZE", // from ogrgeometryfactory.cpp
+   "OGR_ARROW_COLUMNAR_FILTER", // from ogrlayerarrow.cpp
    "OGR_ARROW_COMPUTE_GEOMETRY_TYPE", // from ogrfeatherlayer.cpp
    "OGR_ARROW_LOAD_FILE_SYSTEM_FACTORIES", // from ogrfeatherdriver.cpp
    "OGR_ARROW_MEM_LIMIT", // from ograrrowarrayhelper.cpp
@@ -832,7 +851,10 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
-   "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_JOIN_MAX_MEMORY", // from ogr_gensql.cpp
+   "OGR_SQL_JOIN_STRATEGY", // from ogr_gensql.cpp
+   "OGR_SQL_LIKE_AS_ILIKE", // from ogrlayerarrow.cpp, ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_SORT_MAX_MEMORY", // from ogr_gensql.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
    "OGR_SQLITE_CACHE", // from ogrgmldatasource.cpp, ogrsqlitedatasource.cpp
@@ -1066,11 +1088,15 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "VRT_ALLOW_MEM_DRIVER", // from vrtrasterband.cpp
    "VRT_MIN_MAX_FROM_SOURCES", // from vrtsourcedrasterband.cpp
    "VRT_NUM_THREADS", // from vrtdataset.cpp
+   "VRT_PROCESSED_DATASET_FUSE_STEPS", // from vrtprocesseddataset.cpp
    "VRT_SHARED_SOURCE", // from vrtsources.cpp
+   "VRT_VECTORIZED_EXPRESSION", // from pixelfunctions.cpp
    "VRT_VIRTUAL_OVERVIEWS", // from gdalbuildvrt_lib.cpp, vrtdataset.cpp
+   "VSI_ASYNC_READ_NUM_THREADS", // from cpl_vsil.cpp
    "VSI_CACHE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp, cpl_vsil_unix_stdio_64.cpp, cpl_vsil_win32.cpp
    "VSI_CACHE_SIZE", // from cpl_vsil_cache.cpp
    "VSI_FLUSH", // from cpl_vsil_win32.cpp
+   "VSI_MEM_BUFFER_POOL_SIZE", // from cpl_vsi_mem.cpp
    "VSIAZ_CHUNK_SIZE", // from cpl_vsil_az.cpp
    "VSIAZ_CHUNK_SIZE_BYTES", // from cpl_vsil_az.cpp
    "VSICRYPT_ADD_KEY_CHECK", // from cpl_vsil_crypt.cpp
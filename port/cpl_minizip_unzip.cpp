@@ -1351,6 +1351,13 @@ unzlocal_CheckCurrentFileCoherencyHeader(unz_s *s, uInt *piSizeVar,
             // ok
         }
         else
+#endif
+#ifdef HAVE_ZSTD
+        if (s->cur_file_info.compression_method == 93)
+        {
+            // ok
+        }
+        else
 #endif
         {
             CPLError(CE_Failure, CPLE_NotSupported,
@@ -1652,6 +1659,13 @@ extern int cpl_unzCurrentFileInfoFromLocalHeader(
             // ok
         }
         else
+#endif
+#ifdef HAVE_ZSTD
+        if (pfile_info->compression_method == 93)
+        {
+            // ok
+        }
+        else
 #endif
         {
             CPLError(CE_Failure, CPLE_NotSupported,
@@ -528,6 +528,11 @@ GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
 void CPL_DLL VSINetworkStatsReset(void);
 char CPL_DLL *VSINetworkStatsGetAsSerializedJSON(char **papszOptions);
 
+void CPL_DLL VSITraceReset(void);
+char CPL_DLL *VSITraceGetAsSerializedJSON(CSLConstList papszOptions);
+void CPL_DLL VSITracePushCaller(const char *pszCaller);
+void CPL_DLL VSITracePopCaller(void);
+
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 extern "C++"
 {
@@ -562,6 +567,7 @@ void VSIInstall7zFileHandler(void);   /* No reason to export that */
 void VSIInstallRarFileHandler(void);  /* No reason to export that */
 void VSIInstallGZipFileHandler(void); /* No reason to export that */
 void VSIInstallZipFileHandler(void);  /* No reason to export that */
+void VSIInstallZstdFileHandler(void); /* No reason to export that */
 void VSIInstallStdinHandler(void);    /* No reason to export that */
 void VSIInstallHdfsHandler(void);     /* No reason to export that */
 void VSIInstallWebHdfsHandler(void);  /* No reason to export that */
@@ -587,6 +593,8 @@ GByte CPL_DLL *VSIGetMemFileBuffer(const char *pszFilename,
                                    int bUnlinkAndSeize);
 
 const char CPL_DLL *VSIMemGenerateHiddenFilename(const char *pszFilename);
+const char CPL_DLL *
+VSIMemGenerateThreadPrivateFilename(const char *pszFilename);
 
 /** Callback used by VSIStdoutSetRedirection() */
 typedef size_t (*VSIWriteFunction)(const void *ptr, size_t size, size_t nmemb,
@@ -25,11 +25,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <mutex>
 // c++17 or VS2017
@@ -86,14 +88,27 @@
 
 constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 
+// szTHREAD_PRIVATE_DIRNAME is for files created by
+// VSIMemGenerateThreadPrivateFilename(pszFilename). Such files are of the
+// form "/vsimem/.#!THREAD!#./{counter}/{pszFilename}", follow the same rules
+// as hidden files regarding implicit directories, but are stored in a table
+// that is specific to the calling thread, and never accessed by other threads.
+// Operations on them thus do not require any locking.
+
+constexpr const char *szTHREAD_PRIVATE_DIRNAME = "/vsimem/.#!THREAD!#.";
+
 /*
 ** Notes on Multithreading:
 **
-** VSIMemFilesystemHandler: This class maintains a mutex to protect
-** access and update of the oFileList array which has all the "files" in
-** the memory filesystem area.  It is expected that multiple threads would
-** want to create and read different files at the same time and so might
-** collide access oFileList without the mutex.
+** VSIMemFileTable: The "files" of the memory filesystem area are stored in
+** a table split into several shards, selected from the hash of the filename,
+** each one protected by its own mutex. It is expected that multiple threads
+** would want to create and read different files at the same time, and they
+** will then rarely collide on the same shard. Operations that need a
+** consistent view of a whole hierarchy (RmdirRecursive, Rename) lock all
+** shards, always in the same order.
+** Files in the thread-private namespace are stored in a table that is
+** local to the thread, without any locking.
 **
 ** VSIMemFile: A mutex protects accesses to the file
 **
@@ -108,6 +123,45 @@ constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 ** threads at once.
 */
 
+/************************************************************************/
+/* ==================================================================== */
+/*                           VSIMemBufferPool                           */
+/* ==================================================================== */
+/************************************************************************/
+
+// Per-thread pool of buffers released by deleted files, that are reused
+// when other files are created or extended, instead of allocating a new
+// buffer. Buffers are stored in power-of-two size classes. The pool is
+// only enabled if the VSI_MEM_BUFFER_POOL_SIZE configuration option is set
+// to a non-zero value when a thread first uses it.
+
+class VSIMemBufferPool
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIMemBufferPool)
+
+    static constexpr int MIN_SIZE_CLASS_LOG2 = 12;  // 4 KB
+    static constexpr int MAX_SIZE_CLASS_LOG2 = 24;  // 16 MB
+    static constexpr int SIZE_CLASS_COUNT =
+        MAX_SIZE_CLASS_LOG2 - MIN_SIZE_CLASS_LOG2 + 1;
+
+    const vsi_l_offset m_nMaxRetainedSize;
+    vsi_l_offset m_nRetainedSize = 0;
+    std::vector<GByte *> m_aapabyBuffers[SIZE_CLASS_COUNT];
+
+    static VSIMemBufferPool *GetForCurrentThread();
+
+  public:
+    explicit VSIMemBufferPool(vsi_l_offset nMaxRetainedSize)
+        : m_nMaxRetainedSize(nMaxRetainedSize)
+    {
+    }
+
+    ~VSIMemBufferPool();
+
+    static GByte *Acquire(vsi_l_offset &nSize);
+    static void Release(GByte *pabyData, vsi_l_offset nSize);
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              VSIMemFile                              */
@@ -178,6 +232,58 @@ class VSIMemHandle final : public VSIVirtualHandle
                  vsi_l_offset /*nOffset*/) const override;
 };
 
+/************************************************************************/
+/* ==================================================================== */
+/*                           VSIMemFileTable                            */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIMemFileTable
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIMemFileTable)
+
+    struct Shard
+    {
+        std::mutex oMutex{};
+        std::map<std::string, std::shared_ptr<VSIMemFile>> oMap{};
+    };
+
+    const bool m_bThreadSafe;
+    std::vector<Shard> m_aoShards;
+
+    Shard &GetShard(const std::string &osFilename)
+    {
+        return m_aoShards[std::hash<std::string>()(osFilename) %
+                          m_aoShards.size()];
+    }
+
+    std::unique_lock<std::mutex> Lock(Shard &oShard)
+    {
+        return m_bThreadSafe ? std::unique_lock<std::mutex>(oShard.oMutex)
+                             : std::unique_lock<std::mutex>();
+    }
+
+    std::vector<std::unique_lock<std::mutex>> LockAll();
+
+  public:
+    VSIMemFileTable(size_t nShards, bool bThreadSafe)
+        : m_bThreadSafe(bThreadSafe), m_aoShards(nShards)
+    {
+    }
+
+    std::shared_ptr<VSIMemFile> Find(const std::string &osFilename);
+    std::shared_ptr<VSIMemFile>
+    Emplace(const std::shared_ptr<VSIMemFile> &poFile);
+    std::shared_ptr<VSIMemFile>
+    Replace(const std::shared_ptr<VSIMemFile> &poFile);
+    std::shared_ptr<VSIMemFile> Erase(const std::string &osFilename);
+    std::vector<std::shared_ptr<VSIMemFile>>
+    EraseIf(const std::string &osPrefix,
+            const std::function<bool(const std::string &)> &pfnPredicate);
+    std::vector<std::string> ListFilenames(const std::string &osPrefix);
+    bool Rename(const std::string &osOldPath, const std::string &osNewPath);
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIMemFilesystemHandler                        */
@@ -187,19 +293,17 @@ class VSIMemHandle final : public VSIVirtualHandle
 class VSIMemFilesystemHandler final : public VSIFilesystemHandler
 {
     const std::string m_osPrefix;
+    VSIMemFileTable m_oTable{SHARD_COUNT, true};
     CPL_DISALLOW_COPY_ASSIGN(VSIMemFilesystemHandler)
 
   public:
-    std::map<std::string, std::shared_ptr<VSIMemFile>> oFileList{};
-    CPLMutex *hMutex = nullptr;
+    static constexpr size_t SHARD_COUNT = 64;
 
     explicit VSIMemFilesystemHandler(const char *pszPrefix)
         : m_osPrefix(pszPrefix)
     {
     }
 
-    ~VSIMemFilesystemHandler() override;
-
     VSIVirtualHandleUniquePtr Open(const char *pszFilename,
                                    const char *pszAccess, bool bSetError,
                                    CSLConstList /* papszOptions */) override;
@@ -222,7 +326,7 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
         return NormalizePath(osFilename);
     }
 
-    int Unlink_unlocked(const char *pszFilename);
+    VSIMemFileTable &GetTable(const std::string &osFilename);
 
     VSIFilesystemHandler *Duplicate(const char *pszPrefix) override
     {
@@ -252,7 +356,7 @@ VSIMemFile::VSIMemFile()
 VSIMemFile::~VSIMemFile()
 {
     if (bOwnData && pabyData)
-        CPLFree(pabyData);
+        VSIMemBufferPool::Release(pabyData, nAllocLength);
 }
 
 /************************************************************************/
@@ -289,18 +393,36 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
         // If the first allocation is 1 MB or above, just take that value
         // as the one to allocate
         // Otherwise slightly reserve more to avoid too frequent reallocations.
-        const vsi_l_offset nNewAlloc =
+        vsi_l_offset nNewAlloc =
             (nAllocLength == 0 && nNewLength >= 1024 * 1024)
                 ? nNewLength
                 : nNewLength + nNewLength / 10 + 5000;
-        GByte *pabyNewData = nullptr;
-        if (static_cast<vsi_l_offset>(static_cast<size_t>(nNewAlloc)) ==
-            nNewAlloc)
+        GByte *pabyNewData = VSIMemBufferPool::Acquire(nNewAlloc);
+        if (pabyNewData)
+        {
+            if (nLength > 0)
+                memcpy(pabyNewData, pabyData, static_cast<size_t>(nLength));
+            // A pooled buffer has the content of its previous user
+            memset(pabyNewData + nLength, 0,
+                   static_cast<size_t>(nNewAlloc - nLength));
+            if (pabyData)
+                VSIMemBufferPool::Release(pabyData, nAllocLength);
+        }
+        else if (static_cast<vsi_l_offset>(static_cast<size_t>(nNewAlloc)) ==
+                 nNewAlloc)
         {
             pabyNewData = static_cast<GByte *>(
                 nAllocLength == 0
                     ? VSICalloc(1, static_cast<size_t>(nNewAlloc))
                     : VSIRealloc(pabyData, static_cast<size_t>(nNewAlloc)));
+            if (pabyNewData && nAllocLength > 0)
+            {
+                // Clear the new allocated part of the buffer (only needed if
+                // there was already reserved memory, otherwise VSICalloc() has
+                // zeroized it already)
+                memset(pabyNewData + nAllocLength, 0,
+                       static_cast<size_t>(nNewAlloc - nAllocLength));
+            }
         }
         if (pabyNewData == nullptr)
         {
@@ -311,20 +433,13 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
             return false;
         }
 
-        if (nAllocLength > 0)
-        {
-            // Clear the new allocated part of the buffer (only needed if
-            // there was already reserved memory, otherwise VSICalloc() has
-            // zeroized it already)
-            memset(pabyNewData + nAllocLength, 0,
-                   static_cast<size_t>(nNewAlloc - nAllocLength));
-        }
-
         pabyData = pabyNewData;
         nAllocLength = nNewAlloc;
     }
     else if (nNewLength < nLength)
     {
+        // Keep the bytes after the end of file zeroed, as callers may use
+        // the buffer as a nul-terminated string.
         memset(pabyData + nNewLength, 0,
                static_cast<size_t>(nLength - nNewLength));
     }
@@ -335,6 +450,139 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
     return true;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                           VSIMemBufferPool                           */
+/* ==================================================================== */
+/************************************************************************/
+
+// Set when the pool of the current thread has been destroyed, so that
+// files destroyed afterwards during thread exit (thread-private files)
+// do not try to access it.
+static thread_local bool gbThreadBufferPoolDestroyed = false;
+
+/************************************************************************/
+/*                         ~VSIMemBufferPool()                          */
+/************************************************************************/
+
+VSIMemBufferPool::~VSIMemBufferPool()
+{
+    for (auto &apabyBuffers : m_aapabyBuffers)
+    {
+        for (GByte *pabyData : apabyBuffers)
+            VSIFree(pabyData);
+    }
+}
+
+/************************************************************************/
+/*                        GetForCurrentThread()                         */
+/************************************************************************/
+
+VSIMemBufferPool *VSIMemBufferPool::GetForCurrentThread()
+{
+    if (gbThreadBufferPoolDestroyed)
+        return nullptr;
+
+    struct PoolHolder
+    {
+        std::unique_ptr<VSIMemBufferPool> poPool{};
+
+        // Read the configuration option only once per thread, to avoid
+        // taking the global configuration mutex each time a file is created
+        // or extended
+        PoolHolder()
+        {
+            GIntBig nMaxRetainedSize = 0;
+            const char *pszPoolSize =
+                CPLGetConfigOption("VSI_MEM_BUFFER_POOL_SIZE", "0");
+            if (CPLParseMemorySize(pszPoolSize, &nMaxRetainedSize, nullptr) ==
+                    CE_None &&
+                nMaxRetainedSize > 0)
+            {
+                poPool = std::make_unique<VSIMemBufferPool>(
+                    static_cast<vsi_l_offset>(nMaxRetainedSize));
+            }
+        }
+
+        ~PoolHolder()
+        {
+            poPool.reset();
+            gbThreadBufferPoolDestroyed = true;
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(PoolHolder)
+    };
+
+    static thread_local PoolHolder tlsHolder;
+    return tlsHolder.poPool.get();
+}
+
+/************************************************************************/
+/*                              Acquire()                               */
+/************************************************************************/
+
+// Return a pooled buffer of at least nSize bytes, nSize being then set to its
+// capacity, or nullptr. If the pool is enabled, nSize is rounded up to its
+// size class even if no buffer is available, so that the buffer allocated
+// by the caller can later be pooled.
+GByte *VSIMemBufferPool::Acquire(vsi_l_offset &nSize)
+{
+    VSIMemBufferPool *poPool = GetForCurrentThread();
+    if (!poPool ||
+        nSize > (static_cast<vsi_l_offset>(1) << MAX_SIZE_CLASS_LOG2))
+    {
+        return nullptr;
+    }
+
+    int nClassLog2 = MIN_SIZE_CLASS_LOG2;
+    while ((static_cast<vsi_l_offset>(1) << nClassLog2) < nSize)
+        ++nClassLog2;
+    nSize = static_cast<vsi_l_offset>(1) << nClassLog2;
+
+    auto &apabyBuffers =
+        poPool->m_aapabyBuffers[nClassLog2 - MIN_SIZE_CLASS_LOG2];
+    if (apabyBuffers.empty())
+        return nullptr;
+    GByte *pabyData = apabyBuffers.back();
+    apabyBuffers.pop_back();
+    poPool->m_nRetainedSize -= nSize;
+    return pabyData;
+}
+
+/************************************************************************/
+/*                              Release()                               */
+/************************************************************************/
+
+// Take ownership of a buffer of nSize bytes, and either keep it in the pool,
+// or free it.
+void VSIMemBufferPool::Release(GByte *pabyData, vsi_l_offset nSize)
+{
+    VSIMemBufferPool *poPool = GetForCurrentThread();
+    if (!poPool ||
+        nSize < (static_cast<vsi_l_offset>(1) << MIN_SIZE_CLASS_LOG2) ||
+        nSize >= (static_cast<vsi_l_offset>(2) << MAX_SIZE_CLASS_LOG2))
+    {
+        VSIFree(pabyData);
+        return;
+    }
+
+    // Buffers are stored in the largest class whose size they can hold
+    int nClassLog2 = MAX_SIZE_CLASS_LOG2;
+    while ((static_cast<vsi_l_offset>(1) << nClassLog2) > nSize)
+        --nClassLog2;
+    const vsi_l_offset nClassSize = static_cast<vsi_l_offset>(1)
+                                    << nClassLog2;
+    if (poPool->m_nRetainedSize + nClassSize > poPool->m_nMaxRetainedSize)
+    {
+        VSIFree(pabyData);
+        return;
+    }
+
+    poPool->m_aapabyBuffers[nClassLog2 - MIN_SIZE_CLASS_LOG2].push_back(
+        pabyData);
+    poPool->m_nRetainedSize += nClassSize;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             VSIMemHandle                             */
@@ -590,22 +838,229 @@ int VSIMemHandle::Truncate(vsi_l_offset nNewSize)
 
 /************************************************************************/
 /* ==================================================================== */
-/*                       VSIMemFilesystemHandler                        */
+/*                           VSIMemFileTable                            */
 /* ==================================================================== */
 /************************************************************************/
 
 /************************************************************************/
-/*                      ~VSIMemFilesystemHandler()                      */
+/*                              LockAll()                               */
+/************************************************************************/
+
+std::vector<std::unique_lock<std::mutex>> VSIMemFileTable::LockAll()
+{
+    std::vector<std::unique_lock<std::mutex>> aoLocks;
+    if (m_bThreadSafe)
+    {
+        aoLocks.reserve(m_aoShards.size());
+        for (auto &oShard : m_aoShards)
+            aoLocks.emplace_back(oShard.oMutex);
+    }
+    return aoLocks;
+}
+
+/************************************************************************/
+/*                                Find()                                */
+/************************************************************************/
+
+std::shared_ptr<VSIMemFile>
+VSIMemFileTable::Find(const std::string &osFilename)
+{
+    Shard &oShard = GetShard(osFilename);
+    const auto oLock = Lock(oShard);
+    const auto oIter = oShard.oMap.find(osFilename);
+    return oIter != oShard.oMap.end() ? oIter->second : nullptr;
+}
+
+/************************************************************************/
+/*                              Emplace()                               */
 /************************************************************************/
 
-VSIMemFilesystemHandler::~VSIMemFilesystemHandler()
+// Insert poFile if there is no file of the same name, and return the file
+// that is in the table afterwards.
+std::shared_ptr<VSIMemFile>
+VSIMemFileTable::Emplace(const std::shared_ptr<VSIMemFile> &poFile)
+{
+    Shard &oShard = GetShard(poFile->osFilename);
+    const auto oLock = Lock(oShard);
+    return oShard.oMap.emplace(poFile->osFilename, poFile).first->second;
+}
+
+/************************************************************************/
+/*                              Replace()                               */
+/************************************************************************/
 
+// Insert poFile, and return the file of the same name it replaces, if any,
+// so that it is destroyed by the caller out of the lock.
+std::shared_ptr<VSIMemFile>
+VSIMemFileTable::Replace(const std::shared_ptr<VSIMemFile> &poFile)
 {
-    oFileList.clear();
+    Shard &oShard = GetShard(poFile->osFilename);
+    const auto oLock = Lock(oShard);
+    auto &poSlot = oShard.oMap[poFile->osFilename];
+    std::shared_ptr<VSIMemFile> poOldFile = std::move(poSlot);
+    poSlot = poFile;
+    return poOldFile;
+}
 
-    if (hMutex != nullptr)
-        CPLDestroyMutex(hMutex);
-    hMutex = nullptr;
+/************************************************************************/
+/*                               Erase()                                */
+/************************************************************************/
+
+std::shared_ptr<VSIMemFile>
+VSIMemFileTable::Erase(const std::string &osFilename)
+{
+    Shard &oShard = GetShard(osFilename);
+    const auto oLock = Lock(oShard);
+    const auto oIter = oShard.oMap.find(osFilename);
+    if (oIter == oShard.oMap.end())
+        return nullptr;
+    std::shared_ptr<VSIMemFile> poFile = std::move(oIter->second);
+    oShard.oMap.erase(oIter);
+    return poFile;
+}
+
+/************************************************************************/
+/*                              EraseIf()                               */
+/************************************************************************/
+
+// Erase all files whose name starts with osPrefix and for which
+// pfnPredicate returns true, atomically with respect to other operations.
+std::vector<std::shared_ptr<VSIMemFile>> VSIMemFileTable::EraseIf(
+    const std::string &osPrefix,
+    const std::function<bool(const std::string &)> &pfnPredicate)
+{
+    std::vector<std::shared_ptr<VSIMemFile>> apoErased;
+    const auto aoLocks = LockAll();
+    for (auto &oShard : m_aoShards)
+    {
+        for (auto oIter = oShard.oMap.lower_bound(osPrefix);
+             oIter != oShard.oMap.end() &&
+             cpl::starts_with(oIter->first, osPrefix);
+             /* no automatic increment */)
+        {
+            if (pfnPredicate(oIter->first))
+            {
+                apoErased.push_back(std::move(oIter->second));
+                oIter = oShard.oMap.erase(oIter);
+            }
+            else
+            {
+                ++oIter;
+            }
+        }
+    }
+    return apoErased;
+}
+
+/************************************************************************/
+/*                           ListFilenames()                            */
+/************************************************************************/
+
+// Return the sorted list of the names of the files starting with osPrefix.
+std::vector<std::string>
+VSIMemFileTable::ListFilenames(const std::string &osPrefix)
+{
+    std::vector<std::string> aosFilenames;
+    for (auto &oShard : m_aoShards)
+    {
+        const auto oLock = Lock(oShard);
+        for (auto oIter = oShard.oMap.lower_bound(osPrefix);
+             oIter != oShard.oMap.end() &&
+             cpl::starts_with(oIter->first, osPrefix);
+             ++oIter)
+        {
+            aosFilenames.push_back(oIter->first);
+        }
+    }
+    std::sort(aosFilenames.begin(), aosFilenames.end());
+    return aosFilenames;
+}
+
+/************************************************************************/
+/*                               Rename()                               */
+/************************************************************************/
+
+// Rename osOldPath, and the files under it if it is a directory. Files of
+// the new names are replaced. Returns false if osOldPath does not exist.
+bool VSIMemFileTable::Rename(const std::string &osOldPath,
+                             const std::string &osNewPath)
+{
+    // Replaced files are destroyed after the locks are released
+    std::vector<std::shared_ptr<VSIMemFile>> apoReplaced;
+    const auto aoLocks = LockAll();
+
+    if (GetShard(osOldPath).oMap.count(osOldPath) == 0)
+        return false;
+
+    std::vector<std::shared_ptr<VSIMemFile>> apoMoved;
+    for (auto &oShard : m_aoShards)
+    {
+        for (auto oIter = oShard.oMap.lower_bound(osOldPath);
+             oIter != oShard.oMap.end() &&
+             cpl::starts_with(oIter->first, osOldPath);
+             /* no automatic increment */)
+        {
+            const char *pszRemainder = oIter->first.c_str() + osOldPath.size();
+            if (pszRemainder[0] == 0 || pszRemainder[0] == '/')
+            {
+                apoMoved.push_back(std::move(oIter->second));
+                oIter = oShard.oMap.erase(oIter);
+            }
+            else
+            {
+                ++oIter;
+            }
+        }
+    }
+
+    for (auto &poFile : apoMoved)
+    {
+        poFile->osFilename =
+            osNewPath + poFile->osFilename.substr(osOldPath.size());
+        auto &poSlot = GetShard(poFile->osFilename).oMap[poFile->osFilename];
+        if (poSlot)
+            apoReplaced.push_back(std::move(poSlot));
+        poSlot = std::move(poFile);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIMemFilesystemHandler                        */
+/* ==================================================================== */
+/************************************************************************/
+
+/************************************************************************/
+/*                        GetHiddenRootDirname()                        */
+/************************************************************************/
+
+// Return szHIDDEN_DIRNAME or szTHREAD_PRIVATE_DIRNAME if osPath is one of
+// them or is located under one of them, or nullptr otherwise.
+static const char *GetHiddenRootDirname(const std::string &osPath)
+{
+    for (const char *pszRoot : {szHIDDEN_DIRNAME, szTHREAD_PRIVATE_DIRNAME})
+    {
+        if (STARTS_WITH(osPath.c_str(), pszRoot))
+            return pszRoot;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                              GetTable()                              */
+/************************************************************************/
+
+VSIMemFileTable &
+VSIMemFilesystemHandler::GetTable(const std::string &osFilename)
+{
+    if (STARTS_WITH(osFilename.c_str(), szTHREAD_PRIVATE_DIRNAME))
+    {
+        static thread_local VSIMemFileTable tlsThreadPrivateTable(1, false);
+        return tlsThreadPrivateTable;
+    }
+    return m_oTable;
 }
 
 /************************************************************************/
@@ -617,7 +1072,6 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
                               bool bSetError, CSLConstList /* papszOptions */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
     const CPLString osFilename = NormalizePath(pszFilename);
     if (osFilename.empty())
         return nullptr;
@@ -633,12 +1087,8 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /* -------------------------------------------------------------------- */
     /*      Get the filename we are opening, create if needed.              */
     /* -------------------------------------------------------------------- */
-    std::shared_ptr<VSIMemFile> poFile = nullptr;
-    const auto oIter = oFileList.find(osFilename);
-    if (oIter != oFileList.end())
-    {
-        poFile = oIter->second;
-    }
+    VSIMemFileTable &oTable = GetTable(osFilename);
+    std::shared_ptr<VSIMemFile> poFile = oTable.Find(osFilename);
 
     // If no file and opening in read, error out.
     if (strstr(pszAccess, "w") == nullptr &&
@@ -653,6 +1103,7 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     }
 
     // Create.
+    bool bCreated = false;
     if (poFile == nullptr)
     {
         const std::string osFileDir = CPLGetPathSafe(osFilename.c_str());
@@ -668,17 +1119,20 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
             return nullptr;
         }
 
-        poFile = std::make_shared<VSIMemFile>();
-        poFile->osFilename = osFilename;
-        oFileList[poFile->osFilename] = poFile;
+        auto poNewFile = std::make_shared<VSIMemFile>();
+        poNewFile->osFilename = osFilename;
+        poNewFile->nMaxLength = nMaxLength;
+        // Another thread may have created the file in the meantime
+        poFile = oTable.Emplace(poNewFile);
+        bCreated = poFile == poNewFile;
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
                  static_cast<int>(poFile.use_count()));
 #endif
-        poFile->nMaxLength = nMaxLength;
     }
+
     // Overwrite
-    else if (strstr(pszAccess, "w"))
+    if (!bCreated && strstr(pszAccess, "w"))
     {
         CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
         poFile->SetLength(0);
@@ -728,8 +1182,6 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
                                   VSIStatBufL *pStatBuf, int /* nFlags */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osFilename = NormalizePath(pszFilename);
 
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
@@ -741,17 +1193,13 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
         return 0;
     }
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile = GetTable(osFilename).Find(osFilename);
+    if (poFile == nullptr)
     {
         errno = ENOENT;
         return -1;
     }
 
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
-
-    memset(pStatBuf, 0, sizeof(VSIStatBufL));
-
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     if (poFile->bIsDirectory)
     {
@@ -783,33 +1231,21 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
 
 int VSIMemFilesystemHandler::Unlink(const char *pszFilename)
 
-{
-    CPLMutexHolder oHolder(&hMutex);
-    return Unlink_unlocked(pszFilename);
-}
-
-/************************************************************************/
-/*                          Unlink_unlocked()                           */
-/************************************************************************/
-
-int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
-
 {
     const CPLString osFilename = NormalizePath(pszFilename);
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile =
+        GetTable(osFilename).Erase(osFilename);
+    if (poFile == nullptr)
     {
         errno = ENOENT;
         return -1;
     }
 
 #ifdef DEBUG_VERBOSE
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
     CPLDebug("VSIMEM", "Unlink %s: ref_count=%d (before)", pszFilename,
              static_cast<int>(poFile.use_count()));
 #endif
-    oFileList.erase(oIter);
 
     return 0;
 }
@@ -821,37 +1257,32 @@ int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
 int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPathname = NormalizePath(pszPathname);
-    if (STARTS_WITH(osPathname.c_str(), szHIDDEN_DIRNAME))
+    if (const char *pszHiddenRoot = GetHiddenRootDirname(osPathname))
     {
-        if (osPathname.size() == strlen(szHIDDEN_DIRNAME))
+        const size_t nHiddenRootLen = strlen(pszHiddenRoot);
+        if (osPathname.size() == nHiddenRootLen)
             return 0;
         // "/vsimem/.#!HIDDEN!#./{unique_counter}"
-        else if (osPathname.find('/', strlen(szHIDDEN_DIRNAME) + 1) ==
-                 std::string::npos)
+        else if (osPathname.find('/', nHiddenRootLen + 1) == std::string::npos)
             return 0;
 
         // If "/vsimem/.#!HIDDEN!#./{unique_counter}/user_directory", then
         // accept creating an explicit directory
     }
 
-    if (oFileList.find(osPathname) != oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile = std::make_shared<VSIMemFile>();
+    poFile->osFilename = osPathname;
+    poFile->bIsDirectory = true;
+    if (GetTable(osPathname).Emplace(poFile) != poFile)
     {
         errno = EEXIST;
         return -1;
     }
-
-    std::shared_ptr<VSIMemFile> poFile = std::make_shared<VSIMemFile>();
-    poFile->osFilename = osPathname;
-    poFile->bIsDirectory = true;
-    oFileList[osPathname] = poFile;
 #ifdef DEBUG_VERBOSE
     CPLDebug("VSIMEM", "Mkdir on %s: ref_count=%d", pszPathname,
              static_cast<int>(poFile.use_count()));
 #endif
-    CPL_IGNORE_RET_VAL(poFile);
     return 0;
 }
 
@@ -871,61 +1302,39 @@ int VSIMemFilesystemHandler::Rmdir(const char *pszPathname)
 
 int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszDirname);
     const size_t nPathLen = osPath.size();
-    int ret = 0;
     if (osPath == "/vsimem")
     {
         // Clean-up all files under pszDirname, except hidden directories
         // if called from "/vsimem"
-        for (auto iter = oFileList.begin(); iter != oFileList.end();
-             /* no automatic increment */)
-        {
-            const char *pszFilePath = iter->second->osFilename.c_str();
-            const size_t nFileLen = iter->second->osFilename.size();
-            if (nFileLen > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                pszFilePath[nPathLen] == '/' &&
-                !STARTS_WITH(pszFilePath, szHIDDEN_DIRNAME))
-            {
-                iter = oFileList.erase(iter);
-            }
-            else
-            {
-                ++iter;
-            }
-        }
+        m_oTable.EraseIf(osPath + '/',
+                         [](const std::string &osFilename)
+                         {
+                             return !STARTS_WITH(osFilename.c_str(),
+                                                 szHIDDEN_DIRNAME);
+                         });
+        return 0;
     }
-    else
-    {
-        ret = -1;
-        for (auto iter = oFileList.begin(); iter != oFileList.end();
-             /* no automatic increment */)
+
+    const auto apoErased = GetTable(osPath).EraseIf(
+        osPath,
+        [nPathLen](const std::string &osFilename)
         {
-            const char *pszFilePath = iter->second->osFilename.c_str();
-            const size_t nFileLen = iter->second->osFilename.size();
-            if (nFileLen >= nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                (nFileLen == nPathLen || pszFilePath[nPathLen] == '/'))
-            {
-                // If VSIRmdirRecursive() is used correctly, it should at
-                // least delete the directory on which it has been called
-                ret = 0;
-                iter = oFileList.erase(iter);
-            }
-            else
-            {
-                ++iter;
-            }
-        }
+            return osFilename.size() == nPathLen ||
+                   osFilename[nPathLen] == '/';
+        });
 
-        // Make sure that it always succeed on the root hidden directory
-        if (osPath == szHIDDEN_DIRNAME)
-            ret = 0;
-    }
-    return ret;
+    // If VSIRmdirRecursive() is used correctly, it should at least delete
+    // the directory on which it has been called
+    if (!apoErased.empty())
+        return 0;
+
+    // Make sure that it always succeed on the root hidden directories
+    if (osPath == szHIDDEN_DIRNAME || osPath == szTHREAD_PRIVATE_DIRNAME)
+        return 0;
+
+    return -1;
 }
 
 /************************************************************************/
@@ -935,8 +1344,6 @@ int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszPath);
 
     char **papszDir = nullptr;
@@ -947,18 +1354,17 @@ char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
     int nItems = 0;
     int nAllocatedItems = 0;
 
-    if (osPath == szHIDDEN_DIRNAME)
+    if (osPath == szHIDDEN_DIRNAME || osPath == szTHREAD_PRIVATE_DIRNAME)
     {
         // Special mode for hidden filenames.
         // "/vsimem/.#!HIDDEN!#./{counter}" subdirectories are not explicitly
-        // created so they do not appear in oFileList, but their subcontent
-        // (e.g "/vsimem/.#!HIDDEN!#./{counter}/foo") does
+        // created so they do not appear in the file table, but their
+        // subcontent (e.g "/vsimem/.#!HIDDEN!#./{counter}/foo") does
         std::set<std::string> oSetSubDirs;
-        for (const auto &iter : oFileList)
+        for (const auto &osFilename : GetTable(osPath).ListFilenames(osPath))
         {
-            const char *pszFilePath = iter.second->osFilename.c_str();
-            if (iter.second->osFilename.size() > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0)
+            const char *pszFilePath = osFilename.c_str();
+            if (osFilename.size() > nPathLen)
             {
                 char *pszItem = CPLStrdup(pszFilePath + nPathLen + 1);
                 char *pszSlash = strchr(pszItem, '/');
@@ -995,13 +1401,11 @@ char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
     }
     else
     {
-        for (const auto &iter : oFileList)
+        for (const auto &osFilename :
+             GetTable(osPath).ListFilenames(osPath + '/'))
         {
-            const char *pszFilePath = iter.second->osFilename.c_str();
-            if (iter.second->osFilename.size() > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                pszFilePath[nPathLen] == '/' &&
-                strstr(pszFilePath + nPathLen + 1, "/") == nullptr)
+            const char *pszFilePath = osFilename.c_str();
+            if (strstr(pszFilePath + nPathLen + 1, "/") == nullptr)
             {
                 if (nItems == 0)
                 {
@@ -1038,8 +1442,6 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
                                     void *)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const std::string osOldPath = NormalizePath(pszOldPath);
     const std::string osNewPath = NormalizePath(pszNewPath);
     if (!STARTS_WITH(pszNewPath, m_osPrefix.c_str()))
@@ -1048,29 +1450,18 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
     if (osOldPath.compare(osNewPath) == 0)
         return 0;
 
-    if (oFileList.find(osOldPath) == oFileList.end())
+    // Files cannot be moved between the shared and thread-private tables
+    VSIMemFileTable &oTable = GetTable(osOldPath);
+    if (&oTable != &GetTable(osNewPath))
     {
-        errno = ENOENT;
+        errno = EXDEV;
         return -1;
     }
 
-    std::map<std::string, std::shared_ptr<VSIMemFile>>::iterator it =
-        oFileList.find(osOldPath);
-    while (it != oFileList.end() && it->first.find(osOldPath) == 0)
+    if (!oTable.Rename(osOldPath, osNewPath))
     {
-        const std::string osRemainder = it->first.substr(osOldPath.size());
-        if (osRemainder.empty() || osRemainder[0] == '/')
-        {
-            const std::string osNewFullPath = osNewPath + osRemainder;
-            Unlink_unlocked(osNewFullPath.c_str());
-            oFileList[osNewFullPath] = it->second;
-            it->second->osFilename = osNewFullPath;
-            oFileList.erase(it++);
-        }
-        else
-        {
-            ++it;
-        }
+        errno = ENOENT;
+        return -1;
     }
 
     return 0;
@@ -1234,9 +1625,7 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
 
     if (!osFilename.empty())
     {
-        CPLMutexHolder oHolder(&poHandler->hMutex);
-        poHandler->Unlink_unlocked(osFilename);
-        poHandler->oFileList[poFile->osFilename] = poFile;
+        poHandler->GetTable(osFilename).Replace(poFile);
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIFileFromMemBuffer() %s: ref_count=%d (after)",
                  poFile->osFilename.c_str(),
@@ -1289,12 +1678,12 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
     const std::string osFilename =
         VSIMemFilesystemHandler::NormalizePath(pszFilename);
 
-    CPLMutexHolder oHolder(&poHandler->hMutex);
-
-    if (poHandler->oFileList.find(osFilename) == poHandler->oFileList.end())
+    VSIMemFileTable &oTable = poHandler->GetTable(osFilename);
+    std::shared_ptr<VSIMemFile> poFile =
+        bUnlinkAndSeize ? oTable.Erase(osFilename) : oTable.Find(osFilename);
+    if (poFile == nullptr)
         return nullptr;
 
-    std::shared_ptr<VSIMemFile> poFile = poHandler->oFileList[osFilename];
     GByte *pabyData = poFile->pabyData;
     if (pnDataLength != nullptr)
         *pnDataLength = poFile->nLength;
@@ -1307,7 +1696,6 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
         else
             poFile->bOwnData = false;
 
-        poHandler->oFileList.erase(poHandler->oFileList.find(osFilename));
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIGetMemFileBuffer() %s: ref_count=%d (before)",
                  poFile->osFilename.c_str(),
@@ -1360,3 +1748,40 @@ const char *VSIMemGenerateHiddenFilename(const char *pszFilename)
     return CPLSPrintf("%s/%u/%s", szHIDDEN_DIRNAME, ++nCounter,
                       pszFilename ? pszFilename : "unnamed");
 }
+
+/************************************************************************/
+/*                VSIMemGenerateThreadPrivateFilename()                 */
+/************************************************************************/
+
+/**
+ * \brief Generates a unique filename, private to the calling thread, that
+ * can be used with the /vsimem/ virtual file system.
+ *
+ * Such filenames behave as the ones returned by VSIMemGenerateHiddenFilename(),
+ * except that the corresponding files are only visible from the thread that
+ * created them: they are stored in a file table specific to that thread, so
+ * creating, opening, listing or deleting them does not involve any locking.
+ * This is intended for short-lived temporary files in workloads where many
+ * threads concurrently create and delete in-memory files.
+ *
+ * File handles opened on such files may be used by other threads, but other
+ * threads cannot open, stat or delete those files by their name.
+ * Files that have not been deleted when the thread terminates are destroyed at
+ * that time (their content remains available through already opened handles).
+ *
+ * @param pszFilename the filename to be appended at the end of the returned
+ *                    filename. If not specified, defaults to "unnamed".
+ *
+ * @return pointer to a short-lived string (rotating buffer of strings in
+ * thread-local storage). It is recommended to use CPLStrdup() or std::string()
+ * immediately on it.
+ *
+ * @since GDAL 3.14
+ */
+const char *VSIMemGenerateThreadPrivateFilename(const char *pszFilename)
+{
+    // As the namespace is private to the thread, so is the counter
+    static thread_local uint32_t nCounter = 0;
+    return CPLSPrintf("%s/%u/%s", szTHREAD_PRIVATE_DIRNAME, ++nCounter,
+                      pszFilename ? pszFilename : "unnamed");
+}
@@ -23,9 +23,12 @@
 #include "cpl_string.h"
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -207,6 +210,16 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    /** Callback invoked when all ranges of a SubmitRead() request have been
+     * processed. bSuccess is true if all of them were entirely read.
+     */
+    typedef std::function<void(bool bSuccess)> ReadCompletionCallback;
+
+    virtual std::future<bool>
+    SubmitRead(int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+               const size_t *panSizes,
+               ReadCompletionCallback pfnCallback = nullptr);
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -361,6 +374,15 @@ class VSIProxyFileHandle /* non final */ : public VSIVirtualHandle
         return m_nativeHandle->PRead(pBuffer, nSize, nOffset);
     }
 
+    std::future<bool> SubmitRead(int nRanges, void **ppData,
+                                 const vsi_l_offset *panOffsets,
+                                 const size_t *panSizes,
+                                 ReadCompletionCallback pfnCallback) override
+    {
+        return m_nativeHandle->SubmitRead(nRanges, ppData, panOffsets,
+                                          panSizes, std::move(pfnCallback));
+    }
+
     void Interrupt() override
     {
         m_nativeHandle->Interrupt();
@@ -834,6 +856,25 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
                                         size_t nSOZIPIndexEltSize,
                                         std::vector<uint8_t> *panSOZIPIndex);
 
+VSIVirtualHandle *
+VSICreateZstdReadHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                        vsi_l_offset nStartOffset, vsi_l_offset nCompressedSize,
+                        vsi_l_offset nUncompressedSize);
+
+VSIVirtualHandleUniquePtr CPL_DLL
+VSITraceWrapHandle(VSIVirtualHandleUniquePtr poHandle, const char *pszFilename);
+
+/** Scoped call to VSITracePushCaller() / VSITracePopCaller() */
+class CPL_DLL VSITraceCallerContext
+{
+  public:
+    explicit VSITraceCallerContext(const char *pszCaller);
+    ~VSITraceCallerContext();
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(VSITraceCallerContext)
+};
+
 VSIVirtualHandle *
 VSICreateUploadOnCloseFile(VSIVirtualHandleUniquePtr &&poWritableHandle,
                            VSIVirtualHandleUniquePtr &&poTmpFile,
@@ -24,6 +24,7 @@
 #include <fcntl.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -39,6 +40,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_worker_thread_pool.h"
 
 // To avoid aliasing to GetDiskFreeSpace to GetDiskFreeSpaceA on Windows
 #ifdef GetDiskFreeSpace
@@ -2063,7 +2065,9 @@ VSIFilesystemHandler::OpenStatic(const char *pszFilename, const char *pszAccess,
 {
     VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(pszFilename);
 
-    return poFSHandler->Open(pszFilename, pszAccess, bSetError, papszOptions);
+    return VSITraceWrapHandle(
+        poFSHandler->Open(pszFilename, pszAccess, bSetError, papszOptions),
+        pszFilename);
 }
 
 /************************************************************************/
@@ -2905,8 +2909,10 @@ VSILFILE *VSIFOpenEx2L(const char *pszFilename, const char *pszAccess,
 
     VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(pszFilename);
 
-    auto fp = poFSHandler->Open(pszFilename, pszAccess, CPL_TO_BOOL(bSetError),
-                                papszOptions);
+    auto fp = VSITraceWrapHandle(poFSHandler->Open(pszFilename, pszAccess,
+                                                   CPL_TO_BOOL(bSetError),
+                                                   papszOptions),
+                                 pszFilename);
 
     VSIDebug4("VSIFOpenEx2L(%s,%s,%d) = %p", pszFilename, pszAccess, bSetError,
               fp.get());
@@ -4260,6 +4266,9 @@ VSIFileManager *VSIFileManager::Get()
     VSIInstallGZipFileHandler();
     VSIInstallZipFileHandler();
 #endif
+#ifdef HAVE_ZSTD
+    VSIInstallZstdFileHandler();
+#endif
 #ifdef HAVE_LIBARCHIVE
     VSIInstall7zFileHandler();
     VSIInstallRarFileHandler();
@@ -4429,6 +4438,48 @@ void VSIFileManager::RegisterHandlerLoader(const char *pszPrefix,
     Get()->m_oMapHandlerLoader[pszPrefix] = pfnLoadHandler;
 }
 
+/************************************************************************/
+/*                      VSIGetAsyncReadThreadPool()                     */
+/************************************************************************/
+
+static CPLWorkerThreadPool *gpoAsyncReadThreadPool = nullptr;
+
+static std::mutex &VSIGetAsyncReadThreadPoolMutex()
+{
+    static std::mutex oMutex;
+    return oMutex;
+}
+
+static CPLWorkerThreadPool *VSIGetAsyncReadThreadPool()
+{
+    std::lock_guard oLock(VSIGetAsyncReadThreadPoolMutex());
+    if (gpoAsyncReadThreadPool == nullptr)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("VSI_ASYNC_READ_NUM_THREADS", "ALL_CPUS");
+        int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                           ? CPLGetNumCPUs()
+                           : atoi(pszNumThreads);
+        nThreads = std::clamp(nThreads, 1, 128);
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(nThreads, nullptr, nullptr, false))
+            return nullptr;
+        gpoAsyncReadThreadPool = poPool.release();
+    }
+    return gpoAsyncReadThreadPool;
+}
+
+/************************************************************************/
+/*                    VSIDestroyAsyncReadThreadPool()                   */
+/************************************************************************/
+
+static void VSIDestroyAsyncReadThreadPool()
+{
+    std::lock_guard oLock(VSIGetAsyncReadThreadPoolMutex());
+    delete gpoAsyncReadThreadPool;
+    gpoAsyncReadThreadPool = nullptr;
+}
+
 /************************************************************************/
 /*                       VSICleanupFileManager()                        */
 /************************************************************************/
@@ -4436,6 +4487,8 @@ void VSIFileManager::RegisterHandlerLoader(const char *pszPrefix,
 void VSICleanupFileManager()
 
 {
+    VSIDestroyAsyncReadThreadPool();
+
     if (poManager)
     {
         delete poManager;
@@ -4560,6 +4613,130 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
     return 0;
 }
 
+/************************************************************************/
+/*                             SubmitRead()                             */
+/************************************************************************/
+
+/** Submit an asynchronous read of several ranges.
+ *
+ * This method requests nRanges ranges of the file to be read into the
+ * ppData buffers, and returns immediately. The returned future becomes
+ * ready once all ranges have been processed. Its value is true if all of
+ * them have been entirely read. If pfnCallback is not null, it is invoked
+ * with the same value just before the future becomes ready, potentially from
+ * another thread than the calling one.
+ *
+ * The ppData buffers must remain valid, and the file handle must not be
+ * closed, until completion. The panOffsets and panSizes arrays are copied
+ * and may be freed after the call. The current file offset is not affected.
+ *
+ * The default implementation dispatches PRead() calls on a pool of worker
+ * threads, whose size is controlled by the VSI_ASYNC_READ_NUM_THREADS
+ * configuration option, when HasPRead() returns true. Otherwise it
+ * synchronously calls ReadMultiRange() and returns an already ready future.
+ * Virtual file systems may override it with a native asynchronous
+ * implementation.
+ *
+ * The callback must not wait for the completion of another asynchronous
+ * read, as it may be run by one of the worker threads.
+ *
+ * @param nRanges     number of ranges to read.
+ * @param ppData      array of nRanges output buffers. ppData[i] must be at
+ *                    least panSizes[i] bytes large.
+ * @param panOffsets  array of nRanges file offsets.
+ * @param panSizes    array of nRanges sizes in bytes.
+ * @param pfnCallback completion callback, or nullptr.
+ * @return a future that will hold the success status of the request.
+ * @since GDAL 3.14
+ */
+std::future<bool> VSIVirtualHandle::SubmitRead(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes, ReadCompletionCallback pfnCallback)
+{
+    struct State
+    {
+        std::vector<void *> apData{};
+        std::vector<vsi_l_offset> anOffsets{};
+        std::vector<size_t> anSizes{};
+        ReadCompletionCallback pfnCallback{};
+        std::promise<bool> oPromise{};
+        CPLStringList aosThreadLocalConfigOptions{};
+        std::atomic<int> nNextRange{0};
+        std::atomic<int> nRemainingRanges{0};
+        std::atomic<bool> bSuccess{true};
+    };
+
+    auto poState = std::make_shared<State>();
+    auto oFuture = poState->oPromise.get_future();
+
+    CPLWorkerThreadPool *poPool =
+        nRanges > 0 && HasPRead() ? VSIGetAsyncReadThreadPool() : nullptr;
+    if (poPool == nullptr)
+    {
+        const bool bSuccess =
+            nRanges <= 0 ||
+            ReadMultiRange(nRanges, ppData, panOffsets, panSizes) == 0;
+        if (pfnCallback)
+            pfnCallback(bSuccess);
+        poState->oPromise.set_value(bSuccess);
+        return oFuture;
+    }
+
+    poState->apData.assign(ppData, ppData + nRanges);
+    poState->anOffsets.assign(panOffsets, panOffsets + nRanges);
+    poState->anSizes.assign(panSizes, panSizes + nRanges);
+    poState->pfnCallback = std::move(pfnCallback);
+    poState->aosThreadLocalConfigOptions.Assign(
+        CSLDuplicate(CPLGetThreadLocalConfigOptions()), true);
+    poState->nRemainingRanges = nRanges;
+
+    // Each job pulls ranges until there is none left, so that a request
+    // with many small ranges does not flood the queue of the pool.
+    const auto job = [this, poState]()
+    {
+        CPLStringList aosOldThreadLocalConfigOptions(
+            CSLDuplicate(CPLGetThreadLocalConfigOptions()));
+        CPLSetThreadLocalConfigOptions(
+            poState->aosThreadLocalConfigOptions.List());
+
+        const int nRanges = static_cast<int>(poState->anSizes.size());
+        int i;
+        while ((i = poState->nNextRange++) < nRanges)
+        {
+            if (poState->bSuccess &&
+                PRead(poState->apData[i], poState->anSizes[i],
+                      poState->anOffsets[i]) != poState->anSizes[i])
+            {
+                poState->bSuccess = false;
+            }
+            if (--poState->nRemainingRanges == 0)
+            {
+                CPLSetThreadLocalConfigOptions(
+                    aosOldThreadLocalConfigOptions.List());
+                if (poState->pfnCallback)
+                    poState->pfnCallback(poState->bSuccess);
+                poState->oPromise.set_value(poState->bSuccess);
+                return;
+            }
+        }
+
+        CPLSetThreadLocalConfigOptions(aosOldThreadLocalConfigOptions.List());
+    };
+
+    const int nJobs = std::min(nRanges, poPool->GetThreadCount());
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poPool->SubmitJob(job))
+        {
+            // Ranges not taken by a job are read by the calling thread.
+            job();
+            break;
+        }
+    }
+
+    return oFuture;
+}
+
 #ifndef DOXYGEN_SKIP
 /************************************************************************/
 /*                 VSIProxyFileHandle::CancelCreation()                 */
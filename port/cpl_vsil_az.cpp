@@ -873,7 +873,7 @@ char **VSIAzureFSHandler::GetFileMetadata(const char *pszFilename,
     if (pszDomain == nullptr ||
         (!EQUAL(pszDomain, "TAGS") && !EQUAL(pszDomain, "METADATA")))
     {
-        return VSICurlFilesystemHandlerBase::GetFileMetadata(
+        return IVSIS3LikeFSHandlerWithMultipartUpload::GetFileMetadata(
             pszFilename, pszDomain, papszOptions);
     }
 
@@ -2258,6 +2258,7 @@ std::string VSIAzureFSHandler::PutBlock(
                          poS3HandleHelper->GetURL().c_str(),
                          oRetryContext.GetCurrentDelay());
                 CPLSleep(oRetryContext.GetCurrentDelay());
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
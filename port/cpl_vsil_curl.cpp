@@ -662,6 +662,7 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
 VSICurlHandle::~VSICurlHandle()
 {
+    WaitReadAhead();
     if (m_oThreadAdviseRead.joinable())
     {
         m_oThreadAdviseRead.join();
@@ -2035,7 +2036,8 @@ retry:
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
                         poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                                        sWriteFuncData.pBuffer + nOffset,
+                                        m_bCached);
                         nOffset += nToCache;
                     }
                 }
@@ -2846,7 +2848,17 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
         }
     }
 
-    vsi_l_offset l_startOffset = startOffset;
+    AddRegions(startOffset, knDOWNLOAD_CHUNK_SIZE, pBuffer, nSize);
+}
+
+/************************************************************************/
+/*                             AddRegions()                             */
+/************************************************************************/
+
+/** Insert downloaded content in the region cache, cut into chunks. */
+void VSICurlHandle::AddRegions(vsi_l_offset startOffset, int nChunkSize,
+                               const char *pBuffer, size_t nSize)
+{
     while (nSize > 0)
     {
 #if DEBUG_VERBOSE
@@ -2854,19 +2866,173 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
         {
             CPLDebug(poFS->GetDebugKey(), "Add region %u - %u",
                      static_cast<unsigned int>(startOffset),
-                     static_cast<unsigned int>(std::min(
-                         static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize)));
+                     static_cast<unsigned int>(
+                         std::min(static_cast<size_t>(nChunkSize), nSize)));
         }
 #endif
-        const size_t nChunkSize =
-            std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
-        l_startOffset += nChunkSize;
-        pBuffer += nChunkSize;
-        nSize -= nChunkSize;
+        const size_t nRegionSize =
+            std::min(static_cast<size_t>(nChunkSize), nSize);
+        poFS->AddRegion(m_pszURL, startOffset, nRegionSize, pBuffer,
+                        m_bCached);
+        startOffset += nRegionSize;
+        pBuffer += nRegionSize;
+        nSize -= nRegionSize;
     }
 }
 
+/************************************************************************/
+/*                           StartReadAhead()                           */
+/************************************************************************/
+
+/** Start downloading the data following startOffset in a background
+ * thread, with several concurrent GET requests, as read-ahead of sequential
+ * reads.
+ *
+ * The number of requests is set by CPL_VSIL_CURL_READ_AHEAD_REQUESTS. Each
+ * of them is of nBlocks chunks, reduced if needed so that the whole batch
+ * does not exceed half of the region cache, as read-ahead data must not be
+ * evicted before it is consumed. The downloaded chunks are inserted in the
+ * region cache. Read() only waits for the batch when it needs data from it.
+ * At most one batch is in flight. Errors are silenced, as Read() falls back
+ * to DownloadRegion() for chunks that end up missing from the cache.
+ */
+void VSICurlHandle::StartReadAhead(vsi_l_offset startOffset, int nBlocks)
+{
+    if (m_oThreadReadAhead.joinable())
+    {
+        if (!m_bReadAheadDone)
+            return;
+        m_oThreadReadAhead.join();
+    }
+    m_nReadAheadStart = 0;
+    m_nReadAheadEnd = 0;
+
+    const int nRequests = std::clamp(
+        atoi(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_REQUESTS", "1")), 1,
+        64);
+    if (nRequests <= 1 || pfnReadCbk != nullptr ||
+        (bInterrupted && bStopOnInterruptUntilUninstall) ||
+        !poFS->HasOptimizedReadMultiRange(m_osFilename.c_str()))
+    {
+        return;
+    }
+
+    // The total file size is needed so that no range goes beyond the end
+    // of file, which would make the whole batch fail.
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize || oFileProp.eExists != EXIST_YES ||
+        startOffset >= oFileProp.fileSize)
+    {
+        return;
+    }
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const int nMaxBlocks = std::max(1, GetMaxRegions() / 2);
+    nBlocks = std::clamp(nBlocks, 1, std::max(1, nMaxBlocks / nRequests));
+    const size_t nRequestSize =
+        static_cast<size_t>(nBlocks) * knDOWNLOAD_CHUNK_SIZE;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (int i = 0; i < nRequests; ++i)
+    {
+        const vsi_l_offset nOffset =
+            startOffset + static_cast<vsi_l_offset>(i) * nRequestSize;
+        if (nOffset >= oFileProp.fileSize)
+            break;
+        // Stop at data already in cache, e.g. read by another handle
+        if (poFS->GetRegion(m_pszURL, nOffset) != nullptr)
+            break;
+        anOffsets.push_back(nOffset);
+        anSizes.push_back(static_cast<size_t>(std::min<vsi_l_offset>(
+            nRequestSize, oFileProp.fileSize - nOffset)));
+    }
+    if (anOffsets.empty())
+        return;
+
+    UpdateQueryString();
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+        return;
+
+    if constexpr (ENABLE_DEBUG)
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "Read-ahead of %d ranges of %d bytes from " CPL_FRMT_GUIB,
+                 static_cast<int>(anOffsets.size()),
+                 static_cast<int>(nRequestSize),
+                 static_cast<GUIntBig>(startOffset));
+    }
+
+    m_nReadAheadStart = startOffset;
+    m_nReadAheadEnd = anOffsets.back() + anSizes.back();
+    m_nReadAheadBlocks = nBlocks;
+    m_bReadAheadDone = false;
+
+    const auto task =
+        [this, osURL = std::move(osURL),
+         aosHTTPOptions = std::move(aosHTTPOptions),
+         anOffsets = std::move(anOffsets), anSizes = std::move(anSizes),
+         aosThreadLocalConfigOptions =
+             CPLStringList(CPLGetThreadLocalConfigOptions()),
+         knDOWNLOAD_CHUNK_SIZE]()
+    {
+        CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+
+        NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+        NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+        NetworkStatisticsAction oContextAction("ReadAhead");
+
+        // Errors are silenced as DownloadRegion() will be used as a fallback
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        try
+        {
+            std::vector<std::string> aosBuffers(anOffsets.size());
+            std::vector<void *> apData;
+            for (size_t i = 0; i < anOffsets.size(); ++i)
+            {
+                aosBuffers[i].resize(anSizes[i]);
+                apData.push_back(aosBuffers[i].data());
+            }
+            if (ReadMultiRangeParallelGets(
+                    osURL, aosHTTPOptions, static_cast<int>(anOffsets.size()),
+                    apData.data(), anOffsets.data(), anSizes.data(),
+                    /* bMergeConsecutiveRanges = */ false) == 0)
+            {
+                for (size_t i = 0; i < anOffsets.size(); ++i)
+                {
+                    AddRegions(anOffsets[i], knDOWNLOAD_CHUNK_SIZE,
+                               aosBuffers[i].data(), aosBuffers[i].size());
+                }
+            }
+            else
+            {
+                CPLDebug(poFS->GetDebugKey(), "Read-ahead failed: %s",
+                         CPLGetLastErrorMsg());
+            }
+        }
+        catch (const std::exception &)
+        {
+            CPLDebug(poFS->GetDebugKey(), "Out of memory in read-ahead");
+        }
+        m_bReadAheadDone = true;
+    };
+
+    m_oThreadReadAhead = std::thread(task);
+}
+
+/************************************************************************/
+/*                           WaitReadAhead()                            */
+/************************************************************************/
+
+/** Wait for the read-ahead batch in flight, if there is one. */
+void VSICurlHandle::WaitReadAhead()
+{
+    if (m_oThreadReadAhead.joinable())
+        m_oThreadReadAhead.join();
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2909,6 +3075,15 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
 
         const vsi_l_offset nOffsetToDownload =
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+        if (nOffsetToDownload >= m_nReadAheadStart &&
+            nOffsetToDownload < m_nReadAheadEnd)
+        {
+            // The reader has reached the last read-ahead batch: wait for it
+            // if it is still in flight, and schedule the next one, with
+            // requests of increasing size as in the single request case.
+            WaitReadAhead();
+            StartReadAhead(m_nReadAheadEnd, 2 * m_nReadAheadBlocks);
+        }
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
@@ -2961,12 +3136,26 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
                 }
             }
 
+            // Nor data being downloaded by the read-ahead thread.
+            if (m_oThreadReadAhead.joinable() &&
+                nOffsetToDownload < m_nReadAheadStart &&
+                nOffsetToDownload + static_cast<vsi_l_offset>(
+                                        nBlocksToDownload) *
+                                        knDOWNLOAD_CHUNK_SIZE >
+                    m_nReadAheadStart)
+            {
+                nBlocksToDownload = static_cast<int>(
+                    (m_nReadAheadStart - nOffsetToDownload) /
+                    knDOWNLOAD_CHUNK_SIZE);
+            }
+
             // We can't download more than knMAX_REGIONS chunks at a time,
             // otherwise the cache will not be big enough to store them and
             // copy their content to the target buffer.
             if (nBlocksToDownload > knMAX_REGIONS)
                 nBlocksToDownload = knMAX_REGIONS;
 
+            const bool bSequential = nOffsetToDownload == lastDownloadedOffset;
             osRegion = DownloadRegion(nOffsetToDownload, nBlocksToDownload);
             if (osRegion.empty())
             {
@@ -2974,6 +3163,16 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
                     bError = true;
                 return 0;
             }
+
+            // Download the data following that region in the background
+            if (bSequential)
+            {
+                const vsi_l_offset nEndOffset =
+                    nOffsetToDownload +
+                    static_cast<vsi_l_offset>(nBlocksToDownload) *
+                        knDOWNLOAD_CHUNK_SIZE;
+                StartReadAhead(nEndOffset, nBlocksToDownload);
+            }
         }
 
         const vsi_l_offset nRegionOffset = iterOffset - nOffsetToDownload;
@@ -3057,6 +3256,25 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                                 panSizes);
     }
 
+    return ReadMultiRangeParallelGets(
+        osURL, aosHTTPOptions, nRanges, ppData, panOffsets, panSizes,
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE")));
+}
+
+/************************************************************************/
+/*                     ReadMultiRangeParallelGets()                     */
+/************************************************************************/
+
+/** Download ranges with one GET request per (possibly merged) range, all
+ * run in parallel.
+ */
+int VSICurlHandle::ReadMultiRangeParallelGets(
+    const std::string &osURL, const CPLStringList &aosHTTPOptions,
+    int const nRanges, void **const ppData,
+    const vsi_l_offset *const panOffsets, const size_t *const panSizes,
+    bool bMergeConsecutiveRanges)
+{
     struct CurlErrBuffer
     {
         std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
@@ -3081,9 +3299,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         anSortedSizes[i] = panSizes[anSortOrder[i]];
     }
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
-
     // Build list of merged requests upfront, each with its own retry context
     struct MergedRequest
     {
@@ -4333,6 +4548,7 @@ int VSICurlHandle::Flush()
 
 int VSICurlHandle::Close()
 {
+    WaitReadAhead();
     return 0;
 }
 
@@ -4396,6 +4612,42 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                          GetDiskCacheKey()                           */
+/************************************************************************/
+
+/** Compute the key of a region in the persistent disk cache.
+ *
+ * The key includes the file size and its ETag, or its modification time if
+ * there is no ETag, so that entries of a modified remote file are not reused.
+ * Returns false if those properties are not known yet.
+ */
+static bool GetDiskCacheKey(const char *pszURL, vsi_l_offset nFileOffsetStart,
+                            std::string &osKey)
+{
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize ||
+        (oFileProp.ETag.empty() && oFileProp.mTime == 0))
+    {
+        return false;
+    }
+
+    osKey = pszURL;
+    osKey += '\n';
+    if (!oFileProp.ETag.empty())
+        osKey += "etag=" + oFileProp.ETag;
+    else
+        osKey += CPLSPrintf("mtime=" CPL_FRMT_GIB,
+                            static_cast<GIntBig>(oFileProp.mTime));
+    osKey += CPLSPrintf("\nsize=" CPL_FRMT_GUIB "\noffset=" CPL_FRMT_GUIB
+                        "\nchunk_size=%d",
+                        static_cast<GUIntBig>(oFileProp.fileSize),
+                        static_cast<GUIntBig>(nFileOffsetStart),
+                        VSICURLGetDownloadChunkSize());
+    return true;
+}
+
 /************************************************************************/
 /*                             GetRegion()                              */
 /************************************************************************/
@@ -4404,17 +4656,38 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+        {
+            return out;
+        }
+    }
+
+    // Fallback to the persistent cache, outside of the mutex as this
+    // involves file I/O.
+    std::string osKey;
+    if (auto poDiskCache = VSICurlDiskCache::Get())
+    {
+        if (GetDiskCacheKey(pszURL, nFileOffsetStart, osKey))
+        {
+            auto out = poDiskCache->Read(osKey);
+            if (out)
+            {
+                CPLMutexHolder oHolder(&hMutex);
+                GetRegionCache()->insert(
+                    FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                    out);
+                return out;
+            }
+        }
     }
 
     return nullptr;
@@ -4426,15 +4699,28 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             bool bAllowDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        auto value = std::make_shared<std::string>();
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+            std::move(value));
+    }
 
-    auto value = std::make_shared<std::string>();
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
-        std::move(value));
+    if (bAllowDiskCache)
+    {
+        std::string osKey;
+        if (auto poDiskCache = VSICurlDiskCache::Get())
+        {
+            if (GetDiskCacheKey(pszURL, nFileOffsetStart, osKey))
+                poDiskCache->Write(osKey, pData, nSize);
+        }
+    }
 }
 
 /************************************************************************/
@@ -4692,6 +4978,9 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_CACHE_SIZE' type='integer' "                \
     "description='Size in bytes of the global /vsicurl/ cache' "               \
     "default='16384000'/>"                                                     \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_REQUESTS' type='integer' "       \
+    "description='Number of concurrent GET requests issued ahead of "          \
+    "sequential reads' default='1' min='1' max='64'/>"                         \
     "  <Option name='CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE' type='boolean' "    \
     "description='Whether to skip files with Glacier storage class in "        \
     "directory listing.' default='YES'/>"                                      \
@@ -6606,6 +6895,17 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogRetry()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nRetries++;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6635,6 +6935,8 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nRetries)
+        oJSON.Add("retries", counters.nRetries);
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
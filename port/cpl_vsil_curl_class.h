@@ -18,12 +18,14 @@
 #include "cpl_aws.h"
 #include "cpl_azure.h"
 #include "cpl_port.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
@@ -132,6 +134,37 @@ struct PutData
     }
 };
 
+/************************************************************************/
+/*                           VSICurlDiskCache                           */
+/************************************************************************/
+
+/** Persistent cache of downloaded regions, shared by all network file systems
+ * and by concurrent processes. Enabled by CPL_VSIL_CURL_DISK_CACHE_DIR.
+ */
+class VSICurlDiskCache
+{
+  public:
+    static std::shared_ptr<VSICurlDiskCache> Get();
+
+    std::shared_ptr<std::string> Read(const std::string &osKey);
+    void Write(const std::string &osKey, const char *pData, size_t nSize);
+
+  private:
+    const std::string m_osDirectory;
+    const GUIntBig m_nMaxSize;
+
+    std::mutex m_oMutex{};
+    GUIntBig m_nBytesWrittenSinceTrim = 0;
+    bool m_bTrimDone = false;
+
+    VSICurlDiskCache(const std::string &osDirectory, GUIntBig nMaxSize);
+
+    std::string GetFilename(const std::string &osHash) const;
+    void Trim();
+
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+};
+
 /************************************************************************/
 /*                       VSICurlFilesystemHandler                       */
 /************************************************************************/
@@ -329,7 +362,7 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                            vsi_l_offset nFileOffsetStart);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData, bool bAllowDiskCache);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -455,6 +488,24 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     int ReadMultiRangeSingleGet(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes);
+    int ReadMultiRangeParallelGets(const std::string &osURL,
+                                   const CPLStringList &aosHTTPOptions,
+                                   int nRanges, void **ppData,
+                                   const vsi_l_offset *panOffsets,
+                                   const size_t *panSizes,
+                                   bool bMergeConsecutiveRanges);
+    void AddRegions(vsi_l_offset startOffset, int nChunkSize,
+                    const char *pBuffer, size_t nSize);
+
+    // Asynchronous read-ahead of sequential reads. The bounds of the last
+    // batch are only accessed from the thread of Read().
+    std::thread m_oThreadReadAhead{};
+    std::atomic<bool> m_bReadAheadDone{true};
+    vsi_l_offset m_nReadAheadStart = 0;
+    vsi_l_offset m_nReadAheadEnd = 0;
+    int m_nReadAheadBlocks = 0;
+    void StartReadAhead(vsi_l_offset startOffset, int nBlocks);
+    void WaitReadAhead();
     std::string GetRedirectURLIfValid(bool &bHasExpired,
                                       CPLStringList &aosHTTPOptions) const;
 
@@ -708,15 +759,31 @@ class IVSIS3LikeFSHandler /* non final */
 /*                IVSIS3LikeFSHandlerWithMultipartUpload                */
 /************************************************************************/
 
+class VSIMultipartWriteHandle;
+
 class IVSIS3LikeFSHandlerWithMultipartUpload /* non final */
     : public IVSIS3LikeFSHandler
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandlerWithMultipartUpload)
 
+    friend class VSIMultipartWriteHandle;
+
+    // Write handles currently opened, for the UPLOAD_STATUS metadata domain
+    std::mutex m_oMutexWriteHandles{};
+    std::map<std::string, VSIMultipartWriteHandle *> m_oMapWriteHandles{};
+
+    void RegisterWriteHandle(const std::string &osFilename,
+                             VSIMultipartWriteHandle *poHandle);
+    void UnregisterWriteHandle(const std::string &osFilename,
+                               VSIMultipartWriteHandle *poHandle);
+
   protected:
     IVSIS3LikeFSHandlerWithMultipartUpload() = default;
 
   public:
+    char **GetFileMetadata(const char *pszFilename, const char *pszDomain,
+                           CSLConstList papszOptions) override;
+
     virtual bool SupportsNonSequentialMultipartUpload() const
     {
         return true;
@@ -896,7 +963,27 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Asynchronous upload of parts, when more than one part buffer is
+    // allowed. The members below are protected by m_oMutex.
+    int m_nMaxBuffers = 1;
+    int m_nAllocatedBuffers = 1;
+    std::vector<GByte *> m_apabyFreeBuffers{};
+    CPLStringList m_aosThreadLocalConfigOptions{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCond{};
+    int m_nPartsSubmitted = 0;
+    int m_nPartsInFlight = 0;
+    int m_nPartsUploaded = 0;
+    vsi_l_offset m_nBytesSubmitted = 0;
+    vsi_l_offset m_nBytesUploaded = 0;
+    bool m_bUploadError = false;
+    CPLErrorAccumulator m_oErrorAccumulator{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+
     bool UploadPart();
+    bool SubmitPartUpload();
+    void UploadPartJob(GByte *pabyData, size_t nSize, int nPartNumber);
+    bool WaitForPendingUploads();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -933,6 +1020,8 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
     {
         return m_pabyBuffer != nullptr;
     }
+
+    char **GetUploadStatus();
 };
 
 /************************************************************************/
@@ -1169,6 +1258,7 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nRetries = 0;
     };
 
     enum class ContextPathType
@@ -1248,6 +1338,8 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogRetry();
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
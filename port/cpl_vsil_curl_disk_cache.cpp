@@ -0,0 +1,348 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of regions downloaded by /vsicurl/ and
+ *           related file systems
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+// Header of chunk files, followed by the length of the key hash as a
+// little-endian uint32, the key hash, and the payload. Only the hash of the
+// key is stored, as the URL it contains may embed credentials such as
+// signed or SAS tokens.
+constexpr const char DISK_CACHE_MAGIC[] = "GDALVSIC";
+constexpr size_t DISK_CACHE_MAGIC_SIZE = sizeof(DISK_CACHE_MAGIC) - 1;
+
+constexpr const char DISK_CACHE_CHUNK_EXT[] = ".chunk";
+constexpr const char DISK_CACHE_TMP_EXT[] = ".tmp";
+
+// A cache hit refreshes the modification time of the chunk file, which
+// drives the LRU eviction, at most that often.
+constexpr time_t DISK_CACHE_TOUCH_DELAY_SEC = 60;
+
+// Delay after which a temporary file is considered as left over by a
+// crashed process.
+constexpr time_t DISK_CACHE_STALLED_TMP_DELAY_SEC = 3600;
+
+/************************************************************************/
+/*                         VSICurlDiskCache()                           */
+/************************************************************************/
+
+VSICurlDiskCache::VSICurlDiskCache(const std::string &osDirectory,
+                                   GUIntBig nMaxSize)
+    : m_osDirectory(osDirectory), m_nMaxSize(nMaxSize)
+{
+}
+
+/************************************************************************/
+/*                      VSICurlDiskCache::Get()                         */
+/************************************************************************/
+
+/** Return the cache configured by CPL_VSIL_CURL_DISK_CACHE_DIR and
+ * CPL_VSIL_CURL_DISK_CACHE_SIZE, or nullptr if it is disabled.
+ */
+std::shared_ptr<VSICurlDiskCache> VSICurlDiskCache::Get()
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0')
+        return nullptr;
+
+    constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+    GIntBig nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    if (pszMaxSize &&
+        (CPLParseMemorySize(pszMaxSize, &nMaxSize, nullptr) != CE_None ||
+         nMaxSize <= 0))
+    {
+        nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    }
+
+    static std::mutex goMutex;
+    static std::shared_ptr<VSICurlDiskCache> gpoDiskCache;
+
+    std::lock_guard oLock(goMutex);
+    if (!gpoDiskCache || gpoDiskCache->m_osDirectory != pszDirectory ||
+        gpoDiskCache->m_nMaxSize != static_cast<GUIntBig>(nMaxSize))
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(pszDirectory, &sStat) != 0 &&
+            VSIMkdirRecursive(pszDirectory, 0755) != 0)
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot create %s. Disabling the persistent cache of "
+                     "network file systems",
+                     pszDirectory);
+            gpoDiskCache.reset();
+            return nullptr;
+        }
+        gpoDiskCache.reset(new VSICurlDiskCache(
+            pszDirectory, static_cast<GUIntBig>(nMaxSize)));
+    }
+    return gpoDiskCache;
+}
+
+/************************************************************************/
+/*                           GetFilename()                              */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osHash) const
+{
+    // Spread chunk files over 256 sub-directories to keep directories of
+    // a reasonable size.
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(m_osDirectory.c_str(), osHash.substr(0, 2).c_str(),
+                            nullptr)
+            .c_str(),
+        (osHash + DISK_CACHE_CHUNK_EXT).c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCache::Read()                         */
+/************************************************************************/
+
+/** Return the payload stored for osKey, or nullptr if it is not cached. */
+std::shared_ptr<std::string> VSICurlDiskCache::Read(const std::string &osKey)
+{
+    const std::string osHash = CPLGetLowerCaseHexSHA256(osKey);
+    const std::string osFilename = GetFilename(osHash);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return nullptr;
+
+    const size_t nHeaderSize =
+        DISK_CACHE_MAGIC_SIZE + sizeof(uint32_t) + osHash.size();
+    if (static_cast<vsi_l_offset>(sStat.st_size) < nHeaderSize)
+        return nullptr;
+
+    std::string osContent;
+    {
+        auto fp =
+            VSIVirtualHandleUniquePtr(VSIFOpenL(osFilename.c_str(), "rb"));
+        if (!fp)
+            return nullptr;
+        try
+        {
+            osContent.resize(static_cast<size_t>(sStat.st_size));
+        }
+        catch (const std::exception &)
+        {
+            return nullptr;
+        }
+        if (fp->Read(osContent.data(), osContent.size()) != osContent.size())
+            return nullptr;
+    }
+
+    uint32_t nHashSize = 0;
+    memcpy(&nHashSize, osContent.data() + DISK_CACHE_MAGIC_SIZE,
+           sizeof(nHashSize));
+    CPL_LSBPTR32(&nHashSize);
+    if (memcmp(osContent.data(), DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE) !=
+            0 ||
+        nHashSize != osHash.size() ||
+        osContent.compare(DISK_CACHE_MAGIC_SIZE + sizeof(uint32_t),
+                          osHash.size(), osHash) != 0)
+    {
+        CPLDebug("VSICURL", "Ignoring invalid cache file %s",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    // Refresh the modification time, so that the entry is considered as
+    // recently used by Trim(), by rewriting the first byte of the magic.
+    if (static_cast<time_t>(sStat.st_mtime) + DISK_CACHE_TOUCH_DELAY_SEC <
+        time(nullptr))
+    {
+        auto fp =
+            VSIVirtualHandleUniquePtr(VSIFOpenL(osFilename.c_str(), "r+b"));
+        if (fp)
+            CPL_IGNORE_RET_VAL(fp->Write(DISK_CACHE_MAGIC, 1));
+    }
+
+    return std::make_shared<std::string>(osContent.substr(nHeaderSize));
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCache::Write()                        */
+/************************************************************************/
+
+/** Store the payload of osKey.
+ *
+ * The file is written under a temporary name and then renamed, so that
+ * concurrent readers, possibly in other processes, never see a partially
+ * written file.
+ */
+void VSICurlDiskCache::Write(const std::string &osKey, const char *pData,
+                             size_t nSize)
+{
+    const std::string osHash = CPLGetLowerCaseHexSHA256(osKey);
+    const std::string osFilename = GetFilename(osHash);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        return;
+
+    const std::string osSubDir = CPLGetPathSafe(osFilename.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0)
+        VSIMkdir(osSubDir.c_str(), 0755);
+
+    static std::atomic<int> gnCounter{0};
+    const std::string osTmpFilename =
+        osFilename +
+        CPLSPrintf(".%d_%d%s", CPLGetCurrentProcessID(), ++gnCounter,
+                   DISK_CACHE_TMP_EXT);
+    bool bOK = false;
+    {
+        auto fp =
+            VSIVirtualHandleUniquePtr(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+        if (fp)
+        {
+            uint32_t nHashSize = static_cast<uint32_t>(osHash.size());
+            CPL_LSBPTR32(&nHashSize);
+            bOK =
+                fp->Write(DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE) ==
+                    DISK_CACHE_MAGIC_SIZE &&
+                fp->Write(&nHashSize, sizeof(nHashSize)) == sizeof(nHashSize) &&
+                fp->Write(osHash.data(), osHash.size()) == osHash.size() &&
+                fp->Write(pData, nSize) == nSize;
+            bOK = VSIFCloseL(fp.release()) == 0 && bOK;
+        }
+    }
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        // On Windows, renaming fails if another process has just created
+        // the same entry, which is harmless.
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    bool bMustTrim = false;
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_nBytesWrittenSinceTrim += nSize;
+        // Check the size of the cache at the first write done by the process,
+        // and then every time 1/16th of its maximum size has been written.
+        if (!m_bTrimDone ||
+            m_nBytesWrittenSinceTrim > std::max<GUIntBig>(1, m_nMaxSize / 16))
+        {
+            m_bTrimDone = true;
+            m_nBytesWrittenSinceTrim = 0;
+            bMustTrim = true;
+        }
+    }
+    if (bMustTrim)
+        Trim();
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCache::Trim()                         */
+/************************************************************************/
+
+/** Evict the least recently used chunk files until the cache occupies
+ * less than 90% of its maximum size.
+ *
+ * A lock file ensures that a single process trims the cache at a time.
+ * Other processes skip trimming rather than waiting for the lock.
+ */
+void VSICurlDiskCache::Trim()
+{
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(m_osDirectory.c_str(), ".lock", nullptr);
+    CPLLockFileHandle hLockFileHandle = nullptr;
+    const char *const apszLockOptions[] = {"WAIT_TIME=0", nullptr};
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLockFileHandle,
+                      apszLockOptions) != CLFS_OK)
+    {
+        return;
+    }
+
+    struct Entry
+    {
+        std::string osFilename{};
+        GIntBig nMTime = 0;
+        GUIntBig nSize = 0;
+    };
+
+    std::vector<Entry> aoEntries;
+    GUIntBig nTotalSize = 0;
+    const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+    VSIDIR *psDir = VSIOpenDir(m_osDirectory.c_str(), -1, nullptr);
+    if (psDir)
+    {
+        while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+        {
+            if (!VSI_ISREG(psEntry->nMode))
+                continue;
+            std::string osFilename = CPLFormFilenameSafe(
+                m_osDirectory.c_str(), psEntry->pszName, nullptr);
+            if (cpl::ends_with(osFilename, DISK_CACHE_TMP_EXT))
+            {
+                if (psEntry->nMTime + DISK_CACHE_STALLED_TMP_DELAY_SEC < nNow)
+                    VSIUnlink(osFilename.c_str());
+            }
+            else if (cpl::ends_with(osFilename, DISK_CACHE_CHUNK_EXT))
+            {
+                Entry oEntry;
+                oEntry.osFilename = std::move(osFilename);
+                oEntry.nMTime = psEntry->nMTime;
+                oEntry.nSize = static_cast<GUIntBig>(psEntry->nSize);
+                nTotalSize += oEntry.nSize;
+                aoEntries.push_back(std::move(oEntry));
+            }
+        }
+        VSICloseDir(psDir);
+    }
+
+    if (nTotalSize > m_nMaxSize)
+    {
+        CPLDebug("VSICURL",
+                 "Persistent cache size is " CPL_FRMT_GUIB
+                 " bytes. Trimming it",
+                 nTotalSize);
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        const GUIntBig nTargetSize = m_nMaxSize / 10 * 9;
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oEntry.osFilename.c_str()) == 0)
+                nTotalSize -= oEntry.nSize;
+        }
+    }
+
+    CPLUnlockFileEx(hLockFileHandle);
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
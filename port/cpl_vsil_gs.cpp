@@ -485,7 +485,7 @@ char **VSIGSFSHandler::GetFileMetadata(const char *pszFilename,
 
     if (pszDomain == nullptr || !EQUAL(pszDomain, "ACL"))
     {
-        return VSICurlFilesystemHandlerBase::GetFileMetadata(
+        return IVSIS3LikeFSHandlerWithMultipartUpload::GetFileMetadata(
             pszFilename, pszDomain, papszOptions);
     }
 
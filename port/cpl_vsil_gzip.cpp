@@ -79,6 +79,8 @@
 #endif
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -93,6 +95,7 @@
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
@@ -128,6 +131,1201 @@ constexpr int gz_magic[2] = {0x1f, 0x8b};  // gzip magic header
 
 // #define ENABLE_DEBUG 1
 
+/************************************************************************/
+/* ==================================================================== */
+/*                             VSIGZipIndex                             */
+/* ==================================================================== */
+/************************************************************************/
+
+// Index of access points into a gzip file, following the approach of
+// zlib's examples/zran.c: at an access point, the state of the inflater can
+// be rebuilt from the position in the compressed stream (at the bit level)
+// and the last 32 KB of uncompressed data (the "window"). Access points at
+// the start of a gzip member do not need a window.
+
+constexpr int GZIP_INDEX_WINDOW_SIZE = 32768;
+constexpr char GZIP_INDEX_MAGIC[] = "GDALGZIX";
+constexpr GUInt32 GZIP_INDEX_VERSION = 1;
+
+struct VSIGZipIndexPoint
+{
+    // Offset in the file of the first byte not yet consumed by inflate().
+    vsi_l_offset nCompressedOffset = 0;
+    vsi_l_offset nUncompressedOffset = 0;
+    // Number of bits (0 to 7) of the byte at nCompressedOffset - 1 that
+    // remain to be consumed.
+    int nBits = 0;
+    // CRC32 of the data of the current gzip member up to that point.
+    uLong nCRC = 0;
+    uInt nWindowSize = 0;
+    // Window, compressed with zlib.
+    std::vector<GByte> abyCompressedWindow{};
+};
+
+struct VSIGZipIndex
+{
+    vsi_l_offset nCompressedSize = 0;
+    vsi_l_offset nUncompressedSize = 0;
+    std::vector<VSIGZipIndexPoint> aoPoints{};
+
+    const VSIGZipIndexPoint *
+    GetPoint(vsi_l_offset nUncompressedOffset) const;
+
+    bool Save(const std::string &osFilename) const;
+
+    static std::unique_ptr<VSIGZipIndex> Load(const std::string &osFilename,
+                                              vsi_l_offset nCompressedSize);
+    static std::unique_ptr<VSIGZipIndex>
+    Build(VSIVirtualHandle *fp, vsi_l_offset nCompressedSize,
+          vsi_l_offset nSpacing);
+
+  private:
+    static std::unique_ptr<VSIGZipIndex>
+    BuildFromBGZFHeaders(VSIVirtualHandle *fp, vsi_l_offset nCompressedSize,
+                         vsi_l_offset nSpacing);
+};
+
+/************************************************************************/
+/*                              GetPoint()                              */
+/************************************************************************/
+
+// Return the last access point at or before nUncompressedOffset.
+const VSIGZipIndexPoint *
+VSIGZipIndex::GetPoint(vsi_l_offset nUncompressedOffset) const
+{
+    const auto oIter = std::upper_bound(
+        aoPoints.begin(), aoPoints.end(), nUncompressedOffset,
+        [](vsi_l_offset nOffset, const VSIGZipIndexPoint &oPoint)
+        { return nOffset < oPoint.nUncompressedOffset; });
+    if (oIter == aoPoints.begin())
+        return nullptr;
+    return &*std::prev(oIter);
+}
+
+/************************************************************************/
+/*                                Save()                                */
+/************************************************************************/
+
+bool VSIGZipIndex::Save(const std::string &osFilename) const
+{
+    std::vector<GByte> abyData;
+    const auto AddUInt32 = [&abyData](GUInt32 nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        abyData.insert(abyData.end(), pabyVal, pabyVal + sizeof(nVal));
+    };
+    const auto AddUInt64 = [&abyData](GUInt64 nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        abyData.insert(abyData.end(), pabyVal, pabyVal + sizeof(nVal));
+    };
+
+    abyData.insert(abyData.end(), GZIP_INDEX_MAGIC,
+                   GZIP_INDEX_MAGIC + strlen(GZIP_INDEX_MAGIC));
+    AddUInt32(GZIP_INDEX_VERSION);
+    AddUInt64(nCompressedSize);
+    AddUInt64(nUncompressedSize);
+    AddUInt32(static_cast<GUInt32>(aoPoints.size()));
+    for (const auto &oPoint : aoPoints)
+    {
+        AddUInt64(oPoint.nCompressedOffset);
+        AddUInt64(oPoint.nUncompressedOffset);
+        AddUInt32(static_cast<GUInt32>(oPoint.nCRC));
+        AddUInt32(static_cast<GUInt32>(oPoint.nBits));
+        AddUInt32(oPoint.nWindowSize);
+        AddUInt32(static_cast<GUInt32>(oPoint.abyCompressedWindow.size()));
+        abyData.insert(abyData.end(), oPoint.abyCompressedWindow.begin(),
+                       oPoint.abyCompressedWindow.end());
+    }
+
+    // Write to a temporary file first, so that concurrent readers never
+    // see a partially written index.
+    const std::string osTmpFilename = osFilename + ".tmp";
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (!fp)
+        return false;
+    bool bRet = VSIFWriteL(abyData.data(), 1, abyData.size(), fp) ==
+                abyData.size();
+    bRet = VSIFCloseL(fp) == 0 && bRet;
+    if (bRet)
+        bRet = VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+    if (!bRet)
+        VSIUnlink(osTmpFilename.c_str());
+    return bRet;
+}
+
+/************************************************************************/
+/*                                Load()                                */
+/************************************************************************/
+
+std::unique_ptr<VSIGZipIndex>
+VSIGZipIndex::Load(const std::string &osFilename,
+                   vsi_l_offset nCompressedSize)
+{
+    GByte *pabyData = nullptr;
+    vsi_l_offset nDataSize = 0;
+    if (!VSIIngestFile(nullptr, osFilename.c_str(), &pabyData, &nDataSize,
+                       -1))
+    {
+        return nullptr;
+    }
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyDataHolder(pabyData);
+
+    size_t nPos = 0;
+    bool bOK = true;
+    const auto ReadBytes = [pabyData, nDataSize, &nPos, &bOK](size_t nBytes)
+    {
+        const GByte *pabyRet = pabyData + nPos;
+        if (!bOK || nBytes > nDataSize - nPos)
+        {
+            bOK = false;
+            return static_cast<const GByte *>(nullptr);
+        }
+        nPos += nBytes;
+        return pabyRet;
+    };
+    const auto ReadUInt32 = [&ReadBytes]()
+    {
+        GUInt32 nVal = 0;
+        if (const GByte *pabyVal = ReadBytes(sizeof(nVal)))
+            memcpy(&nVal, pabyVal, sizeof(nVal));
+        CPL_LSBPTR32(&nVal);
+        return nVal;
+    };
+    const auto ReadUInt64 = [&ReadBytes]()
+    {
+        GUInt64 nVal = 0;
+        if (const GByte *pabyVal = ReadBytes(sizeof(nVal)))
+            memcpy(&nVal, pabyVal, sizeof(nVal));
+        CPL_LSBPTR64(&nVal);
+        return nVal;
+    };
+
+    const GByte *pabyMagic = ReadBytes(strlen(GZIP_INDEX_MAGIC));
+    if (!pabyMagic ||
+        memcmp(pabyMagic, GZIP_INDEX_MAGIC, strlen(GZIP_INDEX_MAGIC)) != 0 ||
+        ReadUInt32() != GZIP_INDEX_VERSION)
+    {
+        CPLDebug("GZIP", "%s is not a gzip index", osFilename.c_str());
+        return nullptr;
+    }
+
+    auto poIndex = std::make_unique<VSIGZipIndex>();
+    poIndex->nCompressedSize = ReadUInt64();
+    poIndex->nUncompressedSize = ReadUInt64();
+    if (poIndex->nCompressedSize != nCompressedSize)
+    {
+        CPLDebug("GZIP", "%s is out of date", osFilename.c_str());
+        return nullptr;
+    }
+    const GUInt32 nPoints = ReadUInt32();
+    // Each point takes at least 32 bytes.
+    if (!bOK || nPoints > (nDataSize - nPos) / 32)
+        bOK = false;
+    else
+        poIndex->aoPoints.resize(nPoints);
+    for (auto &oPoint : poIndex->aoPoints)
+    {
+        oPoint.nCompressedOffset = ReadUInt64();
+        oPoint.nUncompressedOffset = ReadUInt64();
+        oPoint.nCRC = ReadUInt32();
+        oPoint.nBits = static_cast<int>(ReadUInt32());
+        oPoint.nWindowSize = ReadUInt32();
+        const GUInt32 nCompressedWindowSize = ReadUInt32();
+        if (const GByte *pabyWindow = ReadBytes(nCompressedWindowSize))
+        {
+            oPoint.abyCompressedWindow.assign(
+                pabyWindow, pabyWindow + nCompressedWindowSize);
+        }
+        if (!bOK || oPoint.nBits < 0 || oPoint.nBits > 7 ||
+            oPoint.nWindowSize > GZIP_INDEX_WINDOW_SIZE ||
+            oPoint.nCompressedOffset > nCompressedSize ||
+            (oPoint.nBits > 0 && oPoint.nCompressedOffset == 0) ||
+            oPoint.nUncompressedOffset > poIndex->nUncompressedSize ||
+            (&oPoint != poIndex->aoPoints.data() &&
+             oPoint.nUncompressedOffset <= (&oPoint - 1)->nUncompressedOffset))
+        {
+            bOK = false;
+            break;
+        }
+    }
+    if (!bOK)
+    {
+        CPLDebug("GZIP", "%s is corrupted", osFilename.c_str());
+        return nullptr;
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                        BuildFromBGZFHeaders()                        */
+/************************************************************************/
+
+// Files made of a sequence of BGZF blocks (as used by SAM/BAM, VCF, ...)
+// store the compressed size of each gzip member in its header, and the
+// uncompressed size in its trailer, so the index can be built without
+// inflating anything.
+std::unique_ptr<VSIGZipIndex>
+VSIGZipIndex::BuildFromBGZFHeaders(VSIVirtualHandle *fp,
+                                   vsi_l_offset nCompressedSize,
+                                   vsi_l_offset nSpacing)
+{
+    constexpr int BGZF_HEADER_SIZE = 18;
+    constexpr int GZIP_TRAILER_SIZE = 8;
+
+    auto poIndex = std::make_unique<VSIGZipIndex>();
+    poIndex->nCompressedSize = nCompressedSize;
+    vsi_l_offset nPos = 0;
+    vsi_l_offset nLastPointOut = 0;
+    while (nPos < nCompressedSize)
+    {
+        GByte abyHeader[BGZF_HEADER_SIZE];
+        if (fp->Seek(nPos, SEEK_SET) != 0 ||
+            fp->Read(abyHeader, sizeof(abyHeader)) != sizeof(abyHeader))
+        {
+            return nullptr;
+        }
+        // A single extra subfield, "BC", with the block size minus one.
+        if (abyHeader[0] != gz_magic[0] || abyHeader[1] != gz_magic[1] ||
+            abyHeader[2] != Z_DEFLATED || abyHeader[3] != EXTRA_FIELD ||
+            abyHeader[10] != 6 || abyHeader[11] != 0 ||
+            abyHeader[12] != 'B' || abyHeader[13] != 'C' ||
+            abyHeader[14] != 2 || abyHeader[15] != 0)
+        {
+            return nullptr;
+        }
+        const unsigned nBlockSize =
+            (abyHeader[16] | (static_cast<unsigned>(abyHeader[17]) << 8)) + 1;
+        if (nBlockSize < BGZF_HEADER_SIZE + GZIP_TRAILER_SIZE ||
+            nBlockSize > nCompressedSize - nPos)
+        {
+            return nullptr;
+        }
+
+        GByte abyTrailer[GZIP_TRAILER_SIZE];
+        if (fp->Seek(nPos + nBlockSize - GZIP_TRAILER_SIZE, SEEK_SET) != 0 ||
+            fp->Read(abyTrailer, sizeof(abyTrailer)) != sizeof(abyTrailer))
+        {
+            return nullptr;
+        }
+        const GUInt32 nISize =
+            abyTrailer[4] | (static_cast<GUInt32>(abyTrailer[5]) << 8) |
+            (static_cast<GUInt32>(abyTrailer[6]) << 16) |
+            (static_cast<GUInt32>(abyTrailer[7]) << 24);
+
+        const vsi_l_offset nOut = poIndex->nUncompressedSize;
+        if (nOut > 0 && nOut - nLastPointOut >= nSpacing)
+        {
+            VSIGZipIndexPoint oPoint;
+            oPoint.nCompressedOffset = nPos + BGZF_HEADER_SIZE;
+            oPoint.nUncompressedOffset = nOut;
+            poIndex->aoPoints.push_back(std::move(oPoint));
+            nLastPointOut = nOut;
+        }
+        poIndex->nUncompressedSize += nISize;
+        nPos += nBlockSize;
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+// Decompress the whole file, and record an access point at the first
+// deflate block boundary (or gzip member start) every nSpacing uncompressed
+// bytes. Returns nullptr if the file is not made only of valid gzip members.
+std::unique_ptr<VSIGZipIndex>
+VSIGZipIndex::Build(VSIVirtualHandle *fp, vsi_l_offset nCompressedSize,
+                    vsi_l_offset nSpacing)
+{
+    auto poIndex = BuildFromBGZFHeaders(fp, nCompressedSize, nSpacing);
+    if (poIndex)
+        return poIndex;
+
+    poIndex = std::make_unique<VSIGZipIndex>();
+    poIndex->nCompressedSize = nCompressedSize;
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return nullptr;
+    struct StreamReleaser
+    {
+        z_stream *psStream;
+
+        ~StreamReleaser()
+        {
+            inflateEnd(psStream);
+        }
+    } oStreamReleaser{&sStream};
+
+    std::vector<GByte> abyInBuf(Z_BUFSIZE);
+    std::vector<GByte> abyWindow(GZIP_INDEX_WINDOW_SIZE);
+    std::vector<GByte> abyLinearWindow(GZIP_INDEX_WINDOW_SIZE);
+    std::vector<GByte> abyCompressedWindow(GZIP_INDEX_WINDOW_SIZE * 2 + 32);
+
+    if (fp->Seek(0, SEEK_SET) != 0)
+        return nullptr;
+    vsi_l_offset nReadOffset = 0;
+    const auto FillBuffer = [fp, &abyInBuf, &sStream, &nReadOffset]()
+    {
+        const size_t nRead = fp->Read(abyInBuf.data(), abyInBuf.size());
+        sStream.next_in = abyInBuf.data();
+        sStream.avail_in = static_cast<uInt>(nRead);
+        nReadOffset += nRead;
+        return nRead > 0;
+    };
+    const auto GetByte = [&sStream, &FillBuffer]()
+    {
+        if (sStream.avail_in == 0 && !FillBuffer())
+            return EOF;
+        sStream.avail_in--;
+        return static_cast<int>(*(sStream.next_in++));
+    };
+    const auto SkipBytes = [&GetByte](int nBytes)
+    {
+        for (int i = 0; i < nBytes; ++i)
+        {
+            if (GetByte() == EOF)
+                return false;
+        }
+        return true;
+    };
+    const auto SkipZeroTerminatedString = [&GetByte]()
+    {
+        int c;
+        while ((c = GetByte()) != 0)
+        {
+            if (c == EOF)
+                return false;
+        }
+        return true;
+    };
+    const auto SkipHeader = [&GetByte, &SkipBytes, &SkipZeroTerminatedString]()
+    {
+        if (GetByte() != gz_magic[0] || GetByte() != gz_magic[1] ||
+            GetByte() != Z_DEFLATED)
+            return false;
+        const int flags = GetByte();
+        if (flags == EOF || (flags & RESERVED) != 0 || !SkipBytes(6))
+            return false;
+        if ((flags & EXTRA_FIELD) != 0)
+        {
+            const int nLow = GetByte();
+            const int nHigh = GetByte();
+            if (nLow == EOF || nHigh == EOF || !SkipBytes(nLow | (nHigh << 8)))
+                return false;
+        }
+        if ((flags & ORIG_NAME) != 0 && !SkipZeroTerminatedString())
+            return false;
+        if ((flags & COMMENT) != 0 && !SkipZeroTerminatedString())
+            return false;
+        return (flags & HEAD_CRC) == 0 || SkipBytes(2);
+    };
+    const auto GetUInt32 = [&GetByte](GUInt32 &nVal)
+    {
+        nVal = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const int c = GetByte();
+            if (c == EOF)
+                return false;
+            nVal |= static_cast<GUInt32>(c) << (8 * i);
+        }
+        return true;
+    };
+
+    vsi_l_offset nTotalOut = 0;
+    vsi_l_offset nLastPointOut = 0;
+    const auto AddPoint = [&](int nBits, uLong nCRC, vsi_l_offset nMemberOut)
+    {
+        VSIGZipIndexPoint oPoint;
+        oPoint.nCompressedOffset = nReadOffset - sStream.avail_in;
+        oPoint.nUncompressedOffset = nTotalOut;
+        oPoint.nBits = nBits;
+        oPoint.nCRC = nCRC;
+        oPoint.nWindowSize = static_cast<uInt>(std::min<vsi_l_offset>(
+            nMemberOut, GZIP_INDEX_WINDOW_SIZE));
+        if (oPoint.nWindowSize > 0)
+        {
+            // Unroll the circular window.
+            const size_t nWindowPos =
+                static_cast<size_t>(nMemberOut % GZIP_INDEX_WINDOW_SIZE);
+            if (oPoint.nWindowSize < GZIP_INDEX_WINDOW_SIZE)
+            {
+                memcpy(abyLinearWindow.data(), abyWindow.data(),
+                       oPoint.nWindowSize);
+            }
+            else
+            {
+                memcpy(abyLinearWindow.data(), abyWindow.data() + nWindowPos,
+                       GZIP_INDEX_WINDOW_SIZE - nWindowPos);
+                memcpy(abyLinearWindow.data() + GZIP_INDEX_WINDOW_SIZE -
+                           nWindowPos,
+                       abyWindow.data(), nWindowPos);
+            }
+            size_t nCompressedWindowSize = 0;
+            if (!CPLZLibDeflate(abyLinearWindow.data(), oPoint.nWindowSize, -1,
+                                abyCompressedWindow.data(),
+                                abyCompressedWindow.size(),
+                                &nCompressedWindowSize))
+            {
+                return false;
+            }
+            oPoint.abyCompressedWindow.assign(
+                abyCompressedWindow.begin(),
+                abyCompressedWindow.begin() + nCompressedWindowSize);
+        }
+        poIndex->aoPoints.push_back(std::move(oPoint));
+        nLastPointOut = nTotalOut;
+        return true;
+    };
+
+    while (true)
+    {
+        if (!SkipHeader())
+            return nullptr;
+        if (nTotalOut > 0 && nTotalOut - nLastPointOut >= nSpacing &&
+            !AddPoint(0, 0, 0))
+        {
+            return nullptr;
+        }
+
+        if (inflateReset(&sStream) != Z_OK)
+            return nullptr;
+        uLong nCRC = crc32(0L, nullptr, 0);
+        vsi_l_offset nMemberOut = 0;
+        int ret;
+        do
+        {
+            if (sStream.avail_in == 0 && !FillBuffer())
+                return nullptr;
+            // Decompress directly into the circular window.
+            const size_t nWindowPos =
+                static_cast<size_t>(nMemberOut % GZIP_INDEX_WINDOW_SIZE);
+            sStream.next_out = abyWindow.data() + nWindowPos;
+            sStream.avail_out =
+                static_cast<uInt>(GZIP_INDEX_WINDOW_SIZE - nWindowPos);
+            ret = inflate(&sStream, Z_BLOCK);
+            const uInt nProduced = static_cast<uInt>(
+                GZIP_INDEX_WINDOW_SIZE - nWindowPos - sStream.avail_out);
+            nCRC = crc32(nCRC, abyWindow.data() + nWindowPos, nProduced);
+            nMemberOut += nProduced;
+            nTotalOut += nProduced;
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+                return nullptr;
+
+            // At the end of a deflate block that is not the last one?
+            if (ret != Z_STREAM_END && (sStream.data_type & 128) != 0 &&
+                (sStream.data_type & 64) == 0 &&
+                nTotalOut - nLastPointOut >= nSpacing &&
+                !AddPoint(sStream.data_type & 7, nCRC, nMemberOut))
+            {
+                return nullptr;
+            }
+        } while (ret != Z_STREAM_END);
+
+        GUInt32 nExpectedCRC = 0;
+        GUInt32 nISize = 0;
+        if (!GetUInt32(nExpectedCRC) || !GetUInt32(nISize) ||
+            nExpectedCRC != nCRC ||
+            nISize != static_cast<GUInt32>(nMemberOut & 0xFFFFFFFFU))
+        {
+            return nullptr;
+        }
+
+        // Another gzip member?
+        if (sStream.avail_in == 0 && !FillBuffer())
+            break;
+    }
+
+    if (nReadOffset != nCompressedSize)
+        return nullptr;
+    poIndex->nUncompressedSize = nTotalOut;
+    return poIndex;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                        VSIGZipParallelDecoder                        */
+/* ==================================================================== */
+/************************************************************************/
+
+// Decompresses a .gz file ahead of a sequential reader, on several threads.
+//
+// The compressed file is cut into chunks at positions where inflating can
+// start without any context:
+// - at the start of a gzip member. For BGZF files, the size of members is
+//   found in their header. For other files, candidates are occurrences of
+//   the gzip magic bytes, from which inflating a few KB succeeds.
+// - after a full flush, which GDAL's multithreaded writer and
+//   "pigz --independent" mark with a 0x00 0x00 0xFF 0xFF 0x00 0x00 0x00 0xFF
+//   0xFF sequence.
+// Apart from BGZF ones, those positions are only guesses, checked when
+// chunks are consumed: a chunk is trusted only if the previous one ended
+// exactly at its start, at a gzip member or deflate block boundary. As chunks
+// are inflated without a dictionary, a back reference beyond the start of a
+// chunk is detected as a data error. When a chunk cannot be trusted, or when
+// the file cannot be cut, the caller must go on with serial decoding.
+
+// Compressed size of chunks, and amount of data decoded serially before
+// switching to parallel decoding.
+constexpr size_t GZIP_PARALLEL_CHUNK_SIZE = 1024 * 1024;
+// Maximum compressed size of a chunk, when looking for a cut position.
+constexpr size_t GZIP_PARALLEL_MAX_CHUNK_SIZE = 8 * GZIP_PARALLEL_CHUNK_SIZE;
+// Maximum uncompressed size of a chunk. This bounds the memory used by
+// chunks in flight whatever the compression ratio (deflate can reach about
+// 1000:1): a more compressed chunk is left to serial decoding.
+constexpr size_t GZIP_PARALLEL_MAX_DECODED_CHUNK_SIZE =
+    32 * GZIP_PARALLEL_CHUNK_SIZE;
+
+class VSIGZipParallelDecoder
+{
+  public:
+    // Position from which decoding can be resumed.
+    struct Boundary
+    {
+        vsi_l_offset nCompressedOffset = 0;
+        vsi_l_offset nUncompressedOffset = 0;
+        // Whether a gzip member header starts at nCompressedOffset. Otherwise
+        // this is a byte-aligned deflate block boundary.
+        bool bMemberStart = true;
+        // CRC32 and size of the data of the current member up to that point.
+        uLong nMemberCRC = 0;
+        vsi_l_offset nMemberSize = 0;
+        // Last (up to) 32 KB of uncompressed data.
+        std::vector<GByte> abyWindow{};
+    };
+
+    enum class Status
+    {
+        OK,
+        END_OF_FILE,
+        DATA_ERROR,
+        SERIAL_DECODING_NEEDED,
+    };
+
+    VSIGZipParallelDecoder(VSIVirtualHandle *poBaseHandle,
+                           vsi_l_offset nFileSize, int nThreads);
+    ~VSIGZipParallelDecoder();
+
+    size_t Read(void *pBuffer, size_t nBytes);
+    bool Seek(vsi_l_offset nOffset);
+
+    vsi_l_offset Tell() const
+    {
+        return m_oChunkStart.nUncompressedOffset + m_nPosInChunk;
+    }
+
+    Status GetStatus() const
+    {
+        return m_eStatus;
+    }
+
+    // Boundary at the start of the current chunk, at or before Tell().
+    const Boundary &GetChunkStart() const
+    {
+        return m_oChunkStart;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipParallelDecoder)
+
+    // Part of the uncompressed data of a chunk that belongs to a single
+    // gzip member.
+    struct Piece
+    {
+        vsi_l_offset nSize = 0;
+        uLong nCRC = 0;
+        bool bEndsMember = false;
+        GUInt32 nExpectedCRC = 0;
+        GUInt32 nExpectedSize = 0;
+    };
+
+    struct Chunk
+    {
+        vsi_l_offset nCompressedOffset = 0;
+        bool bStartsAtMember = false;
+        std::vector<GByte> abyCompressed{};
+
+        bool bDone = false;  // protected by m_oMutex
+        bool bOK = false;
+        bool bTooLarge = false;
+        bool bEndsAtMember = false;
+        std::vector<GByte> abyData{};
+        std::vector<Piece> aoPieces{};
+
+        void Decode();
+    };
+
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    const vsi_l_offset m_nFileSize;
+    const size_t m_nMaxChunksInFlight;
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    // Cutting side
+    bool m_bBGZF = false;
+    bool m_bNoMoreChunks = false;
+    bool m_bReachedEOF = false;
+    vsi_l_offset m_nNextChunkOffset = 0;
+    bool m_bNextChunkAtMember = true;
+    std::vector<GByte> m_abyPending{};
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+
+    // Consuming side
+    Status m_eStatus = Status::OK;
+    Boundary m_oChunkStart{};
+    std::unique_ptr<Chunk> m_poChunk{};
+    size_t m_nPosInChunk = 0;
+    uLong m_nMemberCRCAtChunkEnd = 0;
+    vsi_l_offset m_nMemberSizeAtChunkEnd = 0;
+
+    bool FindCut(const std::vector<GByte> &abyBuffer, size_t &nCut,
+                 bool &bCutAtMember);
+    bool SubmitNextChunk();
+    bool NextChunk();
+};
+
+/************************************************************************/
+/*                         GetGZipHeaderSize()                          */
+/************************************************************************/
+
+// Return the size of the gzip member header at the start of pabyData, or 0
+// if it is invalid or truncated.
+static size_t GetGZipHeaderSize(const GByte *pabyData, size_t nSize)
+{
+    if (nSize < 10 || pabyData[0] != gz_magic[0] ||
+        pabyData[1] != gz_magic[1] || pabyData[2] != Z_DEFLATED ||
+        (pabyData[3] & RESERVED) != 0)
+    {
+        return 0;
+    }
+    const int flags = pabyData[3];
+    size_t nPos = 10;
+    if ((flags & EXTRA_FIELD) != 0)
+    {
+        if (nSize - nPos < 2)
+            return 0;
+        const size_t nExtraSize =
+            pabyData[nPos] | (static_cast<size_t>(pabyData[nPos + 1]) << 8);
+        nPos += 2;
+        if (nSize - nPos < nExtraSize)
+            return 0;
+        nPos += nExtraSize;
+    }
+    for (const int nFlag : {ORIG_NAME, COMMENT})
+    {
+        if ((flags & nFlag) != 0)
+        {
+            const GByte *pabyEnd = static_cast<const GByte *>(
+                memchr(pabyData + nPos, 0, nSize - nPos));
+            if (!pabyEnd)
+                return 0;
+            nPos = static_cast<size_t>(pabyEnd - pabyData) + 1;
+        }
+    }
+    if ((flags & HEAD_CRC) != 0)
+    {
+        if (nSize - nPos < 2)
+            return 0;
+        nPos += 2;
+    }
+    return nPos;
+}
+
+/************************************************************************/
+/*                          GetBGZFBlockSize()                          */
+/************************************************************************/
+
+// Return the size of the BGZF block starting at pabyData, or 0.
+static size_t GetBGZFBlockSize(const GByte *pabyData, size_t nSize)
+{
+    // A single extra subfield, "BC", with the block size minus one.
+    if (nSize < 18 || pabyData[0] != gz_magic[0] ||
+        pabyData[1] != gz_magic[1] || pabyData[2] != Z_DEFLATED ||
+        pabyData[3] != EXTRA_FIELD || pabyData[10] != 6 || pabyData[11] != 0 ||
+        pabyData[12] != 'B' || pabyData[13] != 'C' || pabyData[14] != 2 ||
+        pabyData[15] != 0)
+    {
+        return 0;
+    }
+    return (pabyData[16] | (static_cast<size_t>(pabyData[17]) << 8)) + 1;
+}
+
+/************************************************************************/
+/*                           Chunk::Decode()                            */
+/************************************************************************/
+
+void VSIGZipParallelDecoder::Chunk::Decode()
+{
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return;
+
+    const size_t nCompressedSize = abyCompressed.size();
+    size_t nPos = 0;
+    size_t nOutSize = 0;
+    abyData.resize(std::min(std::max<size_t>(4 * nCompressedSize, Z_BUFSIZE),
+                            GZIP_PARALLEL_MAX_DECODED_CHUNK_SIZE));
+    bool bInMember = !bStartsAtMember;
+    Piece oPiece;
+    while (true)
+    {
+        if (!bInMember)
+        {
+            if (nPos == nCompressedSize)
+            {
+                bEndsAtMember = true;
+                bOK = true;
+                break;
+            }
+            const size_t nHeaderSize = GetGZipHeaderSize(
+                abyCompressed.data() + nPos, nCompressedSize - nPos);
+            if (nHeaderSize == 0 || inflateReset(&sStream) != Z_OK)
+                break;
+            nPos += nHeaderSize;
+            bInMember = true;
+        }
+
+        if (abyData.size() - nOutSize < static_cast<size_t>(Z_BUFSIZE))
+        {
+            if (abyData.size() >= GZIP_PARALLEL_MAX_DECODED_CHUNK_SIZE)
+            {
+                bTooLarge = true;
+                break;
+            }
+            abyData.resize(std::min(2 * abyData.size(),
+                                    GZIP_PARALLEL_MAX_DECODED_CHUNK_SIZE));
+        }
+        sStream.next_in = abyCompressed.data() + nPos;
+        sStream.avail_in = static_cast<uInt>(nCompressedSize - nPos);
+        sStream.next_out = abyData.data() + nOutSize;
+        sStream.avail_out = static_cast<uInt>(std::min<size_t>(
+            abyData.size() - nOutSize, std::numeric_limits<uInt>::max()));
+        const int ret = inflate(&sStream, Z_BLOCK);
+        const size_t nProduced =
+            static_cast<size_t>(sStream.next_out - (abyData.data() + nOutSize));
+        oPiece.nCRC = crc32(oPiece.nCRC, abyData.data() + nOutSize,
+                            static_cast<uInt>(nProduced));
+        oPiece.nSize += nProduced;
+        nOutSize += nProduced;
+        nPos = nCompressedSize - sStream.avail_in;
+
+        if (ret == Z_STREAM_END)
+        {
+            if (nCompressedSize - nPos < 8)
+                break;
+            const GByte *pabyTrailer = abyCompressed.data() + nPos;
+            oPiece.bEndsMember = true;
+            oPiece.nExpectedCRC = CPL_LSBUINT32PTR(pabyTrailer);
+            oPiece.nExpectedSize = CPL_LSBUINT32PTR(pabyTrailer + 4);
+            aoPieces.push_back(oPiece);
+            oPiece = Piece();
+            nPos += 8;
+            bInMember = false;
+        }
+        else if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            break;
+        }
+        else if (sStream.avail_out != 0 &&
+                 (nPos == nCompressedSize || ret == Z_BUF_ERROR))
+        {
+            // The chunk ends in the middle of a member: this must be at a
+            // byte-aligned deflate block boundary.
+            if (nPos == nCompressedSize && (sStream.data_type & 128) != 0 &&
+                (sStream.data_type & 7) == 0)
+            {
+                aoPieces.push_back(oPiece);
+                bOK = true;
+            }
+            break;
+        }
+    }
+    inflateEnd(&sStream);
+    if (bTooLarge)
+    {
+        aoPieces.clear();
+        std::vector<GByte>().swap(abyData);
+    }
+    else
+    {
+        abyData.resize(nOutSize);
+    }
+}
+
+/************************************************************************/
+/*                       VSIGZipParallelDecoder()                       */
+/************************************************************************/
+
+VSIGZipParallelDecoder::VSIGZipParallelDecoder(VSIVirtualHandle *poBaseHandle,
+                                               vsi_l_offset nFileSize,
+                                               int nThreads)
+    : m_poBaseHandle(poBaseHandle), m_nFileSize(nFileSize),
+      m_nMaxChunksInFlight(2 * static_cast<size_t>(nThreads))
+{
+    GByte abyHeader[18];
+    m_bBGZF = m_poBaseHandle->Seek(0, SEEK_SET) == 0 &&
+              m_poBaseHandle->Read(abyHeader, sizeof(abyHeader)) ==
+                  sizeof(abyHeader) &&
+              GetBGZFBlockSize(abyHeader, sizeof(abyHeader)) != 0;
+
+    m_poPool = std::make_unique<CPLWorkerThreadPool>();
+    if (!m_poPool->Setup(nThreads, nullptr, nullptr, false))
+    {
+        m_poPool.reset();
+        m_eStatus = Status::SERIAL_DECODING_NEEDED;
+    }
+}
+
+/************************************************************************/
+/*                      ~VSIGZipParallelDecoder()                       */
+/************************************************************************/
+
+VSIGZipParallelDecoder::~VSIGZipParallelDecoder()
+{
+    if (m_poPool)
+        m_poPool->WaitCompletion();
+}
+
+/************************************************************************/
+/*                              FindCut()                               */
+/************************************************************************/
+
+// Find the last position in abyBuffer (which starts at a chunk start) where
+// a new chunk could start.
+bool VSIGZipParallelDecoder::FindCut(const std::vector<GByte> &abyBuffer,
+                                     size_t &nCut, bool &bCutAtMember)
+{
+    const size_t nSize = abyBuffer.size();
+    const GByte *pabyData = abyBuffer.data();
+    if (m_bBGZF)
+    {
+        size_t nPos = 0;
+        while (nPos < nSize)
+        {
+            const size_t nBlockSize =
+                GetBGZFBlockSize(pabyData + nPos, nSize - nPos);
+            if (nBlockSize == 0)
+            {
+                if (nSize - nPos >= 18)
+                {
+                    CPLDebug("GZIP", "Not a BGZF file after all");
+                    m_bBGZF = false;
+                }
+                break;
+            }
+            if (nBlockSize > nSize - nPos)
+                break;
+            nPos += nBlockSize;
+        }
+        if (nPos > 0 && m_bBGZF)
+        {
+            nCut = nPos;
+            bCutAtMember = true;
+            return true;
+        }
+        if (m_bBGZF)
+            return false;
+    }
+
+    constexpr GByte abyFullFlushMarker[] = {0x00, 0x00, 0xFF, 0xFF, 0x00,
+                                            0x00, 0x00, 0xFF, 0xFF};
+    constexpr size_t MARKER_SIZE = sizeof(abyFullFlushMarker);
+    for (size_t i = nSize; i >= MARKER_SIZE + 1; --i)
+    {
+        if (pabyData[i - 1] == 0xFF &&
+            memcmp(pabyData + i - MARKER_SIZE, abyFullFlushMarker,
+                   MARKER_SIZE) == 0)
+        {
+            nCut = i;
+            bCutAtMember = false;
+            return true;
+        }
+    }
+
+    // Start of a gzip member, following at least the trailer of the
+    // previous one.
+    constexpr size_t GZIP_TRAILER_SIZE = 8;
+    for (size_t i = nSize; i >= GZIP_TRAILER_SIZE + 3; --i)
+    {
+        const size_t nPos = i - 3;
+        if (pabyData[nPos] == gz_magic[0] &&
+            pabyData[nPos + 1] == gz_magic[1] &&
+            pabyData[nPos + 2] == Z_DEFLATED)
+        {
+            const size_t nHeaderSize =
+                GetGZipHeaderSize(pabyData + nPos, nSize - nPos);
+            if (nHeaderSize == 0)
+                continue;
+
+            // Rule out most false positives by inflating a bit of data.
+            z_stream sStream;
+            memset(&sStream, 0, sizeof(sStream));
+            if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+                return false;
+            GByte abyOut[4096];
+            sStream.next_in =
+                const_cast<GByte *>(pabyData + nPos + nHeaderSize);
+            sStream.avail_in = static_cast<uInt>(nSize - nPos - nHeaderSize);
+            sStream.next_out = abyOut;
+            sStream.avail_out = sizeof(abyOut);
+            const int ret = inflate(&sStream, Z_NO_FLUSH);
+            inflateEnd(&sStream);
+            if (ret == Z_OK || ret == Z_STREAM_END || ret == Z_BUF_ERROR)
+            {
+                nCut = nPos;
+                bCutAtMember = true;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          SubmitNextChunk()                           */
+/************************************************************************/
+
+// Read compressed data up to the next cut position, and submit its decoding.
+bool VSIGZipParallelDecoder::SubmitNextChunk()
+{
+    if (m_nNextChunkOffset >= m_nFileSize)
+    {
+        m_bReachedEOF = true;
+        return false;
+    }
+
+    auto poChunk = std::make_unique<Chunk>();
+    poChunk->nCompressedOffset = m_nNextChunkOffset;
+    poChunk->bStartsAtMember = m_bNextChunkAtMember;
+    std::vector<GByte> &abyBuffer = poChunk->abyCompressed;
+    std::swap(abyBuffer, m_abyPending);
+
+    size_t nCut = 0;
+    bool bCutAtMember = true;
+    size_t nTargetSize = GZIP_PARALLEL_CHUNK_SIZE;
+    while (true)
+    {
+        const vsi_l_offset nBufferEnd = m_nNextChunkOffset + abyBuffer.size();
+        if (nTargetSize > abyBuffer.size() && nBufferEnd < m_nFileSize)
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min<vsi_l_offset>(nTargetSize - abyBuffer.size(),
+                                       m_nFileSize - nBufferEnd));
+            const size_t nOldSize = abyBuffer.size();
+            abyBuffer.resize(nOldSize + nToRead);
+            if (m_poBaseHandle->Seek(nBufferEnd, SEEK_SET) != 0 ||
+                m_poBaseHandle->Read(abyBuffer.data() + nOldSize, nToRead) !=
+                    nToRead)
+            {
+                return false;
+            }
+        }
+        if (m_nNextChunkOffset + abyBuffer.size() == m_nFileSize)
+        {
+            // Last chunk
+            nCut = abyBuffer.size();
+            break;
+        }
+        if (FindCut(abyBuffer, nCut, bCutAtMember))
+            break;
+        if (nTargetSize >= GZIP_PARALLEL_MAX_CHUNK_SIZE)
+        {
+            CPLDebug("GZIP", "No cut position found after " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(m_nNextChunkOffset));
+            return false;
+        }
+        nTargetSize += GZIP_PARALLEL_CHUNK_SIZE;
+    }
+
+    m_abyPending.assign(abyBuffer.begin() + nCut, abyBuffer.end());
+    abyBuffer.resize(nCut);
+    m_nNextChunkOffset += nCut;
+    m_bNextChunkAtMember = bCutAtMember;
+
+    Chunk *psChunk = poChunk.get();
+    m_apoChunks.push_back(std::move(poChunk));
+    m_poPool->SubmitJob(
+        [this, psChunk]()
+        {
+            psChunk->Decode();
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                psChunk->bDone = true;
+            }
+            m_oCV.notify_all();
+        });
+    return true;
+}
+
+/************************************************************************/
+/*                             NextChunk()                              */
+/************************************************************************/
+
+// Make the next chunk the current one, once it has been decoded and
+// checked.
+bool VSIGZipParallelDecoder::NextChunk()
+{
+    while (!m_bNoMoreChunks && m_apoChunks.size() < m_nMaxChunksInFlight)
+    {
+        if (!SubmitNextChunk())
+            m_bNoMoreChunks = true;
+    }
+    if (m_apoChunks.empty())
+    {
+        m_eStatus = m_bReachedEOF && (!m_poChunk || m_poChunk->bEndsAtMember)
+                        ? Status::END_OF_FILE
+                        : Status::SERIAL_DECODING_NEEDED;
+        return false;
+    }
+
+    Chunk *psNextChunk = m_apoChunks.front().get();
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [psNextChunk] { return psNextChunk->bDone; });
+    }
+
+    const bool bStartsAtMember =
+        m_poChunk ? m_poChunk->bEndsAtMember : m_oChunkStart.bMemberStart;
+    if (psNextChunk->bTooLarge)
+    {
+        CPLDebug("GZIP",
+                 "Chunk at " CPL_FRMT_GUIB " decompresses to more than %d MB. "
+                 "Going on with serial decoding",
+                 static_cast<GUIntBig>(psNextChunk->nCompressedOffset),
+                 static_cast<int>(GZIP_PARALLEL_MAX_DECODED_CHUNK_SIZE >> 20));
+        m_eStatus = Status::SERIAL_DECODING_NEEDED;
+        return false;
+    }
+    if (!psNextChunk->bOK || psNextChunk->bStartsAtMember != bStartsAtMember)
+    {
+        CPLDebug("GZIP",
+                 "Cannot use chunk decoded in parallel at " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(psNextChunk->nCompressedOffset));
+        m_eStatus = Status::SERIAL_DECODING_NEEDED;
+        return false;
+    }
+
+    uLong nMemberCRC = m_nMemberCRCAtChunkEnd;
+    vsi_l_offset nMemberSize = m_nMemberSizeAtChunkEnd;
+    for (const auto &oPiece : psNextChunk->aoPieces)
+    {
+        nMemberCRC = crc32_combine(nMemberCRC, oPiece.nCRC,
+                                   static_cast<z_off_t>(oPiece.nSize));
+        nMemberSize += oPiece.nSize;
+        if (oPiece.bEndsMember)
+        {
+            if (nMemberCRC != oPiece.nExpectedCRC ||
+                static_cast<GUInt32>(nMemberSize) != oPiece.nExpectedSize)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "CRC error. Got %X instead of %X",
+                         static_cast<unsigned int>(nMemberCRC),
+                         static_cast<unsigned int>(oPiece.nExpectedCRC));
+                m_eStatus = Status::DATA_ERROR;
+                return false;
+            }
+            nMemberCRC = 0;
+            nMemberSize = 0;
+        }
+    }
+
+    // Compute the boundary at the start of the new chunk.
+    if (m_poChunk)
+    {
+        const auto &abyData = m_poChunk->abyData;
+        auto &abyWindow = m_oChunkStart.abyWindow;
+        if (abyData.size() >= GZIP_INDEX_WINDOW_SIZE)
+        {
+            abyWindow.assign(abyData.end() - GZIP_INDEX_WINDOW_SIZE,
+                             abyData.end());
+        }
+        else
+        {
+            abyWindow.insert(abyWindow.end(), abyData.begin(), abyData.end());
+            if (abyWindow.size() > GZIP_INDEX_WINDOW_SIZE)
+                abyWindow.erase(abyWindow.begin(),
+                                abyWindow.end() - GZIP_INDEX_WINDOW_SIZE);
+        }
+        m_oChunkStart.nCompressedOffset = psNextChunk->nCompressedOffset;
+        m_oChunkStart.nUncompressedOffset += abyData.size();
+        m_oChunkStart.bMemberStart = bStartsAtMember;
+        m_oChunkStart.nMemberCRC = m_nMemberCRCAtChunkEnd;
+        m_oChunkStart.nMemberSize = m_nMemberSizeAtChunkEnd;
+    }
+    m_nMemberCRCAtChunkEnd = nMemberCRC;
+    m_nMemberSizeAtChunkEnd = nMemberSize;
+
+    m_poChunk = std::move(m_apoChunks.front());
+    m_apoChunks.pop_front();
+    m_nPosInChunk = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+// pBuffer may be null to skip data.
+size_t VSIGZipParallelDecoder::Read(void *pBuffer, size_t nBytes)
+{
+    size_t nDone = 0;
+    while (nDone < nBytes)
+    {
+        if (m_poChunk && m_nPosInChunk < m_poChunk->abyData.size())
+        {
+            const size_t nToCopy = std::min(
+                nBytes - nDone, m_poChunk->abyData.size() - m_nPosInChunk);
+            if (pBuffer)
+            {
+                memcpy(static_cast<GByte *>(pBuffer) + nDone,
+                       m_poChunk->abyData.data() + m_nPosInChunk, nToCopy);
+            }
+            m_nPosInChunk += nToCopy;
+            nDone += nToCopy;
+        }
+        else if (m_eStatus != Status::OK || !NextChunk())
+        {
+            break;
+        }
+    }
+    return nDone;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+// Only seeking forward, or backward within the current chunk, is possible.
+bool VSIGZipParallelDecoder::Seek(vsi_l_offset nOffset)
+{
+    if (nOffset < m_oChunkStart.nUncompressedOffset)
+        return false;
+    const size_t nChunkSize = m_poChunk ? m_poChunk->abyData.size() : 0;
+    if (nOffset - m_oChunkStart.nUncompressedOffset <= nChunkSize)
+    {
+        m_nPosInChunk =
+            static_cast<size_t>(nOffset - m_oChunkStart.nUncompressedOffset);
+        return true;
+    }
+
+    while (Tell() < nOffset)
+    {
+        const size_t nToSkip = static_cast<size_t>(std::min<vsi_l_offset>(
+            nOffset - Tell(), std::numeric_limits<size_t>::max()));
+        if (Read(nullptr, nToSkip) != nToSkip)
+            return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIGZipHandle                                  */
@@ -178,12 +1376,40 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    // Persistent index of access points (CPL_VSIL_GZIP_INDEX=YES)
+    bool m_bUseIndex = false;
+    bool m_bIndexLoadAttempted = false;
+    vsi_l_offset m_nIndexSpacing = 0;
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{};
+
+    // Multithreaded decoding of sequential reads (GDAL_NUM_THREADS)
+    int m_nDecodingThreads = 0;
+    bool m_bCanDecodeInParallel = false;
+    bool m_bStartParallelDecoding = false;
+    // End of the data read sequentially from the start of the file.
+    vsi_l_offset m_nSequentialReadEnd = 0;
+    std::unique_ptr<VSIGZipParallelDecoder> m_poParallelDecoder{};
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
     int gzrewind();
     uLong getLong();
 
+    std::string GetIndexFilename(bool bInMemory) const;
+    bool LoadIndex();
+    bool BuildIndex();
+    bool SeekToIndexPoint(const VSIGZipIndexPoint &oPoint);
+    bool RestoreInflateState(vsi_l_offset nCompressedOffset, int nBits,
+                             uLong nCRC, const GByte *pabyWindow,
+                             uInt nWindowSize,
+                             vsi_l_offset nUncompressedOffset);
+    void WriteProperties();
+
+    bool StartParallelDecoding();
+    void StopParallelDecoding();
+    size_t ReadParallel(void *pBuffer, size_t nBytes);
+
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipHandle)
 
   public:
@@ -402,6 +1628,8 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
     }
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
+    poHandle->m_bIndexLoadAttempted = m_bIndexLoadAttempted;
+    poHandle->m_poIndex = m_poIndex;
 
     // Most important: duplicate the snapshots!
 
@@ -519,6 +1747,29 @@ VSIGZipHandle::VSIGZipHandle(VSIVirtualHandleUniquePtr poBaseHandleIn,
         snapshots = static_cast<GZipSnapshot *>(CPLCalloc(
             sizeof(GZipSnapshot),
             static_cast<size_t>(compressed_size / snapshot_byte_interval + 1)));
+
+        // Only for standalone .gz files (not for members of .zip files)
+        if (offset == 0 && m_pszBaseFileName && m_transparent == 0 &&
+            CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+        {
+            m_bUseIndex = true;
+            GIntBig nSpacing = 0;
+            if (CPLParseMemorySize(
+                    CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPACING", "4MB"),
+                    &nSpacing, nullptr) != CE_None ||
+                nSpacing <= 0)
+            {
+                nSpacing = 4 * 1024 * 1024;
+            }
+            m_nIndexSpacing = static_cast<vsi_l_offset>(nSpacing);
+        }
+
+        if (offset == 0 && m_transparent == 0 && expected_crc == 0)
+        {
+            m_nDecodingThreads = GDALGetNumThreads(
+                /* nMaxVal = */ 128, /* bDefaultToAllCPUs = */ false);
+            m_bCanDecodeInParallel = m_nDecodingThreads > 1;
+        }
     }
 }
 
@@ -727,9 +1978,309 @@ int VSIGZipHandle::gzrewind()
         CPL_IGNORE_RET_VAL(inflateReset(&stream));
     in = 0;
     out = 0;
+    m_nSequentialReadEnd = 0;
     return m_poBaseHandle->Seek(startOff, SEEK_SET);
 }
 
+/************************************************************************/
+/*                          WriteProperties()                           */
+/************************************************************************/
+
+void VSIGZipHandle::WriteProperties()
+{
+    if (m_pszBaseFileName && !STARTS_WITH(m_pszBaseFileName, "/vsicurl/") &&
+        !STARTS_WITH(m_pszBaseFileName, "/vsitar/") &&
+        !STARTS_WITH(m_pszBaseFileName, "/vsizip/") && m_bWriteProperties)
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+        CPLString osCacheFilename(m_pszBaseFileName);
+        osCacheFilename += ".properties";
+
+        // Write a .properties file to avoid seeking next time.
+        VSILFILE *fpCacheLength = VSIFOpenL(osCacheFilename.c_str(), "wb");
+        if (fpCacheLength)
+        {
+            char szBuffer[32] = {};
+
+            CPLPrintUIntBig(szBuffer, m_compressed_size, 31);
+            char *pszFirstNonSpace = szBuffer;
+            while (*pszFirstNonSpace == ' ')
+                pszFirstNonSpace++;
+            CPL_IGNORE_RET_VAL(VSIFPrintfL(
+                fpCacheLength, "compressed_size=%s\n", pszFirstNonSpace));
+
+            CPLPrintUIntBig(szBuffer, m_uncompressed_size, 31);
+            pszFirstNonSpace = szBuffer;
+            while (*pszFirstNonSpace == ' ')
+                pszFirstNonSpace++;
+            CPL_IGNORE_RET_VAL(VSIFPrintfL(
+                fpCacheLength, "uncompressed_size=%s\n", pszFirstNonSpace));
+
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fpCacheLength));
+        }
+    }
+}
+
+/************************************************************************/
+/*                          GetIndexFilename()                          */
+/************************************************************************/
+
+std::string VSIGZipHandle::GetIndexFilename(bool bInMemory) const
+{
+    if (!bInMemory)
+        return std::string(m_pszBaseFileName).append(".gzidx");
+
+    // Indexes of remote files, or of files in read-only locations, are kept
+    // for the lifetime of the process in a hidden /vsimem/ directory.
+    static const std::string osDir =
+        VSIMemGenerateHiddenFilename("vsigzip_index");
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(m_pszBaseFileName, strlen(m_pszBaseFileName), abyHash);
+    CPLCharUniquePtr pszHash(CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash));
+    return CPLFormFilenameSafe(osDir.c_str(), pszHash.get(), "gzidx");
+}
+
+/************************************************************************/
+/*                             LoadIndex()                              */
+/************************************************************************/
+
+bool VSIGZipHandle::LoadIndex()
+{
+    if (!m_bIndexLoadAttempted)
+    {
+        m_bIndexLoadAttempted = true;
+
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        std::unique_ptr<VSIGZipIndex> poIndex;
+        if (VSIIsLocal(m_pszBaseFileName))
+            poIndex =
+                VSIGZipIndex::Load(GetIndexFilename(false), m_compressed_size);
+        if (!poIndex)
+            poIndex =
+                VSIGZipIndex::Load(GetIndexFilename(true), m_compressed_size);
+        if (poIndex)
+        {
+            m_uncompressed_size = poIndex->nUncompressedSize;
+            m_poIndex = std::move(poIndex);
+        }
+    }
+    return m_poIndex != nullptr;
+}
+
+/************************************************************************/
+/*                             BuildIndex()                             */
+/************************************************************************/
+
+// Decompress the whole file to build its index, and save it. The position
+// in the base handle is undefined after this call.
+bool VSIGZipHandle::BuildIndex()
+{
+    CPLDebug("GZIP", "Building index of %s", m_pszBaseFileName);
+    auto poIndex = VSIGZipIndex::Build(m_poBaseHandle.get(), m_compressed_size,
+                                       m_nIndexSpacing);
+    if (!poIndex)
+    {
+        CPLDebug("GZIP", "Cannot build index of %s", m_pszBaseFileName);
+        m_bUseIndex = false;
+        return false;
+    }
+
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (!VSIIsLocal(m_pszBaseFileName) ||
+            !poIndex->Save(GetIndexFilename(false)))
+        {
+            poIndex->Save(GetIndexFilename(true));
+        }
+    }
+
+    m_uncompressed_size = poIndex->nUncompressedSize;
+    m_poIndex = std::move(poIndex);
+    WriteProperties();
+    return true;
+}
+
+/************************************************************************/
+/*                          SeekToIndexPoint()                          */
+/************************************************************************/
+
+// Restore the state of the inflater at an access point of the index. On
+// failure, the index is disabled and the stream is rewound.
+bool VSIGZipHandle::SeekToIndexPoint(const VSIGZipIndexPoint &oPoint)
+{
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP",
+             "Using index point: in=" CPL_FRMT_GUIB " out=" CPL_FRMT_GUIB,
+             oPoint.nCompressedOffset, oPoint.nUncompressedOffset);
+#endif
+    std::vector<GByte> abyWindow(oPoint.nWindowSize);
+    bool bOK = true;
+    if (oPoint.nWindowSize > 0)
+    {
+        size_t nWindowSize = 0;
+        bOK = CPLZLibInflate(oPoint.abyCompressedWindow.data(),
+                             oPoint.abyCompressedWindow.size(),
+                             abyWindow.data(), abyWindow.size(),
+                             &nWindowSize) != nullptr &&
+              nWindowSize == abyWindow.size();
+    }
+    if (!bOK || !RestoreInflateState(oPoint.nCompressedOffset, oPoint.nBits,
+                                     oPoint.nCRC, abyWindow.data(),
+                                     oPoint.nWindowSize,
+                                     oPoint.nUncompressedOffset))
+    {
+        CPLDebug("GZIP", "Cannot use index of %s", m_pszBaseFileName);
+        m_bUseIndex = false;
+        CPL_IGNORE_RET_VAL(gzrewind());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        RestoreInflateState()                         */
+/************************************************************************/
+
+// Reset the inflater to decode from a deflate block boundary, nBits bits
+// before nCompressedOffset, with pabyWindow as the preceding uncompressed
+// data.
+bool VSIGZipHandle::RestoreInflateState(vsi_l_offset nCompressedOffset,
+                                        int nBits, uLong nCRC,
+                                        const GByte *pabyWindow,
+                                        uInt nWindowSize,
+                                        vsi_l_offset nUncompressedOffset)
+{
+    const vsi_l_offset nSeekOffset = nCompressedOffset - (nBits > 0 ? 1 : 0);
+    bool bOK = inflateReset(&stream) == Z_OK &&
+               m_poBaseHandle->Seek(nSeekOffset, SEEK_SET) == 0;
+    if (bOK && nBits > 0)
+    {
+        GByte byVal = 0;
+        bOK = m_poBaseHandle->Read(&byVal, 1) == 1 &&
+              inflatePrime(&stream, nBits, byVal >> (8 - nBits)) == Z_OK;
+    }
+    if (bOK && nWindowSize > 0)
+    {
+        bOK = inflateSetDictionary(&stream, pabyWindow, nWindowSize) == Z_OK;
+    }
+    if (!bOK)
+        return false;
+
+    z_err = Z_OK;
+    z_eof = 0;
+    m_bEOF = false;
+    m_transparent = 0;
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    crc = nCRC;
+    in = nCompressedOffset > startOff ? nCompressedOffset - startOff : 0;
+    out = nUncompressedOffset;
+    return true;
+}
+
+/************************************************************************/
+/*                       StartParallelDecoding()                        */
+/************************************************************************/
+
+// Switch from serial to parallel decoding, at the current position.
+bool VSIGZipHandle::StartParallelDecoding()
+{
+    const vsi_l_offset nBasePos = m_poBaseHandle->Tell();
+    auto poDecoder = std::make_unique<VSIGZipParallelDecoder>(
+        m_poBaseHandle.get(), m_compressed_size, m_nDecodingThreads);
+    if (!poDecoder->Seek(out))
+    {
+        // Typically a file made of a single member without full flushes.
+        CPLDebug("GZIP", "Cannot decode %s in parallel",
+                 m_pszBaseFileName ? m_pszBaseFileName : "file");
+        poDecoder.reset();
+        m_bCanDecodeInParallel = false;
+        if (m_poBaseHandle->Seek(nBasePos, SEEK_SET) != 0)
+        {
+            z_err = Z_ERRNO;
+            return false;
+        }
+        return false;
+    }
+    m_poParallelDecoder = std::move(poDecoder);
+    return true;
+}
+
+/************************************************************************/
+/*                        StopParallelDecoding()                        */
+/************************************************************************/
+
+// Switch back to serial decoding, at the start of the current chunk of the
+// parallel decoder, which is at or before the current position.
+void VSIGZipHandle::StopParallelDecoding()
+{
+    if (m_poParallelDecoder->GetStatus() ==
+        VSIGZipParallelDecoder::Status::SERIAL_DECODING_NEEDED)
+    {
+        m_bCanDecodeInParallel = false;
+    }
+    const VSIGZipParallelDecoder::Boundary oBoundary =
+        m_poParallelDecoder->GetChunkStart();
+    m_poParallelDecoder.reset();
+    m_nSequentialReadEnd = std::numeric_limits<vsi_l_offset>::max();
+
+    bool bOK;
+    if (oBoundary.bMemberStart)
+    {
+        bOK = RestoreInflateState(oBoundary.nCompressedOffset, 0, 0, nullptr,
+                                  0, oBoundary.nUncompressedOffset);
+        if (bOK)
+            check_header();
+    }
+    else
+    {
+        bOK = RestoreInflateState(
+            oBoundary.nCompressedOffset, 0, oBoundary.nMemberCRC,
+            oBoundary.abyWindow.data(),
+            static_cast<uInt>(oBoundary.abyWindow.size()),
+            oBoundary.nUncompressedOffset);
+    }
+    if (!bOK)
+        CPL_IGNORE_RET_VAL(gzrewind());
+}
+
+/************************************************************************/
+/*                            ReadParallel()                            */
+/************************************************************************/
+
+size_t VSIGZipHandle::ReadParallel(void *pBuffer, size_t nBytes)
+{
+    const size_t nRead = m_poParallelDecoder->Read(pBuffer, nBytes);
+    out = m_poParallelDecoder->Tell();
+    if (nRead == nBytes)
+        return nRead;
+
+    switch (m_poParallelDecoder->GetStatus())
+    {
+        case VSIGZipParallelDecoder::Status::END_OF_FILE:
+            z_err = Z_STREAM_END;
+            m_bEOF = true;
+            break;
+
+        case VSIGZipParallelDecoder::Status::DATA_ERROR:
+            z_err = Z_DATA_ERROR;
+            break;
+
+        case VSIGZipParallelDecoder::Status::OK:
+        case VSIGZipParallelDecoder::Status::SERIAL_DECODING_NEEDED:
+        {
+            const vsi_l_offset nOffset = out;
+            StopParallelDecoding();
+            if (!gzseek(nOffset, SEEK_SET))
+                return nRead;
+            return nRead + Read(static_cast<GByte *>(pBuffer) + nRead,
+                                nBytes - nRead);
+        }
+    }
+    return nRead;
+}
+
 /************************************************************************/
 /*                                Seek()                                */
 /************************************************************************/
@@ -738,6 +2289,21 @@ int VSIGZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
 {
     m_bEOF = false;
 
+    if (m_poParallelDecoder)
+    {
+        if (nWhence == SEEK_CUR)
+        {
+            nOffset += out;
+            nWhence = SEEK_SET;
+        }
+        if (nWhence == SEEK_SET && m_poParallelDecoder->Seek(nOffset))
+        {
+            out = nOffset;
+            return 0;
+        }
+        StopParallelDecoding();
+    }
+
     return gzseek(nOffset, nWhence) ? 0 : -1;
 }
 
@@ -811,6 +2377,23 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
     // whence == SEEK_END is unsuppored in original gzseek.
     if (whence == SEEK_END)
     {
+        // The whole file has to be decompressed to find its end: build the
+        // index along the way, if it is not available yet.
+        if (offset == 0 && m_bUseIndex && !LoadIndex())
+        {
+            const bool bIndexBuilt = BuildIndex();
+            if (gzrewind() < 0)
+            {
+                CPL_VSIL_GZ_RETURN(FALSE);
+                return false;
+            }
+            if (bIndexBuilt)
+            {
+                out = m_uncompressed_size;
+                return true;
+            }
+        }
+
         // If we known the uncompressed size, we can fake a jump to
         // the end of the stream.
         if (offset == 0 && m_uncompressed_size != 0)
@@ -843,8 +2426,17 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         offset += out;
     }
 
+    // Jump to the closest access point of the index, unless the current
+    // position is closer.
+    const VSIGZipIndexPoint *poPoint =
+        m_bUseIndex && LoadIndex() ? m_poIndex->GetPoint(offset) : nullptr;
+    if (poPoint && (offset < out || poPoint->nUncompressedOffset > out) &&
+        SeekToIndexPoint(*poPoint))
+    {
+        offset -= out;
+    }
     // For a negative seek, rewind and use positive seek.
-    if (offset >= out)
+    else if (offset >= out)
     {
         offset -= out;
     }
@@ -945,38 +2537,7 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
     {
         m_uncompressed_size = out;
 
-        if (m_pszBaseFileName && !STARTS_WITH(m_pszBaseFileName, "/vsicurl/") &&
-            !STARTS_WITH(m_pszBaseFileName, "/vsitar/") &&
-            !STARTS_WITH(m_pszBaseFileName, "/vsizip/") && m_bWriteProperties)
-        {
-            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
-
-            CPLString osCacheFilename(m_pszBaseFileName);
-            osCacheFilename += ".properties";
-
-            // Write a .properties file to avoid seeking next time.
-            VSILFILE *fpCacheLength = VSIFOpenL(osCacheFilename.c_str(), "wb");
-            if (fpCacheLength)
-            {
-                char szBuffer[32] = {};
-
-                CPLPrintUIntBig(szBuffer, m_compressed_size, 31);
-                char *pszFirstNonSpace = szBuffer;
-                while (*pszFirstNonSpace == ' ')
-                    pszFirstNonSpace++;
-                CPL_IGNORE_RET_VAL(VSIFPrintfL(
-                    fpCacheLength, "compressed_size=%s\n", pszFirstNonSpace));
-
-                CPLPrintUIntBig(szBuffer, m_uncompressed_size, 31);
-                pszFirstNonSpace = szBuffer;
-                while (*pszFirstNonSpace == ' ')
-                    pszFirstNonSpace++;
-                CPL_IGNORE_RET_VAL(VSIFPrintfL(
-                    fpCacheLength, "uncompressed_size=%s\n", pszFirstNonSpace));
-
-                CPL_IGNORE_RET_VAL(VSIFCloseL(fpCacheLength));
-            }
-        }
+        WriteProperties();
     }
 
     return true;
@@ -1004,6 +2565,9 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
     CPLDebug("GZIP", "Read(%p, %d)", buf, static_cast<int>(nBytes));
 #endif
 
+    if (m_poParallelDecoder)
+        return ReadParallel(buf, nBytes);
+
     if (m_bEOF || z_err != Z_OK)
     {
         if (z_err == Z_STREAM_END && nBytes > 0)
@@ -1011,12 +2575,22 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
         return 0;
     }
 
+    if (m_bStartParallelDecoding)
+    {
+        m_bStartParallelDecoding = false;
+        if (StartParallelDecoding())
+            return ReadParallel(buf, nBytes);
+        if (z_err != Z_OK)
+            return 0;
+    }
+
     if (nBytes > UINT32_MAX)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Too many bytes to read at once");
         return 0;
     }
 
+    const vsi_l_offset nOutBefore = out;
     const unsigned len = static_cast<unsigned int>(nBytes);
     Bytef *pStart =
         static_cast<Bytef *>(buf);  // Start off point for crc computation.
@@ -1217,6 +2791,17 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
         m_bEOF = true;
     }
 
+    // Switch to multithreaded decoding once a significant amount of data has
+    // been read sequentially from the start of the file.
+    if (m_nSequentialReadEnd == nOutBefore)
+    {
+        m_nSequentialReadEnd = out;
+        m_bStartParallelDecoding =
+            m_bCanDecodeInParallel && !m_bEOF && z_err == Z_OK &&
+            nOutBefore < GZIP_PARALLEL_CHUNK_SIZE &&
+            out >= GZIP_PARALLEL_CHUNK_SIZE;
+    }
+
 #ifdef ENABLE_DEBUG
     CPLDebug("GZIP", "Read return %u (z_err=%d, z_eof=%d)", ret, z_err, z_eof);
 #endif
@@ -3258,6 +4843,12 @@ const char *VSIGZipFilesystemHandler::GetOptions()
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX' type='boolean' "
+           "description='Whether to build and use a persistent index of "
+           "access points for random access' default='NO'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX_SPACING' type='string' "
+           "description='Approximate number of uncompressed bytes between "
+           "two access points of the index' default='4MB'/>"
            "</Options>";
 }
 
@@ -4181,6 +5772,8 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
         return false;
     }
     else if (info.nCompressedSize != 0 &&
+             // Zstandard can reach much higher compression ratios
+             info.nCompressionMethod != 93 &&
              info.nUncompressedSize / info.nCompressedSize >
                  MAX_DEFLATE_COMPRESSION_RATIO)
     {
@@ -4326,6 +5919,16 @@ VSIZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     if (!GetFileInfo(pszFilename, info, bSetError))
         return nullptr;
 
+#ifdef HAVE_ZSTD
+    if (info.nCompressionMethod == 93)
+    {
+        // Random access if the entry is in the Zstandard seekable format
+        return VSIVirtualHandleUniquePtr(VSICreateZstdReadHandle(
+            std::move(info.poVirtualHandle), info.nStartDataStream,
+            info.nCompressedSize, info.nUncompressedSize));
+    }
+#endif
+
 #ifdef ENABLE_DEFLATE64
     if (info.nCompressionMethod == 9)
     {
@@ -4410,6 +6013,8 @@ char **VSIZipFilesystemHandler::GetFileMetadata(const char *pszFilename,
             aosMetadata.SetNameValue("COMPRESSION_METHOD", "0 (STORED)");
         else if (info.nCompressionMethod == 8)
             aosMetadata.SetNameValue("COMPRESSION_METHOD", "8 (DEFLATE)");
+        else if (info.nCompressionMethod == 93)
+            aosMetadata.SetNameValue("COMPRESSION_METHOD", "93 (ZSTD)");
         else
         {
             aosMetadata.SetNameValue("COMPRESSION_METHOD",
@@ -911,7 +911,24 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
+        return;
     }
+
+    // With several part buffers, full parts are uploaded by worker threads
+    // while the next one is being filled.
+    if (poFS->SupportsParallelMultipartUpload())
+    {
+        m_nMaxBuffers = std::max(
+            1, atoi(VSIGetPathSpecificOption(
+                   pszFilename, "CPL_VSIL_MULTIPART_UPLOAD_BUFFERS", "1")));
+        if (m_nMaxBuffers > 1)
+        {
+            m_aosThreadLocalConfigOptions.Assign(
+                CSLDuplicate(CPLGetThreadLocalConfigOptions()), true);
+        }
+    }
+
+    m_poFS->RegisterWriteHandle(m_osFilename, this);
 }
 
 /************************************************************************/
@@ -982,8 +999,11 @@ size_t IVSIS3LikeFSHandlerWithMultipartUpload::GetUploadChunkSizeInBytes(
 VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
 {
     VSIMultipartWriteHandle::Close();
+    m_poFS->UnregisterWriteHandle(m_osFilename, this);
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1151,17 +1171,254 @@ bool VSIMultipartWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
+    if (m_nMaxBuffers > 1)
+        return SubmitPartUpload();
+
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
         m_pabyBuffer, m_nBufferOff, m_poS3HandleHelper, m_oRetryParameters,
         nullptr);
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        ++m_nPartsSubmitted;
+        m_nBytesSubmitted += m_nBufferOff;
+        if (!osEtag.empty())
+        {
+            ++m_nPartsUploaded;
+            m_nBytesUploaded += m_nBufferOff;
+            m_aosEtags.push_back(osEtag);
+        }
+        else
+        {
+            m_bUploadError = true;
+        }
+    }
     m_nBufferOff = 0;
+    return !osEtag.empty();
+}
+
+/************************************************************************/
+/*                          SubmitPartUpload()                          */
+/************************************************************************/
+
+/** Hand the current buffer over to a worker thread for upload, and get a
+ * free buffer for the next part, waiting for an upload to complete if all
+ * part buffers are in use.
+ */
+bool VSIMultipartWriteHandle::SubmitPartUpload()
+{
+    if (!m_poThreadPool)
+    {
+        auto poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poThreadPool->Setup(m_nMaxBuffers - 1, nullptr, nullptr))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot create threads to upload parts of %s",
+                     m_osFilename.c_str());
+            return false;
+        }
+        m_poThreadPool = std::move(poThreadPool);
+    }
+
+    GByte *pabyNextBuffer = nullptr;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCond.wait(oLock,
+                     [this]
+                     {
+                         return m_bUploadError ||
+                                !m_apabyFreeBuffers.empty() ||
+                                m_nAllocatedBuffers < m_nMaxBuffers;
+                     });
+        if (!m_bUploadError)
+        {
+            if (!m_apabyFreeBuffers.empty())
+            {
+                pabyNextBuffer = m_apabyFreeBuffers.back();
+                m_apabyFreeBuffers.pop_back();
+            }
+            else
+            {
+                pabyNextBuffer =
+                    static_cast<GByte *>(VSI_MALLOC_VERBOSE(m_nBufferSize));
+                if (pabyNextBuffer)
+                    ++m_nAllocatedBuffers;
+            }
+        }
+        if (pabyNextBuffer)
+        {
+            ++m_nPartsSubmitted;
+            ++m_nPartsInFlight;
+            m_nBytesSubmitted += m_nBufferOff;
+        }
+    }
+    if (!pabyNextBuffer)
+    {
+        // Report the errors of the failed upload
+        WaitForPendingUploads();
+        return false;
+    }
+
+    GByte *pabyData = m_pabyBuffer;
+    const size_t nSize = m_nBufferOff;
+    const int nPartNumber = m_nPartNumber;
+    m_pabyBuffer = pabyNextBuffer;
+    m_nBufferOff = 0;
+    m_poThreadPool->SubmitJob([this, pabyData, nSize, nPartNumber]()
+                              { UploadPartJob(pabyData, nSize, nPartNumber); });
+    return true;
+}
+
+/************************************************************************/
+/*                           UploadPartJob()                            */
+/************************************************************************/
+
+void VSIMultipartWriteHandle::UploadPartJob(GByte *pabyData, size_t nSize,
+                                            int nPartNumber)
+{
+    bool bSkip;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        bSkip = m_bUploadError;
+    }
+
+    std::string osEtag;
+    if (!bSkip)
+    {
+        CPLStringList aosOldThreadLocalConfigOptions(
+            CSLDuplicate(CPLGetThreadLocalConfigOptions()));
+        CPLSetThreadLocalConfigOptions(m_aosThreadLocalConfigOptions.List());
+
+        {
+            auto oAccumulatorContext =
+                m_oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulatorContext);
+
+            // UploadPart() modifies the query parameters of the handle
+            // helper, so each job needs its own.
+            auto poS3HandleHelper = std::unique_ptr<IVSIS3LikeHandleHelper>(
+                m_poFS->CreateHandleHelper(
+                    m_osFilename.c_str() + m_poFS->GetFSPrefix().size(),
+                    false));
+            if (poS3HandleHelper)
+            {
+                osEtag = m_poFS->UploadPart(
+                    m_osFilename, nPartNumber, m_osUploadID,
+                    static_cast<vsi_l_offset>(m_nBufferSize) *
+                        (nPartNumber - 1),
+                    pabyData, nSize, poS3HandleHelper.get(),
+                    m_oRetryParameters, nullptr);
+            }
+        }
+
+        CPLSetThreadLocalConfigOptions(aosOldThreadLocalConfigOptions.List());
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
     if (!osEtag.empty())
     {
-        m_aosEtags.push_back(osEtag);
+        if (m_aosEtags.size() < static_cast<size_t>(nPartNumber))
+            m_aosEtags.resize(nPartNumber);
+        m_aosEtags[nPartNumber - 1] = std::move(osEtag);
+        ++m_nPartsUploaded;
+        m_nBytesUploaded += nSize;
     }
-    return !osEtag.empty();
+    else
+    {
+        m_bUploadError = true;
+    }
+    --m_nPartsInFlight;
+    m_apabyFreeBuffers.push_back(pabyData);
+    m_oCond.notify_all();
+}
+
+/************************************************************************/
+/*                       WaitForPendingUploads()                        */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPendingUploads()
+{
+    if (m_poThreadPool)
+        m_poThreadPool->WaitCompletion();
+    m_oErrorAccumulator.ReplayErrors();
+    m_oErrorAccumulator.ClearErrors();
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return !m_bUploadError;
+}
+
+/************************************************************************/
+/*                          GetUploadStatus()                           */
+/************************************************************************/
+
+char **VSIMultipartWriteHandle::GetUploadStatus()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    CPLStringList aosStatus;
+    if (!m_osUploadID.empty())
+        aosStatus.SetNameValue("UPLOAD_ID", m_osUploadID.c_str());
+    aosStatus.SetNameValue("PART_SIZE",
+                           CPLSPrintf(CPL_FRMT_GUIB,
+                                      static_cast<GUIntBig>(m_nBufferSize)));
+    aosStatus.SetNameValue("PART_BUFFERS", CPLSPrintf("%d", m_nMaxBuffers));
+    aosStatus.SetNameValue("PARTS_SUBMITTED",
+                           CPLSPrintf("%d", m_nPartsSubmitted));
+    aosStatus.SetNameValue("PARTS_IN_FLIGHT",
+                           CPLSPrintf("%d", m_nPartsInFlight));
+    aosStatus.SetNameValue("PARTS_UPLOADED",
+                           CPLSPrintf("%d", m_nPartsUploaded));
+    aosStatus.SetNameValue(
+        "BYTES_SUBMITTED",
+        CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(m_nBytesSubmitted)));
+    aosStatus.SetNameValue(
+        "BYTES_UPLOADED",
+        CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(m_nBytesUploaded)));
+    aosStatus.SetNameValue("ERROR", m_bUploadError ? "YES" : "NO");
+    return aosStatus.StealList();
+}
+
+/************************************************************************/
+/*                        RegisterWriteHandle()                         */
+/************************************************************************/
+
+void IVSIS3LikeFSHandlerWithMultipartUpload::RegisterWriteHandle(
+    const std::string &osFilename, VSIMultipartWriteHandle *poHandle)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexWriteHandles);
+    m_oMapWriteHandles[osFilename] = poHandle;
+}
+
+/************************************************************************/
+/*                       UnregisterWriteHandle()                        */
+/************************************************************************/
+
+void IVSIS3LikeFSHandlerWithMultipartUpload::UnregisterWriteHandle(
+    const std::string &osFilename, VSIMultipartWriteHandle *poHandle)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexWriteHandles);
+    const auto oIter = m_oMapWriteHandles.find(osFilename);
+    // Another handle may have been opened since on the same file
+    if (oIter != m_oMapWriteHandles.end() && oIter->second == poHandle)
+        m_oMapWriteHandles.erase(oIter);
+}
+
+/************************************************************************/
+/*                          GetFileMetadata()                           */
+/************************************************************************/
+
+char **IVSIS3LikeFSHandlerWithMultipartUpload::GetFileMetadata(
+    const char *pszFilename, const char *pszDomain, CSLConstList papszOptions)
+{
+    if (pszDomain != nullptr && EQUAL(pszDomain, "UPLOAD_STATUS"))
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexWriteHandles);
+        const auto oIter = m_oMapWriteHandles.find(pszFilename);
+        if (oIter == m_oMapWriteHandles.end())
+            return nullptr;
+        return oIter->second->GetUploadStatus();
+    }
+    return VSICurlFilesystemHandlerBase::GetFileMetadata(
+        pszFilename, pszDomain, papszOptions);
 }
 
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
@@ -1230,6 +1487,7 @@ std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
                          poS3HandleHelper->GetURL().c_str(),
                          oRetryContext.GetCurrentDelay());
                 CPLSleep(oRetryContext.GetCurrentDelay());
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1305,14 +1563,16 @@ size_t VSIMultipartWriteHandle::Write(const void *pBuffer, size_t nBytes)
         {
             if (m_nCurOffset == m_nBufferSize)
             {
-                m_osUploadID = m_poFS->InitiateMultipartUpload(
+                std::string osUploadID = m_poFS->InitiateMultipartUpload(
                     m_osFilename, m_poS3HandleHelper, m_oRetryParameters,
                     m_aosOptions.List());
-                if (m_osUploadID.empty())
+                if (osUploadID.empty())
                 {
                     m_bError = true;
                     return 0;
                 }
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_osUploadID = std::move(osUploadID);
             }
             if (!UploadPart())
             {
@@ -1861,6 +2121,15 @@ int VSIMultipartWriteHandle::Close()
         }
         else
         {
+            const bool bLastPartOK =
+                m_bError || m_nBufferOff == 0 || UploadPart();
+            // Parts uploaded asynchronously must be done before completing
+            // or aborting the upload
+            if (m_nMaxBuffers > 1 && !WaitForPendingUploads() && !m_bError)
+            {
+                m_bError = true;
+                nRet = -1;
+            }
             if (m_bError)
             {
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
@@ -1868,7 +2137,7 @@ int VSIMultipartWriteHandle::Close()
                                             m_oRetryParameters))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
+            else if (!bLastPartOK)
                 nRet = -1;
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
@@ -2498,7 +2767,7 @@ char **VSIS3FSHandler::GetFileMetadata(const char *pszFilename,
 
     if (pszDomain == nullptr || !EQUAL(pszDomain, "TAGS"))
     {
-        return VSICurlFilesystemHandlerBase::GetFileMetadata(
+        return IVSIS3LikeFSHandlerWithMultipartUpload::GetFileMetadata(
             osFilename, pszDomain, papszOptions);
     }
 
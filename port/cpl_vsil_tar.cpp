@@ -143,6 +143,22 @@ static bool VSIIsTGZ(const char *pszFilename)
           STARTS_WITH_CI(pszFilename + strlen(pszFilename) - 7, ".tar.gz"))));
 }
 
+#ifdef HAVE_ZSTD
+/************************************************************************/
+/*                            VSIIsTarZstd()                            */
+/************************************************************************/
+
+static bool VSIIsTarZstd(const char *pszFilename)
+{
+    return (
+        !STARTS_WITH_CI(pszFilename, "/vsizstd/") &&
+        ((strlen(pszFilename) > 5 &&
+          STARTS_WITH_CI(pszFilename + strlen(pszFilename) - 5, ".tzst")) ||
+         (strlen(pszFilename) > 8 &&
+          STARTS_WITH_CI(pszFilename + strlen(pszFilename) - 8, ".tar.zst"))));
+}
+#endif
+
 /************************************************************************/
 /*                            VSITarReader()                            */
 /************************************************************************/
@@ -524,6 +540,10 @@ std::vector<CPLString> VSITarFilesystemHandler::GetExtensions() const
     oList.push_back(".tar.gz");
     oList.push_back(".tar");
     oList.push_back(".tgz");
+#ifdef HAVE_ZSTD
+    oList.push_back(".tar.zst");
+    oList.push_back(".tzst");
+#endif
     return oList;
 }
 
@@ -541,6 +561,13 @@ VSITarFilesystemHandler::CreateReader(const char *pszTarFileName)
         osTarInFileName = "/vsigzip/";
         osTarInFileName += pszTarFileName;
     }
+#ifdef HAVE_ZSTD
+    else if (VSIIsTarZstd(pszTarFileName))
+    {
+        osTarInFileName = "/vsizstd/";
+        osTarInFileName += pszTarFileName;
+    }
+#endif
     else
         osTarInFileName = pszTarFileName;
 
@@ -595,6 +622,13 @@ VSITarFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         osSubFileName += "/vsigzip/";
         osSubFileName += tarFilename.get();
     }
+#ifdef HAVE_ZSTD
+    else if (VSIIsTarZstd(tarFilename.get()))
+    {
+        osSubFileName += "/vsizstd/";
+        osSubFileName += tarFilename.get();
+    }
+#endif
     else
         osSubFileName += tarFilename.get();
 
@@ -611,7 +645,7 @@ VSITarFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
  \brief Install /vsitar/ file system handler.
 
  A special file handler is installed that allows reading on-the-fly in TAR
- (regular .tar, or compressed .tar.gz/.tgz) archives.
+ (regular .tar, or compressed .tar.gz/.tgz or .tar.zst/.tzst) archives.
 
  All portions of the file system underneath the base path "/vsitar/" will be
  handled by this driver.
@@ -0,0 +1,945 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Implement opt-in tracing of the I/O operations done through the
+ *           VSI large file api.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+// Bucket i of histograms counts values in [2^(i-1), 2^i[, and bucket 0
+// counts zero values. The last bucket of latency histograms also counts all
+// larger values.
+constexpr int LATENCY_HISTOGRAM_SIZE = 40;
+constexpr int DISTANCE_HISTOGRAM_SIZE = 65;
+
+// Maximum number of disjoint byte ranges recorded per file
+constexpr size_t MAX_RANGES_PER_FILE = 10000;
+
+constexpr const char *UNKNOWN_CALLER = "(unknown)";
+
+/************************************************************************/
+/*                           GetLog2Bucket()                            */
+/************************************************************************/
+
+static int GetLog2Bucket(uint64_t nVal, int nBucketCount)
+{
+    int nBucket = 0;
+    while (nVal)
+    {
+        nVal >>= 1;
+        ++nBucket;
+    }
+    return std::min(nBucket, nBucketCount - 1);
+}
+
+/************************************************************************/
+/*                           HistogramAsJSON()                          */
+/************************************************************************/
+
+template <size_t N>
+static CPLJSONArray HistogramAsJSON(const std::array<uint64_t, N> &anHistogram,
+                                    const char *pszMinKey,
+                                    const char *pszMaxKey,
+                                    bool bLastBucketUnbounded)
+{
+    CPLJSONArray oArray;
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (anHistogram[i] == 0)
+            continue;
+        const uint64_t nMin = i == 0 ? 0 : static_cast<uint64_t>(1) << (i - 1);
+        const uint64_t nMax = i == 0 ? 0 : nMin * 2 - 1;
+        CPLJSONObject oBucket;
+        oBucket.Add(pszMinKey, nMin);
+        if (i + 1 < N || !bLastBucketUnbounded)
+            oBucket.Add(pszMaxKey, nMax);
+        oBucket.Add("count", anHistogram[i]);
+        oArray.Add(oBucket);
+    }
+    return oArray;
+}
+
+/************************************************************************/
+/*                            VSITraceStats                             */
+/************************************************************************/
+
+struct VSITraceStats
+{
+    uint64_t nOpenCount = 0;
+    uint64_t nReadCount = 0;
+    uint64_t nReadMultiRangeCount = 0;
+    uint64_t nBytesRequested = 0;
+    uint64_t nBytesRead = 0;
+    uint64_t nWriteCount = 0;
+    uint64_t nBytesWritten = 0;
+    uint64_t nSequentialReads = 0;
+    uint64_t nForwardSeeks = 0;
+    uint64_t nForwardSeekBytes = 0;
+    uint64_t nBackwardSeeks = 0;
+    uint64_t nBackwardSeekBytes = 0;
+    uint64_t nReadMicroseconds = 0;
+    uint64_t nMaxReadMicroseconds = 0;
+    uint64_t nWriteMicroseconds = 0;
+    std::array<uint64_t, LATENCY_HISTOGRAM_SIZE> anReadLatency{};
+    std::array<uint64_t, LATENCY_HISTOGRAM_SIZE> anWriteLatency{};
+    std::array<uint64_t, DISTANCE_HISTOGRAM_SIZE> anSeekDistance{};
+
+    void AddReadLatency(uint64_t nMicroseconds)
+    {
+        nReadMicroseconds += nMicroseconds;
+        nMaxReadMicroseconds = std::max(nMaxReadMicroseconds, nMicroseconds);
+        ++anReadLatency[GetLog2Bucket(nMicroseconds, LATENCY_HISTOGRAM_SIZE)];
+    }
+
+    void AddWriteLatency(uint64_t nMicroseconds)
+    {
+        nWriteMicroseconds += nMicroseconds;
+        ++anWriteLatency[GetLog2Bucket(nMicroseconds, LATENCY_HISTOGRAM_SIZE)];
+    }
+
+    void AddSeekDistance(vsi_l_offset nPrevEnd, vsi_l_offset nOffset)
+    {
+        if (nOffset == nPrevEnd)
+        {
+            ++nSequentialReads;
+            ++anSeekDistance[0];
+        }
+        else if (nOffset > nPrevEnd)
+        {
+            ++nForwardSeeks;
+            nForwardSeekBytes += nOffset - nPrevEnd;
+            ++anSeekDistance[GetLog2Bucket(nOffset - nPrevEnd,
+                                           DISTANCE_HISTOGRAM_SIZE)];
+        }
+        else
+        {
+            ++nBackwardSeeks;
+            nBackwardSeekBytes += nPrevEnd - nOffset;
+            ++anSeekDistance[GetLog2Bucket(nPrevEnd - nOffset,
+                                           DISTANCE_HISTOGRAM_SIZE)];
+        }
+    }
+
+    void AddToJSON(CPLJSONObject &oJSON) const
+    {
+        oJSON.Add("open_count", nOpenCount);
+        if (nReadCount || nReadMultiRangeCount)
+        {
+            CPLJSONObject oRead;
+            oRead.Add("count", nReadCount);
+            oRead.Add("multi_range_count", nReadMultiRangeCount);
+            oRead.Add("requested_bytes", nBytesRequested);
+            oRead.Add("read_bytes", nBytesRead);
+            oRead.Add("total_us", nReadMicroseconds);
+            oRead.Add("max_us", nMaxReadMicroseconds);
+            oRead.Add("latency_histogram",
+                      HistogramAsJSON(anReadLatency, "min_us", "max_us",
+                                      true));
+            oJSON.Add("read", oRead);
+
+            CPLJSONObject oSeeks;
+            oSeeks.Add("sequential_count", nSequentialReads);
+            oSeeks.Add("forward_count", nForwardSeeks);
+            oSeeks.Add("forward_bytes", nForwardSeekBytes);
+            oSeeks.Add("backward_count", nBackwardSeeks);
+            oSeeks.Add("backward_bytes", nBackwardSeekBytes);
+            oSeeks.Add("distance_histogram",
+                       HistogramAsJSON(anSeekDistance, "min_bytes",
+                                       "max_bytes", false));
+            oJSON.Add("seeks", oSeeks);
+        }
+        if (nWriteCount)
+        {
+            CPLJSONObject oWrite;
+            oWrite.Add("count", nWriteCount);
+            oWrite.Add("written_bytes", nBytesWritten);
+            oWrite.Add("total_us", nWriteMicroseconds);
+            oWrite.Add("latency_histogram",
+                       HistogramAsJSON(anWriteLatency, "min_us", "max_us",
+                                       true));
+            oJSON.Add("write", oWrite);
+        }
+    }
+};
+
+/************************************************************************/
+/*                          VSITraceFileStats                           */
+/************************************************************************/
+
+struct VSITraceFileStats : public VSITraceStats
+{
+    // Disjoint ranges of bytes read, as start offset -> end offset (excluded)
+    std::map<vsi_l_offset, vsi_l_offset> oMapRanges{};
+    bool bRangesTruncated = false;
+    std::set<std::string> oSetCallers{};
+
+    void AddRange(vsi_l_offset nStart, size_t nSize)
+    {
+        if (nSize == 0)
+            return;
+        vsi_l_offset nEnd = nStart + nSize;
+        auto oIter = oMapRanges.upper_bound(nStart);
+        if (oIter != oMapRanges.begin())
+        {
+            auto oPrev = std::prev(oIter);
+            if (oPrev->second >= nStart)
+            {
+                nStart = oPrev->first;
+                nEnd = std::max(nEnd, oPrev->second);
+                oIter = oMapRanges.erase(oPrev);
+            }
+        }
+        while (oIter != oMapRanges.end() && oIter->first <= nEnd)
+        {
+            nEnd = std::max(nEnd, oIter->second);
+            oIter = oMapRanges.erase(oIter);
+        }
+        if (oMapRanges.size() >= MAX_RANGES_PER_FILE)
+        {
+            // Coalesce with the closest previous range to bound memory usage
+            bRangesTruncated = true;
+            if (oIter != oMapRanges.begin())
+            {
+                auto oPrev = std::prev(oIter);
+                nStart = oPrev->first;
+                oMapRanges.erase(oPrev);
+            }
+        }
+        oMapRanges[nStart] = nEnd;
+    }
+
+    void AddToJSON(CPLJSONObject &oJSON) const
+    {
+        VSITraceStats::AddToJSON(oJSON);
+        if (!oMapRanges.empty())
+        {
+            uint64_t nUniqueBytes = 0;
+            CPLJSONArray oRanges;
+            for (const auto &[nStart, nEnd] : oMapRanges)
+            {
+                nUniqueBytes += nEnd - nStart;
+                CPLJSONArray oRange;
+                oRange.Add(static_cast<uint64_t>(nStart));
+                oRange.Add(static_cast<uint64_t>(nEnd));
+                oRanges.Add(oRange);
+            }
+            oJSON.Add("unique_bytes_read", nUniqueBytes);
+            oJSON.Add("ranges", oRanges);
+            if (bRangesTruncated)
+                oJSON.Add("ranges_truncated", true);
+        }
+        CPLJSONArray oCallers;
+        for (const auto &osCaller : oSetCallers)
+            oCallers.Add(osCaller);
+        oJSON.Add("callers", oCallers);
+    }
+};
+
+/************************************************************************/
+/*                            VSITraceEvent                             */
+/************************************************************************/
+
+struct VSITraceEvent
+{
+    const char *pszName = nullptr;
+    int64_t nStartMicroseconds = 0;
+    int64_t nDurationMicroseconds = 0;
+    GIntBig nThreadId = 0;
+    int nFileIdx = 0;
+    int nCallerIdx = 0;
+    vsi_l_offset nOffset = 0;
+    size_t nSize = 0;
+};
+
+/************************************************************************/
+/*                         VSITraceHandleState                          */
+/************************************************************************/
+
+// State of a traced file handle, only accessed under the logger mutex.
+struct VSITraceHandleState
+{
+    std::string osFilename{};
+    std::string osCaller = UNKNOWN_CALLER;
+    vsi_l_offset nLastReadEnd = 0;
+};
+
+// Stack of the callers (typically driver names) of the current thread,
+// pushed by VSITracePushCaller() / VSITraceCallerContext.
+thread_local std::vector<const char *> gapszCallerStack{};
+
+using Clock = std::chrono::steady_clock;
+
+/************************************************************************/
+/*                            VSITraceLogger                            */
+/************************************************************************/
+
+class VSITraceLogger
+{
+    static std::atomic<int> gnEnabled;
+    static VSITraceLogger gInstance;
+
+    std::mutex m_mutex{};
+    Clock::time_point m_oStart = Clock::now();
+    std::map<std::string, VSITraceFileStats> m_oMapFiles{};
+    std::map<std::string, VSITraceStats> m_oMapCallers{};
+
+    std::vector<VSITraceEvent> m_aoEvents{};
+    size_t m_nMaxEvents = 0;
+    uint64_t m_nDroppedEvents = 0;
+    std::vector<std::string> m_aosEventStrings{};
+    std::map<std::string, int> m_oMapEventStringToIdx{};
+
+    static void ReadEnabled();
+
+    static void UpdateCaller(VSITraceHandleState &oState)
+    {
+        if (!gapszCallerStack.empty() && gapszCallerStack.back())
+            oState.osCaller = gapszCallerStack.back();
+    }
+
+    int GetEventStringIdx(const std::string &osStr)
+    {
+        auto oIter = m_oMapEventStringToIdx.find(osStr);
+        if (oIter != m_oMapEventStringToIdx.end())
+            return oIter->second;
+        const int nIdx = static_cast<int>(m_aosEventStrings.size());
+        m_aosEventStrings.push_back(osStr);
+        m_oMapEventStringToIdx[osStr] = nIdx;
+        return nIdx;
+    }
+
+    void AddEvent(const char *pszName, const VSITraceHandleState &oState,
+                  Clock::time_point oStart, Clock::time_point oEnd,
+                  vsi_l_offset nOffset, size_t nSize);
+
+    void RecordReadLocked(VSITraceHandleState &oState, vsi_l_offset nOffset,
+                          size_t nRequested, size_t nRead,
+                          VSITraceFileStats &oFileStats,
+                          VSITraceStats &oCallerStats);
+
+  public:
+    static inline bool IsEnabled()
+    {
+        if (gnEnabled < 0)
+        {
+            ReadEnabled();
+        }
+        return gnEnabled == TRUE;
+    }
+
+    static void Reset();
+    static std::string GetReportAsSerializedJSON();
+    static std::string GetChromeTraceAsSerializedJSON();
+
+    static void RecordOpen(VSITraceHandleState &oState);
+    static void RecordRead(const char *pszName, VSITraceHandleState &oState,
+                           vsi_l_offset nOffset, size_t nRequested,
+                           size_t nRead, Clock::time_point oStart,
+                           Clock::time_point oEnd);
+    static void RecordReadMultiRange(const char *pszName,
+                                     VSITraceHandleState &oState, int nRanges,
+                                     const vsi_l_offset *panOffsets,
+                                     const size_t *panSizes, bool bSuccess,
+                                     Clock::time_point oStart,
+                                     Clock::time_point oEnd);
+    static void RecordWrite(VSITraceHandleState &oState, vsi_l_offset nOffset,
+                            size_t nWritten, Clock::time_point oStart,
+                            Clock::time_point oEnd);
+};
+
+std::atomic<int> VSITraceLogger::gnEnabled{-1};  // unknown state
+VSITraceLogger VSITraceLogger::gInstance{};
+
+/************************************************************************/
+/*                          WriteTraceReport()                          */
+/************************************************************************/
+
+static void WriteTraceReport()
+{
+    const char *pszOutput = CPLGetConfigOption("CPL_VSIL_TRACE_OUTPUT", "");
+    if (pszOutput[0] == '\0')
+        return;
+    const bool bChromeTrace = EQUAL(
+        CPLGetConfigOption("CPL_VSIL_TRACE_FORMAT", "JSON"), "CHROME_TRACE");
+    const std::string osReport =
+        bChromeTrace ? VSITraceLogger::GetChromeTraceAsSerializedJSON()
+                     : VSITraceLogger::GetReportAsSerializedJSON();
+    // Use stdio, as the VSI file manager may already be destroyed
+    FILE *fp = EQUAL(pszOutput, "stdout")   ? stdout
+               : EQUAL(pszOutput, "stderr") ? stderr
+                                            : fopen(pszOutput, "wb");
+    if (fp == nullptr)
+    {
+        fprintf(stderr, "Cannot create %s\n", pszOutput);
+        return;
+    }
+    fwrite(osReport.data(), 1, osReport.size(), fp);
+    fputc('\n', fp);
+    if (fp != stdout && fp != stderr)
+        fclose(fp);
+}
+
+/************************************************************************/
+/*                            ReadEnabled()                             */
+/************************************************************************/
+
+void VSITraceLogger::ReadEnabled()
+{
+    const bool bEnabled =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_TRACE", "NO"));
+    {
+        std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+        gInstance.m_nMaxEvents = static_cast<size_t>(std::max(
+            0, atoi(CPLGetConfigOption("CPL_VSIL_TRACE_MAX_EVENTS",
+                                       "1000000"))));
+    }
+    if (bEnabled && CPLGetConfigOption("CPL_VSIL_TRACE_OUTPUT", nullptr))
+    {
+        static bool bRegistered = false;
+        if (!bRegistered)
+        {
+            bRegistered = true;
+            atexit(WriteTraceReport);
+        }
+    }
+    gnEnabled = bEnabled ? TRUE : FALSE;
+}
+
+/************************************************************************/
+/*                               Reset()                                */
+/************************************************************************/
+
+void VSITraceLogger::Reset()
+{
+    {
+        std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+        gInstance.m_oStart = Clock::now();
+        gInstance.m_oMapFiles.clear();
+        gInstance.m_oMapCallers.clear();
+        gInstance.m_aoEvents.clear();
+        gInstance.m_nDroppedEvents = 0;
+        gInstance.m_aosEventStrings.clear();
+        gInstance.m_oMapEventStringToIdx.clear();
+    }
+    gnEnabled = -1;
+}
+
+/************************************************************************/
+/*                              AddEvent()                              */
+/************************************************************************/
+
+void VSITraceLogger::AddEvent(const char *pszName,
+                              const VSITraceHandleState &oState,
+                              Clock::time_point oStart, Clock::time_point oEnd,
+                              vsi_l_offset nOffset, size_t nSize)
+{
+    if (m_aoEvents.size() >= m_nMaxEvents)
+    {
+        ++m_nDroppedEvents;
+        return;
+    }
+    VSITraceEvent oEvent;
+    oEvent.pszName = pszName;
+    oEvent.nStartMicroseconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(oStart -
+                                                              m_oStart)
+            .count();
+    oEvent.nDurationMicroseconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(oEnd - oStart)
+            .count();
+    oEvent.nThreadId = CPLGetPID();
+    oEvent.nFileIdx = GetEventStringIdx(oState.osFilename);
+    oEvent.nCallerIdx = GetEventStringIdx(oState.osCaller);
+    oEvent.nOffset = nOffset;
+    oEvent.nSize = nSize;
+    m_aoEvents.push_back(oEvent);
+}
+
+/************************************************************************/
+/*                             RecordOpen()                             */
+/************************************************************************/
+
+void VSITraceLogger::RecordOpen(VSITraceHandleState &oState)
+{
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    UpdateCaller(oState);
+    auto &oFileStats = gInstance.m_oMapFiles[oState.osFilename];
+    ++oFileStats.nOpenCount;
+    oFileStats.oSetCallers.insert(oState.osCaller);
+    ++gInstance.m_oMapCallers[oState.osCaller].nOpenCount;
+}
+
+/************************************************************************/
+/*                          RecordReadLocked()                          */
+/************************************************************************/
+
+void VSITraceLogger::RecordReadLocked(VSITraceHandleState &oState,
+                                      vsi_l_offset nOffset, size_t nRequested,
+                                      size_t nRead,
+                                      VSITraceFileStats &oFileStats,
+                                      VSITraceStats &oCallerStats)
+{
+    for (VSITraceStats *poStats :
+         {static_cast<VSITraceStats *>(&oFileStats), &oCallerStats})
+    {
+        poStats->nBytesRequested += nRequested;
+        poStats->nBytesRead += nRead;
+        poStats->AddSeekDistance(oState.nLastReadEnd, nOffset);
+    }
+    oFileStats.AddRange(nOffset, nRead);
+    oState.nLastReadEnd = nOffset + nRead;
+}
+
+/************************************************************************/
+/*                             RecordRead()                             */
+/************************************************************************/
+
+void VSITraceLogger::RecordRead(const char *pszName,
+                                VSITraceHandleState &oState,
+                                vsi_l_offset nOffset, size_t nRequested,
+                                size_t nRead, Clock::time_point oStart,
+                                Clock::time_point oEnd)
+{
+    const uint64_t nMicroseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(oEnd - oStart)
+            .count());
+
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    UpdateCaller(oState);
+    auto &oFileStats = gInstance.m_oMapFiles[oState.osFilename];
+    oFileStats.oSetCallers.insert(oState.osCaller);
+    auto &oCallerStats = gInstance.m_oMapCallers[oState.osCaller];
+    ++oFileStats.nReadCount;
+    ++oCallerStats.nReadCount;
+    oFileStats.AddReadLatency(nMicroseconds);
+    oCallerStats.AddReadLatency(nMicroseconds);
+    gInstance.RecordReadLocked(oState, nOffset, nRequested, nRead, oFileStats,
+                               oCallerStats);
+    gInstance.AddEvent(pszName, oState, oStart, oEnd, nOffset, nRead);
+}
+
+/************************************************************************/
+/*                        RecordReadMultiRange()                        */
+/************************************************************************/
+
+void VSITraceLogger::RecordReadMultiRange(
+    const char *pszName, VSITraceHandleState &oState, int nRanges,
+    const vsi_l_offset *panOffsets, const size_t *panSizes, bool bSuccess,
+    Clock::time_point oStart, Clock::time_point oEnd)
+{
+    const uint64_t nMicroseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(oEnd - oStart)
+            .count());
+
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    UpdateCaller(oState);
+    auto &oFileStats = gInstance.m_oMapFiles[oState.osFilename];
+    oFileStats.oSetCallers.insert(oState.osCaller);
+    auto &oCallerStats = gInstance.m_oMapCallers[oState.osCaller];
+    ++oFileStats.nReadMultiRangeCount;
+    ++oCallerStats.nReadMultiRangeCount;
+    oFileStats.AddReadLatency(nMicroseconds);
+    oCallerStats.AddReadLatency(nMicroseconds);
+    size_t nTotalSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        gInstance.RecordReadLocked(oState, panOffsets[i], panSizes[i],
+                                   bSuccess ? panSizes[i] : 0, oFileStats,
+                                   oCallerStats);
+        nTotalSize += panSizes[i];
+    }
+    gInstance.AddEvent(pszName, oState, oStart, oEnd,
+                       nRanges ? panOffsets[0] : 0, nTotalSize);
+}
+
+/************************************************************************/
+/*                            RecordWrite()                             */
+/************************************************************************/
+
+void VSITraceLogger::RecordWrite(VSITraceHandleState &oState,
+                                 vsi_l_offset nOffset, size_t nWritten,
+                                 Clock::time_point oStart,
+                                 Clock::time_point oEnd)
+{
+    const uint64_t nMicroseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(oEnd - oStart)
+            .count());
+
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    UpdateCaller(oState);
+    auto &oFileStats = gInstance.m_oMapFiles[oState.osFilename];
+    oFileStats.oSetCallers.insert(oState.osCaller);
+    auto &oCallerStats = gInstance.m_oMapCallers[oState.osCaller];
+    for (VSITraceStats *poStats :
+         {static_cast<VSITraceStats *>(&oFileStats), &oCallerStats})
+    {
+        ++poStats->nWriteCount;
+        poStats->nBytesWritten += nWritten;
+        poStats->AddWriteLatency(nMicroseconds);
+    }
+    gInstance.AddEvent("Write", oState, oStart, oEnd, nOffset, nWritten);
+}
+
+/************************************************************************/
+/*                     GetReportAsSerializedJSON()                      */
+/************************************************************************/
+
+std::string VSITraceLogger::GetReportAsSerializedJSON()
+{
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+
+    CPLJSONObject oJSON;
+    CPLJSONObject oFiles;
+    for (const auto &[osFilename, oStats] : gInstance.m_oMapFiles)
+    {
+        CPLJSONObject oFile;
+        oStats.AddToJSON(oFile);
+        oFiles.AddNoSplitName(osFilename, oFile);
+    }
+    oJSON.Add("files", oFiles);
+
+    CPLJSONObject oCallers;
+    for (const auto &[osCaller, oStats] : gInstance.m_oMapCallers)
+    {
+        CPLJSONObject oCaller;
+        oStats.AddToJSON(oCaller);
+        oCallers.AddNoSplitName(osCaller, oCaller);
+    }
+    oJSON.Add("callers", oCallers);
+
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+/************************************************************************/
+/*                   GetChromeTraceAsSerializedJSON()                   */
+/************************************************************************/
+
+std::string VSITraceLogger::GetChromeTraceAsSerializedJSON()
+{
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+
+    CPLJSONObject oJSON;
+    CPLJSONArray oEvents;
+    for (const auto &oEvent : gInstance.m_aoEvents)
+    {
+        CPLJSONObject oJSONEvent;
+        oJSONEvent.Add("name", oEvent.pszName);
+        oJSONEvent.Add("cat", "vsi");
+        oJSONEvent.Add("ph", "X");
+        oJSONEvent.Add("ts", static_cast<GInt64>(oEvent.nStartMicroseconds));
+        oJSONEvent.Add("dur",
+                       static_cast<GInt64>(oEvent.nDurationMicroseconds));
+        oJSONEvent.Add("pid", 1);
+        oJSONEvent.Add("tid", static_cast<GInt64>(oEvent.nThreadId));
+        CPLJSONObject oArgs;
+        oArgs.Add("file", gInstance.m_aosEventStrings[oEvent.nFileIdx]);
+        oArgs.Add("caller", gInstance.m_aosEventStrings[oEvent.nCallerIdx]);
+        oArgs.Add("offset", static_cast<uint64_t>(oEvent.nOffset));
+        oArgs.Add("size", static_cast<uint64_t>(oEvent.nSize));
+        oJSONEvent.Add("args", oArgs);
+        oEvents.Add(oJSONEvent);
+    }
+    oJSON.Add("traceEvents", oEvents);
+    oJSON.Add("displayTimeUnit", "ms");
+    CPLJSONObject oOtherData;
+    oOtherData.Add("dropped_events", gInstance.m_nDroppedEvents);
+    oJSON.Add("otherData", oOtherData);
+
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Plain);
+}
+
+/************************************************************************/
+/*                            VSITraceHandle                            */
+/************************************************************************/
+
+class VSITraceHandle final : public VSIProxyFileHandle
+{
+    // mutable for PRead()
+    mutable VSITraceHandleState m_oState{};
+    vsi_l_offset m_nCurOffset = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSITraceHandle)
+
+  public:
+    VSITraceHandle(VSIVirtualHandleUniquePtr &&poBaseHandle,
+                   const char *pszFilename)
+        : VSIProxyFileHandle(std::move(poBaseHandle))
+    {
+        m_oState.osFilename = pszFilename;
+        m_nCurOffset = m_nativeHandle->Tell();
+        VSITraceLogger::RecordOpen(m_oState);
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override
+    {
+        const int nRet = m_nativeHandle->Seek(nOffset, nWhence);
+        if (nWhence == SEEK_SET && nRet == 0)
+            m_nCurOffset = nOffset;
+        else
+            m_nCurOffset = m_nativeHandle->Tell();
+        return nRet;
+    }
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurOffset;
+    }
+
+    size_t Read(void *pBuffer, size_t nBytes) override
+    {
+        const auto oStart = Clock::now();
+        const size_t nRet = m_nativeHandle->Read(pBuffer, nBytes);
+        const auto oEnd = Clock::now();
+        VSITraceLogger::RecordRead("Read", m_oState, m_nCurOffset, nBytes,
+                                   nRet, oStart, oEnd);
+        m_nCurOffset += nRet;
+        return nRet;
+    }
+
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override
+    {
+        const auto oStart = Clock::now();
+        const int nRet = m_nativeHandle->ReadMultiRange(nRanges, ppData,
+                                                        panOffsets, panSizes);
+        const auto oEnd = Clock::now();
+        VSITraceLogger::RecordReadMultiRange("ReadMultiRange", m_oState,
+                                             nRanges, panOffsets, panSizes,
+                                             nRet == 0, oStart, oEnd);
+        m_nCurOffset = m_nativeHandle->Tell();
+        return nRet;
+    }
+
+    std::future<bool> SubmitRead(int nRanges, void **ppData,
+                                 const vsi_l_offset *panOffsets,
+                                 const size_t *panSizes,
+                                 ReadCompletionCallback pfnCallback) override
+    {
+        // The ranges are recorded on completion, from the thread invoking
+        // the callback. The handle cannot be closed before that.
+        const auto oStart = Clock::now();
+        std::vector<vsi_l_offset> anOffsets(panOffsets, panOffsets + nRanges);
+        std::vector<size_t> anSizes(panSizes, panSizes + nRanges);
+        return m_nativeHandle->SubmitRead(
+            nRanges, ppData, panOffsets, panSizes,
+            [this, oStart, anOffsets = std::move(anOffsets),
+             anSizes = std::move(anSizes),
+             pfnCallback = std::move(pfnCallback)](bool bSuccess)
+            {
+                VSITraceLogger::RecordReadMultiRange(
+                    "SubmitRead", m_oState, static_cast<int>(anOffsets.size()),
+                    anOffsets.data(), anSizes.data(), bSuccess, oStart,
+                    Clock::now());
+                if (pfnCallback)
+                    pfnCallback(bSuccess);
+            });
+    }
+
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override
+    {
+        const auto oStart = Clock::now();
+        const size_t nRet = m_nativeHandle->PRead(pBuffer, nSize, nOffset);
+        const auto oEnd = Clock::now();
+        VSITraceLogger::RecordRead("PRead", m_oState, nOffset, nSize, nRet,
+                                   oStart, oEnd);
+        return nRet;
+    }
+
+    size_t Write(const void *pBuffer, size_t nBytes) override
+    {
+        const auto oStart = Clock::now();
+        const size_t nRet = m_nativeHandle->Write(pBuffer, nBytes);
+        const auto oEnd = Clock::now();
+        VSITraceLogger::RecordWrite(m_oState, m_nCurOffset, nRet, oStart,
+                                    oEnd);
+        m_nCurOffset += nRet;
+        return nRet;
+    }
+
+    int Truncate(vsi_l_offset nNewSize) override
+    {
+        const int nRet = m_nativeHandle->Truncate(nNewSize);
+        m_nCurOffset = m_nativeHandle->Tell();
+        return nRet;
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                         VSITraceWrapHandle()                         */
+/************************************************************************/
+
+/** Wrap a file handle into a handle recording its I/O operations, if
+ * tracing is enabled with the CPL_VSIL_TRACE configuration option.
+ * Otherwise return the passed handle.
+ */
+VSIVirtualHandleUniquePtr VSITraceWrapHandle(VSIVirtualHandleUniquePtr poHandle,
+                                             const char *pszFilename)
+{
+    if (!poHandle || !VSITraceLogger::IsEnabled())
+        return poHandle;
+    return VSIVirtualHandleUniquePtr(
+        new VSITraceHandle(std::move(poHandle), pszFilename));
+}
+
+/************************************************************************/
+/*                        VSITraceCallerContext                         */
+/************************************************************************/
+
+VSITraceCallerContext::VSITraceCallerContext(const char *pszCaller)
+{
+    VSITracePushCaller(pszCaller);
+}
+
+VSITraceCallerContext::~VSITraceCallerContext()
+{
+    VSITracePopCaller();
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                         VSITracePushCaller()                         */
+/************************************************************************/
+
+/**
+ * \brief Set the caller to which I/O operations are attributed.
+ *
+ * Files opened, or first read, while a caller is set in the current thread
+ * are attributed to it in the output of VSITraceGetAsSerializedJSON(). The
+ * caller is typically a driver name, and is set by GDALOpenEx() and the
+ * dataset creation methods.
+ *
+ * Each call must be paired with a call to VSITracePopCaller() in the same
+ * thread, and pszCaller must remain valid until then.
+ *
+ * @param pszCaller Caller name.
+ * @since GDAL 3.14
+ */
+
+void VSITracePushCaller(const char *pszCaller)
+{
+    gapszCallerStack.push_back(pszCaller);
+}
+
+/************************************************************************/
+/*                         VSITracePopCaller()                          */
+/************************************************************************/
+
+/**
+ * \brief Restore the caller that was active before the last call to
+ * VSITracePushCaller().
+ *
+ * @since GDAL 3.14
+ */
+
+void VSITracePopCaller(void)
+{
+    if (!gapszCallerStack.empty())
+        gapszCallerStack.pop_back();
+}
+
+/************************************************************************/
+/*                           VSITraceReset()                            */
+/************************************************************************/
+
+/**
+ * \brief Clear I/O tracing statistics.
+ *
+ * This also re-reads the CPL_VSIL_TRACE configuration option, which is
+ * otherwise cached on first access. Only files opened while tracing is
+ * enabled are traced.
+ *
+ * @since GDAL 3.14
+ */
+
+void VSITraceReset(void)
+{
+    VSITraceLogger::Reset();
+}
+
+/************************************************************************/
+/*                    VSITraceGetAsSerializedJSON()                     */
+/************************************************************************/
+
+/**
+ * \brief Return I/O tracing statistics, as a JSON serialized object.
+ *
+ * Tracing should be enabled with the CPL_VSIL_TRACE configuration option
+ * set to YES before the files to trace are opened (for efficiency, reading
+ * it is cached on first access, until VSITraceReset() is called). All
+ * files opened through VSIFOpenL() and related functions are then traced,
+ * including the files opened internally by virtual file systems, such as
+ * the .zip file behind a /vsizip/ path.
+ *
+ * With FORMAT=JSON (default), the output has a "files" object with
+ * statistics per file, and a "callers" object with statistics per caller
+ * (typically a driver, see VSITracePushCaller()). Statistics include the
+ * number of operations, the number of bytes read and written, the
+ * distribution of the distances between the end of a read and the start of
+ * the next one, and histograms of latencies with power-of-two buckets.
+ * For files, the disjoint byte ranges read are also listed.
+ *
+ * With FORMAT=CHROME_TRACE, the output is in the Trace Event Format
+ * understood by chrome://tracing and https://ui.perfetto.dev, with one
+ * event per operation. At most CPL_VSIL_TRACE_MAX_EVENTS (default 1000000)
+ * events are recorded.
+ *
+ * The statistics can also be written at process termination in the file
+ * pointed by the CPL_VSIL_TRACE_OUTPUT configuration option (or "stdout"
+ * or "stderr"), in the format set by the CPL_VSIL_TRACE_FORMAT
+ * configuration option.
+ *
+ * @param papszOptions NULL or NULL terminated list of options.
+ *                     FORMAT=JSON or CHROME_TRACE.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.14
+ */
+
+char *VSITraceGetAsSerializedJSON(CSLConstList papszOptions)
+{
+    const char *pszFormat =
+        CSLFetchNameValueDef(papszOptions, "FORMAT", "JSON");
+    if (EQUAL(pszFormat, "CHROME_TRACE"))
+        return CPLStrdup(
+            VSITraceLogger::GetChromeTraceAsSerializedJSON().c_str());
+    if (!EQUAL(pszFormat, "JSON"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Unsupported FORMAT=%s",
+                 pszFormat);
+        return nullptr;
+    }
+    return CPLStrdup(VSITraceLogger::GetReportAsSerializedJSON().c_str());
+}
@@ -84,6 +84,10 @@
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
 
+#ifdef HAVE_LINUX_IO_URING
+#include "cpl_io_uring.h"
+#endif
+
 #if defined(UNIX_STDIO_64)
 
 #ifndef VSI_OPEN64
@@ -259,6 +263,17 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     std::string m_osTmpFilename{};
 #endif
 
+#ifdef HAVE_LINUX_IO_URING
+    bool m_bUseIOUring = false;
+    // Minimum size of Read() requests served with O_DIRECT. 0 means never.
+    size_t m_nDirectIOMinSize = 0;
+    // File descriptor opened with O_DIRECT: -1 if not opened yet, -2 if
+    // opening it or reading from it failed.
+    int m_fdDirect = -1;
+
+    bool ReadWithDirectIO(void *pBuffer, size_t nBytes, size_t &nRead);
+#endif
+
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, int fdIn,
                        AccessMode eAccessModeIn);
@@ -287,6 +302,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
 #endif
+#ifdef HAVE_LINUX_IO_URING
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
 
     void CancelCreation() override;
 };
@@ -360,6 +380,12 @@ int VSIUnixStdioHandle::Close()
     if (ret == 0 && ret2 != 0)
         ret = ret2;
 
+#ifdef HAVE_LINUX_IO_URING
+    if (m_fdDirect >= 0)
+        close(m_fdDirect);
+    m_fdDirect = -1;
+#endif
+
 #if !defined(__linux)
     if (!m_osTmpFilename.empty() && !m_osFilename.empty())
     {
@@ -606,6 +632,24 @@ size_t VSIUnixStdioHandle::Read(void *pBuffer, size_t nBytes)
         if (nAvailInBuffer == 0)
         {
             size_t nRemaining = nTotal - nBytesRead;
+#ifdef HAVE_LINUX_IO_URING
+            size_t nDirectRead = 0;
+            if (m_nDirectIOMinSize > 0 && nRemaining >= m_nDirectIOMinSize &&
+                ReadWithDirectIO(pabyDest + nBytesRead, nRemaining,
+                                 nDirectRead))
+            {
+                if (nDirectRead == 0)
+                {
+                    bAtEOF = true;
+                    break;
+                }
+                m_nFilePos += nDirectRead;
+                nBytesRead += nDirectRead;
+                m_nBufferCurPos = 0;
+                m_nBufferSize = 0;
+                continue;
+            }
+#endif
             if (nRemaining >= BUFFER_SIZE)
             {
                 // Bypass buffer if large request
@@ -905,6 +949,89 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
 }
 #endif
 
+#ifdef HAVE_LINUX_IO_URING
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if (m_bUseIOUring && eAccessMode != AccessMode::WRITE_ONLY &&
+        (!m_bBufferDirty || Flush() == 0))
+    {
+        CPLIOUring *poRing = CPLIOUring::GetForCurrentThread();
+        if (poRing &&
+            poRing->ReadRanges(fd, nRanges, ppData, panOffsets, panSizes))
+        {
+#ifdef VSI_COUNT_BYTES_READ
+            for (int i = 0; i < nRanges; ++i)
+                nTotalBytesRead += panSizes[i];
+#endif
+            return 0;
+        }
+        // On failure (typically a range beyond end of file), let the
+        // generic implementation retry, so that the error state of the
+        // handle is set as usual.
+    }
+    return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                            panSizes);
+}
+
+/************************************************************************/
+/*                          ReadWithDirectIO()                          */
+/************************************************************************/
+
+/** Read nBytes at the current position, bypassing the page cache.
+ *
+ * The kernel file position is updated as if read() had been called.
+ *
+ * @return false if O_DIRECT cannot be used, in which case the caller must
+ * use regular I/O.
+ */
+bool VSIUnixStdioHandle::ReadWithDirectIO(void *pBuffer, size_t nBytes,
+                                          size_t &nRead)
+{
+    if (m_fdDirect == -1)
+    {
+        // Re-open the same file, even if it has been renamed since then
+        char szPath[32];
+        snprintf(szPath, sizeof(szPath), "/proc/self/fd/%d", fd);
+        m_fdDirect = VSI_OPEN64(szPath, O_RDONLY | O_DIRECT | O_CLOEXEC);
+        if (m_fdDirect < 0)
+        {
+            CPLDebug("VSI", "Cannot open %s with O_DIRECT: %s",
+                     m_osFilename.c_str(), strerror(errno));
+            m_fdDirect = -2;
+        }
+    }
+    if (m_fdDirect < 0)
+        return false;
+
+    CPLIOUring *poRing = CPLIOUring::GetForCurrentThread();
+    if (!poRing)
+        return false;
+    if (!poRing->ReadDirect(m_fdDirect, pBuffer, nBytes, m_nFilePos, nRead))
+    {
+        CPLDebug("VSI", "O_DIRECT read failed on %s. Using regular I/O",
+                 m_osFilename.c_str());
+        close(m_fdDirect);
+        m_fdDirect = -2;
+        return false;
+    }
+
+    if (VSI_LSEEK64(fd, m_nFilePos + nRead, SEEK_SET) < 0)
+    {
+        // Data has been read, but the regular descriptor is out of sync.
+        bError = true;
+    }
+    return true;
+}
+
+#endif  // HAVE_LINUX_IO_URING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -991,6 +1118,22 @@ VSIUnixStdioFilesystemHandler::Open(const char *pszFilename,
     auto poHandle = std::make_unique<VSIUnixStdioHandle>(this, fd, eAccessMode);
     poHandle->m_osFilename = pszFilename;
 
+#ifdef HAVE_LINUX_IO_URING
+    poHandle->m_bUseIOUring =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "NO"));
+    const char *pszDirectIOMinSize =
+        CPLGetConfigOption("CPL_VSIL_IO_URING_DIRECT_IO_MIN_SIZE", nullptr);
+    GIntBig nDirectIOMinSize = 0;
+    if (poHandle->m_bUseIOUring && eAccessMode == AccessMode::READ_ONLY &&
+        pszDirectIOMinSize &&
+        CPLParseMemorySize(pszDirectIOMinSize, &nDirectIOMinSize, nullptr) ==
+            CE_None &&
+        nDirectIOMinSize > 0)
+    {
+        poHandle->m_nDirectIOMinSize = static_cast<size_t>(nDirectIOMinSize);
+    }
+#endif
+
     errno = nError;
 
     if (strchr(pszAccess, 'a'))
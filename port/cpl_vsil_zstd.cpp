@@ -0,0 +1,1175 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Implement VSI large file api for Zstandard (.zst) files, with
+ *           random access to files in the seekable format.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_port.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "../gcore/gdal_thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <zstd.h>
+
+// The seekable format is described in
+// https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+// A seek table, stored in a skippable frame at the end of the file, gives the
+// compressed and decompressed size of each of the independent frames the
+// file is made of.
+
+constexpr uint32_t ZSTD_SEEK_TABLE_SKIPPABLE_MAGIC = 0x184D2A5E;
+constexpr uint32_t ZSTD_SEEKABLE_MAGIC = 0x8F92EAB1;
+constexpr int ZSTD_SKIPPABLE_HEADER_SIZE = 8;
+constexpr int ZSTD_SEEK_TABLE_FOOTER_SIZE = 9;
+constexpr GByte ZSTD_SEEK_TABLE_CHECKSUM_FLAG = 0x80;
+constexpr GByte ZSTD_SEEK_TABLE_RESERVED_BITS = 0x7C;
+
+// Maximum uncompressed size of a frame of a seekable file we accept to
+// decode in memory.
+constexpr uint32_t ZSTD_MAX_FRAME_SIZE = 256 * 1024 * 1024;
+
+/************************************************************************/
+/*                            VSIZstdFrame                              */
+/************************************************************************/
+
+struct VSIZstdFrame
+{
+    vsi_l_offset nCompressedOffset = 0;  // relative to start of the stream
+    vsi_l_offset nUncompressedOffset = 0;
+    uint32_t nCompressedSize = 0;
+    uint32_t nUncompressedSize = 0;
+};
+
+/************************************************************************/
+/*                       VSIZstdReadSeekTable()                         */
+/************************************************************************/
+
+// Read the seek table at the end of [nStart, nStart + nSize[, if there is
+// one.
+static bool VSIZstdReadSeekTable(VSIVirtualHandle *poBaseHandle,
+                                 vsi_l_offset nStart, vsi_l_offset nSize,
+                                 std::vector<VSIZstdFrame> &aoFrames,
+                                 vsi_l_offset &nUncompressedSize)
+{
+    if (nSize < ZSTD_SKIPPABLE_HEADER_SIZE + ZSTD_SEEK_TABLE_FOOTER_SIZE)
+        return false;
+
+    GByte abyFooter[ZSTD_SEEK_TABLE_FOOTER_SIZE];
+    if (poBaseHandle->Seek(nStart + nSize - ZSTD_SEEK_TABLE_FOOTER_SIZE,
+                           SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyFooter, sizeof(abyFooter)) != sizeof(abyFooter))
+    {
+        return false;
+    }
+    uint32_t nFrames = 0;
+    memcpy(&nFrames, abyFooter, sizeof(nFrames));
+    CPL_LSBPTR32(&nFrames);
+    const GByte nDescriptor = abyFooter[4];
+    uint32_t nMagic = 0;
+    memcpy(&nMagic, abyFooter + 5, sizeof(nMagic));
+    CPL_LSBPTR32(&nMagic);
+    if (nMagic != ZSTD_SEEKABLE_MAGIC)
+        return false;
+    if ((nDescriptor & ZSTD_SEEK_TABLE_RESERVED_BITS) != 0)
+    {
+        CPLDebug("ZSTD", "Reserved bits set in seek table descriptor");
+        return false;
+    }
+
+    const int nEntrySize =
+        (nDescriptor & ZSTD_SEEK_TABLE_CHECKSUM_FLAG) != 0 ? 12 : 8;
+    // Each frame is at least 9 bytes large
+    if (nFrames > (nSize - ZSTD_SKIPPABLE_HEADER_SIZE -
+                   ZSTD_SEEK_TABLE_FOOTER_SIZE) /
+                      (nEntrySize + 9))
+    {
+        CPLDebug("ZSTD", "Invalid number of frames in seek table: %u",
+                 nFrames);
+        return false;
+    }
+    const size_t nTableSize =
+        static_cast<size_t>(nFrames) * nEntrySize + ZSTD_SEEK_TABLE_FOOTER_SIZE;
+    const vsi_l_offset nTableStart =
+        nStart + nSize - nTableSize - ZSTD_SKIPPABLE_HEADER_SIZE;
+
+    std::vector<GByte> abyTable;
+    try
+    {
+        abyTable.resize(ZSTD_SKIPPABLE_HEADER_SIZE + nTableSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    if (poBaseHandle->Seek(nTableStart, SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyTable.data(), abyTable.size()) != abyTable.size())
+    {
+        return false;
+    }
+    uint32_t nSkippableMagic = 0;
+    memcpy(&nSkippableMagic, abyTable.data(), sizeof(nSkippableMagic));
+    CPL_LSBPTR32(&nSkippableMagic);
+    uint32_t nSkippableSize = 0;
+    memcpy(&nSkippableSize, abyTable.data() + 4, sizeof(nSkippableSize));
+    CPL_LSBPTR32(&nSkippableSize);
+    if (nSkippableMagic != ZSTD_SEEK_TABLE_SKIPPABLE_MAGIC ||
+        nSkippableSize != nTableSize)
+    {
+        CPLDebug("ZSTD", "Invalid seek table header");
+        return false;
+    }
+
+    aoFrames.resize(nFrames);
+    vsi_l_offset nCompressedOffset = 0;
+    nUncompressedSize = 0;
+    for (uint32_t i = 0; i < nFrames; ++i)
+    {
+        const GByte *pabyEntry =
+            abyTable.data() + ZSTD_SKIPPABLE_HEADER_SIZE + i * nEntrySize;
+        auto &oFrame = aoFrames[i];
+        memcpy(&oFrame.nCompressedSize, pabyEntry, sizeof(uint32_t));
+        CPL_LSBPTR32(&oFrame.nCompressedSize);
+        memcpy(&oFrame.nUncompressedSize, pabyEntry + 4, sizeof(uint32_t));
+        CPL_LSBPTR32(&oFrame.nUncompressedSize);
+        if (oFrame.nCompressedSize == 0 ||
+            oFrame.nUncompressedSize > ZSTD_MAX_FRAME_SIZE)
+        {
+            CPLDebug("ZSTD", "Invalid entry %u in seek table", i);
+            return false;
+        }
+        oFrame.nCompressedOffset = nCompressedOffset;
+        oFrame.nUncompressedOffset = nUncompressedSize;
+        nCompressedOffset += oFrame.nCompressedSize;
+        nUncompressedSize += oFrame.nUncompressedSize;
+    }
+    if (nCompressedOffset != nTableStart - nStart)
+    {
+        CPLDebug("ZSTD", "Seek table inconsistent with file size");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIZstdHandle                             */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIZstdHandle final : public VSIVirtualHandle
+{
+  public:
+    VSIZstdHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                  vsi_l_offset nStartOffset, vsi_l_offset nCompressedSize,
+                  vsi_l_offset nUncompressedSize);
+    ~VSIZstdHandle() override;
+
+    bool Init();
+
+    bool IsSeekable() const
+    {
+        return m_bSeekable;
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurOffset;
+    }
+
+    size_t Read(void *pBuffer, size_t nBytes) override;
+
+    size_t Write(const void *, size_t) override
+    {
+        return 0;
+    }
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Error() override
+    {
+        return m_bError;
+    }
+
+    void ClearErr() override
+    {
+        m_bEOF = false;
+        m_bError = false;
+    }
+
+    int Close() override;
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdHandle)
+
+    struct DecodedFrame
+    {
+        size_t nIdx = 0;
+        std::vector<GByte> abyCompressed{};
+        std::vector<GByte> abyData{};
+        bool bDone = false;
+        bool bOK = false;
+    };
+
+    VSIVirtualHandleUniquePtr m_poBaseHandle{};
+    const vsi_l_offset m_nStartOffset;
+    const vsi_l_offset m_nCompressedSize;
+    vsi_l_offset m_nUncompressedSize;
+    bool m_bUncompressedSizeKnown;
+    vsi_l_offset m_nCurOffset = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+    ZSTD_DCtx *m_psDCtx = nullptr;
+
+    // Seekable mode
+    bool m_bSeekable = false;
+    std::vector<VSIZstdFrame> m_aoFrames{};
+    std::shared_ptr<DecodedFrame> m_poCurFrame{};
+    std::deque<std::shared_ptr<DecodedFrame>> m_apoPrefetchedFrames{};
+    int m_nThreads = 0;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    // Must be declared after m_oMutex and m_oCV, which are used by jobs
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    // Streaming mode
+    std::vector<GByte> m_abyIn{};
+    ZSTD_inBuffer m_sIn{nullptr, 0, 0};
+    vsi_l_offset m_nCompressedPos = 0;
+    vsi_l_offset m_nStreamPos = 0;
+    size_t m_nLastStreamRet = 0;
+    bool m_bStreamEnd = false;
+
+    size_t FindFrame(vsi_l_offset nOffset) const;
+    bool ReadCompressedFrame(DecodedFrame &oFrame);
+    static bool DecodeFrame(ZSTD_DCtx *psDCtx, DecodedFrame &oFrame,
+                            size_t nExpectedSize);
+    bool SetCurrentFrame(size_t nIdx);
+    void PrefetchFrames(size_t nFirstIdx);
+    size_t ReadSeekable(void *pBuffer, size_t nBytes);
+
+    void RestartStream();
+    size_t DecodeStream(void *pBuffer, size_t nBytes);
+    bool SkipStream(vsi_l_offset nOffset);
+    size_t ReadStreaming(void *pBuffer, size_t nBytes);
+};
+
+/************************************************************************/
+/*                           VSIZstdHandle()                            */
+/************************************************************************/
+
+VSIZstdHandle::VSIZstdHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                             vsi_l_offset nStartOffset,
+                             vsi_l_offset nCompressedSize,
+                             vsi_l_offset nUncompressedSize)
+    : m_poBaseHandle(std::move(poBaseHandle)), m_nStartOffset(nStartOffset),
+      m_nCompressedSize(nCompressedSize),
+      m_nUncompressedSize(nUncompressedSize),
+      m_bUncompressedSizeKnown(nUncompressedSize != 0)
+{
+}
+
+/************************************************************************/
+/*                           ~VSIZstdHandle()                           */
+/************************************************************************/
+
+VSIZstdHandle::~VSIZstdHandle()
+{
+    VSIZstdHandle::Close();
+    if (m_poPool)
+        m_poPool->WaitCompletion();
+    ZSTD_freeDCtx(m_psDCtx);
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIZstdHandle::Close()
+{
+    int ret = 0;
+    if (m_poBaseHandle)
+    {
+        ret = m_poBaseHandle->Close();
+        m_poBaseHandle.reset();
+    }
+    return ret;
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool VSIZstdHandle::Init()
+{
+    m_psDCtx = ZSTD_createDCtx();
+    if (!m_psDCtx)
+        return false;
+
+    vsi_l_offset nUncompressedSize = 0;
+    if (VSIZstdReadSeekTable(m_poBaseHandle.get(), m_nStartOffset,
+                             m_nCompressedSize, m_aoFrames,
+                             nUncompressedSize))
+    {
+        if (m_bUncompressedSizeKnown &&
+            nUncompressedSize != m_nUncompressedSize)
+        {
+            CPLDebug("ZSTD", "Seek table inconsistent with uncompressed size");
+            m_aoFrames.clear();
+        }
+        else
+        {
+            CPLDebugOnly("ZSTD", "Seekable file with %d frames",
+                         static_cast<int>(m_aoFrames.size()));
+            m_bSeekable = true;
+            m_nUncompressedSize = nUncompressedSize;
+            m_bUncompressedSizeKnown = true;
+            m_nThreads = GDALGetNumThreads(/* nMaxVal = */ 128,
+                                           /* bDefaultToAllCPUs = */ false);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIZstdHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nCurOffset = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nCurOffset += nOffset;
+    }
+    else
+    {
+        if (!m_bUncompressedSizeKnown)
+        {
+            // Decode the whole stream to learn its size (slow)
+            SkipStream(std::numeric_limits<vsi_l_offset>::max());
+            if (!m_bUncompressedSizeKnown)
+                return -1;
+        }
+        m_nCurOffset = m_nUncompressedSize + nOffset;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIZstdHandle::Read(void *pBuffer, size_t nBytes)
+{
+    if (nBytes == 0 || m_bError)
+        return 0;
+    if (!m_poBaseHandle)
+    {
+        m_bError = true;
+        return 0;
+    }
+    const size_t nRead = m_bSeekable ? ReadSeekable(pBuffer, nBytes)
+                                     : ReadStreaming(pBuffer, nBytes);
+    if (nRead < nBytes && !m_bError)
+        m_bEOF = true;
+    return nRead;
+}
+
+/************************************************************************/
+/*                             FindFrame()                              */
+/************************************************************************/
+
+size_t VSIZstdHandle::FindFrame(vsi_l_offset nOffset) const
+{
+    const auto oIter =
+        std::upper_bound(m_aoFrames.begin(), m_aoFrames.end(), nOffset,
+                         [](vsi_l_offset nVal, const VSIZstdFrame &oFrame)
+                         { return nVal < oFrame.nUncompressedOffset; });
+    CPLAssert(oIter != m_aoFrames.begin());
+    return static_cast<size_t>(std::distance(m_aoFrames.begin(), oIter)) - 1;
+}
+
+/************************************************************************/
+/*                        ReadCompressedFrame()                         */
+/************************************************************************/
+
+bool VSIZstdHandle::ReadCompressedFrame(DecodedFrame &oFrame)
+{
+    const auto &oFrameDesc = m_aoFrames[oFrame.nIdx];
+    try
+    {
+        oFrame.abyCompressed.resize(oFrameDesc.nCompressedSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for zstd frame");
+        return false;
+    }
+    if (m_poBaseHandle->Seek(m_nStartOffset + oFrameDesc.nCompressedOffset,
+                             SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(oFrame.abyCompressed.data(),
+                             oFrame.abyCompressed.size()) !=
+            oFrame.abyCompressed.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read zstd frame %d",
+                 static_cast<int>(oFrame.nIdx));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            DecodeFrame()                             */
+/************************************************************************/
+
+// Can be called from worker threads, in which case psDCtx is null.
+bool VSIZstdHandle::DecodeFrame(ZSTD_DCtx *psDCtx, DecodedFrame &oFrame,
+                                size_t nExpectedSize)
+{
+    try
+    {
+        oFrame.abyData.resize(nExpectedSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    const size_t nRet =
+        psDCtx ? ZSTD_decompressDCtx(psDCtx, oFrame.abyData.data(),
+                                     oFrame.abyData.size(),
+                                     oFrame.abyCompressed.data(),
+                                     oFrame.abyCompressed.size())
+               : ZSTD_decompress(oFrame.abyData.data(), oFrame.abyData.size(),
+                                 oFrame.abyCompressed.data(),
+                                 oFrame.abyCompressed.size());
+    oFrame.abyCompressed.clear();
+    oFrame.abyCompressed.shrink_to_fit();
+    return !ZSTD_isError(nRet) && nRet == nExpectedSize;
+}
+
+/************************************************************************/
+/*                          SetCurrentFrame()                           */
+/************************************************************************/
+
+bool VSIZstdHandle::SetCurrentFrame(size_t nIdx)
+{
+    if (m_poCurFrame && m_poCurFrame->nIdx == nIdx)
+        return true;
+    const bool bSequential = m_poCurFrame && m_poCurFrame->nIdx + 1 == nIdx;
+
+    std::shared_ptr<DecodedFrame> poFrame;
+    while (!m_apoPrefetchedFrames.empty() &&
+           m_apoPrefetchedFrames.front()->nIdx <= nIdx)
+    {
+        if (m_apoPrefetchedFrames.front()->nIdx == nIdx)
+        {
+            poFrame = std::move(m_apoPrefetchedFrames.front());
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock, [&poFrame] { return poFrame->bDone; });
+        }
+        // Frames before nIdx are dropped. Their decoding job, if still
+        // running, keeps them alive.
+        m_apoPrefetchedFrames.pop_front();
+    }
+
+    if (!poFrame)
+    {
+        poFrame = std::make_shared<DecodedFrame>();
+        poFrame->nIdx = nIdx;
+        if (!ReadCompressedFrame(*poFrame))
+            return false;
+        poFrame->bOK = DecodeFrame(m_psDCtx, *poFrame,
+                                   m_aoFrames[nIdx].nUncompressedSize);
+    }
+    if (!poFrame->bOK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot decode zstd frame %d",
+                 static_cast<int>(nIdx));
+        return false;
+    }
+    m_poCurFrame = std::move(poFrame);
+
+    if (bSequential && m_nThreads > 1)
+        PrefetchFrames(nIdx + 1);
+    return true;
+}
+
+/************************************************************************/
+/*                           PrefetchFrames()                           */
+/************************************************************************/
+
+// Submit the decoding of the frames following the current one to the
+// thread pool. The compressed data is read from this thread, since the base
+// handle is not thread-safe.
+void VSIZstdHandle::PrefetchFrames(size_t nFirstIdx)
+{
+    if (!m_poPool)
+    {
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!m_poPool->Setup(m_nThreads, nullptr, nullptr, false))
+        {
+            m_poPool.reset();
+            m_nThreads = 1;
+            return;
+        }
+    }
+
+    size_t nIdx = m_apoPrefetchedFrames.empty()
+                      ? nFirstIdx
+                      : m_apoPrefetchedFrames.back()->nIdx + 1;
+    const size_t nMaxFramesInFlight = 2 * static_cast<size_t>(m_nThreads);
+    while (m_apoPrefetchedFrames.size() < nMaxFramesInFlight &&
+           nIdx < m_aoFrames.size())
+    {
+        auto poFrame = std::make_shared<DecodedFrame>();
+        poFrame->nIdx = nIdx;
+        if (!ReadCompressedFrame(*poFrame))
+            break;
+        m_apoPrefetchedFrames.push_back(poFrame);
+        const size_t nExpectedSize = m_aoFrames[nIdx].nUncompressedSize;
+        m_poPool->SubmitJob(
+            [this, poFrame, nExpectedSize]()
+            {
+                const bool bOK = DecodeFrame(nullptr, *poFrame, nExpectedSize);
+                {
+                    std::lock_guard<std::mutex> oLock(m_oMutex);
+                    poFrame->bOK = bOK;
+                    poFrame->bDone = true;
+                }
+                m_oCV.notify_all();
+            });
+        ++nIdx;
+    }
+}
+
+/************************************************************************/
+/*                            ReadSeekable()                            */
+/************************************************************************/
+
+size_t VSIZstdHandle::ReadSeekable(void *pBuffer, size_t nBytes)
+{
+    size_t nRead = 0;
+    while (nRead < nBytes && m_nCurOffset < m_nUncompressedSize)
+    {
+        const size_t nIdx = FindFrame(m_nCurOffset);
+        if (!SetCurrentFrame(nIdx))
+        {
+            m_bError = true;
+            break;
+        }
+        const auto &oFrameDesc = m_aoFrames[nIdx];
+        const size_t nOffsetInFrame =
+            static_cast<size_t>(m_nCurOffset - oFrameDesc.nUncompressedOffset);
+        const size_t nToCopy = std::min(
+            nBytes - nRead, oFrameDesc.nUncompressedSize - nOffsetInFrame);
+        memcpy(static_cast<GByte *>(pBuffer) + nRead,
+               m_poCurFrame->abyData.data() + nOffsetInFrame, nToCopy);
+        nRead += nToCopy;
+        m_nCurOffset += nToCopy;
+    }
+    return nRead;
+}
+
+/************************************************************************/
+/*                           RestartStream()                            */
+/************************************************************************/
+
+void VSIZstdHandle::RestartStream()
+{
+    ZSTD_DCtx_reset(m_psDCtx, ZSTD_reset_session_only);
+    m_sIn = ZSTD_inBuffer{nullptr, 0, 0};
+    m_nCompressedPos = 0;
+    m_nStreamPos = 0;
+    m_nLastStreamRet = 0;
+    m_bStreamEnd = false;
+}
+
+/************************************************************************/
+/*                            DecodeStream()                            */
+/************************************************************************/
+
+size_t VSIZstdHandle::DecodeStream(void *pBuffer, size_t nBytes)
+{
+    ZSTD_outBuffer sOut{pBuffer, nBytes, 0};
+    while (sOut.pos < sOut.size && !m_bStreamEnd)
+    {
+        if (m_sIn.pos == m_sIn.size)
+        {
+            if (m_nCompressedPos == m_nCompressedSize)
+            {
+                if (m_nLastStreamRet != 0)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Truncated zstd stream");
+                    m_bError = true;
+                    break;
+                }
+                m_bStreamEnd = true;
+                m_nUncompressedSize = m_nStreamPos + sOut.pos;
+                m_bUncompressedSizeKnown = true;
+                break;
+            }
+            if (m_abyIn.empty())
+                m_abyIn.resize(ZSTD_DStreamInSize());
+            const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                m_abyIn.size(), m_nCompressedSize - m_nCompressedPos));
+            if (m_poBaseHandle->Seek(m_nStartOffset + m_nCompressedPos,
+                                     SEEK_SET) != 0 ||
+                m_poBaseHandle->Read(m_abyIn.data(), nToRead) != nToRead)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot read compressed data");
+                m_bError = true;
+                break;
+            }
+            m_nCompressedPos += nToRead;
+            m_sIn = ZSTD_inBuffer{m_abyIn.data(), nToRead, 0};
+        }
+        const size_t nRet = ZSTD_decompressStream(m_psDCtx, &sOut, &m_sIn);
+        if (ZSTD_isError(nRet))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "ZSTD_decompressStream(): %s",
+                     ZSTD_getErrorName(nRet));
+            m_bError = true;
+            break;
+        }
+        m_nLastStreamRet = nRet;
+    }
+    m_nStreamPos += sOut.pos;
+    return sOut.pos;
+}
+
+/************************************************************************/
+/*                             SkipStream()                             */
+/************************************************************************/
+
+bool VSIZstdHandle::SkipStream(vsi_l_offset nOffset)
+{
+    if (nOffset < m_nStreamPos)
+        RestartStream();
+    std::vector<GByte> abyScratch(ZSTD_DStreamOutSize());
+    while (m_nStreamPos < nOffset && !m_bStreamEnd && !m_bError)
+    {
+        const size_t nToSkip = static_cast<size_t>(std::min<vsi_l_offset>(
+            abyScratch.size(), nOffset - m_nStreamPos));
+        DecodeStream(abyScratch.data(), nToSkip);
+    }
+    return m_nStreamPos == nOffset;
+}
+
+/************************************************************************/
+/*                           ReadStreaming()                            */
+/************************************************************************/
+
+size_t VSIZstdHandle::ReadStreaming(void *pBuffer, size_t nBytes)
+{
+    if (m_bUncompressedSizeKnown && m_nCurOffset >= m_nUncompressedSize)
+        return 0;
+    if (!SkipStream(m_nCurOffset))
+        return 0;
+    const size_t nRead = DecodeStream(pBuffer, nBytes);
+    m_nCurOffset += nRead;
+    return nRead;
+}
+
+/************************************************************************/
+/*                      VSICreateZstdReadHandle()                       */
+/************************************************************************/
+
+/** Create a read-only handle on the Zstandard stream located at
+ * [nStartOffset, nStartOffset + nCompressedSize[ in poBaseHandle.
+ *
+ * nUncompressedSize may be 0 if unknown.
+ */
+VSIVirtualHandle *
+VSICreateZstdReadHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                        vsi_l_offset nStartOffset, vsi_l_offset nCompressedSize,
+                        vsi_l_offset nUncompressedSize)
+{
+    auto poHandle = std::make_unique<VSIZstdHandle>(
+        std::move(poBaseHandle), nStartOffset, nCompressedSize,
+        nUncompressedSize);
+    if (!poHandle->Init())
+        return nullptr;
+    if (poHandle->IsSeekable())
+        return poHandle.release();
+
+    // Backward seeks require decoding from the start of the stream, so
+    // wrap the handle inside a buffered reader to make small ones cheap.
+    return VSICreateBufferedReaderHandle(poHandle.release());
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSIZstdWriteHandle                          */
+/* ==================================================================== */
+/************************************************************************/
+
+// Writes a file in the seekable format: the input is split in frames of
+// nFrameSize bytes that are compressed independently, and the seek table
+// is appended when closing.
+class VSIZstdWriteHandle final : public VSIVirtualHandle
+{
+  public:
+    VSIZstdWriteHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                       size_t nFrameSize, int nLevel);
+    ~VSIZstdWriteHandle() override;
+
+    bool Init();
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurOffset;
+    }
+
+    size_t Read(void *, size_t) override;
+    size_t Write(const void *pBuffer, size_t nBytes) override;
+
+    int Eof() override
+    {
+        return 0;
+    }
+
+    int Error() override
+    {
+        return m_bError;
+    }
+
+    void ClearErr() override
+    {
+    }
+
+    int Close() override;
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdWriteHandle)
+
+    VSIVirtualHandleUniquePtr m_poBaseHandle{};
+    const size_t m_nFrameSize;
+    const int m_nLevel;
+    ZSTD_CCtx *m_psCCtx = nullptr;
+    std::vector<GByte> m_abyFrame{};
+    std::vector<GByte> m_abyCompressed{};
+    std::vector<GByte> m_abySeekTable{};
+    uint32_t m_nFrames = 0;
+    vsi_l_offset m_nCurOffset = 0;
+    bool m_bError = false;
+
+    bool CompressFrame();
+};
+
+/************************************************************************/
+/*                         VSIZstdWriteHandle()                         */
+/************************************************************************/
+
+VSIZstdWriteHandle::VSIZstdWriteHandle(VSIVirtualHandleUniquePtr poBaseHandle,
+                                       size_t nFrameSize, int nLevel)
+    : m_poBaseHandle(std::move(poBaseHandle)), m_nFrameSize(nFrameSize),
+      m_nLevel(nLevel)
+{
+}
+
+/************************************************************************/
+/*                        ~VSIZstdWriteHandle()                         */
+/************************************************************************/
+
+VSIZstdWriteHandle::~VSIZstdWriteHandle()
+{
+    VSIZstdWriteHandle::Close();
+    ZSTD_freeCCtx(m_psCCtx);
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool VSIZstdWriteHandle::Init()
+{
+    m_psCCtx = ZSTD_createCCtx();
+    if (!m_psCCtx ||
+        ZSTD_isError(ZSTD_CCtx_setParameter(m_psCCtx, ZSTD_c_compressionLevel,
+                                            m_nLevel)) ||
+        ZSTD_isError(
+            ZSTD_CCtx_setParameter(m_psCCtx, ZSTD_c_checksumFlag, 1)))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot initialize zstd compression context");
+        return false;
+    }
+    try
+    {
+        m_abyFrame.reserve(m_nFrameSize);
+        m_abyCompressed.resize(ZSTD_compressBound(m_nFrameSize));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate zstd compression buffers");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIZstdWriteHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    if ((nWhence == SEEK_SET && nOffset == m_nCurOffset) ||
+        (nWhence != SEEK_SET && nOffset == 0))
+        return 0;
+
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Seeking is not supported on writable /vsizstd/ files");
+    return -1;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIZstdWriteHandle::Read(void *, size_t)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Reading is not supported on writable /vsizstd/ files");
+    return 0;
+}
+
+/************************************************************************/
+/*                           CompressFrame()                            */
+/************************************************************************/
+
+bool VSIZstdWriteHandle::CompressFrame()
+{
+    const size_t nRet = ZSTD_compress2(
+        m_psCCtx, m_abyCompressed.data(), m_abyCompressed.size(),
+        m_abyFrame.data(), m_abyFrame.size());
+    if (ZSTD_isError(nRet))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "ZSTD_compress2(): %s",
+                 ZSTD_getErrorName(nRet));
+        return false;
+    }
+    if (m_poBaseHandle->Write(m_abyCompressed.data(), nRet) != nRet)
+        return false;
+
+    GByte abyEntry[8];
+    uint32_t nCompressedSize = static_cast<uint32_t>(nRet);
+    CPL_LSBPTR32(&nCompressedSize);
+    memcpy(abyEntry, &nCompressedSize, sizeof(uint32_t));
+    uint32_t nUncompressedSize = static_cast<uint32_t>(m_abyFrame.size());
+    CPL_LSBPTR32(&nUncompressedSize);
+    memcpy(abyEntry + 4, &nUncompressedSize, sizeof(uint32_t));
+    m_abySeekTable.insert(m_abySeekTable.end(), abyEntry,
+                          abyEntry + sizeof(abyEntry));
+    ++m_nFrames;
+    m_abyFrame.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIZstdWriteHandle::Write(const void *pBuffer, size_t nBytes)
+{
+    if (m_bError || !m_poBaseHandle)
+        return 0;
+
+    const GByte *pabyBuffer = static_cast<const GByte *>(pBuffer);
+    size_t nWritten = 0;
+    while (nWritten < nBytes)
+    {
+        const size_t nToCopy =
+            std::min(nBytes - nWritten, m_nFrameSize - m_abyFrame.size());
+        m_abyFrame.insert(m_abyFrame.end(), pabyBuffer + nWritten,
+                          pabyBuffer + nWritten + nToCopy);
+        nWritten += nToCopy;
+        if (m_abyFrame.size() == m_nFrameSize && !CompressFrame())
+        {
+            m_bError = true;
+            break;
+        }
+    }
+    m_nCurOffset += nWritten;
+    return nWritten;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIZstdWriteHandle::Close()
+{
+    if (!m_poBaseHandle)
+        return 0;
+
+    if (!m_bError && !m_abyFrame.empty() && !CompressFrame())
+        m_bError = true;
+
+    if (!m_bError)
+    {
+        GByte abyHeader[ZSTD_SKIPPABLE_HEADER_SIZE];
+        uint32_t nMagic = ZSTD_SEEK_TABLE_SKIPPABLE_MAGIC;
+        CPL_LSBPTR32(&nMagic);
+        memcpy(abyHeader, &nMagic, sizeof(uint32_t));
+        uint32_t nFrameSize = static_cast<uint32_t>(
+            m_abySeekTable.size() + ZSTD_SEEK_TABLE_FOOTER_SIZE);
+        CPL_LSBPTR32(&nFrameSize);
+        memcpy(abyHeader + 4, &nFrameSize, sizeof(uint32_t));
+
+        GByte abyFooter[ZSTD_SEEK_TABLE_FOOTER_SIZE];
+        uint32_t nFrames = m_nFrames;
+        CPL_LSBPTR32(&nFrames);
+        memcpy(abyFooter, &nFrames, sizeof(uint32_t));
+        abyFooter[4] = 0;  // descriptor: no checksums
+        nMagic = ZSTD_SEEKABLE_MAGIC;
+        CPL_LSBPTR32(&nMagic);
+        memcpy(abyFooter + 5, &nMagic, sizeof(uint32_t));
+
+        if (m_poBaseHandle->Write(abyHeader, sizeof(abyHeader)) !=
+                sizeof(abyHeader) ||
+            m_poBaseHandle->Write(m_abySeekTable.data(),
+                                  m_abySeekTable.size()) !=
+                m_abySeekTable.size() ||
+            m_poBaseHandle->Write(abyFooter, sizeof(abyFooter)) !=
+                sizeof(abyFooter))
+        {
+            m_bError = true;
+        }
+    }
+
+    int nRet = m_poBaseHandle->Close();
+    m_poBaseHandle.reset();
+    if (m_bError)
+        nRet = -1;
+    return nRet;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIZstdFilesystemHandler                       */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIZstdFilesystemHandler final : public VSIFilesystemHandler
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdFilesystemHandler)
+
+  public:
+    VSIZstdFilesystemHandler() = default;
+
+    VSIVirtualHandleUniquePtr Open(const char *pszFilename,
+                                   const char *pszAccess, bool bSetError,
+                                   CSLConstList /* papszOptions */) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+
+    char **ReadDirEx(const char * /*pszDirname*/,
+                     int /* nMaxFiles */) override
+    {
+        return nullptr;
+    }
+
+    const char *GetOptions() override;
+
+    bool SupportsSequentialWrite(const char *pszPath,
+                                 bool bAllowLocalTempFile) override;
+
+    bool SupportsRandomWrite(const char * /* pszPath */,
+                             bool /* bAllowLocalTempFile */) override
+    {
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandleUniquePtr
+VSIZstdFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
+                               bool /* bSetError */,
+                               CSLConstList /* papszOptions */)
+{
+    if (!STARTS_WITH_CI(pszFilename, "/vsizstd/"))
+        return nullptr;
+    const char *pszBaseFileName = pszFilename + strlen("/vsizstd/");
+
+    if (strchr(pszAccess, 'w') != nullptr)
+    {
+        if (strchr(pszAccess, '+') != nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Write+update (w+) not supported for /vsizstd, "
+                     "only read-only or write-only.");
+            return nullptr;
+        }
+
+        GIntBig nFrameSize = 0;
+        if (CPLParseMemorySize(
+                CPLGetConfigOption("CPL_VSIL_ZSTD_FRAME_SIZE", "1MB"),
+                &nFrameSize, nullptr) != CE_None ||
+            nFrameSize <= 0 || nFrameSize > ZSTD_MAX_FRAME_SIZE)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for CPL_VSIL_ZSTD_FRAME_SIZE");
+            return nullptr;
+        }
+        const int nLevel =
+            atoi(CPLGetConfigOption("CPL_VSIL_ZSTD_LEVEL", "3"));
+
+        auto poBaseHandle = VSIFilesystemHandler::OpenStatic(
+            pszBaseFileName, "wb");
+        if (poBaseHandle == nullptr)
+            return nullptr;
+        auto poHandle = std::make_unique<VSIZstdWriteHandle>(
+            std::move(poBaseHandle), static_cast<size_t>(nFrameSize), nLevel);
+        if (!poHandle->Init())
+            return nullptr;
+        return VSIVirtualHandleUniquePtr(poHandle.release());
+    }
+
+    auto poBaseHandle = VSIFilesystemHandler::OpenStatic(pszBaseFileName, "rb");
+    if (poBaseHandle == nullptr)
+        return nullptr;
+
+    uint32_t nMagic = 0;
+    if (!poBaseHandle->ReadLSB(nMagic) ||
+        (nMagic != ZSTD_MAGICNUMBER &&
+         (nMagic & 0xFFFFFFF0U) != ZSTD_MAGIC_SKIPPABLE_START))
+    {
+        return nullptr;
+    }
+    if (poBaseHandle->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = poBaseHandle->Tell();
+
+    return VSIVirtualHandleUniquePtr(
+        VSICreateZstdReadHandle(std::move(poBaseHandle), 0, nFileSize, 0));
+}
+
+/************************************************************************/
+/*                      SupportsSequentialWrite()                       */
+/************************************************************************/
+
+bool VSIZstdFilesystemHandler::SupportsSequentialWrite(const char *pszPath,
+                                                       bool bAllowLocalTempFile)
+{
+    if (!STARTS_WITH_CI(pszPath, "/vsizstd/"))
+        return false;
+    const char *pszBaseFileName = pszPath + strlen("/vsizstd/");
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(pszBaseFileName);
+    return poFSHandler->SupportsSequentialWrite(pszBaseFileName,
+                                                bAllowLocalTempFile);
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSIZstdFilesystemHandler::Stat(const char *pszFilename,
+                                   VSIStatBufL *pStatBuf, int nFlags)
+{
+    if (!STARTS_WITH_CI(pszFilename, "/vsizstd/"))
+        return -1;
+
+    memset(pStatBuf, 0, sizeof(VSIStatBufL));
+    int ret = VSIStatExL(pszFilename + strlen("/vsizstd/"), pStatBuf, nFlags);
+    if (ret == 0 && (nFlags & VSI_STAT_SIZE_FLAG))
+    {
+        // Fast for seekable files, requires decompressing the whole file
+        // otherwise.
+        auto poHandle = Open(pszFilename, "rb", false, nullptr);
+        if (poHandle && poHandle->Seek(0, SEEK_END) == 0)
+        {
+            pStatBuf->st_size = poHandle->Tell();
+        }
+        else
+        {
+            ret = -1;
+        }
+    }
+    return ret;
+}
+
+/************************************************************************/
+/*                             GetOptions()                             */
+/************************************************************************/
+
+const char *VSIZstdFilesystemHandler::GetOptions()
+{
+    return "<Options>"
+           "  <Option name='GDAL_NUM_THREADS' type='string' "
+           "description='Number of threads for decompression of seekable "
+           "files. Either a integer or ALL_CPUS'/>"
+           "  <Option name='CPL_VSIL_ZSTD_FRAME_SIZE' type='string' "
+           "description='Uncompressed size of the independent frames of "
+           "written files' default='1MB'/>"
+           "  <Option name='CPL_VSIL_ZSTD_LEVEL' type='int' "
+           "description='Compression level of written files' default='3'/>"
+           "</Options>";
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                     VSIInstallZstdFileHandler()                      */
+/************************************************************************/
+
+/*!
+ \brief Install Zstandard file system handler.
+
+ A special file handler is installed that allows reading on-the-fly and
+ writing in Zstandard (.zst) files.
+
+ All portions of the file system underneath the base
+ path "/vsizstd/" will be handled by this driver.
+
+ \verbatim embed:rst
+ See :ref:`/vsizstd/ documentation <vsizstd>`
+ \endverbatim
+
+ @since GDAL 3.14
+ */
+
+void VSIInstallZstdFileHandler()
+{
+    VSIFileManager::InstallHandler(
+        "/vsizstd/", std::make_shared<VSIZstdFilesystemHandler>());
+}
@@ -1037,6 +1037,9 @@ const char* CPLReadLineL(VSILFILE* fp);
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
 
+void VSITraceReset();
+retStringAndCPLFree* VSITraceGetAsSerializedJSON( char** options = NULL );
+
 #endif /* !defined(SWIGJAVA) */
 
 %apply (char **CSL) {char **};
@@ -5633,6 +5633,8 @@ def BuildVRTOptions(options=None,
                     nodataMaxMaskThreshold=None,
                     strict=False,
                     writeAbsolutePath=False,
+                    numThreads=None,
+                    probeCache=None,
                     pixelFunction=None,
                     pixelFunctionArgs=None,
                     creationOptions=None,
@@ -5686,6 +5688,10 @@ def BuildVRTOptions(options=None,
         list or dict of creation options
     writeAbsolutePath : any
         Enables writing the absolute path of the input datasets. By default, input filenames are written in a relative way with respect to the VRT filename (when possible)
+    numThreads : any
+        number of threads used to open the source datasets, or 'ALL_CPUS'.
+    probeCache : any
+        filename of a JSON file caching the properties of the source datasets across runs.
     callback : any
         callback method.
     callback_data : any
@@ -5740,6 +5746,10 @@ def BuildVRTOptions(options=None,
             new_options += ['-strict']
         if writeAbsolutePath:
             new_options += ['-write_absolute_path']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
+        if probeCache is not None:
+            new_options += ['-probe_cache', str(probeCache)]
         if creationOptions is not None:
             _addCreationOptions(new_options, creationOptions)
         if pixelFunction: